@@ -5,7 +5,9 @@
 *     Source file for a command-line argument parser and validator.
 */
 #include <array>
+#include <utility>
 #include <boost/asio/error.hpp>
+#include <boost/asio/ip/address_v4.hpp>
 #include "includes/console/arg_parser.h"
 #include "includes/file_system/file.h"
 #include "includes/file_system/path.h"
@@ -89,6 +91,19 @@ bool scan::ArgParser::is_value(const string& t_arg)
     return algo::matches(t_arg, POS_RGX);
 }
 
+/**
+* @brief
+*     Add all IPv4 addresses in the given inclusive address
+*     range to the underlying command-line argument targets.
+*/
+void scan::ArgParser::add_targets(uint32_t t_first_addr, uint32_t t_last_addr)
+{
+    for (uint64_t addr{t_first_addr}; addr <= t_last_addr; addr++)
+    {
+        args.targets.emplace_back(ip::address_v4{static_cast<uint32_t>(addr)}.to_string());
+    }
+}
+
 /**
 * @brief
 *     Write the application usage information and an
@@ -148,25 +163,61 @@ bool scan::ArgParser::help()
         usage() + LF,
         "Network service scanner application\n",
         "Positional Arguments:",
-        "  TARGET                      Target IPv4 address or hostname\n",
+        "  TARGET                      Target hostname, IPv4 address, address range",
+        "                              or CIDR block - comma separated (no spaces)\n",
         "Named Arguments:",
         "  -h/-?,     --help           Show this help message and exit",
         "  -v,        --verbose        Enable verbose console output",
         "  -s,        --ssl            Enable SSL/TLS socket connections",
+        "  -e,        --tls-enum       Enumerate SSL/TLS versions, ciphers and groups",
+        "                              [ Implies -s/--ssl ]",
+#ifdef SCAN_RAW_SOCKETS
+        "  -S,        --syn            Use half-open (SYN) port discovery",
+        "                              [ Requires raw socket privileges ]",
+#endif // SCAN_RAW_SOCKETS
         "  -j,        --json           Output scan results in JSON format",
+        "  -J,        --ndjson         Stream scan results as NDJSON (one per line)",
         "  -p PORT,   --port PORT      Port number(s) - comma separated (no spaces)",
+        "  -i PATH,   --input PATH     Read targets from a file (one per line)",
         "  -t MS,     --timeout MS     Connection timeout (milliseconds)",
         "                              [ Default: 3500 ]",
-        "  -T NUM,    --threads NUM    Thread pool size (execution thread count)",
-        "                              [ Default: system thread count or 16 ]",
+        "  -m MS,     --min-timeout MS Minimum adaptive connection timeout",
+        "                              [ Default: 100 ]",
+        "  -T NUM,    --threads NUM    Maximum service probing concurrency",
+        "                              [ Default: adaptive, up to 256 ]",
+        "  -C NUM,    --connects NUM   Maximum concurrent connection attempts",
+        "                              [ Default: 512 ]",
+        "  -r NUM,    --max-rate NUM   Maximum connection attempts per second",
+        "                              [ Default: unlimited ]",
+        "  -R NUM,    --min-rate NUM   Minimum rate when backing off from timeouts",
+        "                              [ Default: 1 ]",
         "  -o PATH,   --output PATH    Write the scan results to a file",
-        "  -c [URI],  --curl [URI]     Use GET requests for HTTP/HTTPS probing\n",
+        "  -b NUM,    --banner-bytes NUM Maximum service banner size (bytes)",
+        "                              [ Default: 4096 ]",
+        "  -B NUM,    --body-bytes NUM Maximum HTTP response body size (bytes)",
+        "                              [ Default: 65536, 0 reads headers only ]",
+        "  -c [URI],  --curl [URI]     Use GET requests for HTTP/HTTPS probing",
+        "  -P PATHS,  --paths PATHS    Additional HTTP request URIs to probe over one",
+        "                              connection - comma separated (no spaces)\n",
         "Usage Examples:",
         "  svcscan.exe -v localhost 21,443,80",
         "  svcscan.exe -p 22-25,53 192.168.1.1",
         "  svcscan.exe -vt 500 192.168.1.1 4444",
+        "  svcscan.exe -m 250 -p 1-1024 10.0.0.0/24",
         "  svcscan.exe --curl /admin 192.168.1.1 80",
+        "  svcscan.exe -P /robots.txt,/server-status 192.168.1.1 80",
+        "  svcscan.exe -B 0 -p 80,443,8080 192.168.1.0/24",
         "  svcscan.exe --ssl 192.168.1.1 443 --curl",
+        "  svcscan.exe --tls-enum -p 443,8443 192.168.1.0/24",
+#ifdef SCAN_RAW_SOCKETS
+        "  svcscan.exe --syn 192.168.1.1 1-65535",
+#endif // SCAN_RAW_SOCKETS
+        "  svcscan.exe -p 22,80,443 192.168.1.0/24",
+        "  svcscan.exe -p 21-25 10.0.0.1-254,10.0.1.5",
+        "  svcscan.exe -i targets.txt -p 80,443",
+        "  svcscan.exe -J -p 1-1024 10.0.0.0/16",
+        "  svcscan.exe -r 200 -R 20 -p 1-1024 10.0.0.0/24",
+        "  svcscan.exe -b 16384 -p 21,22,25 192.168.1.1",
     };
 
     std::cout << algo::concat(usage_lines.join_lines(), LF, LF);
@@ -201,12 +252,29 @@ bool scan::ArgParser::parse_aliases(List<string>& t_list)
                 case 's':
                     args.tls_enabled = true;
                     break;
+                case 'e':
+                    args.tls_enabled = args.tls_enum = true;
+                    break;
+#ifdef SCAN_RAW_SOCKETS
+                case 'S':
+                    args.syn_scan = true;
+                    break;
+#endif // SCAN_RAW_SOCKETS
                 case 'j':
                     args.out_json = true;
                     break;
+                case 'J':
+                    args.out_ndjson = true;
+                    break;
                 case 'p':
                     valid = parse_ports(indexed_alias, proc_indexes);
                     break;
+                case 'i':
+                    valid = parse_input(indexed_alias, proc_indexes);
+                    break;
+                case 'm':
+                    valid = parse_min_timeout(indexed_alias, proc_indexes);
+                    break;
                 case 't':
                     valid = parse_timeout(indexed_alias, proc_indexes);
                     break;
@@ -216,9 +284,27 @@ bool scan::ArgParser::parse_aliases(List<string>& t_list)
                 case 'o':
                     valid = parse_path(indexed_alias, proc_indexes);
                     break;
+                case 'b':
+                    valid = parse_banner_bytes(indexed_alias, proc_indexes);
+                    break;
+                case 'B':
+                    valid = parse_body_bytes(indexed_alias, proc_indexes);
+                    break;
                 case 'c':
                     valid = parse_curl_uri(indexed_alias, proc_indexes);
                     break;
+                case 'P':
+                    valid = parse_paths(indexed_alias, proc_indexes);
+                    break;
+                case 'C':
+                    valid = parse_connects(indexed_alias, proc_indexes);
+                    break;
+                case 'r':
+                    valid = parse_max_rate(indexed_alias, proc_indexes);
+                    break;
+                case 'R':
+                    valid = parse_min_rate(indexed_alias, proc_indexes);
+                    break;
                 default:
                     valid = errorf("Unrecognized flag: '-%'", ch);
                     break;
@@ -241,6 +327,56 @@ bool scan::ArgParser::parse_aliases(List<string>& t_list)
     return valid;
 }
 
+/**
+* @brief
+*     Parse and validate the given maximum service banner
+*     size and update the underlying command-line arguments.
+*/
+bool scan::ArgParser::parse_banner_bytes(const IndexedArg& t_indexed_arg,
+                                         List<size_t>& t_proc_indexes)
+{
+    return parse_size(t_indexed_arg,
+                      t_proc_indexes,
+                      args.banner_bytes,
+                      "-b/--banner-bytes NUM",
+                      "banner size",
+                      1_sz,
+                      MAX_BANNER_BYTES);
+}
+
+/**
+* @brief
+*     Parse and validate the given maximum HTTP response body
+*     size and update the underlying command-line arguments.
+*/
+bool scan::ArgParser::parse_body_bytes(const IndexedArg& t_indexed_arg,
+                                       List<size_t>& t_proc_indexes)
+{
+    return parse_size(t_indexed_arg,
+                      t_proc_indexes,
+                      args.body_bytes,
+                      "-B/--body-bytes NUM",
+                      "body size",
+                      0_sz,
+                      MAX_BODY_BYTES);
+}
+
+/**
+* @brief
+*     Parse and validate the given concurrent connection limit
+*     and update the underlying command-line arguments.
+*/
+bool scan::ArgParser::parse_connects(const IndexedArg& t_indexed_arg,
+                                     List<size_t>& t_proc_indexes)
+{
+    return parse_size(t_indexed_arg,
+                      t_proc_indexes,
+                      args.connects,
+                      "-C/--connects NUM",
+                      "connection limit",
+                      1_sz);
+}
+
 /**
 * @brief
 *     Parse and validate the HTTP request URI argument
@@ -304,14 +440,36 @@ bool scan::ArgParser::parse_flags(List<string>& t_list)
         {
             args.out_json = true;
         }
+        else if (indexed_flag.value == "--ndjson")
+        {
+            args.out_ndjson = true;
+        }
         else if (indexed_flag.value == "--ssl")
         {
             args.tls_enabled = true;
         }
+        else if (indexed_flag.value == "--tls-enum")
+        {
+            args.tls_enabled = args.tls_enum = true;
+        }
+#ifdef SCAN_RAW_SOCKETS
+        else if (indexed_flag.value == "--syn")
+        {
+            args.syn_scan = true;
+        }
+#endif // SCAN_RAW_SOCKETS
         else if (indexed_flag.value == "--port")
         {
             valid = parse_ports(indexed_flag, proc_indexes);
         }
+        else if (indexed_flag.value == "--input")
+        {
+            valid = parse_input(indexed_flag, proc_indexes);
+        }
+        else if (indexed_flag.value == "--min-timeout")
+        {
+            valid = parse_min_timeout(indexed_flag, proc_indexes);
+        }
         else if (indexed_flag.value == "--timeout")
         {
             valid = parse_timeout(indexed_flag, proc_indexes);
@@ -324,10 +482,34 @@ bool scan::ArgParser::parse_flags(List<string>& t_list)
         {
             valid = parse_path(indexed_flag, proc_indexes);
         }
+        else if (indexed_flag.value == "--banner-bytes")
+        {
+            valid = parse_banner_bytes(indexed_flag, proc_indexes);
+        }
+        else if (indexed_flag.value == "--body-bytes")
+        {
+            valid = parse_body_bytes(indexed_flag, proc_indexes);
+        }
         else if (indexed_flag.value == "--curl")
         {
             valid = parse_curl_uri(indexed_flag, proc_indexes);
         }
+        else if (indexed_flag.value == "--paths")
+        {
+            valid = parse_paths(indexed_flag, proc_indexes);
+        }
+        else if (indexed_flag.value == "--connects")
+        {
+            valid = parse_connects(indexed_flag, proc_indexes);
+        }
+        else if (indexed_flag.value == "--max-rate")
+        {
+            valid = parse_max_rate(indexed_flag, proc_indexes);
+        }
+        else if (indexed_flag.value == "--min-rate")
+        {
+            valid = parse_min_rate(indexed_flag, proc_indexes);
+        }
         else  // Unknown flag name
         {
             valid = errorf("Unrecognized flag: '%'", indexed_flag.value);
@@ -344,6 +526,115 @@ bool scan::ArgParser::parse_flags(List<string>& t_list)
     return valid;
 }
 
+/**
+* @brief
+*     Parse and validate the targets in the given input file path and update
+*     the underlying command-line arguments. The file must contain one target
+*     per line, and blank lines or lines that begin with '#' are ignored.
+*/
+bool scan::ArgParser::parse_input(const IndexedArg& t_indexed_arg,
+                                  List<size_t>& t_proc_indexes)
+{
+    if (!m_argv.valid_index(t_indexed_arg.index))
+    {
+        throw ArgEx{INVALID_ARG_INDEX_MSG, "t_indexed_arg"};
+    }
+
+    bool valid{true};
+    const size_t value_index{t_indexed_arg.index + 1_sz};
+
+    if (m_argv.valid_index(value_index) && is_value(m_argv[value_index]))
+    {
+        const string path{path::resolve(m_argv[value_index])};
+
+        if (path::path_info(path) == PathInfo::file)
+        {
+            t_proc_indexes.emplace_back(value_index);
+
+            for (const string& line : algo::split(File::read(path), LF))
+            {
+                const string target{algo::trim_right(algo::trim_left(line))};
+
+                // Skip blank lines and comments
+                if (target.empty() || target.starts_with('#'))
+                {
+                    continue;
+                }
+
+                if (!(valid = parse_targets(target)))
+                {
+                    break;
+                }
+            }
+        }
+        else  // Missing input file
+        {
+            valid = errorf("Input file not found: '%'", path);
+        }
+    }
+    else  // Missing value argument
+    {
+        valid = error("-i/--input PATH", ArgType::flag);
+    }
+    return valid;
+}
+
+/**
+* @brief
+*     Parse and validate the given maximum connection rate
+*     (per second) and update the underlying command-line arguments.
+*/
+bool scan::ArgParser::parse_max_rate(const IndexedArg& t_indexed_arg,
+                                     List<size_t>& t_proc_indexes)
+{
+    return parse_size(t_indexed_arg,
+                      t_proc_indexes,
+                      args.max_rate,
+                      "-r/--max-rate NUM",
+                      "connection rate",
+                      1_sz);
+}
+
+/**
+* @brief
+*     Parse and validate the given minimum connection rate
+*     (per second) and update the underlying command-line arguments.
+*/
+bool scan::ArgParser::parse_min_rate(const IndexedArg& t_indexed_arg,
+                                     List<size_t>& t_proc_indexes)
+{
+    return parse_size(t_indexed_arg,
+                      t_proc_indexes,
+                      args.min_rate,
+                      "-R/--min-rate NUM",
+                      "connection rate",
+                      1_sz);
+}
+
+/**
+* @brief
+*     Parse and validate the given minimum adaptive connection timeout
+*     (in milliseconds) and update the underlying command-line arguments.
+*     The timeout must be non-zero, and it is validated against the
+*     connection timeout once all arguments have been parsed.
+*/
+bool scan::ArgParser::parse_min_timeout(const IndexedArg& t_indexed_arg,
+                                        List<size_t>& t_proc_indexes)
+{
+    size_t ms{0_sz};
+
+    const bool valid{parse_size(t_indexed_arg,
+                                t_proc_indexes,
+                                ms,
+                                "-m/--min-timeout MS",
+                                "minimum connection timeout")};
+    if (valid)
+    {
+        args.min_timeout = ms;
+    }
+    return valid;
+}
+
 /**
 * @brief
 *     Parse and validate the given report output path and
@@ -401,6 +692,51 @@ bool scan::ArgParser::parse_path(const IndexedArg& t_indexed_arg,
     return valid;
 }
 
+/**
+* @brief
+*     Parse and validate the given additional HTTP request
+*     URIs and update the underlying command-line arguments.
+*/
+bool scan::ArgParser::parse_paths(const IndexedArg& t_indexed_arg,
+                                  List<size_t>& t_proc_indexes)
+{
+    if (!m_argv.valid_index(t_indexed_arg.index))
+    {
+        throw ArgEx{INVALID_ARG_INDEX_MSG, "t_indexed_arg"};
+    }
+
+    bool valid{true};
+    const size_t value_index{t_indexed_arg.index + 1_sz};
+
+    if (m_argv.valid_index(value_index) && is_value(m_argv[value_index]))
+    {
+        for (const string& uri : algo::split(m_argv[value_index], ","))
+        {
+            if (!Request<>::valid_uri(uri))
+            {
+                valid = errorf("'%' is not a valid HTTP URI", uri);
+                break;
+            }
+
+            // Skip duplicate URIs
+            if (!args.paths.contains(uri))
+            {
+                args.paths.push_back(uri);
+            }
+        }
+
+        if (valid)
+        {
+            t_proc_indexes.emplace_back(value_index);
+        }
+    }
+    else  // Missing value argument
+    {
+        valid = error("-P/--paths PATHS", ArgType::flag);
+    }
+    return valid;
+}
+
 /**
 * @brief
 *     Parse and validate the given port range and
@@ -509,8 +845,177 @@ bool scan::ArgParser::parse_ports(const IndexedArg& t_indexed_arg,
 
 /**
 * @brief
-*     Parse and validate the given thread count and
-*     update the underlying command-line arguments.
+*     Parse and validate the size value of the given command-line argument and
+*     update the given size reference. The value must be an unsigned integral
+*     number within the given bounds, and the argument name is used in errors.
+*/
+bool scan::ArgParser::parse_size(const IndexedArg& t_indexed_arg,
+                                 List<size_t>& t_proc_indexes,
+                                 size_t& t_size,
+                                 const string& t_flag,
+                                 const string& t_name,
+                                 size_t t_min_size,
+                                 size_t t_max_size)
+{
+    if (!m_argv.valid_index(t_indexed_arg.index))
+    {
+        throw ArgEx{INVALID_ARG_INDEX_MSG, "t_indexed_arg"};
+    }
+
+    bool valid{true};
+    const size_t value_index{t_indexed_arg.index + 1_sz};
+
+    if (m_argv.valid_index(value_index) && is_value(m_argv[value_index]))
+    {
+        const string size_str{m_argv[value_index]};
+
+        const bool size_str_integral{algo::is_integral(size_str, true)};
+        const size_t size{size_str_integral ? algo::to_uint(size_str) : 0_sz};
+
+        if (size_str_integral && size >= t_min_size && size <= t_max_size)
+        {
+            t_size = size;
+            t_proc_indexes.emplace_back(value_index);
+        }
+        else  // Invalid or out of bounds size
+        {
+            valid = error(algo::fstr("'%' is not a valid %", size_str, t_name));
+        }
+    }
+    else  // Missing value argument
+    {
+        valid = error(t_flag, ArgType::flag);
+    }
+    return valid;
+}
+
+/**
+* @brief
+*     Parse and validate the given target and update the underlying command-line
+*     arguments. The target can be a hostname, an IPv4 address, an IPv4 address
+*     range (e.g., 10.0.0.1-254 or 10.0.0.1-10.0.1.254) or a CIDR block. Fails
+*     once the total target count of all parsed targets exceeds the maximum.
+*/
+bool scan::ArgParser::parse_target(const string& t_target)
+{
+    bool valid{true};
+    bool addr_range{false};
+
+    const string_array_t<2> cidr_parts{algo::split<2>(t_target, "/")};
+    const string_array_t<2> range_parts{algo::split<2>(t_target, "-")};
+
+    uint32_t first_addr{0U};
+    uint32_t last_addr{0U};
+
+    // Parse CIDR block notation
+    if (net::valid_ipv4(cidr_parts[0]) && !cidr_parts[1].empty())
+    {
+        const string& prefix_str{cidr_parts[1]};
+
+        const bool prefix_integral{prefix_str.size() <= 2 && algo::is_integral(prefix_str, true)};
+        const uint_t prefix{prefix_integral ? algo::to_uint(prefix_str) : 33U};
+
+        if (prefix <= 32U)
+        {
+            const uint64_t host_mask{(1_u64 << (32U - prefix)) - 1_u64};
+
+            first_addr = ip::make_address_v4(cidr_parts[0]).to_uint();
+            first_addr &= static_cast<uint32_t>(~host_mask);
+            last_addr = static_cast<uint32_t>(first_addr | host_mask);
+
+            addr_range = true;
+        }
+        else  // Invalid network prefix length
+        {
+            valid = errorf("'%' is not a valid CIDR block", t_target);
+        }
+    }
+    else if (net::valid_ipv4(range_parts[0]) && !range_parts[1].empty())
+    {
+        string last_addr_str{range_parts[1]};
+
+        // Expand last octet range notation
+        if (algo::is_integral(last_addr_str, true))
+        {
+            last_addr_str = algo::fstr("%.%", algo::up_to_last(range_parts[0], "."), last_addr_str);
+        }
+
+        if (net::valid_ipv4(last_addr_str))
+        {
+            first_addr = ip::make_address_v4(range_parts[0]).to_uint();
+            last_addr = ip::make_address_v4(last_addr_str).to_uint();
+
+            addr_range = first_addr <= last_addr;
+        }
+
+        if (!addr_range)
+        {
+            valid = errorf("'%' is not a valid IPv4 address range", t_target);
+        }
+    }
+    else if (args.targets.size() >= MAX_TARGETS)
+    {
+        valid = errorf("Target exceeds the maximum target count: '%'", t_target);
+    }
+    else  // Parse hostname or IPv4 address
+    {
+        Hostname target{t_target};
+
+        if (target.valid())
+        {
+            args.targets.emplace_back(std::move(target));
+        }
+        else if (net::valid_ipv4_fmt(t_target))
+        {
+            valid = errorf("Invalid IPv4 address received: '%'", t_target);
+        }
+        else  // Name resolution failed
+        {
+            error(t_target, asio::error::host_not_found);
+            valid = false;
+        }
+    }
+
+    // Add address range targets
+    if (valid && addr_range)
+    {
+        const size_t range_size{static_cast<size_t>(last_addr - first_addr) + 1_sz};
+
+        if (range_size > MAX_TARGETS - args.targets.size())
+        {
+            valid = errorf("Address range exceeds the maximum target count: '%'", t_target);
+        }
+        else  // Valid address range
+        {
+            add_targets(first_addr, last_addr);
+        }
+    }
+    return valid;
+}
+
+/**
+* @brief
+*     Parse and validate the given comma-separated targets
+*     and update the underlying command-line arguments.
+*/
+bool scan::ArgParser::parse_targets(const string& t_targets)
+{
+    bool valid{true};
+
+    for (const string& target : algo::split(t_targets, ","))
+    {
+        if (!(valid = parse_target(target)))
+        {
+            break;
+        }
+    }
+    return valid;
+}
+
+/**
+* @brief
+*     Parse and validate the given maximum service probing
+*     concurrency and update the underlying command-line arguments.
 */
 bool scan::ArgParser::parse_threads(const IndexedArg& t_indexed_arg,
                                     List<size_t>& t_proc_indexes)
@@ -596,9 +1101,18 @@ bool scan::ArgParser::validate(List<string>& t_list)
     {
         switch (t_list.size())
         {
-            case 0:   // Missing TARGET
+            case 0:   // Syntax: -i PATH
             {
-                m_valid = error("TARGET", ArgType::value);
+                if (args.targets.empty())
+                {
+                    m_valid = error("TARGET", ArgType::value);
+                    break;
+                }
+
+                if (args.ports.empty())
+                {
+                    m_valid = error("PORT", ArgType::value);
+                }
                 break;
             }
             case 1:   // Syntax: TARGET
@@ -608,7 +1122,7 @@ bool scan::ArgParser::validate(List<string>& t_list)
                     m_valid = error("PORT", ArgType::value);
                     break;
                 }
-                args.target = t_list[0];
+                m_valid = parse_targets(t_list[0]);
                 break;
             }
             case 2:   // Syntax: TARGET PORTS
@@ -618,7 +1132,7 @@ bool scan::ArgParser::validate(List<string>& t_list)
                     m_valid = false;
                     break;
                 }
-                args.target = t_list[0];
+                m_valid = parse_targets(t_list[0]);
                 break;
             }
             default:  // Unrecognized argument
@@ -627,19 +1141,48 @@ bool scan::ArgParser::validate(List<string>& t_list)
                 break;
             }
         }
+    }
 
-        // Validate the target hostname/address
-        if (m_valid && !args.target.valid())
+    // JSON and NDJSON output are mutually exclusive
+    if (m_valid && args.out_json && args.out_ndjson)
+    {
+        m_valid = errorf("Mutually exclusive arguments: '%'", "-j/--json, -J/--ndjson");
+    }
+
+    // Minimum rate cannot exceed the maximum rate
+    if (m_valid && args.max_rate > 0 && args.min_rate > args.max_rate)
+    {
+        m_valid = errorf("'%' exceeds the maximum connection rate", args.min_rate);
+    }
+
+    // Default minimum timeout is lowered to a shorter connection timeout
+    if (m_valid && args.min_timeout > args.timeout)
+    {
+        if (args.min_timeout == Timeout{MIN_CONNECT_TIMEOUT})
         {
-            if (net::valid_ipv4_fmt(args.target))
-            {
-                errorf("Invalid IPv4 address received: '%'", args.target);
-            }
-            else
+            args.min_timeout = args.timeout;
+        }
+        else  // Minimum timeout cannot exceed the connection timeout
+        {
+            const uint_t min_timeout{args.min_timeout};
+            m_valid = errorf("'%' exceeds the connection timeout", min_timeout);
+        }
+    }
+
+    // Remove duplicate target addresses
+    if (m_valid)
+    {
+        set<string> addrs;
+        List<Hostname> targets;
+
+        for (Hostname& target : args.targets)
+        {
+            if (addrs.insert(target.addr()).second)
             {
-                error(asio::error::host_not_found);
+                targets.emplace_back(std::move(target));
             }
         }
+        args.targets = std::move(targets);
     }
     return m_valid;
 }
@@ -649,12 +1192,12 @@ bool scan::ArgParser::validate(List<string>& t_list)
 *     Write the application usage information and the given
 *     network socket error to the standard error stream.
 */
-std::string scan::ArgParser::error(const net_error_code_t& t_ecode)
+std::string scan::ArgParser::error(const string& t_name, const net_error_code_t& t_ecode)
 {
     m_valid = false;
     std::cout << usage() << LF;
 
-    const string error_msg{net::error(args.target.name(), t_ecode)};
+    const string error_msg{net::error(t_name, t_ecode)};
     std::cout << LF;
 
     return error_msg;
@@ -0,0 +1,152 @@
+/*
+* @file
+*     concurrency_limit.cpp
+* @brief
+*     Source file for an adaptive concurrency limit.
+*/
+#include <cmath>
+#include "includes/ranges/algo.h"
+#include "includes/threading/concurrency_limit.h"
+#include "includes/utils/literals.h"
+
+/**
+* @brief
+*     Initialize the object.
+*/
+scan::ConcurrencyLimit::ConcurrencyLimit(size_t t_initial, size_t t_min, size_t t_max)
+    noexcept
+{
+    m_max_limit = (algo::max)(t_max, 1_sz);
+    m_min_limit = (algo::min)((algo::max)(t_min, 1_sz), m_max_limit);
+    m_limit = m_peak_limit = (algo::min)((algo::max)(t_initial, m_min_limit), m_max_limit);
+
+    m_saturated = false;
+    m_active = m_window_count = 0_sz;
+    m_latency_ratio = 1.0;
+}
+
+/**
+* @brief
+*     Block execution until the number of acquired permits is below the current limit.
+*/
+void scan::ConcurrencyLimit::acquire()
+{
+    unique_lock lock{m_mtx};
+
+    m_permit_cv.wait(lock, [this]() -> bool
+    {
+        return m_active < m_limit;
+    });
+
+    if (++m_active >= m_limit)
+    {
+        m_saturated = true;
+    }
+}
+
+/**
+* @brief
+*     Release an acquired permit. Adjusts the limit once
+*     the current window of completed operations ends.
+*/
+void scan::ConcurrencyLimit::release()
+{
+    bool grown{false};
+    {
+        scoped_lock lock{m_mtx};
+
+        if (m_active > 0)
+        {
+            m_active--;
+        }
+
+        if (++m_window_count >= m_limit)
+        {
+            const size_t prev_limit{m_limit};
+
+            adjust();
+            grown = m_limit > prev_limit;
+        }
+    }
+
+    // Wake all waiters when multiple permits became available
+    if (grown)
+    {
+        m_permit_cv.notify_all();
+    }
+    else  // Only a single permit became available
+    {
+        m_permit_cv.notify_one();
+    }
+}
+
+/**
+* @brief
+*     Record an observed latency sample and the minimum latency observed for
+*     the same destination, so that destinations with different base latencies
+*     are compared by their relative latency increase.
+*/
+void scan::ConcurrencyLimit::update(const microseconds& t_latency,
+                                    const microseconds& t_min_latency)
+{
+    if (t_min_latency > microseconds{0})
+    {
+        const double ratio{static_cast<double>(t_latency.count()) / t_min_latency.count()};
+        scoped_lock lock{m_mtx};
+
+        m_latency_ratio += (ratio - m_latency_ratio) * LATENCY_GAIN;
+    }
+}
+
+/**
+* @brief
+*     Get the current concurrency limit.
+*/
+size_t scan::ConcurrencyLimit::limit() const
+{
+    scoped_lock lock{m_mtx};
+    return m_limit;
+}
+
+/**
+* @brief
+*     Get the maximum concurrency limit.
+*/
+size_t scan::ConcurrencyLimit::max_limit() const noexcept
+{
+    return m_max_limit;
+}
+
+/**
+* @brief
+*     Get the highest concurrency limit that was reached.
+*/
+size_t scan::ConcurrencyLimit::peak_limit() const
+{
+    scoped_lock lock{m_mtx};
+    return m_peak_limit;
+}
+
+/**
+* @brief
+*     Adjust the concurrency limit at the end of a window and start the next
+*     window. The caller must lock the underlying concurrency limit mutex.
+*/
+void scan::ConcurrencyLimit::adjust()
+{
+    if (m_latency_ratio > LATENCY_TOLERANCE)
+    {
+        const size_t limit{static_cast<size_t>(m_limit * BACKOFF_FACTOR)};
+        m_limit = (algo::max)(limit, m_min_limit);
+    }
+    else if (m_saturated)  // All permits were needed
+    {
+        const size_t growth{static_cast<size_t>(std::ceil(m_limit * GROWTH_GAIN))};
+
+        m_limit = (algo::min)(m_limit + growth, m_max_limit);
+        m_peak_limit = (algo::max)(m_peak_limit, m_limit);
+    }
+
+    m_saturated = m_active >= m_limit;
+    m_window_count = 0_sz;
+}
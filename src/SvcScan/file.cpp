@@ -89,6 +89,18 @@ void scan::File::close()
     }
 }
 
+/**
+* @brief
+*     Flush any buffered data in the underlying file stream.
+*/
+void scan::File::flush()
+{
+    if (is_open())
+    {
+        m_fstream.flush();
+    }
+}
+
 /**
 * @brief
 *     Determine whether an error occurred in the underlying file stream.
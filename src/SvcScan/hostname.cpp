@@ -33,10 +33,17 @@ void scan::Hostname::name(const string& t_name)
 
 /**
 * @brief
-*     Resolve the underlying hostname (or IPv4 address).
+*     Resolve the underlying hostname (or IPv4 address). IPv4 addresses
+*     are used as-is, so large address ranges require no DNS lookups.
 */
 bool scan::Hostname::resolve(uint_t t_retries)
 {
+    if (m_addr.empty() && net::valid_ipv4(m_name))
+    {
+        m_ecode.clear();
+        m_addr = m_name;
+    }
+
     // Skip previously resolved name
     if (m_addr.empty())
     {
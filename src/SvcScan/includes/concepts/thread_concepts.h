@@ -9,9 +9,7 @@
 #ifndef SCAN_THREAD_CONCEPTS_H
 #define SCAN_THREAD_CONCEPTS_H
 
-#include <utility>
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
+#include <concepts>
 #include "../threading/thread_aliases.h"
 #include "concepts.h"
 
@@ -23,10 +21,7 @@ namespace scan
     *     can be submitted to a thread pool for asynchronous execution.
     */
     template<class F>
-    concept Task = NullaryVoid<F> && requires(thread_pool_t& r_pool, F&& r_task)
-    {
-        { asio::post(r_pool, std::forward<F>(r_task)) } -> Same<void>;
-    };
+    concept Task = NullaryVoid<F> && std::constructible_from<task_t, F>;
 }
 
 #endif // !SCAN_THREAD_CONCEPTS_H
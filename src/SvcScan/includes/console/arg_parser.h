@@ -171,25 +171,59 @@ namespace scan
         static bool is_port_range(const string& t_port);
         static bool is_value(const string& t_arg);
 
+        void add_targets(uint32_t t_first_addr, uint32_t t_last_addr);
+
         bool error(const string& t_msg, bool t_valid = false);
         bool error(const string& t_arg, ArgType t_arg_type, bool t_valid = false);
         bool errorf(const string& t_msg, const LShift auto& t_arg, bool t_valid = false);
         bool help();
         bool parse_aliases(List<string>& t_list);
 
+        bool parse_banner_bytes(const IndexedArg& t_indexed_arg,
+                                List<size_t>& t_proc_indexes);
+
+        bool parse_body_bytes(const IndexedArg& t_indexed_arg,
+                              List<size_t>& t_proc_indexes);
+
+        bool parse_connects(const IndexedArg& t_indexed_arg,
+                            List<size_t>& t_proc_indexes);
+
         bool parse_curl_uri(const IndexedArg& t_indexed_arg,
                             List<size_t>& t_proc_indexes);
 
         bool parse_flags(List<string>& t_list);
+        bool parse_input(const IndexedArg& t_indexed_arg, List<size_t>& t_proc_indexes);
+
+        bool parse_max_rate(const IndexedArg& t_indexed_arg,
+                            List<size_t>& t_proc_indexes);
+
+        bool parse_min_rate(const IndexedArg& t_indexed_arg,
+                            List<size_t>& t_proc_indexes);
+
+        bool parse_min_timeout(const IndexedArg& t_indexed_arg,
+                               List<size_t>& t_proc_indexes);
+
         bool parse_path(const IndexedArg& t_indexed_arg, List<size_t>& t_proc_indexes);
+        bool parse_paths(const IndexedArg& t_indexed_arg, List<size_t>& t_proc_indexes);
         bool parse_port_range(const string& t_ports);
         bool parse_ports(const string& t_ports);
         bool parse_ports(const IndexedArg& t_indexed_arg, List<size_t>& t_proc_indexes);
+
+        bool parse_size(const IndexedArg& t_indexed_arg,
+                        List<size_t>& t_proc_indexes,
+                        size_t& t_size,
+                        const string& t_flag,
+                        const string& t_name,
+                        size_t t_min_size = 1_sz,
+                        size_t t_max_size = NPOS);
+
+        bool parse_target(const string& t_target);
+        bool parse_targets(const string& t_targets);
         bool parse_threads(const IndexedArg& t_indexed_arg, List<size_t>& t_proc_indexes);
         bool parse_timeout(const IndexedArg& t_indexed_arg, List<size_t>& t_proc_indexes);
         bool validate(List<string>& t_list);
 
-        string error(const net_error_code_t& t_ecode);
+        string error(const string& t_name, const net_error_code_t& t_ecode);
     };
 }
 
@@ -29,21 +29,31 @@ namespace scan
     public:  /* Fields */
         bool curl;           // Perform an HTTP GET request
         bool out_json;       // Output scan results as JSON
+        bool out_ndjson;     // Stream scan results as NDJSON
+        bool syn_scan;       // Use half-open (SYN) scanner
         bool tls_enabled;    // Use SSL/TLS scanner
+        bool tls_enum;       // Enumerate SSL/TLS capabilities
         bool verbose;        // Enable verbose output
 
-        size_t threads;      // Thread pool thread count
+        size_t banner_bytes; // Maximum service banner capture size
+        size_t body_bytes;   // Maximum HTTP response body size
+        size_t connects;     // Concurrent connection limit
+        size_t max_rate;     // Maximum connection rate (per second)
+        size_t min_rate;     // Minimum connection rate (per second)
+        size_t threads;      // Maximum service probing concurrency
+        Timeout min_timeout; // Minimum adaptive connection timeout
         Timeout timeout;     // Socket connection timeout
 
         string exe_path;     // Executable file path
         string out_path;     // Output file path
         string uri;          // HTTP request URI
 
-        Hostname target;     // Target hostname
-
         List<string> argv;   // Command-line argument list
+        List<string> paths;  // Additional HTTP request URIs
         List<port_t> ports;  // Target port numbers
 
+        List<Hostname> targets;  // Target hostnames
+
     public:  /* Constructors & Destructor */
         /**
         * @brief
@@ -51,9 +61,14 @@ namespace scan
         */
         constexpr Args() noexcept
         {
-            curl = out_json = tls_enabled = verbose = false;
-            threads = 0_sz;
-
+            curl = out_json = out_ndjson = syn_scan = tls_enabled = tls_enum = verbose = false;
+            banner_bytes = BANNER_BYTES;
+            body_bytes = BODY_BYTES;
+            connects = MAX_CONNECTS;
+            max_rate = threads = 0_sz;
+            min_rate = MIN_RATE;
+
+            min_timeout = MIN_CONNECT_TIMEOUT;
             timeout = CONNECT_TIMEOUT;
             uri = URI_ROOT;
         }
@@ -11,6 +11,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <exception>
 #include <iostream>
 #include <mutex>
 #include <string>
@@ -77,6 +78,9 @@ namespace scan::util
     /// @brief  Standard console output stream mutex.
     inline mutex cout_mtx{};
 
+    /// @brief  Standard output stream is reserved for scan result data.
+    inline atomic_bool stdout_reserved{false};
+
     /**
     * @brief
     *     Get the application name and repository formatted as a title.
@@ -257,6 +261,7 @@ namespace scan::util
     void errorf(const string& t_msg, ArgsT&&... t_args);
 
     void except(const DerivedFrom<Exception> auto& t_ex);
+    void except(std::exception_ptr t_exp);
 
     template<LShift... ArgsT>
     void printf(const string& t_msg, ArgsT&&... t_args);
@@ -323,6 +328,8 @@ inline void scan::util::printf(const string& t_msg, ArgsT&&... t_args)
 * @brief
 *     Interpolate arguments in the given status message and
 *     write it to the standard output or standard error stream.
+*     Informational and success messages are only written to the
+*     standard output stream when it is not reserved for result data.
 *     Locks the corresponding output stream mutex.
 */
 template<scan::LShift... ArgsT>
@@ -343,7 +350,7 @@ inline void scan::util::printf(Severity t_sev, const string& t_msg, ArgsT&&... t
     msg = algo::fstr("% %%", severity_prefix(t_sev), std::move(msg), LF);
 
     // Print to standard output
-    if (algo::any_eq(t_sev, Severity::info, Severity::success))
+    if (algo::any_eq(t_sev, Severity::info, Severity::success) && !stdout_reserved)
     {
         scoped_lock lock{cout_mtx};
         std::cout << std::move(msg);
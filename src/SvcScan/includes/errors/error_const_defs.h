@@ -91,9 +91,6 @@ namespace scan
     /// @brief  Invalid network port number(s) error message.
     constexpr c_string_t INVALID_PORTS_MSG = "Port(s) must be between 0 and 65535.";
 
-    /// @brief  Invalid embedded resource symbol error message.
-    constexpr c_string_t INVALID_RC_SYMBOL_MSG = "Invalid embedded resource symbol.";
-
     /// @brief  Invalid HTTP request error message.
     constexpr c_string_t INVALID_REQUEST_MSG = "Invalid HTTP request specified.";
 
@@ -133,11 +130,8 @@ namespace scan
     /// @brief  Null pointer argument exception type name.
     constexpr c_string_t NULL_PTR_EX_NAME = "scan::NullPtrEx";
 
-    /// @brief  Failure loading embedded resource error message.
-    constexpr c_string_t RC_LOAD_FAILED_MSG = "Failure loading embedded resource.";
-
-    /// @brief  Embedded resource not loaded error message.
-    constexpr c_string_t RC_NOT_LOADED_MSG = "Embedded resource not loaded.";
+    /// @brief  Raw socket operation failure error message.
+    constexpr c_string_t RAW_SOCKET_FAILED_MSG = "Raw socket operation failed.";
 
     /// @brief  Runtime exception type name.
     constexpr c_string_t RUNTIME_EX_NAME = "scan::RuntimeEx";
@@ -147,6 +141,9 @@ namespace scan
 
     /// @brief  Failure enabling virtual terminal processing error message.
     constexpr c_string_t VT_FAILED_MSG = "Failure enabling virtual terminal processing.";
+
+    /// @brief  NDJSON writer already running error message.
+    constexpr c_string_t WRITER_RUNNING_MSG = "The NDJSON writer is already running.";
 }
 
 #endif // !SCAN_ERROR_CONST_DEFS_H
@@ -70,6 +70,7 @@ namespace scan
         static string read(const path_t& t_file_path, Eol t_eol = Eol::lf);
 
         void close();
+        void flush();
         void open(const path_t& t_file_path, BitMask auto t_mode);
 
         void open(const path_t& t_file_path,
@@ -29,7 +29,10 @@ namespace scan
 {
     /**
     * @brief
-    *     Virtual HTTP network message.
+    *     Virtual HTTP network message. Header fields are stored only in the
+    *     underlying Beast message, and header lookups are views over its fields.
+    *     Normalized header field names are computed lazily and cached until
+    *     the message header is modified.
     */
     template<HttpMessage T>
     class Message : public IStringCastable
@@ -47,7 +50,8 @@ namespace scan
         string m_body;           // Message body
         string m_content_type;   // 'Content-Type' header
 
-        header_map_t m_headers;  // HTTP header fields
+        mutable vector<string> m_names;  // Cached normalized header field names
+
         message_t m_msg;         // HTTP message
 
     public:  /* Constructors & Destructor */
@@ -108,15 +112,6 @@ namespace scan
             return stream.str();
         }
 
-        /**
-        * @brief
-        *     Get a copy of the underlying HTTP message header field map.
-        */
-        constexpr header_map_t msg_headers() const noexcept
-        {
-            return m_headers;
-        }
-
         /**
         * @brief
         *     Get a constant reference to the underlying HTTP message.
@@ -128,10 +123,12 @@ namespace scan
 
         /**
         * @brief
-        *     Get a reference to the underlying HTTP message.
+        *     Get a reference to the underlying HTTP message. The cached normalized
+        *     header field names are discarded, since the header may be modified.
         */
         constexpr T& message() noexcept
         {
+            m_names.clear();
             return m_msg;
         }
 
@@ -142,10 +139,13 @@ namespace scan
         virtual void update_msg() = 0;
 
         bool contains(const string& t_name) const;
+        bool has_headers() const;
         virtual bool valid() const = 0;
 
         size_t content_length() const;
 
+        string_view header(const string& t_name) const;
+
         string msg_header();
         string raw() const;
         string raw_headers(const string& t_indent = {}) const;
@@ -153,17 +153,21 @@ namespace scan
         string str() const;
         string str();
 
+        header_list_t headers() const;
+
     protected:  /* Methods */
-        static string normalize_header(const string& t_name);
+        /**
+        * @brief
+        *     Get a standard string view of the given Beast string view.
+        */
+        static constexpr string_view make_view(const beast::string_view& t_view) noexcept
+        {
+            return string_view{t_view.data(), t_view.size()};
+        }
 
-        static header_map_t make_header_map(const string& t_raw_headers);
-        static header_map_t make_header_map(const fields_t& t_fields);
+        static string normalize_header(const string& t_name);
 
-        void add_headers(const string& t_raw_headers);
-        void add_headers(const fields_t& t_fields);
         void update_content_type();
-        void update_member_headers();
-        void update_message_headers();
         virtual void validate_headers() const = 0;
     };
 }
@@ -180,7 +184,7 @@ inline scan::Message<T>::operator std::string() const
 
 /**
 * @brief
-*     Add a new HTTP header field to the underlying header field map and message.
+*     Add a new HTTP header field to the underlying message.
 */
 template<scan::HttpMessage T>
 inline void scan::Message<T>::add_header(const header_t& t_header)
@@ -190,18 +194,19 @@ inline void scan::Message<T>::add_header(const header_t& t_header)
 
 /**
 * @brief
-*     Add a new HTTP header field to the underlying header field map and message.
+*     Add a new HTTP header field to the underlying message. Existing
+*     header fields with the same name (in any casing) are replaced.
 */
 template<scan::HttpMessage T>
 inline void scan::Message<T>::add_header(const string& t_name, const string& t_value)
 {
-    m_headers[normalize_header(t_name)] = t_value;
     m_msg.set(normalize_header(t_name), t_value);
+    m_names.clear();
 }
 
 /**
 * @brief
-*     Add the given HTTP header fields to the underlying header field map and message.
+*     Add the given HTTP header fields to the underlying message.
 */
 template<scan::HttpMessage T>
 inline void scan::Message<T>::add_headers(const header_map_t& t_headers)
@@ -227,30 +232,61 @@ inline void scan::Message<T>::body(const string& t_body, const string& t_mime)
 
 /**
 * @brief
-*     Determine whether the underlying header field map contains the given header field.
+*     Determine whether the underlying message contains the given header
+*     field. Header field names are compared case-insensitively.
 */
 template<scan::HttpMessage T>
 inline bool scan::Message<T>::contains(const string& t_name) const
 {
-    return m_headers.contains(normalize_header(t_name));
+    return m_msg.find(t_name) != m_msg.end();
+}
+
+/**
+* @brief
+*     Determine whether the underlying message contains any header fields.
+*/
+template<scan::HttpMessage T>
+inline bool scan::Message<T>::has_headers() const
+{
+    return m_msg.begin() != m_msg.end();
 }
 
 /**
 * @brief
-*     Get the 'Content-Length' header field value from the underlying header field map.
+*     Get the 'Content-Length' header field value from the underlying message.
 */
 template<scan::HttpMessage T>
 inline size_t scan::Message<T>::content_length() const
 {
     size_t length{0_sz};
+    const string_view length_str{header(HTTP_CONTENT_LENGTH)};
 
-    if (contains(HTTP_CONTENT_LENGTH))
+    if (!length_str.empty())
     {
-        length = algo::to_uint(m_headers.at(HTTP_CONTENT_LENGTH));
+        length = algo::to_uint(string{length_str});
     }
     return length;
 }
 
+/**
+* @brief
+*     Get a view of the value of the given header field in the underlying message.
+*     The view is empty when the header field does not exist, and it is only valid
+*     until the message header is modified.
+*/
+template<scan::HttpMessage T>
+inline std::string_view scan::Message<T>::header(const string& t_name) const
+{
+    string_view value;
+    const typename fields_t::const_iterator iter{m_msg.find(t_name)};
+
+    if (iter != m_msg.end())
+    {
+        value = make_view(iter->value());
+    }
+    return value;
+}
+
 /**
 * @brief
 *     Get the underlying HTTP message header as a string.
@@ -280,12 +316,13 @@ template<scan::HttpMessage T>
 inline std::string scan::Message<T>::raw_headers(const string& t_indent) const
 {
     sstream stream;
+    const header_list_t header_views{headers()};
 
-    for (size_t i{0_sz}; const header_t& header : m_headers)
+    for (size_t i{0_sz}; const header_view_t& header : header_views)
     {
-        stream << algo::fstr("%%: %", t_indent, header.first, header.second);
+        stream << t_indent << header.first << ": " << header.second;
 
-        if (i++ != m_headers.size() - 1)
+        if (i++ != header_views.size() - 1)
         {
             stream << CRLF;
         }
@@ -325,137 +362,72 @@ inline std::string scan::Message<T>::str()
 
 /**
 * @brief
-*     Normalize the casing of the given HTTP message header field
-*     name to avoid parsing errors caused by duplicate header checks.
+*     Get views of the header fields in the underlying message with normalized
+*     field names. The names are normalized once and cached until the message
+*     header is modified. The views are only valid until the message is modified.
 */
 template<scan::HttpMessage T>
-inline std::string scan::Message<T>::normalize_header(const string& t_name)
+inline scan::header_list_t scan::Message<T>::headers() const
 {
-    string header_name;
+    header_list_t header_views;
 
-    if (!t_name.empty())
+    // Normalize and cache the header field names
+    if (m_names.empty())
     {
-        vector<string> new_parts;
-
-        // Normalize header name casing
-        for (const string& header_part : algo::split(t_name, "-"))
+        for (const field_t& field : m_msg)
         {
-            string part{algo::to_lower(header_part)};
-
-            if (!part.empty())
-            {
-                part[0] = std::toupper(part[0]);
-            }
-            new_parts.emplace_back(part);
+            m_names.push_back(normalize_header(static_cast<string>(field.name_string())));
         }
-        header_name = algo::join(new_parts, "-");
     }
-    return header_name;
-}
 
-/**
-* @brief
-*     Create a new header field map from the given raw HTTP message header fields.
-*/
-template<scan::HttpMessage T>
-inline scan::header_map_t scan::Message<T>::make_header_map(const string& t_raw_headers)
-{
-    header_map_t headers;
-
-    if (!t_raw_headers.empty())
+    for (size_t i{0_sz}; const field_t& field : m_msg)
     {
-        for (const string& raw_header : algo::split(t_raw_headers, CRLF))
-        {
-            if (algo::contains(raw_header, ":"))
-            {
-                const string_array_t kv_pair{algo::split<2>(raw_header, ":")};
-                const string name{normalize_header(algo::trim_right(kv_pair[0]))};
-
-                headers[name] = algo::trim_left(kv_pair[1]);
-            }
-        }
+        header_views.emplace_back(m_names[i++], make_view(field.value()));
     }
-    return headers;
+    return header_views;
 }
 
 /**
 * @brief
-*     Create a new header field map from the given HTTP message headers fields.
+*     Normalize the casing of the given HTTP message header field
+*     name to avoid parsing errors caused by duplicate header checks.
 */
 template<scan::HttpMessage T>
-inline scan::header_map_t scan::Message<T>::make_header_map(const fields_t& t_fields)
+inline std::string scan::Message<T>::normalize_header(const string& t_name)
 {
-    header_map_t headers;
+    bool part_start{true};
+    string header_name{algo::to_lower(t_name)};
 
-    for (const field_t& field : t_fields)
+    // Capitalize the first character of each hyphen-separated part
+    for (char& ch : header_name)
     {
-        headers[normalize_header(field.name_string())] = field.value();
+        if (part_start)
+        {
+            ch = static_cast<char>(std::toupper(ch));
+        }
+        part_start = ch == '-';
     }
-    return headers;
-}
-
-/**
-* @brief
-*     Parse the HTTP message header fields from the given raw headers
-*     and add them to the underlying header field map and message.
-*/
-template<scan::HttpMessage T>
-inline void scan::Message<T>::add_headers(const string& t_raw_headers)
-{
-    add_headers(make_header_map(t_raw_headers));
-}
-
-/**
-* @brief
-*     Add the given HTTP message header fields to
-*     the underlying header field map and message.
-*/
-template<scan::HttpMessage T>
-inline void scan::Message<T>::add_headers(const fields_t& t_fields)
-{
-    add_headers(make_header_map(t_fields));
+    return header_name;
 }
 
 /**
 * @brief
-*     Update the 'Content-Type' header field in
-*     the underlying header field map and message.
+*     Update the 'Content-Type' header field in the underlying message. An existing
+*     'Content-Type' header field is only replaced by an explicit MIME type.
 */
 template<scan::HttpMessage T>
 inline void scan::Message<T>::update_content_type()
 {
     if (m_body.size() > 0)
     {
-        if (m_content_type.empty())
+        if (!m_content_type.empty())
         {
-            m_content_type = mime_type(MIME_TYPE_TEXT, MIME_SUBTYPE_PLAIN);
+            add_header(HTTP_CONTENT_TYPE, m_content_type);
+        }
+        else if (!contains(HTTP_CONTENT_TYPE))
+        {
+            add_header(HTTP_CONTENT_TYPE, mime_type(MIME_TYPE_TEXT, MIME_SUBTYPE_PLAIN));
         }
-        add_header(HTTP_CONTENT_TYPE, m_content_type);
-    }
-}
-
-/**
-* @brief
-*     Update the underlying HTTP header field map member
-*     using the current values of the HTTP message member.
-*/
-template<scan::HttpMessage T>
-inline void scan::Message<T>::update_member_headers()
-{
-    add_headers(m_msg.base());
-}
-
-/**
-* @brief
-*     Update the underlying HTTP message member using the
-*     current values of the HTTP header field map member.
-*/
-template<scan::HttpMessage T>
-inline void scan::Message<T>::update_message_headers()
-{
-    for (const header_t& header : m_headers)
-    {
-        m_msg.set(header.first, header.second);
     }
 }
 
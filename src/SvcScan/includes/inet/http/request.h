@@ -163,7 +163,6 @@ inline scan::Request<T>::Request(verb_t t_method,
     m_host = t_host;
     m_method = t_method;
 
-    this->m_msg = message_t{t_method, t_uri, this->httpv};
     this->add_header(HTTP_HOST, t_host);
     this->body(t_body);
 
@@ -218,7 +217,6 @@ template<scan::HttpBody T>
 inline void scan::Request<T>::update_msg()
 {
     this->update_content_type();
-    this->update_member_headers();
 
     method(m_method);
     uri(m_uri);
@@ -226,8 +224,7 @@ inline void scan::Request<T>::update_msg()
 
     this->m_msg.body() = this->m_body;
     this->m_msg.prepare_payload();
-
-    this->update_message_headers();
+    this->m_names.clear();
 }
 
 /**
@@ -291,28 +288,27 @@ inline void scan::Request<T>::host(const string& t_host)
 
 /**
 * @brief
-*     Validate the HTTP header entries in the underlying header
-*     field map. Throws a runtime exception when validation fails.
+*     Validate the HTTP header fields in the underlying
+*     message. Throws a runtime exception when validation fails.
 */
 template<scan::HttpBody T>
 inline void scan::Request<T>::validate_headers() const
 {
     const string caller{"Request<T>::validate_headers"};
 
-    if (this->m_headers.empty())
+    if (!this->has_headers())
     {
         throw RuntimeEx{EMPTY_HEADER_MAP_MSG, caller};
     }
-    header_map_t::const_iterator host_iter{this->m_headers.find(HTTP_HOST)};
 
     // Missing 'Host' header key
-    if (host_iter == this->m_headers.end())
+    if (!this->contains(HTTP_HOST))
     {
         throw RuntimeEx{algo::fstr(MISSING_HEADER_FMT_MSG, HTTP_HOST), caller};
     }
 
     // Missing 'Host' header value
-    if (host_iter->second.empty())
+    if (this->header(HTTP_HOST).empty())
     {
         throw RuntimeEx{algo::fstr(EMPTY_HEADER_FMT_MSG, HTTP_HOST), caller};
     }
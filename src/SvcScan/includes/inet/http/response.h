@@ -35,6 +35,7 @@ namespace scan
         using message_t = typename Message<http::response<T>>::message_t;
 
     private:  /* Fields */
+        bool m_truncated;   // Response body was truncated
         bool m_valid;       // Response is valid
         status_t m_status;  // Response status
 
@@ -46,7 +47,7 @@ namespace scan
         constexpr Response() noexcept : Message<http::response<T>>{}
         {
             m_status = status_t::unknown;
-            m_valid = false;
+            m_truncated = m_valid = false;
         }
 
         Response(const Response&) = default;
@@ -93,6 +94,17 @@ namespace scan
             return status() == status_t::ok;
         }
 
+        /**
+        * @brief
+        *     Determine whether the underlying HTTP response message body was truncated
+        *     or not read, either because it exceeded the maximum body size or because
+        *     only the response header was read.
+        */
+        constexpr bool truncated() const noexcept
+        {
+            return m_truncated;
+        }
+
         /**
         * @brief
         *     Determine whether the underlying HTTP response status code is unknown.
@@ -153,6 +165,16 @@ namespace scan
             return algo::fstr("% % %", this->httpv, status_code(), reason());
         }
 
+        /**
+        * @brief
+        *     Set the value indicating whether the underlying
+        *     HTTP response message body was truncated.
+        */
+        constexpr void truncated(bool t_truncated) noexcept
+        {
+            m_truncated = t_truncated;
+        }
+
         void parse(const message_t& t_msg);
         void update_msg() override;
 
@@ -197,13 +219,12 @@ template<scan::HttpBody T>
 inline void scan::Response<T>::update_msg()
 {
     this->update_content_type();
-    this->update_message_headers();
 
     this->m_msg.body() = this->m_body;
     this->m_msg.prepare_payload();
     this->m_msg.result(m_status);
 
-    this->update_member_headers();
+    this->m_names.clear();
 }
 
 /**
@@ -213,39 +234,32 @@ inline void scan::Response<T>::update_msg()
 template<scan::HttpBody T>
 inline std::string scan::Response<T>::server() const
 {
-    string server_str;
-
-    if (this->contains(HTTP_SERVER))
-    {
-        server_str = this->m_headers.at(HTTP_SERVER);
-    }
-    return server_str;
+    return string{this->header(HTTP_SERVER)};
 }
 
 /**
 * @brief
-*     Validate the HTTP header entries in the underlying header
-*     field map. Throws a runtime exception when validation fails.
+*     Validate the HTTP header fields in the underlying
+*     message. Throws a runtime exception when validation fails.
 */
 template<scan::HttpBody T>
 inline void scan::Response<T>::validate_headers() const
 {
     const string caller{"Response<T>::validate_headers"};
 
-    if (this->m_headers.empty())
+    if (!this->has_headers())
     {
         throw RuntimeEx{EMPTY_HEADER_MAP_MSG, caller};
     }
-    const header_map_t::const_iterator server_iter{this->m_headers.find(HTTP_SERVER)};
 
     // Missing 'Server' header key
-    if (server_iter == this->m_headers.end())
+    if (!this->contains(HTTP_SERVER))
     {
         throw RuntimeEx{algo::fstr(MISSING_HEADER_FMT_MSG, HTTP_SERVER), caller};
     }
 
     // Missing 'Server' header value
-    if (server_iter->second.empty())
+    if (this->header(HTTP_SERVER).empty())
     {
         throw RuntimeEx{algo::fstr(EMPTY_HEADER_FMT_MSG, HTTP_SERVER), caller};
     }
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <string>
+#include <string_view>
 #include <boost/asio/error.hpp>
 #include <boost/asio/ssl/error.hpp>
 #include <boost/beast/core/error.hpp>
@@ -18,11 +19,13 @@
 #include <openssl/types.h>
 #include "../concepts/concepts.h"
 #include "../ranges/algo.h"
-#include "../resources/text_rc.h"
+#include "../resources/port_db.h"
 #include "../utils/aliases.h"
 #include "../utils/const_defs.h"
 #include "net_aliases.h"
 #include "net_const_defs.h"
+#include "services/banner_policy.h"
+#include "services/port_record.h"
 #include "services/svc_info.h"
 #include "sockets/endpoint.h"
 #include "sockets/host_state.h"
@@ -33,6 +36,129 @@
 */
 namespace scan::net
 {
+    static_assert(ranges::is_sorted(PORT_DB, {}, &PortRecord::port));
+    static_assert(PORT_DB.size() < UINT16_T_MAX);
+
+    /**
+    * @brief
+    *     Create the direct port number index of the port service database. Each
+    *     element holds the database index of its port number's record plus one, so
+    *     zero-initialized elements indicate ports without a known service.
+    */
+    consteval array<uint16_t, PORT_MAX + 1_sz> make_port_index() noexcept
+    {
+        array<uint16_t, PORT_MAX + 1_sz> index{};
+
+        for (size_t i{0_sz}; i < PORT_DB.size(); i++)
+        {
+            index[PORT_DB[i].port] = static_cast<uint16_t>(i + 1_sz);
+        }
+        return index;
+    }
+
+    /// @brief  Port service database record indexes (plus one) by port number.
+    inline constexpr array<uint16_t, PORT_MAX + 1_sz> PORT_INDEX{make_port_index()};
+
+    /**
+    * @brief
+    *     Determine whether the given partially received service banner is complete
+    *     based on protocol-specific terminators. Banners are complete once their
+    *     last line is an SSH identification string, a final SMTP or FTP reply line
+    *     (reply code followed by a space), a POP3 or IMAP greeting or an RFB version.
+    */
+    constexpr bool banner_complete(string_view t_banner)
+    {
+        bool complete{false};
+
+        if (!t_banner.empty() && t_banner.back() == *LF)
+        {
+            const string_view data{t_banner.substr(0_sz, t_banner.size() - 1_sz)};
+            const size_t offset{data.rfind(LF)};
+
+            const string_view line{algo::is_npos(offset) ? data : data.substr(offset + 1_sz)};
+
+            const auto is_digit = [](char l_ch) constexpr -> bool
+            {
+                return l_ch >= '0' && l_ch <= '9';
+            };
+
+            const bool reply_line = line.size() >= 4_sz
+                                 && ranges::all_of(line.substr(0_sz, 3_sz), is_digit)
+                                 && line[3] == ' ';
+
+            complete = reply_line
+                    || line.starts_with("SSH-")
+                    || line.starts_with("+OK")
+                    || line.starts_with("* OK")
+                    || line.starts_with("* PREAUTH")
+                    || line.starts_with("RFB ");
+        }
+        return complete;
+    }
+
+    /**
+    * @brief
+    *     Get the banner policy of the given service name (from the generated port
+    *     service database). Determines whether the service is expected to send a
+    *     banner upon connection or to wait for the client to send data. Implicit
+    *     SSL/TLS services wait for the client hello, and only send a banner once
+    *     the given connection has completed its SSL/TLS handshake.
+    */
+    constexpr BannerPolicy banner_policy(string_view t_service, bool t_tls = false)
+    {
+        BannerPolicy policy{BannerPolicy::unknown};
+
+        const bool implicit_tls{algo::any_eq(t_service, "imaps", "ircs", "pop3s", "smtps")};
+
+        const bool client_first = (implicit_tls && !t_tls)
+                               || t_service.starts_with("http")
+                               || algo::any_eq(t_service,
+                                               "ajp13",
+                                               "domain",
+                                               "kerberos-sec",
+                                               "ldap",
+                                               "ldapssl",
+                                               "memcache",
+                                               "microsoft-ds",
+                                               "mongod",
+                                               "ms-sql-s",
+                                               "ms-wbt-server",
+                                               "msrpc",
+                                               "netbios-ssn",
+                                               "nfs",
+                                               "oracle",
+                                               "postgresql",
+                                               "redis",
+                                               "rpcbind",
+                                               "sip",
+                                               "sip-tls",
+                                               "wsman",
+                                               "wsmans");
+
+        const bool server_first = (implicit_tls && t_tls)
+                               || t_service.starts_with("vnc")
+                               || algo::any_eq(t_service,
+                                               "ftp",
+                                               "imap",
+                                               "irc",
+                                               "mysql",
+                                               "nntp",
+                                               "pop3",
+                                               "smtp",
+                                               "ssh",
+                                               "submission",
+                                               "telnet");
+        if (client_first)
+        {
+            policy = BannerPolicy::client_first;
+        }
+        else if (server_first)
+        {
+            policy = BannerPolicy::server_first;
+        }
+        return policy;
+    }
+
     /**
     * @brief
     *     Determine whether the given socket error code is
@@ -99,6 +225,24 @@ namespace scan::net
         return t_port >= (t_ign_zero ? PORT_NULL : PORT_MIN) && t_port <= PORT_MAX;
     }
 
+    /**
+    * @brief
+    *     Get the port service database record of the given port number using the
+    *     direct port number index. Ports without a known service use an unknown
+    *     service record.
+    */
+    constexpr PortRecord port_record(port_t t_port) noexcept
+    {
+        PortRecord record{t_port, PROTO, SVC_UNKNOWN, {}};
+        const uint16_t index{PORT_INDEX[t_port]};
+
+        if (index > 0)
+        {
+            record = PORT_DB[index - 1_sz];
+        }
+        return record;
+    }
+
     /**
     * @brief
     *     Determine whether the network port numbers in the given range are valid.
@@ -164,13 +308,17 @@ namespace scan::net
         return msg;
     }
 
-    void update_svc(const TextRc& t_csv_rc, SvcInfo& t_info, HostState t_state);
+    void update_svc(SvcInfo& t_info, HostState t_state);
+
+    BannerPolicy banner_policy(port_t t_port, bool t_tls = false);
 
     bool valid_endpoint(const Endpoint& t_ep);
     bool valid_ipv4(const string& t_addr);
     bool valid_ipv4_fmt(const string& t_addr);
     bool valid_port(const string& t_port, bool t_ign_zero = false);
 
+    size_t socket_budget();
+
     string error(const Endpoint& t_ep, const net_error_code_t& t_ecode);
     string ipv4_from_results(const results_t& t_results);
     string x509_issuer(const X509* t_certp);
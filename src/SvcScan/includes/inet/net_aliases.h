@@ -16,10 +16,14 @@
 #include <cstdint>
 #include <map>
 #include <winsock2.h>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/awaitable.hpp>
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/detail/socket_option.hpp>
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/ip/basic_resolver.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/beast/core/flat_buffer.hpp>
 #include <boost/beast/core/tcp_stream.hpp>
 #include <boost/beast/http/status.hpp>
@@ -36,10 +40,15 @@ namespace scan
     namespace http  = beast::http;
     namespace ssl   = asio::ssl;
 
+    using endpoint_t       = ip::tcp::endpoint;
+    using executor_t       = asio::any_io_executor;
     using flat_buffer_t    = beast::flat_buffer;
+    using header_view_t    = pair<string_view, string_view>;
+    using header_list_t    = vector<header_view_t>;
     using header_map_t     = map<string, string>;
     using header_t         = header_map_t::value_type;
     using mutable_buffer_t = asio::mutable_buffer;
+    using native_socket_t  = ip::tcp::socket::native_handle_type;
     using net_error_code_t = boost::system::error_code;
     using port_t           = uint16_t;
     using resolver_t       = ip::tcp::resolver;
@@ -47,9 +56,14 @@ namespace scan
     using socket_t         = ip::tcp::socket;
     using ssl_stream_t     = beast::ssl_stream<beast::tcp_stream>;
     using status_t         = http::status;
+    using steady_timer_t   = asio::steady_timer;
     using stream_t         = beast::tcp_stream;
     using string_body_t    = http::string_body;
     using verb_t           = http::verb;
+    using work_guard_t     = asio::executor_work_guard<io_context_t::executor_type>;
+
+    template<class T = void>
+    using awaitable_t = asio::awaitable<T>;
 
     template<int SockOpt>
     using socket_option_t = asio::detail::socket_option::integer<SOL_SOCKET, SockOpt>;
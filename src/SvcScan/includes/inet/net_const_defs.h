@@ -31,15 +31,72 @@ namespace scan
     /// @brief  Receive buffer size.
     constexpr size_t BUFFER_SIZE = 1024_sz;
 
+    /// @brief  Default maximum service banner capture size.
+    constexpr size_t BANNER_BYTES = 4096_sz;
+
+    /// @brief  Maximum configurable service banner capture size.
+    constexpr size_t MAX_BANNER_BYTES = 65536_sz;
+
+    /// @brief  Default maximum HTTP response body size.
+    constexpr size_t BODY_BYTES = 65536_sz;
+
+    /// @brief  Maximum configurable HTTP response body size.
+    constexpr size_t MAX_BODY_BYTES = 8388608_sz;
+
+    /// @brief  Shared I/O context worker thread count.
+    constexpr size_t IO_THREADS = 2_sz;
+
+    /// @brief  Default maximum concurrent asynchronous connect operations.
+    constexpr size_t MAX_CONNECTS = 512_sz;
+
+    /// @brief  Initial service probing concurrency limit.
+    constexpr size_t INITIAL_PROBES = 16_sz;
+
+    /// @brief  Default maximum service probing concurrency limit.
+    constexpr size_t MAX_PROBES = 256_sz;
+
+    /// @brief  Minimum service probing concurrency limit.
+    constexpr size_t MIN_PROBES = 4_sz;
+
+    /// @brief  Default minimum paced connection rate (per second).
+    constexpr size_t MIN_RATE = 1_sz;
+
+    /// @brief  Maximum total target count of a scan.
+    constexpr size_t MAX_TARGETS = 65536_sz;
+
+    /// @brief  Minimum service probing queue capacity.
+    constexpr size_t PROBE_QUEUE_SIZE = 1024_sz;
+
+    /// @brief  File descriptors reserved for non-socket use.
+    constexpr size_t RESERVED_FDS = 64_sz;
+
+    /// @brief  Default maximum concurrently open socket count.
+    constexpr size_t SOCKET_BUDGET = 8192_sz;
+
+    /// @brief  Maximum concurrent SSL/TLS enumeration handshakes per host.
+    constexpr size_t TLS_ENUM_HANDSHAKES = 8_sz;
+
     /// @brief  Default connect timeout.
     constexpr milliseconds CONNECT_TIMEOUT = 3500_ms;
 
+    /// @brief  Default minimum adaptive connect timeout.
+    constexpr milliseconds MIN_CONNECT_TIMEOUT = 100_ms;
+
+    /// @brief  Minimum adaptive banner receive timeout.
+    constexpr milliseconds MIN_RECV_TIMEOUT = 250_ms;
+
     /// @brief  Default receive timeout.
     constexpr milliseconds RECV_TIMEOUT = 1000_ms;
 
+    /// @brief  Idle gap that ends a multi-read service banner capture.
+    constexpr milliseconds BANNER_IDLE_TIMEOUT = 150_ms;
+
     /// @brief  Default send timeout.
     constexpr milliseconds SEND_TIMEOUT = 500_ms;
 
+    /// @brief  SSL/TLS enumeration handshake slot polling interval.
+    constexpr milliseconds TLS_ENUM_POLL_INTERVAL = 25_ms;
+
     /// @brief  MIME character set.
     constexpr c_string_t CHARSET_UTF8 = "utf-8";
 
@@ -70,6 +127,9 @@ namespace scan
     /// @brief  Unspecified IPv4 address.
     constexpr c_string_t IPV4_ANY = "0.0.0.0";
 
+    /// @brief  Keep the connection alive.
+    constexpr c_string_t KEEP_ALIVE = "keep-alive";
+
     /// @brief  MIME subtype of 'application/json'.
     constexpr c_string_t MIME_SUBTYPE_JSON = "json";
 
@@ -0,0 +1,139 @@
+/*
+* @file
+*     raw_scanner.h
+* @brief
+*     Header file for an IPv4 half-open (SYN) network scanner.
+*/
+#pragma once
+
+#ifndef SCAN_RAW_SCANNER_H
+#define SCAN_RAW_SCANNER_H
+
+#include <cstdint>
+#include "../../console/args.h"
+#include "../../threading/thread_aliases.h"
+#include "../../utils/aliases.h"
+#include "../../utils/literals.h"
+#include "../net_aliases.h"
+#include "../sockets/host_state.h"
+#include "../sockets/raw_tcp.h"
+#include "tcp_scanner.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     IPv4 network scanner that performs stateless half-open (SYN) port discovery
+    *     on a raw socket. Only the discovered open ports are probed for service details.
+    *     Selectable only when compiled with SCAN_RAW_SOCKETS defined, since raw TCP
+    *     segments can only be sent on Linux (with CAP_NET_RAW), and Windows rejects
+    *     raw TCP sends.
+    */
+    class RawScanner final : public TcpScanner
+    {
+    private:  /* Constants */
+        static constexpr size_t IPV4_HEADER_MIN = 20_sz;    // Minimum IPv4 header size
+        static constexpr size_t PACKET_SIZE_MAX = 1500_sz;  // Maximum inbound packet size
+        static constexpr size_t TCP_HEADER_MIN = 20_sz;     // Minimum TCP header size
+        static constexpr size_t TCP_HEADER_SIZE = 24_sz;    // SYN segment header size
+
+        static constexpr uint8_t TCP_FLAG_ACK = 0x10;       // TCP acknowledgment flag
+        static constexpr uint8_t TCP_FLAG_RST = 0x04;       // TCP reset flag
+        static constexpr uint8_t TCP_FLAG_SYN = 0x02;       // TCP synchronize flag
+
+        static constexpr uint16_t MSS = 1460_u16;           // Maximum segment size
+        static constexpr uint16_t WINDOW_SIZE = 1024_u16;   // TCP receive window size
+
+        static constexpr port_t PORT_DYNAMIC = 49152_u16;   // Dynamic port range start
+
+    private:  /* Type Aliases */
+        using packet_t     = byte_array_t<PACKET_SIZE_MAX>;
+        using raw_socket_t = RawTcp::socket;
+        using route_t      = pair<uint32_t, uint32_t>;
+        using segment_t    = byte_array_t<TCP_HEADER_SIZE>;
+        using state_map_t  = map<uint64_t, HostState>;
+
+    private:  /* Fields */
+        port_t m_src_port;          // Probe source port
+        uint32_t m_cookie_key;      // SYN cookie secret key
+
+        mutable mutex m_syn_mtx;    // SYN reply state map mutex
+        state_map_t m_syn_states;   // SYN reply state map
+
+    public:  /* Constructors & Destructor */
+        RawScanner() = delete;
+        RawScanner(const RawScanner&) = delete;
+        RawScanner(RawScanner&& t_scanner) noexcept;
+        RawScanner(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp);
+
+        virtual ~RawScanner() = default;
+
+    public:  /* Operators */
+        RawScanner& operator=(const RawScanner&) = delete;
+        RawScanner& operator=(RawScanner&& t_scanner) noexcept;
+
+    private:  /* Methods */
+        /**
+        * @brief
+        *     Get the SYN reply state map key of the given IPv4 address and port number.
+        */
+        static constexpr uint64_t state_key(uint32_t t_addr, port_t t_port) noexcept
+        {
+            return static_cast<uint64_t>(t_addr) << 16 | t_port;
+        }
+
+        /**
+        * @brief
+        *     Read a 16-bit unsigned integer in network byte order from the given buffer.
+        */
+        static constexpr uint16_t read_word(const uint8_t* t_bytesp) noexcept
+        {
+            return static_cast<uint16_t>(t_bytesp[0] << 8 | t_bytesp[1]);
+        }
+
+        /**
+        * @brief
+        *     Read a 32-bit unsigned integer in network byte order from the given buffer.
+        */
+        static constexpr uint32_t read_dword(const uint8_t* t_bytesp) noexcept
+        {
+            return static_cast<uint32_t>(read_word(t_bytesp)) << 16 | read_word(t_bytesp + 2);
+        }
+
+        /**
+        * @brief
+        *     Write a 16-bit unsigned integer in network byte order to the given buffer.
+        */
+        static constexpr void write_word(uint8_t* t_bytesp, uint16_t t_value) noexcept
+        {
+            t_bytesp[0] = static_cast<uint8_t>(t_value >> 8);
+            t_bytesp[1] = static_cast<uint8_t>(t_value);
+        }
+
+        /**
+        * @brief
+        *     Write a 32-bit unsigned integer in network byte order to the given buffer.
+        */
+        static constexpr void write_dword(uint8_t* t_bytesp, uint32_t t_value) noexcept
+        {
+            write_word(t_bytesp, static_cast<uint16_t>(t_value >> 16));
+            write_word(t_bytesp + 2, static_cast<uint16_t>(t_value));
+        }
+
+        void async_recv(raw_socket_t& t_socket, packet_t& t_packet, promise<void>& t_done);
+        void on_reply(const uint8_t* t_datap, size_t t_size);
+        void post_port_scan(const Endpoint& t_ep) override;
+        void scan_ports() override;
+        void syn_sweep();
+
+        uint16_t checksum(const segment_t& t_segment, const route_t& t_route) const noexcept;
+        uint32_t local_addr(uint32_t t_dest_addr) const;
+        uint32_t syn_cookie(const route_t& t_route, port_t t_port) const noexcept;
+
+        HostState syn_state(const Endpoint& t_ep) const;
+
+        segment_t syn_segment(const route_t& t_route, port_t t_port) const noexcept;
+    };
+}
+
+#endif // !SCAN_RAW_SCANNER_H
@@ -16,18 +16,24 @@
 #include "../../errors/logic_ex.h"
 #include "../../ranges/algo.h"
 #include "../../ranges/list.h"
-#include "../../resources/text_rc.h"
-#include "../../threading/task_status.h"
+#include "../../threading/concurrency_limit.h"
+#include "../../threading/lock_free_stack.h"
 #include "../../threading/thread_aliases.h"
 #include "../../threading/thread_pool.h"
 #include "../../utils/aliases.h"
+#include "../../utils/ndjson_writer.h"
 #include "../../utils/timer.h"
 #include "../http/request.h"
 #include "../http/response.h"
+#include "../net.h"
 #include "../net_aliases.h"
+#include "../services/banner_policy.h"
 #include "../services/svc_info.h"
 #include "../services/svc_table.h"
+#include "../sockets/client_pool.h"
 #include "../sockets/hostname.h"
+#include "../sockets/rate_limiter.h"
+#include "../sockets/rtt_estimator.h"
 #include "../sockets/tcp_client.h"
 #include "../sockets/timeout.h"
 
@@ -35,41 +41,60 @@ namespace scan
 {
     /**
     * @brief
-    *     IPv4 TCP and HTTP network scanner.
+    *     IPv4 TCP and HTTP network scanner. Scans one or more targets
+    *     using a single connection pipeline and shared I/O context.
     */
     class TcpScanner
     {
     protected:  /* Type Aliases */
-        using client_ptr_t      = unique_ptr<TcpClient>;
-        using port_status_map_t = map<port_t, TaskStatus>;
+        using client_ptr_t    = shared_ptr<TcpClient>;
+        using latency_key_t   = pair<string, BannerPolicy>;
+        using latency_map_t   = map<latency_key_t, microseconds>;
+        using rtt_map_t       = map<string, RttEstimator>;
+        using table_list_t    = vector<SvcTable>;
 
     public:  /* Fields */
-        atomic_bool out_json;  // Output results as JSON
-        atomic_bool verbose;   // Enable verbose output
+        atomic_bool out_json;    // Output results as JSON
+        atomic_bool out_ndjson;  // Stream results as NDJSON
+        atomic_bool verbose;     // Enable verbose output
 
-        string out_path;       // Output file path
+        string out_path;         // Output file path
 
-        Hostname target;       // Target hostname
-        List<port_t> ports;    // Target ports
+        List<Hostname> targets;  // Target hostnames
+        List<port_t> ports;      // Target ports
 
     protected:  /* Fields */
         atomic_ptr_t<Args> m_args_ap;  // Command-line arguments atomic pointer
-        atomic_ptr_t<TextRc> m_rc_ap;  // Embedded CSV resource atomic pointer
 
-        Timeout m_timeout;             // Connection timeout
+        Timeout m_min_timeout;         // Minimum adaptive connection timeout
+        Timeout m_timeout;             // Maximum connection timeout
 
-        io_context_t& m_io_ctx;        // I/O context reference
+        io_context_t& m_io_ctx;        // Shared I/O context reference
         Timer m_timer;                 // Scan duration timer
 
         string m_uri;                  // HTTP request URI
-        ThreadPool m_pool;             // Execution thread pool
+        ThreadPool m_pool;             // Service probing thread pool
+        ThreadPool m_io_pool;          // I/O context thread pool
+
+        semaphore m_connect_sem;       // Concurrent connection semaphore
+        semaphore m_queue_sem;         // Queued service probe semaphore
+        ClientPool<TcpClient> m_clients;  // Reusable TCP client pool
+        RateLimiter m_limiter;         // Connection rate limiter
+        ConcurrencyLimit m_probe_limit;  // Service probing concurrency limit
 
         mutable mutex m_ports_mtx;     // Port list mutex
-        mutable mutex m_services_mtx;  // Service information list mutex
-        mutable mutex m_statuses_mtx;  // Task execution status map mutex
+        mutable mutex m_latency_mtx;   // Probe latency map mutex
+        mutable mutex m_rtt_mtx;       // RTT estimator map mutex
+
+        atomic<size_t> m_active_count;     // Started and uncompleted task count
+        atomic<size_t> m_completed_count;  // Completed task count
+        atomic<size_t> m_task_count;       // Total task count
+
+        latency_map_t m_min_latencies; // Minimum probe latency map
+        rtt_map_t m_rtt_estimators;    // Per-target RTT estimator map
 
-        port_status_map_t m_statuses;  // Task execution status map
-        List<SvcInfo> m_services;      // Service information list
+        LockFreeStack<SvcInfo> m_services;  // Service information stack
+        NdjsonWriter m_writer;              // Streaming NDJSON result writer
 
     public:  /* Constructors & Destructor */
         TcpScanner() = delete;
@@ -88,31 +113,58 @@ namespace scan
         void wait();
 
     protected:  /* Methods */
-        void add_service(const SvcInfo& t_info);
+        static bool reusable(const Response<>& t_response);
+
+        static size_t max_clients(const Args& t_args) noexcept;
+        static size_t max_probes(const Args& t_args) noexcept;
+        static size_t probe_queue_size(const Args& t_args) noexcept;
+
+        void complete_task(SvcInfo&& t_info);
         void parse_argsp(shared_ptr<Args> t_argsp);
-        virtual void post_port_scan(port_t t_port);
+        virtual void post_port_scan(const Endpoint& t_ep);
         void print_progress() const;
-        void print_report(const SvcTable& t_table) const;
-        void save_report(const SvcTable& t_table) const;
+        virtual void probe_client(client_ptr_t& t_clientp);
+        void print_report(const table_list_t& t_tables) const;
+        void save_report(const table_list_t& t_tables) const;
+        virtual void scan_ports();
         void scan_shutdown();
         void scan_startup();
-        void set_status(port_t t_port, TaskStatus t_status);
+        void post_probe(client_ptr_t&& t_clientp);
+        void start_io();
+        void update_probe_latency(const latency_key_t& t_key, const microseconds& t_latency);
+        void update_rtt(const client_ptr_t& t_clientp, const microseconds& t_rtt);
+
+        bool ndjson_stdout() const noexcept;
 
-        size_t completed_tasks() const;
+        size_t active_tasks() const noexcept;
+        size_t completed_tasks() const noexcept;
+        size_t task_count() const noexcept;
 
         double calc_progress() const;
         double calc_progress(size_t& t_completed) const;
 
+        Timeout banner_timeout(const string& t_addr) const;
+        Timeout connect_timeout(const string& t_addr) const;
+
         client_ptr_t& process_data(client_ptr_t& t_clientp);
 
         ClientPtr auto& probe_http(ClientPtr auto& t_clientp);
+        ClientPtr auto& probe_paths(ClientPtr auto& t_clientp);
 
-        string json_report(const SvcTable& t_table,
+        string json_report(const table_list_t& t_tables,
                            bool t_colorize = false,
                            bool t_include_title = false) const;
 
+        string_view recv_banner(ClientPtr auto& t_clientp);
+
+        string probe_summary() const;
         string scan_progress() const;
         string scan_summary(bool t_colorize = false, bool t_include_cmd = false) const;
+        string targets_summary() const;
+
+        virtual string session_summary() const;
+
+        table_list_t make_tables();
     };
 }
 
@@ -130,7 +182,14 @@ inline scan::ClientPtr auto& scan::TcpScanner::probe_http(ClientPtr auto& t_clie
     SvcInfo& svc_info{t_clientp->svcinfo()};
     const verb_t method{m_args_ap.load()->curl ? verb_t::get : verb_t::head};
 
-    const Request<> request{method, target, m_uri};
+    const bool probe_paths_enabled{!m_args_ap.load()->paths.empty()};
+    Request<> request{method, svc_info.addr, m_uri};
+
+    // Keep the connection alive for the additional request URIs
+    if (probe_paths_enabled)
+    {
+        request.add_header(HTTP_CONNECTION, KEEP_ALIVE);
+    }
     const Response<> response{t_clientp->request(request)};
 
     // Update HTTP service information
@@ -142,8 +201,104 @@ inline scan::ClientPtr auto& scan::TcpScanner::probe_http(ClientPtr auto& t_clie
         svc_info.summary = algo::replace(response.server(), replacement_subs, " ");
         svc_info.request = request;
         svc_info.response = response;
+
+        if (probe_paths_enabled)
+        {
+            probe_paths(t_clientp);
+        }
+    }
+    return t_clientp;
+}
+
+/**
+* @brief
+*     Request each additional HTTP request URI from the given connected client's
+*     service. Requests are sent sequentially over the persistent connection of the
+*     initial request, and the client reconnects whenever the server closes it.
+*/
+inline scan::ClientPtr auto& scan::TcpScanner::probe_paths(ClientPtr auto& t_clientp)
+{
+    SvcInfo& svc_info{t_clientp->svcinfo()};
+    const shared_ptr<Args> argsp{m_args_ap.load()};
+
+    const verb_t method{svc_info.request.method()};
+    bool keep_alive{reusable(svc_info.response)};
+
+    for (const string& uri : argsp->paths)
+    {
+        // Initial request URI was already probed
+        if (uri == m_uri)
+        {
+            continue;
+        }
+
+        bool reconnected{false};
+
+        // Server closed the persistent connection
+        if (!keep_alive || !t_clientp->is_connected())
+        {
+            t_clientp->reconnect();
+            reconnected = true;
+        }
+
+        if (!t_clientp->is_connected())
+        {
+            break;
+        }
+
+        Request<> request{method, svc_info.addr, uri};
+        request.add_header(HTTP_CONNECTION, KEEP_ALIVE);
+
+        Response<> response{t_clientp->request(request)};
+
+        // Connection was closed while idle, retry once on a new connection
+        if (!response.valid() && !reconnected)
+        {
+            t_clientp->reconnect();
+
+            if (t_clientp->is_connected())
+            {
+                response = t_clientp->request(request);
+            }
+        }
+        keep_alive = reusable(response);
+
+        if (response.valid())
+        {
+            svc_info.path_responses[uri] = std::move(response);
+        }
     }
     return t_clientp;
 }
 
+/**
+* @brief
+*     Read the banner of the given connected client's service. The banner policy of
+*     the port's service determines whether to wait for a banner, and the receive
+*     timeout is derived from the target round-trip time whenever a banner may be sent.
+*     The returned view references the client's banner buffer, so it is only valid
+*     until the client receives another banner.
+*/
+inline std::string_view scan::TcpScanner::recv_banner(ClientPtr auto& t_clientp)
+{
+    if (!t_clientp->is_connected())
+    {
+        throw LogicEx{CLIENT_DISCONNECTED_MSG, "TcpScanner::recv_banner"};
+    }
+
+    string_view banner;
+    const SvcInfo& svc_info{t_clientp->svcinfo()};
+
+    constexpr bool tls_client{SameByValue<decltype(*t_clientp), TlsClient>};
+    const BannerPolicy policy{net::banner_policy(svc_info.port(), tls_client)};
+
+    // Server-first and unknown services may send a banner
+    if (policy != BannerPolicy::client_first)
+    {
+        const size_t max_bytes{m_args_ap.load()->banner_bytes};
+        banner = t_clientp->recv_banner(max_bytes, banner_timeout(svc_info.addr));
+    }
+    return banner;
+}
+
 #endif // !SCAN_TCP_SCANNER_H
@@ -17,14 +17,17 @@
 #include "../../errors/error_const_defs.h"
 #include "../../errors/logic_ex.h"
 #include "../../errors/null_ptr_ex.h"
+#include "../../threading/thread_aliases.h"
 #include "../../utils/aliases.h"
 #include "../../utils/const_defs.h"
 #include "../net.h"
 #include "../net_aliases.h"
 #include "../services/svc_info.h"
+#include "../sockets/client_pool.h"
 #include "../sockets/host_state.h"
 #include "../sockets/tcp_client.h"
 #include "../sockets/tls_client.h"
+#include "../sockets/tls_enumerator.h"
 #include "tcp_scanner.h"
 
 namespace scan
@@ -36,7 +39,15 @@ namespace scan
     class TlsScanner final : public TcpScanner
     {
     private:  /* Type Aliases */
-        using tls_client_ptr_t = unique_ptr<TlsClient>;
+        using tls_client_ptr_t = shared_ptr<TlsClient>;
+
+    private:  /* Fields */
+        atomic<size_t> m_resumed_count;       // Resumed SSL/TLS session count
+        atomic<size_t> m_session_count;       // Established SSL/TLS session count
+
+        ClientPool<TlsClient> m_tls_clients;  // Reusable SSL/TLS client pool
+
+        map<string, string> m_server_names;   // SNI host names by target address
 
     public:  /* Constructors & Destructor */
         TlsScanner() = delete;
@@ -48,12 +59,18 @@ namespace scan
 
     public:  /* Operators */
         TlsScanner& operator=(const TlsScanner&) = delete;
-        TlsScanner& operator=(TlsScanner&&) = default;
+        TlsScanner& operator=(TlsScanner&& t_scanner) noexcept;
 
     private:  /* Methods */
-        void post_port_scan(port_t t_port) override;
+        void enumerate_tls(SvcInfo& t_info);
+        void parse_server_names();
+        void probe_client(client_ptr_t& t_clientp) override;
 
-        bool process_data(ClientPtr auto& t_clientp);
+        string server_name(const string& t_addr) const;
+        string session_summary() const override;
+
+        void process_data(ClientPtr auto& t_clientp);
+        void process_data(ClientPtr auto& t_clientp, string_view t_banner);
     };
 }
 
@@ -61,7 +78,7 @@ namespace scan
 * @brief
 *     Process the inbound and outbound socket stream data.
 */
-inline bool scan::TlsScanner::process_data(ClientPtr auto& t_clientp)
+inline void scan::TlsScanner::process_data(ClientPtr auto& t_clientp)
 {
     if (t_clientp == nullptr)
     {
@@ -72,29 +89,44 @@ inline bool scan::TlsScanner::process_data(ClientPtr auto& t_clientp)
     {
         throw LogicEx{CLIENT_DISCONNECTED_MSG, "TlsScanner::process_data"};
     }
-    bool success{true};
 
-    TlsClient::buffer_t buffer{CHAR_NULL};
-    SvcInfo& svc_info{t_clientp->svcinfo()};
+    process_data(t_clientp, recv_banner(t_clientp));
+}
 
-    const size_t bytes_read{t_clientp->recv(buffer)};
+/**
+* @brief
+*     Process the inbound and outbound socket stream data
+*     using the given previously received service banner.
+*/
+inline void scan::TlsScanner::process_data(ClientPtr auto& t_clientp,
+                                           string_view t_banner)
+{
+    if (t_clientp == nullptr)
+    {
+        throw NullPtrEx{"t_clientp"};
+    }
+
+    if (!t_clientp->is_connected())
+    {
+        throw LogicEx{CLIENT_DISCONNECTED_MSG, "TlsScanner::process_data"};
+    }
+
+    SvcInfo& svc_info{t_clientp->svcinfo()};
     HostState state{t_clientp->host_state()};
 
     // Parse banner or probe HTTP information
     if (state == HostState::open)
     {
-        const string recv_data(&buffer[0], bytes_read);
-
-        if (!recv_data.empty())
+        if (!t_banner.empty())
         {
-            svc_info.parse_banner(recv_data);
-            net::update_svc(*m_rc_ap.load(), svc_info, state);
+            svc_info.parse_banner(t_banner);
+            net::update_svc(svc_info, state);
         }
 
-        if (recv_data.empty() || m_args_ap.load()->curl)
+        if (t_banner.empty() || m_args_ap.load()->curl)
         {
             probe_http(t_clientp);
-            success = !svc_info.summary.empty();
+            const bool success{!svc_info.summary.empty()};
 
             if (success && SmartPtrOf<decltype(t_clientp), TlsClient>)
             {
@@ -102,9 +134,7 @@ inline bool scan::TlsScanner::process_data(ClientPtr auto& t_clientp)
             }
         }
     }
-    net::update_svc(*m_rc_ap.load(), svc_info, state);
-
-    return success;
+    net::update_svc(svc_info, state);
 }
 
 #endif // !SCAN_TLS_SCANNER_H
@@ -0,0 +1,28 @@
+/*
+* @file
+*     banner_policy.h
+* @brief
+*     Header file for a network service banner policy enumeration.
+*/
+#pragma once
+
+#ifndef SCAN_BANNER_POLICY_H
+#define SCAN_BANNER_POLICY_H
+
+#include <cstdint>
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Network service banner policy enumeration.
+    */
+    enum class BannerPolicy : uint8_t
+    {
+        unknown,       // Service may send a banner
+        client_first,  // Service waits for the client to send data
+        server_first   // Service sends a banner upon connection
+    };
+}
+
+#endif // !SCAN_BANNER_POLICY_H
@@ -0,0 +1,77 @@
+/*
+* @file
+*     port_record.h
+* @brief
+*     Header file for a network port service database record.
+*/
+#pragma once
+
+#ifndef SCAN_PORT_RECORD_H
+#define SCAN_PORT_RECORD_H
+
+#include "../../utils/aliases.h"
+#include "../net_aliases.h"
+#include "../net_const_defs.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Network port service database record. Record fields are views
+    *     into static string data, which must outlive the record.
+    */
+    class PortRecord final
+    {
+    public:  /* Fields */
+        port_t port;          // Port number
+        string_view proto;    // Transport protocol
+        string_view service;  // Service name
+        string_view summary;  // Service summary
+
+    public:  /* Constructors & Destructor */
+        /**
+        * @brief
+        *     Initialize the object.
+        */
+        constexpr PortRecord() noexcept : PortRecord{PORT_NULL, {}, {}, {}}
+        {
+        }
+
+        constexpr PortRecord(const PortRecord&) = default;
+        constexpr PortRecord(PortRecord&&) = default;
+
+        /**
+        * @brief
+        *     Initialize the object.
+        */
+        constexpr PortRecord(port_t t_port,
+                             string_view t_proto,
+                             string_view t_service,
+                             string_view t_summary)
+            noexcept
+        {
+            port = t_port;
+            proto = t_proto;
+            service = t_service;
+            summary = t_summary;
+        }
+
+        constexpr ~PortRecord() = default;
+
+    public:  /* Operators */
+        constexpr PortRecord& operator=(const PortRecord&) = default;
+        constexpr PortRecord& operator=(PortRecord&&) = default;
+
+    public:  /* Methods */
+        /**
+        * @brief
+        *     Determine whether the record contains no service details.
+        */
+        constexpr bool empty() const noexcept
+        {
+            return proto.empty() && service.empty() && summary.empty();
+        }
+    };
+}
+
+#endif // !SCAN_PORT_RECORD_H
@@ -20,6 +20,7 @@
 #include "../net_const_defs.h"
 #include "../sockets/endpoint.h"
 #include "../sockets/host_state.h"
+#include "port_record.h"
 
 namespace scan
 {
@@ -29,6 +30,10 @@ namespace scan
     */
     class SvcInfo
     {
+    public:  /* Type Aliases */
+        using cipher_map_t   = map<string, vector<string>>;
+        using response_map_t = map<string, Response<>>;
+
     public:  /* Fields */
         string addr;          // Target address or hostname
         string banner;        // Raw banner data
@@ -39,9 +44,16 @@ namespace scan
         string subject;       // SSL/TLS certificate subject
         string summary;       // Service summary
 
+        vector<string> tls_groups;    // Supported SSL/TLS key exchange groups
+        vector<string> tls_versions;  // Supported SSL/TLS protocol versions
+
+        cipher_map_t tls_ciphers;     // Supported SSL/TLS cipher suites by version
+
         Request<> request;    // HTTP request message
         Response<> response;  // HTTP response message
 
+        response_map_t path_responses;  // HTTP responses by additional request URI
+
     private:  /* Fields */
         HostState m_state;  // Target host state
         port_t m_port;      // Target port number
@@ -65,19 +77,16 @@ namespace scan
     public:  /* Methods */
         /**
         * @brief
-        *     Parse service details from the given CSV record line.
+        *     Parse service details from the given port service database record.
         *     Underlying fields are only updated when they are empty.
         */
-        constexpr void parse_csv_line(const string& t_csv_line)
+        constexpr void parse_record(const PortRecord& t_record)
         {
-            if (!t_csv_line.empty())
+            if (!t_record.empty())
             {
-                const string csv_line{algo::erase(t_csv_line, "\"")};
-                const string_array_t fields{algo::split<4>(csv_line, ",")};
-
-                proto = proto.empty() ? fields[1] : proto;
-                service = service.empty() ? fields[2] : service;
-                summary = summary.empty() ? fields[3] : summary;
+                proto = proto.empty() ? string{t_record.proto} : proto;
+                service = service.empty() ? string{t_record.service} : service;
+                summary = summary.empty() ? string{t_record.summary} : summary;
             }
         }
 
@@ -181,7 +190,7 @@ namespace scan
             return state;
         }
 
-        void parse_banner(const string& t_banner);
+        void parse_banner(string_view t_banner);
         void reset() noexcept;
         void reset(const string& t_addr) noexcept;
 
@@ -194,15 +203,23 @@ namespace scan
         */
         template<size_t N>
             requires(N > 0)
-        constexpr string abbreviate(const string& t_data) const
+        constexpr string abbreviate(string_view t_data) const
         {
-            const string abbrev_data{algo::up_to_first(t_data.substr(0_sz, N), " ")};
-            return t_data.size() > N ? algo::fstr("%...", abbrev_data) : abbrev_data;
+            const string_view prefix{t_data.substr(0_sz, N)};
+            string abbrev_data{prefix.substr(0_sz, prefix.find(' '))};
+
+            if (t_data.size() > N)
+            {
+                abbrev_data += "...";
+            }
+            return abbrev_data;
         }
 
+        string paths_details(bool t_colorize) const;
         string request_details(bool t_colorize) const;
         string response_details(bool t_colorize) const;
         string tls_details(bool t_colorize) const;
+        string tls_enum_details(bool t_colorize) const;
     };
 }
 
@@ -0,0 +1,147 @@
+/*
+* @file
+*     client_pool.h
+* @brief
+*     Header file for a thread-safe TCP socket client object pool.
+*/
+#pragma once
+
+#ifndef SCAN_CLIENT_POOL_H
+#define SCAN_CLIENT_POOL_H
+
+#include <memory>
+#include <utility>
+#include "../../concepts/concepts.h"
+#include "../../console/args.h"
+#include "../../errors/null_ptr_ex.h"
+#include "../../threading/thread_aliases.h"
+#include "../../utils/aliases.h"
+#include "../../utils/literals.h"
+#include "../net_aliases.h"
+#include "tcp_client.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Thread-safe TCP socket client object pool. The pool is filled when it is
+    *     constructed, and released clients are reset and recycled by subsequent
+    *     acquisitions, so new clients are only constructed once the pool capacity
+    *     is exceeded.
+    */
+    template<DerivedFrom<TcpClient> T>
+    class ClientPool
+    {
+    private:  /* Type Aliases */
+        using client_ptr_t = shared_ptr<T>;
+
+    private:  /* Fields */
+        size_t m_created_count;         // Constructed client count
+
+        mutable mutex m_mtx;            // Idle client list mutex
+        atomic_ptr_t<Args> m_args_ap;   // Command-line arguments atomic pointer
+        io_context_t& m_io_ctx;         // Shared I/O context reference
+
+        vector<client_ptr_t> m_clients; // Idle client list
+
+    public:  /* Constructors & Destructor */
+        ClientPool() = delete;
+        ClientPool(const ClientPool&) = delete;
+        ClientPool(ClientPool&&) = delete;
+
+        /**
+        * @brief
+        *     Initialize the object. The given number of idle
+        *     clients are constructed in advance.
+        */
+        ClientPool(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp, size_t t_capacity)
+            : m_io_ctx{t_io_ctx}
+        {
+            m_args_ap = t_argsp;
+            m_created_count = t_capacity;
+
+            m_clients.reserve(t_capacity);
+
+            for (size_t i{0_sz}; i < t_capacity; i++)
+            {
+                m_clients.push_back(std::make_shared<T>(m_io_ctx, t_argsp));
+            }
+        }
+
+        virtual ~ClientPool() = default;
+
+    public:  /* Operators */
+        ClientPool& operator=(const ClientPool&) = delete;
+        ClientPool& operator=(ClientPool&&) = delete;
+
+    public:  /* Methods */
+        void release(client_ptr_t&& t_clientp);
+
+        size_t created() const;
+
+        client_ptr_t acquire();
+    };
+}
+
+/**
+* @brief
+*     Reset the given client and return it to the pool. The client must not be
+*     used by its previous owner after it has been released. Locks the underlying
+*     idle client list mutex.
+*/
+template<scan::DerivedFrom<scan::TcpClient> T>
+inline void scan::ClientPool<T>::release(client_ptr_t&& t_clientp)
+{
+    if (t_clientp == nullptr)
+    {
+        throw NullPtrEx{"t_clientp"};
+    }
+    t_clientp->reset();
+
+    scoped_lock lock{m_mtx};
+    m_clients.push_back(std::move(t_clientp));
+}
+
+/**
+* @brief
+*     Get the number of clients that were constructed by the pool.
+*     Locks the underlying idle client list mutex.
+*/
+template<scan::DerivedFrom<scan::TcpClient> T>
+inline size_t scan::ClientPool<T>::created() const
+{
+    scoped_lock lock{m_mtx};
+    return m_created_count;
+}
+
+/**
+* @brief
+*     Acquire an idle client from the pool, or construct a new client if the
+*     pool capacity is exceeded and no idle clients are available. Locks the underlying idle client list mutex.
+*/
+template<scan::DerivedFrom<scan::TcpClient> T>
+inline typename scan::ClientPool<T>::client_ptr_t scan::ClientPool<T>::acquire()
+{
+    client_ptr_t clientp;
+    {
+        scoped_lock lock{m_mtx};
+
+        if (m_clients.empty())
+        {
+            m_created_count++;
+        }
+        else  // Recycle the most recently released client
+        {
+            clientp = std::move(m_clients.back());
+            m_clients.pop_back();
+        }
+    }
+
+    if (clientp == nullptr)
+    {
+        clientp = std::make_shared<T>(m_io_ctx, m_args_ap.load());
+    }
+    return clientp;
+}
+
+#endif // !SCAN_CLIENT_POOL_H
@@ -39,6 +39,8 @@ namespace scan
         Hostname& operator=(const Hostname&) = default;
         Hostname& operator=(Hostname&&) = default;
 
+        bool operator==(const Hostname&) const = default;
+
         /**
         * @brief
         *     Cast operator overload.
@@ -0,0 +1,116 @@
+/*
+* @file
+*     rate_limiter.h
+* @brief
+*     Header file for a global and per-target connection rate limiter.
+*/
+#pragma once
+
+#ifndef SCAN_RATE_LIMITER_H
+#define SCAN_RATE_LIMITER_H
+
+#include <string>
+#include "../../threading/thread_aliases.h"
+#include "../../utils/aliases.h"
+#include "../../utils/literals.h"
+#include "token_bucket.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Global and per-target connection rate limiter. Connections are paced by
+    *     a global token bucket and a token bucket for each target. The rate of
+    *     each target is decreased multiplicatively when its connection timeouts
+    *     rise above the baseline timeout ratio of the target, and increased
+    *     additively as connections succeed again.
+    */
+    class RateLimiter
+    {
+    private:  /* Constants */
+        static constexpr double BACKOFF_FACTOR = 0.5;     // Rate decrease multiplier
+        static constexpr double BASELINE_GAIN = 1.0 / 64; // Baseline timeout ratio gain
+        static constexpr double BURST_SECONDS = 0.1;      // Burst capacity duration
+        static constexpr double RECOVERY_GAIN = 1.0 / 64; // Rate increase gain
+        static constexpr double TIMEOUT_GAIN = 1.0 / 8;   // Timeout ratio gain
+        static constexpr double TIMEOUT_SPIKE = 0.25;     // Backoff timeout ratio rise
+
+        static constexpr size_t BASELINE_SAMPLES = 16_sz; // Baseline warm-up sample count
+
+        static constexpr milliseconds BACKOFF_INTERVAL = 1000_ms;  // Minimum backoff interval
+
+    private:  /* Types */
+        /**
+        * @brief
+        *     Connection pacing state of a single target.
+        */
+        class TargetState final
+        {
+        public:  /* Fields */
+            double baseline_ratio;             // Baseline connection timeout ratio
+            double timeout_ratio;              // Smoothed connection timeout ratio
+            size_t samples;                    // Connection result sample count
+            TokenBucket bucket;                // Target token bucket
+            steady_time_point_t backoff_time;  // Last rate decrease time
+
+        public:  /* Constructors & Destructor */
+            TargetState() = delete;
+            TargetState(const TargetState&) = default;
+            TargetState(TargetState&&) = default;
+
+            /**
+            * @brief
+            *     Initialize the object.
+            */
+            TargetState(double t_rate, double t_burst) noexcept
+                : bucket{t_rate, t_burst}
+            {
+                baseline_ratio = timeout_ratio = 0.0;
+                samples = 0_sz;
+            }
+
+            virtual ~TargetState() = default;
+
+        public:  /* Operators */
+            TargetState& operator=(const TargetState&) = default;
+            TargetState& operator=(TargetState&&) = default;
+        };
+
+        using state_map_t = map<string, TargetState>;
+
+    private:  /* Fields */
+        double m_max_rate;          // Maximum connection rate (per second)
+        double m_min_rate;          // Minimum connection rate (per second)
+
+        mutex m_mtx;                // Token bucket mutex
+        TokenBucket m_bucket;       // Global token bucket
+        state_map_t m_states;       // Target pacing state map
+
+    public:  /* Constructors & Destructor */
+        RateLimiter() = delete;
+        RateLimiter(const RateLimiter&) = delete;
+        RateLimiter(RateLimiter&&) = delete;
+        RateLimiter(size_t t_max_rate, size_t t_min_rate);
+
+        virtual ~RateLimiter() = default;
+
+    public:  /* Operators */
+        RateLimiter& operator=(const RateLimiter&) = delete;
+        RateLimiter& operator=(RateLimiter&&) = delete;
+
+    public:  /* Methods */
+        void acquire();
+        void update(const string& t_addr, bool t_timed_out);
+
+        microseconds try_acquire(const string& t_addr);
+
+        bool enabled() const noexcept;
+
+    private:  /* Methods */
+        static double burst(double t_rate) noexcept;
+
+        TargetState& target_state(const string& t_addr);
+    };
+}
+
+#endif // !SCAN_RATE_LIMITER_H
@@ -0,0 +1,109 @@
+/*
+* @file
+*     raw_tcp.h
+* @brief
+*     Header file for a raw IPv4 TCP socket protocol.
+*/
+#pragma once
+
+#ifndef SCAN_RAW_TCP_H
+#define SCAN_RAW_TCP_H
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif // _WIN32
+
+#include <boost/asio/basic_raw_socket.hpp>
+#include <boost/asio/ip/basic_endpoint.hpp>
+#include "../net_aliases.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Raw IPv4 TCP socket protocol. Outbound datagrams begin with the
+    *     TCP header, while inbound datagrams begin with the IPv4 header.
+    */
+    class RawTcp
+    {
+    public:  /* Type Aliases */
+        using endpoint = ip::basic_endpoint<RawTcp>;
+        using socket   = asio::basic_raw_socket<RawTcp>;
+
+    private:  /* Fields */
+        int m_family;  // Address family
+
+    public:  /* Constructors & Destructor */
+        RawTcp() = delete;
+        constexpr RawTcp(const RawTcp&) = default;
+        constexpr RawTcp(RawTcp&&) = default;
+
+        virtual constexpr ~RawTcp() = default;
+
+    private:  /* Constructors */
+        /**
+        * @brief
+        *     Initialize the object.
+        */
+        explicit constexpr RawTcp(int t_family) noexcept : m_family{t_family}
+        {
+        }
+
+    public:  /* Operators */
+        constexpr RawTcp& operator=(const RawTcp&) = default;
+        constexpr RawTcp& operator=(RawTcp&&) = default;
+
+        constexpr bool operator==(const RawTcp&) const = default;
+
+    public:  /* Methods */
+        /**
+        * @brief
+        *     Get a raw TCP protocol object for IPv4 addresses.
+        */
+        static constexpr RawTcp v4() noexcept
+        {
+            return RawTcp{AF_INET};
+        }
+
+        /**
+        * @brief
+        *     Get a raw TCP protocol object for IPv6 addresses.
+        */
+        static constexpr RawTcp v6() noexcept
+        {
+            return RawTcp{AF_INET6};
+        }
+
+        /**
+        * @brief
+        *     Get the underlying protocol address family.
+        */
+        constexpr int family() const noexcept
+        {
+            return m_family;
+        }
+
+        /**
+        * @brief
+        *     Get the underlying protocol identifier.
+        */
+        constexpr int protocol() const noexcept
+        {
+            return IPPROTO_TCP;
+        }
+
+        /**
+        * @brief
+        *     Get the underlying socket type.
+        */
+        constexpr int type() const noexcept
+        {
+            return SOCK_RAW;
+        }
+    };
+}
+
+#endif // !SCAN_RAW_TCP_H
@@ -0,0 +1,134 @@
+/*
+* @file
+*     rtt_estimator.h
+* @brief
+*     Header file for a network round-trip time estimator.
+*/
+#pragma once
+
+#ifndef SCAN_RTT_ESTIMATOR_H
+#define SCAN_RTT_ESTIMATOR_H
+
+#include <chrono>
+#include "../../ranges/algo.h"
+#include "../../utils/aliases.h"
+#include "../../utils/literals.h"
+#include "timeout.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Network round-trip time (RTT) estimator. Derives a connection timeout
+    *     from the smoothed RTT and RTT variance, like the TCP retransmission
+    *     timeout described in RFC 6298.
+    */
+    class RttEstimator
+    {
+    private:  /* Constants */
+        static constexpr int VAR_FACTOR = 4;  // RTT variance multiplier
+
+        static constexpr int64_t SRTT_SHIFT = 3;    // Smoothed RTT gain (1/8)
+        static constexpr int64_t RTTVAR_SHIFT = 2;  // RTT variance gain (1/4)
+
+    private:  /* Fields */
+        bool m_sampled;          // At least one RTT was sampled
+
+        microseconds m_min_rtt;  // Minimum RTT
+        microseconds m_rttvar;   // RTT variance
+        microseconds m_srtt;     // Smoothed RTT
+
+        Timeout m_max_timeout;   // Maximum connection timeout
+        Timeout m_min_timeout;   // Minimum connection timeout
+
+    public:  /* Constructors & Destructor */
+        RttEstimator() = delete;
+        constexpr RttEstimator(const RttEstimator&) = default;
+        constexpr RttEstimator(RttEstimator&&) = default;
+
+        /**
+        * @brief
+        *     Initialize the object.
+        */
+        constexpr RttEstimator(const Timeout& t_min_timeout,
+                               const Timeout& t_max_timeout)
+            noexcept
+        {
+            m_sampled = false;
+            m_min_rtt = m_rttvar = m_srtt = microseconds{0};
+
+            m_max_timeout = t_max_timeout;
+            m_min_timeout = t_min_timeout < t_max_timeout ? t_min_timeout : t_max_timeout;
+        }
+
+        virtual constexpr ~RttEstimator() = default;
+
+    public:  /* Operators */
+        constexpr RttEstimator& operator=(const RttEstimator&) = default;
+        constexpr RttEstimator& operator=(RttEstimator&&) = default;
+
+    public:  /* Methods */
+        /**
+        * @brief
+        *     Update the smoothed RTT, RTT variance and minimum RTT using the given RTT sample.
+        */
+        constexpr void update(microseconds t_rtt) noexcept
+        {
+            if (m_sampled)
+            {
+                const microseconds delta{algo::abs((m_srtt - t_rtt).count())};
+
+                m_rttvar += (delta - m_rttvar) / (1_i64 << RTTVAR_SHIFT);
+                m_srtt += (t_rtt - m_srtt) / (1_i64 << SRTT_SHIFT);
+
+                if (t_rtt < m_min_rtt)
+                {
+                    m_min_rtt = t_rtt;
+                }
+            }
+            else  // First RTT sample
+            {
+                m_min_rtt = m_srtt = t_rtt;
+                m_rttvar = t_rtt / 2;
+                m_sampled = true;
+            }
+        }
+
+        /**
+        * @brief
+        *     Get the minimum RTT sample, which is zero until the first RTT sample is recorded.
+        */
+        constexpr microseconds min_rtt() const noexcept
+        {
+            return m_min_rtt;
+        }
+
+        /**
+        * @brief
+        *     Get the connection timeout derived from the current RTT estimates.
+        *     The maximum timeout is used until the first RTT sample is recorded.
+        */
+        constexpr Timeout timeout() const noexcept
+        {
+            Timeout timeout{m_max_timeout};
+
+            if (m_sampled)
+            {
+                const microseconds rto{m_srtt + m_rttvar * VAR_FACTOR};
+                timeout = chrono::ceil<milliseconds>(rto);
+
+                if (timeout < m_min_timeout)
+                {
+                    timeout = m_min_timeout;
+                }
+                else if (timeout > m_max_timeout)
+                {
+                    timeout = m_max_timeout;
+                }
+            }
+            return timeout;
+        }
+    };
+}
+
+#endif // !SCAN_RTT_ESTIMATOR_H
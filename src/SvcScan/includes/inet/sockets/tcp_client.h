@@ -9,11 +9,26 @@
 #ifndef SCAN_TCP_CLIENT_H
 #define SCAN_TCP_CLIENT_H
 
+#include <memory>
+#include <utility>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/co_spawn.hpp>
 #include <boost/asio/detail/socket_option.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/use_future.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/beast/http/error.hpp>
+#include <boost/beast/http/parser.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/write.hpp>
+#include "../../errors/arg_ex.h"
+#include "../../errors/error_const_defs.h"
 #include "../../console/args.h"
-#include "../../resources/text_rc.h"
 #include "../../threading/thread_aliases.h"
 #include "../../utils/aliases.h"
+#include "../../utils/literals.h"
 #include "../http/request.h"
 #include "../http/response.h"
 #include "../net.h"
@@ -28,13 +43,51 @@ namespace scan
 {
     /**
     * @brief
-    *     IPv4 TCP socket client.
+    *     IPv4 TCP socket client. Socket operations are implemented as coroutines,
+    *     which can be awaited within coroutines spawned on the client's strand
+    *     executor. Coroutine operations never block the calling thread, so a single
+    *     I/O context thread can multiplex the socket communications of many clients.
+    *     Blocking socket operations run the coroutine operations on the strand
+    *     executor and wait for their results.
     */
     class TcpClient
     {
     public:  /* Type Aliases */
         using buffer_t = array<char, BUFFER_SIZE>;
 
+    protected:  /* Types */
+        /**
+        * @brief
+        *     Coroutine socket operation deadline state. Only accessed
+        *     by handlers that execute on the client's strand executor.
+        */
+        class Deadline final
+        {
+        public:  /* Fields */
+            bool expired;  // Deadline expired before the operation completed
+            bool pending;  // Guarded operation is still pending
+
+        public:  /* Constructors & Destructor */
+            /**
+            * @brief
+            *     Initialize the object.
+            */
+            Deadline() noexcept
+            {
+                expired = false;
+                pending = true;
+            }
+
+            Deadline(const Deadline&) = delete;
+            Deadline(Deadline&&) = delete;
+
+            virtual ~Deadline() = default;
+
+        public:  /* Operators */
+            Deadline& operator=(const Deadline&) = delete;
+            Deadline& operator=(Deadline&&) = delete;
+        };
+
     protected:  /* Fields */
         bool m_connected;                // Client connected
         bool m_verbose;                  // Verbose output
@@ -42,13 +95,14 @@ namespace scan
         unique_ptr<stream_t> m_streamp;  // TCP stream smart pointer
 
         atomic_ptr_t<Args> m_args_ap;    // Command-line arguments atomic pointer
-        atomic_ptr_t<TextRc> m_rc_ap;    // Embedded CSV resource atomic pointer
 
         Timeout m_timeout;               // Connection timeout
 
         io_context_t& m_io_ctx;          // I/O context reference
         net_error_code_t m_ecode;        // Socket error code
 
+        string m_banner_buffer;          // Reusable service banner buffer
+
         Endpoint m_remote_ep;            // Remote endpoint
         SvcInfo m_svc_info;              // Service information
 
@@ -57,17 +111,29 @@ namespace scan
         TcpClient(const TcpClient&) = delete;
         TcpClient(TcpClient&& t_client) noexcept;
 
-        TcpClient(io_context_t& t_io_ctx,
-                  shared_ptr<Args> t_argsp,
-                  shared_ptr<TextRc> t_rcp);
+        TcpClient(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp);
 
         virtual ~TcpClient();
 
+    protected:  /* Constructors */
+        TcpClient(io_context_t& t_io_ctx,
+                  shared_ptr<Args> t_argsp,
+                  unique_ptr<stream_t>&& t_streamp);
+
     public:  /* Operators */
         TcpClient& operator=(const TcpClient&) = delete;
         TcpClient& operator=(TcpClient&& t_client) noexcept;
 
     public:  /* Methods */
+        /**
+        * @brief
+        *     Set the timeout for subsequent connection attempts.
+        */
+        constexpr void connect_timeout(const Timeout& t_timeout) noexcept
+        {
+            m_timeout = t_timeout;
+        }
+
         /**
         * @brief
         *     Determine whether the underlying TCP socket is connected.
@@ -118,13 +184,19 @@ namespace scan
         virtual void connect(const Endpoint& t_ep);
         virtual void connect(port_t t_port);
         void disconnect();
+        virtual void reconnect();
+        virtual void reset();
         void shutdown();
 
         bool is_open() const noexcept;
 
-        virtual size_t recv(buffer_t& t_buffer);
+        native_socket_t release_socket();
+
+        virtual size_t recv(buffer_t& t_buffer, const Timeout& t_timeout = RECV_TIMEOUT);
         virtual size_t send(const string& t_payload);
 
+        string_view recv_banner(size_t t_max_bytes, const Timeout& t_timeout = RECV_TIMEOUT);
+
         virtual Response<> request(const Request<>& t_request);
         virtual Response<> request(const string& t_host, const string& t_uri = URI_ROOT);
 
@@ -133,6 +205,17 @@ namespace scan
                                    const string& t_uri = URI_ROOT,
                                    const string& t_body = {});
 
+        virtual awaitable_t<> co_connect(Endpoint t_ep);
+
+        virtual awaitable_t<size_t> co_recv_some(buffer_t& t_buffer,
+                                                 Timeout t_timeout = RECV_TIMEOUT);
+
+        virtual awaitable_t<size_t> co_send(string t_payload);
+
+        virtual awaitable_t<Response<>> co_request(Request<> t_request);
+
+        executor_t executor() noexcept;
+
     protected:  /* Methods */
         /**
         * @brief
@@ -166,17 +249,29 @@ namespace scan
             return m_connected && net::timeout_error(t_ecode);
         }
 
-        void async_await();
-        void async_connect(const results_t& t_results);
         void error(const net_error_code_t& t_ecode);
         virtual void on_connect(const net_error_code_t& t_ecode, Endpoint t_ep);
         void parse_argsp(shared_ptr<Args> t_argsp);
         void recv_timeout(const Timeout& t_timeout);
-        void send_timeout(const Timeout& t_timeout);
 
         template<int SockOpt>
         void set_timeout(const Timeout& t_timeout);
 
+        template<class T>
+        T co_wait(awaitable_t<T> t_operation);
+
+        template<class T>
+        awaitable_t<T> co_deadline(awaitable_t<T> t_operation, Timeout t_timeout);
+
+        template<class S>
+        awaitable_t<size_t> co_recv_some(S& t_stream, buffer_t& t_buffer, Timeout t_timeout);
+
+        template<class S>
+        awaitable_t<size_t> co_send(S& t_stream, string t_payload);
+
+        template<class S>
+        awaitable_t<Response<>> co_request(S& t_stream, Request<> t_request);
+
         bool connected_check();
         bool success_check(bool t_allow_eof = true, bool t_allow_partial_msg = true);
 
@@ -184,6 +279,8 @@ namespace scan
                            bool t_allow_eof = true,
                            bool t_allow_partial_msg = true);
 
+        virtual size_t read_some(const mutable_buffer_t& t_buffer);
+
         virtual const stream_t& stream() const noexcept;
         virtual stream_t& stream() noexcept;
 
@@ -205,4 +302,181 @@ inline void scan::TcpClient::set_timeout(const Timeout& t_timeout)
     success_check();
 }
 
+/**
+* @brief
+*     Run the given coroutine socket operation on the client's strand executor and
+*     wait for its result. Exceptions thrown by the operation are rethrown. The
+*     underlying I/O context must be run by another thread, so this method must
+*     never be called from within a coroutine or an asynchronous completion handler.
+*/
+template<class T>
+inline T scan::TcpClient::co_wait(awaitable_t<T> t_operation)
+{
+    return asio::co_spawn(executor(), std::move(t_operation), asio::use_future).get();
+}
+
+/**
+* @brief
+*     Await the given coroutine socket operation, which is canceled if the given
+*     timeout duration elapses before it completes. Canceled operations do not close
+*     the underlying socket, and their error code is replaced by a timeout error.
+*/
+template<class T>
+inline scan::awaitable_t<T> scan::TcpClient::co_deadline(awaitable_t<T> t_operation,
+                                                         Timeout t_timeout)
+{
+    shared_ptr<Deadline> deadlinep{std::make_shared<Deadline>()};
+    steady_timer_t timer{executor(), static_cast<milliseconds>(t_timeout)};
+
+    // The client is only accessed while the operation is pending
+    timer.async_wait([this, deadlinep](const net_error_code_t& l_ecode) -> void
+    {
+        if (!l_ecode && deadlinep->pending)
+        {
+            net_error_code_t discard_ecode;
+
+            deadlinep->expired = true;
+            socket().cancel(discard_ecode);
+        }
+    });
+
+    T result{co_await std::move(t_operation)};
+
+    deadlinep->pending = false;
+    timer.cancel();
+
+    if (deadlinep->expired)
+    {
+        m_ecode = asio::error::timed_out;
+    }
+    co_return result;
+}
+
+/**
+* @brief
+*     Read inbound data from the given socket stream. Waits for data
+*     until the given receive timeout duration has elapsed. The given
+*     buffer must remain valid until the returned coroutine completes.
+*/
+template<class S>
+inline scan::awaitable_t<size_t> scan::TcpClient::co_recv_some(S& t_stream,
+                                                               buffer_t& t_buffer,
+                                                               Timeout t_timeout)
+{
+    size_t bytes_read{0_sz};
+
+    if (connected_check())
+    {
+        const mutable_buffer_t mut_buffer{&t_buffer[0], sizeof t_buffer};
+        auto token{asio::redirect_error(asio::use_awaitable, m_ecode)};
+
+        stream().expires_never();
+        bytes_read = co_await co_deadline(t_stream.async_read_some(mut_buffer, token),
+                                          t_timeout);
+    }
+    co_return bytes_read;
+}
+
+/**
+* @brief
+*     Write the given string payload to the given socket stream.
+*/
+template<class S>
+inline scan::awaitable_t<size_t> scan::TcpClient::co_send(S& t_stream, string t_payload)
+{
+    size_t bytes_sent{0_sz};
+
+    if (connected_check() && !t_payload.empty())
+    {
+        auto token{asio::redirect_error(asio::use_awaitable, m_ecode)};
+
+        stream().expires_never();
+        bytes_sent = co_await co_deadline(asio::async_write(t_stream,
+                                                            asio::buffer(t_payload),
+                                                            token),
+                                          SEND_TIMEOUT);
+    }
+    co_return bytes_sent;
+}
+
+/**
+* @brief
+*     Send the given HTTP request over the given socket stream and return the server's
+*     response. Each write and read operation is bounded by the send or receive timeout.
+*/
+template<class S>
+inline scan::awaitable_t<scan::Response<>> scan::TcpClient::co_request(S& t_stream,
+                                                                      Request<> t_request)
+{
+    if (!t_request.valid())
+    {
+        throw ArgEx{INVALID_REQUEST_MSG, "t_request"};
+    }
+    Response response;
+
+    // Perform HTTP communications
+    if (connected_check())
+    {
+        auto token{asio::redirect_error(asio::use_awaitable, m_ecode)};
+
+        stream().expires_never();
+        co_await co_deadline(http::async_write(t_stream, t_request.message(), token),
+                             SEND_TIMEOUT);
+
+        if (success_check())
+        {
+            http::response_parser<string_body_t> parser;
+            flat_buffer_t& buffer{response.buffer};
+
+            const size_t body_limit{m_args_ap.load()->body_bytes};
+
+            // Responses to HEAD requests never include a body
+            parser.skip(t_request.method() == verb_t::head);
+            parser.body_limit(body_limit);
+
+            size_t bytes_read{co_await co_deadline(http::async_read_header(t_stream,
+                                                                           buffer,
+                                                                           parser,
+                                                                           token),
+                                                   RECV_TIMEOUT)};
+
+            bool truncated{m_ecode == http::error::body_limit};
+
+            // Header was parsed, but the body size exceeds the limit
+            if (truncated)
+            {
+                m_ecode.clear();
+            }
+
+            if (m_ecode != http::error::bad_version && success_check(true, true))
+            {
+                // Read the message body unless only the header is wanted
+                if (!truncated && body_limit > 0_sz)
+                {
+                    do  // Read until end reached or message fully parsed
+                    {
+                        bytes_read = co_await co_deadline(http::async_read(t_stream,
+                                                                           buffer,
+                                                                           parser,
+                                                                           token),
+                                                          RECV_TIMEOUT);
+                    }
+                    while (bytes_read > 0 && net::no_error(m_ecode));
+
+                    truncated = m_ecode == http::error::body_limit;
+
+                    if (truncated)
+                    {
+                        m_ecode.clear();
+                    }
+                }
+
+                response.parse(parser.get());
+                response.truncated(truncated || !parser.is_done());
+            }
+        }
+    }
+    co_return response;
+}
+
 #endif // !SCAN_TCP_CLIENT_H
@@ -11,10 +11,9 @@
 
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/ssl/error.hpp>
-#include <boost/asio/ssl/verify_context.hpp>
 #include <openssl/ssl.h>
 #include "../../console/args.h"
-#include "../../resources/text_rc.h"
+#include "../../threading/thread_aliases.h"
 #include "../../utils/aliases.h"
 #include "../http/request.h"
 #include "../http/response.h"
@@ -30,26 +29,47 @@ namespace scan
 {
     /**
     * @brief
-    *     IPv4 TCP socket client that supports SSL/TLS protocols.
+    *     IPv4 TCP socket client that supports SSL/TLS protocols. All clients
+    *     share process-wide TLS contexts, which are created once per TLS method
+    *     and never modified afterwards, so the system certificate store is only
+    *     loaded once. Sessions negotiated with each remote host are cached
+    *     process-wide by host address and SNI host name, and offered in subsequent
+    *     handshakes with the same host for resumption.
+    *     Existing plaintext TCP connections can also be upgraded to SSL/TLS.
     */
     class TlsClient final : public TcpClient
     {
     private:  /* Type Aliases */
-        using ssl_context_t    = ssl::context;
-        using verify_context_t = ssl::verify_context;
+        using ssl_context_t     = ssl::context;
+        using ssl_context_ptr_t = shared_ptr<ssl_context_t>;
+        using ssl_method_t      = ssl_context_t::method;
+        using context_map_t     = map<ssl_method_t, ssl_context_ptr_t>;
+        using session_ptr_t     = shared_ptr<SSL_SESSION>;
+        using session_map_t     = map<string, session_ptr_t>;
+
+    private:  /* Constants */
+        static constexpr ssl_method_t CLIENT_METHOD = ssl_context_t::tlsv12_client;
 
     private:  /* Fields */
-        unique_ptr<ssl_context_t> m_ssl_ctxp;    // TLS context smart pointer
+        static const int m_ssl_index;            // OpenSSL client pointer data index
+
+        static mutex m_contexts_mtx;             // Shared TLS context map mutex
+        static mutex m_sessions_mtx;             // TLS session cache mutex
+
+        static context_map_t m_contexts;         // Shared TLS context map
+        static session_map_t m_sessions;         // TLS session cache
+
+        ssl_context_ptr_t m_ssl_ctxp;            // Shared TLS context smart pointer
         unique_ptr<ssl_stream_t> m_ssl_streamp;  // TLS stream smart pointer
 
+        string m_server_name;                    // SNI host name
+
     public:  /* Constructors & Destructor */
         TlsClient() = delete;
         TlsClient(const TlsClient&) = delete;
         TlsClient(TlsClient&& t_client) noexcept;
 
-        TlsClient(io_context_t& t_io_ctx,
-                  shared_ptr<Args> t_argsp,
-                  shared_ptr<TextRc> t_rcp);
+        TlsClient(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp);
 
         virtual ~TlsClient();
 
@@ -79,28 +99,41 @@ namespace scan
         }
 
         void close() override;
-        void connect(const Endpoint& t_ep) override;
-        void connect(port_t t_port) override;
+        void reconnect() override;
+        void reset() override;
+        void server_name(const string& t_name);
+        void upgrade(TcpClient& t_client);
 
-        size_t recv(buffer_t& t_buffer) override;
-        size_t send(const string& t_payload) override;
+        bool session_resumed() const;
 
-        Response<> request(const Request<>& t_request) override;
-        Response<> request(const string& t_host, const string& t_uri = URI_ROOT) override;
+        awaitable_t<> co_connect(Endpoint t_ep) override;
+        awaitable_t<net_error_code_t> co_handshake();
 
-        Response<> request(verb_t t_method,
-                           const string& t_host,
-                           const string& t_uri = URI_ROOT,
-                           const string& t_body = {}) override;
+        awaitable_t<size_t> co_recv_some(buffer_t& t_buffer,
+                                         Timeout t_timeout = RECV_TIMEOUT) override;
+
+        awaitable_t<size_t> co_send(string t_payload) override;
+
+        awaitable_t<Response<>> co_request(Request<> t_request) override;
 
     private:  /* Methods */
-        void async_handshake();
+        static int on_new_session(SSL* t_sslp, SSL_SESSION* t_sessionp);
+
+        static ssl_context_ptr_t shared_context(ssl_method_t t_method);
+
+        void bind_callbacks();
+        void mark_shutdown();
         void on_connect(const net_error_code_t& t_ecode, Endpoint t_ep) override;
         void on_handshake(const net_error_code_t& t_ecode);
+        void parse_peer_cert();
+        void recycle_stream();
+        void reset_stream();
+        void resume_session();
 
-        bool on_verify(bool t_preverified, verify_context_t& t_verify_ctx);
         bool valid_handshake() const;
 
+        size_t read_some(const mutable_buffer_t& t_buffer) override;
+
         OSSL_HANDSHAKE_STATE handshake_state() const;
 
         const SSL_CIPHER* cipher_ptr() const;
@@ -108,6 +141,7 @@ namespace scan
         net_error_code_t handshake();
 
         string cipher_suite() const;
+        string session_key() const;
 
         const stream_t& stream() const noexcept override;
         stream_t& stream() noexcept override;
@@ -0,0 +1,234 @@
+/*
+* @file
+*     tls_enumerator.h
+* @brief
+*     Header file for an SSL/TLS network service capability enumerator.
+*/
+#pragma once
+
+#ifndef SCAN_TLS_ENUMERATOR_H
+#define SCAN_TLS_ENUMERATOR_H
+
+#include <boost/asio/ssl/context.hpp>
+#include <boost/asio/strand.hpp>
+#include <openssl/ssl.h>
+#include "../../threading/thread_aliases.h"
+#include "../../utils/aliases.h"
+#include "../net_aliases.h"
+#include "../net_const_defs.h"
+#include "../services/svc_info.h"
+#include "endpoint.h"
+#include "timeout.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     SSL/TLS network service capability enumerator. Enumerates the protocol
+    *     versions, cipher suites and key exchange groups supported by a service
+    *     using concurrent handshake attempts. The number of concurrent handshakes
+    *     to each remote host is limited across all enumerators.
+    */
+    class TlsEnumerator final
+    {
+    private:  /* Type Aliases */
+        using cipher_list_t = vector<const SSL_CIPHER*>;
+        using count_map_t   = map<string, size_t>;
+        using ssl_context_t = ssl::context;
+        using strand_t      = asio::strand<io_context_t::executor_type>;
+        using task_list_t   = vector<awaitable_t<>>;
+
+    private:  /* Types */
+        /**
+        * @brief
+        *     SSL/TLS handshake attempt parameters and results.
+        */
+        class Handshake final
+        {
+        public:  /* Fields */
+            bool accepted;  // Handshake completed successfully
+
+            int group;      // Negotiated key exchange group NID
+            int version;    // Offered protocol version
+
+            uint_t cipher;  // Negotiated cipher suite ID
+
+            string ciphers; // Offered cipher suite list
+            string groups;  // Offered key exchange group list
+            string suite;   // Negotiated cipher suite standard name
+
+        public:  /* Constructors & Destructor */
+            /**
+            * @brief
+            *     Initialize the object.
+            */
+            Handshake(int t_version) noexcept
+            {
+                accepted = false;
+                cipher = 0U;
+                group = NID_undef;
+                version = t_version;
+            }
+
+            Handshake(const Handshake&) = default;
+            Handshake(Handshake&&) = default;
+
+            virtual ~Handshake() = default;
+
+        public:  /* Operators */
+            Handshake& operator=(const Handshake&) = default;
+            Handshake& operator=(Handshake&&) = default;
+        };
+
+        /**
+        * @brief
+        *     Acquired handshake slot guard. Releases the handshake slot of
+        *     the owning enumerator when the guard goes out of scope, even
+        *     if the handshake attempt throws an exception.
+        */
+        class SlotGuard final
+        {
+        private:  /* Fields */
+            TlsEnumerator& m_enumerator;  // Owning enumerator reference
+
+        public:  /* Constructors & Destructor */
+            SlotGuard() = delete;
+            SlotGuard(const SlotGuard&) = delete;
+            SlotGuard(SlotGuard&&) = delete;
+
+            /**
+            * @brief
+            *     Initialize the object.
+            */
+            SlotGuard(TlsEnumerator& t_enumerator) noexcept : m_enumerator{t_enumerator}
+            {
+            }
+
+            /**
+            * @brief
+            *     Destroy the object.
+            */
+            virtual ~SlotGuard()
+            {
+                m_enumerator.release_slot();
+            }
+
+        public:  /* Operators */
+            SlotGuard& operator=(const SlotGuard&) = delete;
+            SlotGuard& operator=(SlotGuard&&) = delete;
+        };
+
+    private:  /* Constants */
+        static constexpr array<int, 4> VERSIONS
+        {
+            TLS1_VERSION,
+            TLS1_1_VERSION,
+            TLS1_2_VERSION,
+            TLS1_3_VERSION
+        };
+
+        static constexpr array<const char*, 10> GROUPS
+        {
+            "X25519",
+            "X448",
+            "P-256",
+            "P-384",
+            "P-521",
+            "ffdhe2048",
+            "ffdhe3072",
+            "ffdhe4096",
+            "ffdhe6144",
+            "ffdhe8192"
+        };
+
+        static constexpr c_string_t CIPHER_LIST = "ALL:COMPLEMENTOFALL";
+
+        static constexpr c_string_t CIPHER_SUITES = "TLS_AES_128_GCM_SHA256:"
+                                                    "TLS_AES_256_GCM_SHA384:"
+                                                    "TLS_CHACHA20_POLY1305_SHA256:"
+                                                    "TLS_AES_128_CCM_SHA256:"
+                                                    "TLS_AES_128_CCM_8_SHA256";
+
+    private:  /* Fields */
+        static mutex m_hosts_mtx;       // Active handshake count map mutex
+        static count_map_t m_hosts;     // Active handshake counts by host
+
+        io_context_t& m_io_ctx;         // I/O context reference
+        strand_t m_strand;              // Handshake coroutine strand
+        net_error_code_t m_ecode;       // Name resolution error code
+
+        Timeout m_timeout;              // Connection timeout
+        Endpoint m_remote_ep;           // Remote endpoint
+        results_t m_results;            // Resolved remote endpoints
+
+        vector<int> m_versions;         // Supported protocol versions
+        vector<string> m_groups;        // Supported key exchange groups
+
+        SvcInfo::cipher_map_t m_ciphers;  // Supported cipher suites by version
+
+    public:  /* Constructors & Destructor */
+        TlsEnumerator() = delete;
+        TlsEnumerator(const TlsEnumerator&) = delete;
+        TlsEnumerator(TlsEnumerator&&) = delete;
+
+        TlsEnumerator(io_context_t& t_io_ctx, const Timeout& t_timeout);
+
+        virtual ~TlsEnumerator() = default;
+
+    public:  /* Operators */
+        TlsEnumerator& operator=(const TlsEnumerator&) = delete;
+        TlsEnumerator& operator=(TlsEnumerator&&) = delete;
+
+    public:  /* Methods */
+        void enumerate(SvcInfo& t_info);
+
+    private:  /* Methods */
+        /**
+        * @brief
+        *     Get the OpenSSL name of the given SSL/TLS protocol version.
+        */
+        static constexpr string version_name(int t_version)
+        {
+            string name;
+
+            switch (t_version)
+            {
+                case TLS1_VERSION:
+                    name = "TLSv1";
+                    break;
+                case TLS1_1_VERSION:
+                    name = "TLSv1.1";
+                    break;
+                case TLS1_2_VERSION:
+                    name = "TLSv1.2";
+                    break;
+                case TLS1_3_VERSION:
+                    name = "TLSv1.3";
+                    break;
+                default:
+                    break;
+            }
+            return name;
+        }
+
+        static ssl_context_t& shared_context();
+
+        static string cipher_list(const cipher_list_t& t_ciphers);
+
+        static cipher_list_t supported_ciphers(int t_version);
+
+        void release_slot();
+        void run(task_list_t&& t_tasks);
+
+        bool acquire_slot();
+
+        awaitable_t<> await_slot();
+        awaitable_t<> probe_ciphers(int t_version);
+        awaitable_t<> probe_group(string t_group, int t_version);
+        awaitable_t<> probe_version(int t_version);
+
+        awaitable_t<Handshake> handshake(Handshake t_handshake);
+    };
+}
+
+#endif // !SCAN_TLS_ENUMERATOR_H
@@ -0,0 +1,140 @@
+/*
+* @file
+*     token_bucket.h
+* @brief
+*     Header file for a token bucket rate limiter.
+*/
+#pragma once
+
+#ifndef SCAN_TOKEN_BUCKET_H
+#define SCAN_TOKEN_BUCKET_H
+
+#include <chrono>
+#include "../../ranges/algo.h"
+#include "../../utils/aliases.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Token bucket rate limiter. Tokens are refilled at a fixed rate up
+    *     to the burst capacity, and reservations may borrow tokens that have
+    *     not yet been refilled, in which case the caller must wait until the
+    *     borrowed tokens are refilled. The bucket is not thread-safe.
+    */
+    class TokenBucket
+    {
+    private:  /* Type Aliases */
+        using seconds_t = chrono::duration<double>;
+
+    private:  /* Fields */
+        double m_burst;                  // Maximum token count
+        double m_rate;                   // Token refill rate (per second)
+        double m_tokens;                 // Available token count
+
+        steady_time_point_t m_last_time; // Last token refill time
+
+    public:  /* Constructors & Destructor */
+        TokenBucket() = delete;
+        TokenBucket(const TokenBucket&) = default;
+        TokenBucket(TokenBucket&&) = default;
+
+        /**
+        * @brief
+        *     Initialize the object.
+        */
+        TokenBucket(double t_rate, double t_burst) noexcept
+        {
+            m_rate = t_rate > 0.0 ? t_rate : 1.0;
+            m_burst = m_tokens = t_burst >= 1.0 ? t_burst : 1.0;
+            m_last_time = steady_clock::now();
+        }
+
+        virtual ~TokenBucket() = default;
+
+    public:  /* Operators */
+        TokenBucket& operator=(const TokenBucket&) = default;
+        TokenBucket& operator=(TokenBucket&&) = default;
+
+    public:  /* Methods */
+        /**
+        * @brief
+        *     Set the token refill rate. Tokens accumulated at the
+        *     previous rate are refilled before the rate is changed.
+        */
+        void rate(double t_rate) noexcept
+        {
+            if (t_rate > 0.0)
+            {
+                refill();
+                m_rate = t_rate;
+            }
+        }
+
+        /**
+        * @brief
+        *     Get the token refill rate.
+        */
+        double rate() const noexcept
+        {
+            return m_rate;
+        }
+
+        /**
+        * @brief
+        *     Reserve a single token. Returns the duration to wait until the
+        *     reserved token is refilled, which is zero if a token was available.
+        */
+        microseconds reserve() noexcept
+        {
+            refill();
+            m_tokens -= 1.0;
+
+            microseconds delay{0};
+
+            if (m_tokens < 0.0)
+            {
+                delay = chrono::ceil<microseconds>(seconds_t{-m_tokens / m_rate});
+            }
+            return delay;
+        }
+
+        /**
+        * @brief
+        *     Reserve a single token only if one is available, without borrowing.
+        *     Returns the duration to wait until a token becomes available, which
+        *     is zero if a token was reserved.
+        */
+        microseconds try_reserve() noexcept
+        {
+            refill();
+            microseconds delay{0};
+
+            if (m_tokens >= 1.0)
+            {
+                m_tokens -= 1.0;
+            }
+            else  // Token is not yet available
+            {
+                delay = chrono::ceil<microseconds>(seconds_t{(1.0 - m_tokens) / m_rate});
+            }
+            return delay;
+        }
+
+    private:  /* Methods */
+        /**
+        * @brief
+        *     Refill the tokens accumulated since the last refill.
+        */
+        void refill() noexcept
+        {
+            const steady_time_point_t now{steady_clock::now()};
+            const seconds_t elapsed{now - m_last_time};
+
+            m_tokens = (algo::min)(m_burst, m_tokens + elapsed.count() * m_rate);
+            m_last_time = now;
+        }
+    };
+}
+
+#endif // !SCAN_TOKEN_BUCKET_H
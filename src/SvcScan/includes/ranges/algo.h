@@ -655,6 +655,21 @@ namespace scan::algo
         return up_to_first(t_data, CRLF, LF);
     }
 
+    /**
+    * @brief
+    *     Get a view of the given string data up to the first EOL substring.
+    */
+    constexpr string_view up_to_first_eol(string_view t_data) noexcept
+    {
+        size_t offset{t_data.find(CRLF)};
+
+        if (is_npos(offset))
+        {
+            offset = t_data.find(LF);
+        }
+        return t_data.substr(0_sz, offset);
+    }
+
     /**
     * @brief
     *     Read the given string data until the last occurrence
@@ -686,6 +701,21 @@ namespace scan::algo
         return up_to_last(t_data, CRLF, LF);
     }
 
+    /**
+    * @brief
+    *     Get a view of the given string data up to the last EOL substring.
+    */
+    constexpr string_view up_to_last_eol(string_view t_data) noexcept
+    {
+        size_t offset{t_data.rfind(CRLF)};
+
+        if (is_npos(offset))
+        {
+            offset = t_data.rfind(LF);
+        }
+        return t_data.substr(0_sz, offset);
+    }
+
     /**
     * @brief
     *     Wrap the given data into lines using the specified line size.
@@ -0,0 +1,6442 @@
+/*
+* @file
+*     port_db.h
+* @brief
+*     Header file for the embedded port service database. Generated
+*     from 'data/ports.csv' by 'tools/svcscan-gendb.ps1', do not edit.
+*/
+#pragma once
+
+#ifndef SCAN_PORT_DB_H
+#define SCAN_PORT_DB_H
+
+#include "../inet/services/port_record.h"
+#include "../utils/aliases.h"
+
+namespace scan
+{
+    /// @brief  Known port service database records (sorted by port number).
+    constexpr array<PortRecord, 6418> PORT_DB
+    {
+        PortRecord{1, "tcp", "tcpmux", "TCP Port Service Multiplexer"},
+        PortRecord{2, "tcp", "compressnet", "Management Utility"},
+        PortRecord{3, "tcp", "compressnet", "Compression Process"},
+        PortRecord{5, "tcp", "rje", "Remote Job Entry"},
+        PortRecord{7, "tcp", "echo", "echo"},
+        PortRecord{9, "tcp", "discard", "sink null"},
+        PortRecord{11, "tcp", "systat", "Active Users"},
+        PortRecord{13, "tcp", "daytime", "daytime"},
+        PortRecord{15, "tcp", "netstat", "netstat"},
+        PortRecord{17, "tcp", "qotd", "Quote of the Day"},
+        PortRecord{18, "tcp", "msp", "msp"},
+        PortRecord{19, "tcp", "chargen", "chargen"},
+        PortRecord{20, "tcp", "ftp-data", "File Transfer Protocol (Data)"},
+        PortRecord{21, "tcp", "ftp", "File Transfer Protocol (Control)"},
+        PortRecord{22, "tcp", "ssh", "Secure Shell Protocol"},
+        PortRecord{23, "tcp", "telnet", "Telnet Server"},
+        PortRecord{24, "tcp", "priv-mail", "Private Mail System"},
+        PortRecord{25, "tcp", "smtp", "Simple Mail Transfer Protocol"},
+        PortRecord{26, "tcp", "rsftp", "RSFTP"},
+        PortRecord{27, "tcp", "nsw-fe", "NSW User System FE"},
+        PortRecord{29, "tcp", "msg-icp", "MSG ICP"},
+        PortRecord{31, "tcp", "msg-auth", "MSG Authentication"},
+        PortRecord{33, "tcp", "dsp", "Display Support Protocol"},
+        PortRecord{35, "tcp", "priv-print", "any private printer server"},
+        PortRecord{37, "tcp", "time", "timeserver"},
+        PortRecord{38, "tcp", "rap", "Route Access Protocol"},
+        PortRecord{39, "tcp", "rlp", "Resource Location Protocol"},
+        PortRecord{41, "tcp", "graphics", "graphics"},
+        PortRecord{42, "tcp", "nameserver", "nameserver"},
+        PortRecord{43, "tcp", "whois", "whois"},
+        PortRecord{44, "tcp", "mpm-flags", "MPM FLAGS Protocol"},
+        PortRecord{45, "tcp", "mpm", "Message Processing Module [recv]"},
+        PortRecord{46, "tcp", "mpm-snd", "MPM [default send]"},
+        PortRecord{47, "tcp", "ni-ftp", "NI File Transfer Protocol"},
+        PortRecord{48, "tcp", "auditd", "Digital Audit Daemon"},
+        PortRecord{49, "tcp", "tacacs", "Login Host Protocol (TACACS)"},
+        PortRecord{50, "tcp", "re-mail-ck", "Remote Mail Checking Protocol"},
+        PortRecord{51, "tcp", "la-maint", "IMP Logical Address Maintenance"},
+        PortRecord{52, "tcp", "xns-time", "XNS Time Protocol"},
+        PortRecord{53, "tcp", "domain", "Domain Name Server"},
+        PortRecord{54, "tcp", "xns-ch", "XNS Clearinghouse"},
+        PortRecord{55, "tcp", "isi-gl", "ISI Graphics Language"},
+        PortRecord{56, "tcp", "xns-auth", "XNS Authentication"},
+        PortRecord{57, "tcp", "priv-term", "any private terminal access"},
+        PortRecord{58, "tcp", "xns-mail", "XNS Mail"},
+        PortRecord{59, "tcp", "priv-file", "any private file service"},
+        PortRecord{61, "tcp", "ni-mail", "NI MAIL"},
+        PortRecord{62, "tcp", "acas", "ACA Services"},
+        PortRecord{63, "tcp", "via-ftp", "File Transfer Protocol"},
+        PortRecord{64, "tcp", "covia", "Communications Integrator (CI)"},
+        PortRecord{65, "tcp", "tacacs-ds", "TACACS-Database Service"},
+        PortRecord{66, "tcp", "sqlnet", "sqlnet"},
+        PortRecord{67, "tcp", "dhcps", "dhcps"},
+        PortRecord{68, "tcp", "dhcpc", "dhcpc"},
+        PortRecord{69, "tcp", "tftp", "Trivial File Transfer"},
+        PortRecord{70, "tcp", "gopher", "gopher"},
+        PortRecord{71, "tcp", "netrjs-1", "Remote Job Service"},
+        PortRecord{72, "tcp", "netrjs-2", "Remote Job Service"},
+        PortRecord{73, "tcp", "netrjs-3", "Remote Job Service"},
+        PortRecord{74, "tcp", "netrjs-4", "Remote Job Service"},
+        PortRecord{75, "tcp", "priv-dial", "any private dial out service"},
+        PortRecord{76, "tcp", "deos", "Distributed External Object Store"},
+        PortRecord{77, "tcp", "priv-rje", "any private RJE service (netrjs)"},
+        PortRecord{78, "tcp", "vettcp", "vettcp"},
+        PortRecord{79, "tcp", "finger", "finger"},
+        PortRecord{80, "tcp", "http", "Hyper Text Transfer Protocol"},
+        PortRecord{81, "tcp", "hosts2-ns", "HOSTS2 Name Server"},
+        PortRecord{82, "tcp", "xfer", "XFER Utility"},
+        PortRecord{83, "tcp", "mit-ml-dev", "MIT ML Device"},
+        PortRecord{84, "tcp", "ctf", "Common Trace Facility"},
+        PortRecord{85, "tcp", "mit-ml-dev", "MIT ML Device"},
+        PortRecord{86, "tcp", "mfcobol", "Micro Focus Cobol"},
+        PortRecord{87, "tcp", "priv-term-l", "any private terminal link (ttylink)"},
+        PortRecord{88, "tcp", "kerberos-sec", "Kerberos"},
+        PortRecord{89, "tcp", "su-mit-tg", "SU/MIT Telnet Gateway"},
+        PortRecord{90, "tcp", "dnsix", "DNSIX Securit Attribute Token Map"},
+        PortRecord{91, "tcp", "mit-dov", "MIT Dover Spooler"},
+        PortRecord{92, "tcp", "npp", "Network Printing Protocol"},
+        PortRecord{93, "tcp", "dcp", "Device Control Protocol"},
+        PortRecord{94, "tcp", "objcall", "Tivoli Object Dispatcher"},
+        PortRecord{95, "tcp", "supdup", "BSD supdupd(8)"},
+        PortRecord{96, "tcp", "dixie", "DIXIE Protocol Specification"},
+        PortRecord{97, "tcp", "swift-rvf", "Swift Remote Virtural File Protocol"},
+        PortRecord{98, "tcp", "linuxconf", "linuxconf"},
+        PortRecord{99, "tcp", "metagram", "Metagram Relay"},
+        PortRecord{100, "tcp", "newacct", "[unauthorized use]"},
+        PortRecord{101, "tcp", "hostname", "hostname"},
+        PortRecord{102, "tcp", "iso-tsap", "iso-tsap"},
+        PortRecord{103, "tcp", "gppitnp", "gppitnp"},
+        PortRecord{104, "tcp", "acr-nema", "ACR-NEMA Digital Imag. & Comm. 300"},
+        PortRecord{105, "tcp", "csnet-ns", "csnet-ns"},
+        PortRecord{106, "tcp", "pop3pw", "pop3pw"},
+        PortRecord{107, "tcp", "rtelnet", "rtelnet"},
+        PortRecord{108, "tcp", "snagas", "SNA Gateway Access Server"},
+        PortRecord{109, "tcp", "pop2", "pop2"},
+        PortRecord{110, "tcp", "pop3", "pop3"},
+        PortRecord{111, "tcp", "rpcbind", "rpcbind"},
+        PortRecord{112, "tcp", "mcidas", "McIDAS Data Transmission Protocol"},
+        PortRecord{113, "tcp", "ident", "ident"},
+        PortRecord{114, "tcp", "audionews", "Audio News Multicast"},
+        PortRecord{115, "tcp", "sftp", "Simple File Transfer Protocol"},
+        PortRecord{116, "tcp", "ansanotify", "ANSA REX Notify"},
+        PortRecord{117, "tcp", "uucp-path", "UUCP Path Service"},
+        PortRecord{118, "tcp", "sqlserv", "SQL Services"},
+        PortRecord{119, "tcp", "nntp", "Network News Transfer Protocol"},
+        PortRecord{120, "tcp", "cfdptkt", "cfdptkt"},
+        PortRecord{121, "tcp", "erpc", "Encore Expedited Remote Pro.Call"},
+        PortRecord{122, "tcp", "smakynet", "smakynet"},
+        PortRecord{123, "tcp", "ntp", "Network Time Protocol"},
+        PortRecord{124, "tcp", "ansatrader", "ANSA REX Trader"},
+        PortRecord{125, "tcp", "locus-map", "Locus PC-Interface Net Map Ser"},
+        PortRecord{126, "tcp", "unitary", "unitary"},
+        PortRecord{127, "tcp", "locus-con", "Locus PC-Interface Conn Server"},
+        PortRecord{128, "tcp", "gss-xlicen", "GSS X License Verification"},
+        PortRecord{129, "tcp", "pwdgen", "Password Generator Protocol"},
+        PortRecord{130, "tcp", "cisco-fna", "Cisco FNATIVE"},
+        PortRecord{131, "tcp", "cisco-tna", "Cisco TNATIVE"},
+        PortRecord{132, "tcp", "cisco-sys", "Cisco SYSMAINT"},
+        PortRecord{133, "tcp", "statsrv", "Statistics Service"},
+        PortRecord{134, "tcp", "ingres-net", "INGRES-NET Service"},
+        PortRecord{135, "tcp", "msrpc", "msrpc"},
+        PortRecord{136, "tcp", "profile", "PROFILE Naming System"},
+        PortRecord{137, "tcp", "netbios-ns", "NETBIOS Name Service"},
+        PortRecord{138, "tcp", "netbios-dgm", "NETBIOS Datagram Service"},
+        PortRecord{139, "tcp", "netbios-ssn", "NETBIOS Session Service"},
+        PortRecord{140, "tcp", "emfis-data", "EMFIS Data Service"},
+        PortRecord{141, "tcp", "emfis-cntl", "EMFIS Control Service"},
+        PortRecord{142, "tcp", "bl-idm", "Britton-Lee IDM"},
+        PortRecord{143, "tcp", "imap", "imap"},
+        PortRecord{144, "tcp", "news", "news"},
+        PortRecord{145, "tcp", "uaac", "UAAC Protocol"},
+        PortRecord{146, "tcp", "iso-tp0", "ISO-IP0"},
+        PortRecord{147, "tcp", "iso-ip", "iso-ip"},
+        PortRecord{148, "tcp", "cronus", "cronus"},
+        PortRecord{149, "tcp", "aed-512", "AED 512 Emulation Service"},
+        PortRecord{150, "tcp", "sql-net", "sql-net"},
+        PortRecord{151, "tcp", "hems", "hems"},
+        PortRecord{152, "tcp", "bftp", "Background File Transfer Program"},
+        PortRecord{153, "tcp", "sgmp", "sgmp"},
+        PortRecord{154, "tcp", "netsc-prod", "NETSC"},
+        PortRecord{155, "tcp", "netsc-dev", "NETSC"},
+        PortRecord{156, "tcp", "sqlsrv", "SQL Service"},
+        PortRecord{157, "tcp", "knet-cmp", "KNET/VM Command/Message Protocol"},
+        PortRecord{158, "tcp", "pcmail-srv", "PCMail Server"},
+        PortRecord{159, "tcp", "nss-routing", "nss-routing"},
+        PortRecord{160, "tcp", "sgmp-traps", "sgmp-traps"},
+        PortRecord{161, "tcp", "snmp", "snmp"},
+        PortRecord{162, "tcp", "snmptrap", "snmp-trap"},
+        PortRecord{163, "tcp", "cmip-man", "CMIP/TCP Manager"},
+        PortRecord{164, "tcp", "cmip-agent", "CMIP/TCP Agent"},
+        PortRecord{165, "tcp", "xns-courier", "Xerox"},
+        PortRecord{166, "tcp", "s-net", "Sirius Systems"},
+        PortRecord{167, "tcp", "namp", "namp"},
+        PortRecord{168, "tcp", "rsvd", "rsvd"},
+        PortRecord{169, "tcp", "send", "send"},
+        PortRecord{170, "tcp", "print-srv", "Network PostScript"},
+        PortRecord{171, "tcp", "multiplex", "Network Innovations Multiplex"},
+        PortRecord{172, "tcp", "cl-1", "cl-1"},
+        PortRecord{173, "tcp", "xyplex-mux", "Xyplex"},
+        PortRecord{174, "tcp", "mailq", "mailq"},
+        PortRecord{175, "tcp", "vmnet", "vmnet"},
+        PortRecord{176, "tcp", "genrad-mux", "genrad-mux"},
+        PortRecord{177, "tcp", "xdmcp", "xdmcp"},
+        PortRecord{178, "tcp", "nextstep", "NextStep Window Server"},
+        PortRecord{179, "tcp", "bgp", "Border Gateway Protocol"},
+        PortRecord{180, "tcp", "ris", "Intergraph"},
+        PortRecord{181, "tcp", "unify", "unify"},
+        PortRecord{182, "tcp", "audit", "Unisys Audit SITP"},
+        PortRecord{183, "tcp", "ocbinder", "ocbinder"},
+        PortRecord{184, "tcp", "ocserver", "ocserver"},
+        PortRecord{185, "tcp", "remote-kis", "remote-kis"},
+        PortRecord{186, "tcp", "kis", "KIS Protocol"},
+        PortRecord{187, "tcp", "aci", "Application Communication Interface"},
+        PortRecord{188, "tcp", "mumps", "Plus Five's MUMPS"},
+        PortRecord{189, "tcp", "qft", "Queued File Transport"},
+        PortRecord{190, "tcp", "gacp", "Gateway Access Control Protocol"},
+        PortRecord{191, "tcp", "prospero", "Prospero Directory Service"},
+        PortRecord{192, "tcp", "osu-nms", "OSU Network Monitoring System"},
+        PortRecord{193, "tcp", "srmp", "Spider Remote Monitoring Protocol"},
+        PortRecord{194, "tcp", "irc", "irc"},
+        PortRecord{195, "tcp", "dn6-nlm-aud", "DNSIX Network Level Module Audit"},
+        PortRecord{196, "tcp", "dn6-smm-red", "DNSIX Session Mgt Module Audit Redir"},
+        PortRecord{197, "tcp", "dls", "Directory Location Service"},
+        PortRecord{198, "tcp", "dls-mon", "Directory Location Service Monitor"},
+        PortRecord{199, "tcp", "smux", "SNMP Unix Multiplexer"},
+        PortRecord{200, "tcp", "src", "IBM System Resource Controller"},
+        PortRecord{201, "tcp", "at-rtmp", "AppleTalk Routing Maintenance"},
+        PortRecord{202, "tcp", "at-nbp", "AppleTalk Name Binding"},
+        PortRecord{203, "tcp", "at-3", "AppleTalk Unused"},
+        PortRecord{204, "tcp", "at-echo", "AppleTalk Echo"},
+        PortRecord{205, "tcp", "at-5", "AppleTalk Unused"},
+        PortRecord{206, "tcp", "at-zis", "AppleTalk Zone Information"},
+        PortRecord{207, "tcp", "at-7", "AppleTalk Unused"},
+        PortRecord{208, "tcp", "at-8", "AppleTalk Unused"},
+        PortRecord{209, "tcp", "tam", "tam"},
+        PortRecord{210, "tcp", "z39.50", "z39.50"},
+        PortRecord{211, "tcp", "914c-g", "914c-g"},
+        PortRecord{212, "tcp", "anet", "ATEXSSTR"},
+        PortRecord{213, "tcp", "ipx", "ipx"},
+        PortRecord{214, "tcp", "vmpwscs", "VM PWSCS"},
+        PortRecord{215, "tcp", "softpc", "Insignia Solutions"},
+        PortRecord{216, "tcp", "atls", "atls"},
+        PortRecord{217, "tcp", "dbase", "dBASE Unix"},
+        PortRecord{218, "tcp", "mpp", "Netix Message Posting Protocol"},
+        PortRecord{219, "tcp", "uarps", "Unisys ARPs"},
+        PortRecord{220, "tcp", "imap3", "Interactive Mail Access Protocol v3"},
+        PortRecord{221, "tcp", "fln-spx", "Berkeley rlogind with SPX auth"},
+        PortRecord{222, "tcp", "rsh-spx", "Berkeley rshd with SPX auth"},
+        PortRecord{223, "tcp", "cdc", "Certificate Distribution Center"},
+        PortRecord{224, "tcp", "masqdialer", "masqdialer"},
+        PortRecord{242, "tcp", "direct", "direct"},
+        PortRecord{243, "tcp", "sur-meas", "Survey Measurement"},
+        PortRecord{244, "tcp", "dayna", "inbusiness"},
+        PortRecord{245, "tcp", "link", "link"},
+        PortRecord{246, "tcp", "dsp3270", "Display Systems Protocol"},
+        PortRecord{247, "tcp", "subntbcst_tftp", "subntbcst-tftp"},
+        PortRecord{248, "tcp", "bhfhs", "bhfhs"},
+        PortRecord{256, "tcp", "fw1-secureremote", "fw1-secureremote"},
+        PortRecord{257, "tcp", "fw1-mc-fwmodule", "fw1-mc-fwmodule"},
+        PortRecord{258, "tcp", "fw1-mc-gui", "also yak winsock personal chat"},
+        PortRecord{259, "tcp", "esro-gen", "esro-gen"},
+        PortRecord{260, "tcp", "openport", "openport"},
+        PortRecord{261, "tcp", "nsiiops", "nsiiops"},
+        PortRecord{262, "tcp", "arcisdms", "arcisdms"},
+        PortRecord{263, "tcp", "hdap", "hdap"},
+        PortRecord{264, "tcp", "bgmp", "bgmp"},
+        PortRecord{265, "tcp", "maybe-fw1", "maybe-fw1"},
+        PortRecord{266, "tcp", "sst", "SCSI on ST"},
+        PortRecord{267, "tcp", "td-service", "Tobit David Service Layer"},
+        PortRecord{268, "tcp", "td-replica", "Tobit David Replica"},
+        PortRecord{269, "tcp", "manet", "MANET Protocols"},
+        PortRecord{270, "tcp", "gist", "Q-mode encapsulation for GIST messages"},
+        PortRecord{271, "tcp", "pt-tls", "IETF Network Endpoint Assessment (NEA) Posture Transport Protocol over TLS (PT-TLS)"},
+        PortRecord{280, "tcp", "http-mgmt", "Hypertext Transfer Protocol [Management]"},
+        PortRecord{281, "tcp", "personal-link", "Personal Link"},
+        PortRecord{282, "tcp", "cableport-ax", "cableport-ax"},
+        PortRecord{283, "tcp", "rescap", "rescap"},
+        PortRecord{284, "tcp", "corerjd", "corerjd"},
+        PortRecord{286, "tcp", "fxp", "FXP Communication"},
+        PortRecord{287, "tcp", "k-block", "k-block"},
+        PortRecord{308, "tcp", "novastorbakcup", "novastorbakcup"},
+        PortRecord{309, "tcp", "entrusttime", "entrusttime"},
+        PortRecord{310, "tcp", "bhmds", "bhmds"},
+        PortRecord{311, "tcp", "asip-webadmin", "asip-webadmin"},
+        PortRecord{312, "tcp", "vslmp", "vslmp"},
+        PortRecord{313, "tcp", "magenta-logic", "Magenta Logic"},
+        PortRecord{314, "tcp", "opalis-robot", "Opalis Robot"},
+        PortRecord{315, "tcp", "dpsi", "dpsi"},
+        PortRecord{316, "tcp", "decauth", "decauth"},
+        PortRecord{317, "tcp", "zannet", "zannet"},
+        PortRecord{318, "tcp", "pkix-timestamp", "PKIX TimeStamp"},
+        PortRecord{319, "tcp", "ptp-event", "PTP Event"},
+        PortRecord{320, "tcp", "ptp-general", "PTP General"},
+        PortRecord{321, "tcp", "pip", "pip"},
+        PortRecord{322, "tcp", "rtsps", "rtsps"},
+        PortRecord{323, "tcp", "rpki-rtr", "Resource PKI to Router Protocol"},
+        PortRecord{324, "tcp", "rpki-rtr-tls", "Resource PKI to Router Protocol over TLS"},
+        PortRecord{333, "tcp", "texar", "Texar Security Port"},
+        PortRecord{344, "tcp", "pdap", "Prospero Data Access Protocol"},
+        PortRecord{345, "tcp", "pawserv", "Perf Analysis Workbench"},
+        PortRecord{346, "tcp", "zserv", "Zebra server"},
+        PortRecord{347, "tcp", "fatserv", "Fatmen Server"},
+        PortRecord{348, "tcp", "csi-sgwp", "Cabletron Management Protocol"},
+        PortRecord{349, "tcp", "mftp", "mftp"},
+        PortRecord{350, "tcp", "matip-type-a", "MATIP Type A"},
+        PortRecord{351, "tcp", "matip-type-b", "matip-type-b"},
+        PortRecord{352, "tcp", "dtag-ste-sb", "dtag-ste-sb"},
+        PortRecord{353, "tcp", "ndsauth", "ndsauth"},
+        PortRecord{354, "tcp", "bh611", "bh611"},
+        PortRecord{355, "tcp", "datex-asn", "datex-asn"},
+        PortRecord{356, "tcp", "cloanto-net-1", "Cloanto Net 1"},
+        PortRecord{357, "tcp", "bhevent", "bhevent"},
+        PortRecord{358, "tcp", "shrinkwrap", "shrinkwrap"},
+        PortRecord{359, "tcp", "tenebris_nts", "tenebris_nts"},
+        PortRecord{360, "tcp", "scoi2odialog", "scoi2odialog"},
+        PortRecord{361, "tcp", "semantix", "semantix"},
+        PortRecord{362, "tcp", "srssend", "SRS Send"},
+        PortRecord{363, "tcp", "rsvp_tunnel", "rsvp_tunnel"},
+        PortRecord{364, "tcp", "aurora-cmgr", "Aurora CMGR"},
+        PortRecord{365, "tcp", "dtk", "Deception Tool Kit (www.all.net)"},
+        PortRecord{366, "tcp", "odmr", "odmr"},
+        PortRecord{367, "tcp", "mortgageware", "mortgageware"},
+        PortRecord{368, "tcp", "qbikgdp", "qbikgdp"},
+        PortRecord{369, "tcp", "rpc2portmap", "rpc2portmap"},
+        PortRecord{370, "tcp", "codaauth2", "codaauth2"},
+        PortRecord{371, "tcp", "clearcase", "clearcase"},
+        PortRecord{372, "tcp", "ulistserv", "ulistserv"},
+        PortRecord{373, "tcp", "legent-1", "legent-1"},
+        PortRecord{374, "tcp", "legent-2", "legent-2"},
+        PortRecord{375, "tcp", "hassle", "hassle"},
+        PortRecord{376, "tcp", "nip", "Amiga Envoy Network Inquiry Proto"},
+        PortRecord{377, "tcp", "tnETOS", "NEC Corporation"},
+        PortRecord{378, "tcp", "dsETOS", "NEC Corporation"},
+        PortRecord{379, "tcp", "is99c", "TIA/EIA/IS-99 modem client"},
+        PortRecord{380, "tcp", "is99s", "TIA/EIA/IS-99 modem server"},
+        PortRecord{381, "tcp", "hp-collector", "hp performance data collector"},
+        PortRecord{382, "tcp", "hp-managed-node", "hp performance data managed node"},
+        PortRecord{383, "tcp", "hp-alarm-mgr", "hp performance data alarm manager"},
+        PortRecord{384, "tcp", "arns", "A Remote Network Server System"},
+        PortRecord{385, "tcp", "ibm-app", "IBM Application"},
+        PortRecord{386, "tcp", "asa", "ASA Message Router Object Def."},
+        PortRecord{387, "tcp", "aurp", "Appletalk Update-Based Routing Pro."},
+        PortRecord{388, "tcp", "unidata-ldm", "unidata-ldm"},
+        PortRecord{389, "tcp", "ldap", "Lightweight Directory Access Protocol"},
+        PortRecord{390, "tcp", "uis", "uis"},
+        PortRecord{391, "tcp", "synotics-relay", "SynOptics SNMP Relay Port"},
+        PortRecord{392, "tcp", "synotics-broker", "SynOptics Port Broker Port"},
+        PortRecord{393, "tcp", "dis", "dis"},
+        PortRecord{394, "tcp", "embl-ndt", "EMBL Nucleic Data Transfer"},
+        PortRecord{395, "tcp", "netcp", "netcp"},
+        PortRecord{396, "tcp", "netware-ip", "Novell Netware over IP"},
+        PortRecord{397, "tcp", "mptn", "Multi Protocol Trans. Net."},
+        PortRecord{398, "tcp", "kryptolan", "kryptolan"},
+        PortRecord{399, "tcp", "iso-tsap-c2", "iso-tsap-c2"},
+        PortRecord{400, "tcp", "work-sol", "work-sol"},
+        PortRecord{401, "tcp", "ups", "Uninterruptible Power Supply"},
+        PortRecord{402, "tcp", "genie", "Genie Protocol"},
+        PortRecord{403, "tcp", "decap", "decap"},
+        PortRecord{404, "tcp", "nced", "nced"},
+        PortRecord{405, "tcp", "ncld", "ncld"},
+        PortRecord{406, "tcp", "imsp", "Interactive Mail Support Protocol"},
+        PortRecord{407, "tcp", "timbuktu", "timbuktu"},
+        PortRecord{408, "tcp", "prm-sm", "Prospero Resource Manager Sys. Man."},
+        PortRecord{409, "tcp", "prm-nm", "Prospero Resource Manager Node Man."},
+        PortRecord{410, "tcp", "decladebug", "DECLadebug Remote Debug Protocol"},
+        PortRecord{411, "tcp", "rmt", "Remote MT Protocol"},
+        PortRecord{412, "tcp", "synoptics-trap", "Trap Convention Port"},
+        PortRecord{413, "tcp", "smsp", "Storage Management Services Protocol"},
+        PortRecord{414, "tcp", "infoseek", "infoseek"},
+        PortRecord{415, "tcp", "bnet", "bnet"},
+        PortRecord{416, "tcp", "silverplatter", "silverplatter"},
+        PortRecord{417, "tcp", "onmux", "Meeting maker"},
+        PortRecord{418, "tcp", "hyper-g", "hyper-g"},
+        PortRecord{419, "tcp", "ariel1", "Ariel 1"},
+        PortRecord{420, "tcp", "smpte", "smpte"},
+        PortRecord{421, "tcp", "ariel2", "Ariel 2"},
+        PortRecord{422, "tcp", "ariel3", "Ariel 3"},
+        PortRecord{423, "tcp", "opc-job-start", "IBM Operations Planning and Control Start"},
+        PortRecord{424, "tcp", "opc-job-track", "IBM Operations Planning and Control Track"},
+        PortRecord{425, "tcp", "icad-el", "ICAD"},
+        PortRecord{426, "tcp", "smartsdp", "smartsdp"},
+        PortRecord{427, "tcp", "svrloc", "Server Location"},
+        PortRecord{428, "tcp", "ocs_cmu", "ocs-cmu"},
+        PortRecord{429, "tcp", "ocs_amu", "ocs-amu"},
+        PortRecord{430, "tcp", "utmpsd", "utmpsd"},
+        PortRecord{431, "tcp", "utmpcd", "utmpcd"},
+        PortRecord{432, "tcp", "iasd", "iasd"},
+        PortRecord{433, "tcp", "nnsp", "nnsp"},
+        PortRecord{434, "tcp", "mobileip-agent", "mobileip-agent"},
+        PortRecord{435, "tcp", "mobilip-mn", "mobilip-mn"},
+        PortRecord{436, "tcp", "dna-cml", "dna-cml"},
+        PortRecord{437, "tcp", "comscm", "comscm"},
+        PortRecord{438, "tcp", "dsfgw", "dsfgw"},
+        PortRecord{439, "tcp", "dasp", "dasp"},
+        PortRecord{440, "tcp", "sgcp", "sgcp"},
+        PortRecord{441, "tcp", "decvms-sysmgt", "decvms-sysmgt"},
+        PortRecord{442, "tcp", "cvc_hostd", "cvc-hostd"},
+        PortRecord{443, "tcp", "https", "Hypertext Transfer Protocol Secure"},
+        PortRecord{444, "tcp", "snpp", "Simple Network Paging Protocol"},
+        PortRecord{445, "tcp", "microsoft-ds", "SMB directly over IP"},
+        PortRecord{446, "tcp", "ddm-rdb", "DDM-Remote Relational Database Access"},
+        PortRecord{447, "tcp", "ddm-dfm", "DDM-Distributed File Management"},
+        PortRecord{448, "tcp", "ddm-ssl", "ddm-ssl"},
+        PortRecord{449, "tcp", "as-servermap", "AS Server Mapper"},
+        PortRecord{450, "tcp", "tserver", "Computer Supported Telecomunication Applications"},
+        PortRecord{451, "tcp", "sfs-smp-net", "Cray Network Semaphore server"},
+        PortRecord{452, "tcp", "sfs-config", "Cray SFS config server"},
+        PortRecord{453, "tcp", "creativeserver", "creativeserver"},
+        PortRecord{454, "tcp", "contentserver", "contentserver"},
+        PortRecord{455, "tcp", "creativepartnr", "creativepartnr"},
+        PortRecord{456, "tcp", "macon", "macon"},
+        PortRecord{457, "tcp", "scohelp", "scohelp"},
+        PortRecord{458, "tcp", "appleqtc", "apple quick time"},
+        PortRecord{459, "tcp", "ampr-rcmd", "ampr-rcmd"},
+        PortRecord{460, "tcp", "skronk", "skronk"},
+        PortRecord{461, "tcp", "datasurfsrv", "DataRampSrv"},
+        PortRecord{462, "tcp", "datasurfsrvsec", "DataRampSrvSec"},
+        PortRecord{463, "tcp", "alpes", "alpes"},
+        PortRecord{464, "tcp", "kpasswd5", "kpasswd5"},
+        PortRecord{465, "tcp", "smtps", "smtps"},
+        PortRecord{466, "tcp", "digital-vrc", "digital-vrc"},
+        PortRecord{467, "tcp", "mylex-mapd", "mylex-mapd"},
+        PortRecord{468, "tcp", "photuris", "photuris"},
+        PortRecord{469, "tcp", "rcp", "Radio Control Protocol"},
+        PortRecord{470, "tcp", "scx-proxy", "scx-proxy"},
+        PortRecord{471, "tcp", "mondex", "mondex"},
+        PortRecord{472, "tcp", "ljk-login", "ljk-login"},
+        PortRecord{473, "tcp", "hybrid-pop", "hybrid-pop"},
+        PortRecord{474, "tcp", "tn-tl-w1", "tn-tl-w2"},
+        PortRecord{475, "tcp", "tcpnethaspsrv", "tcpnethaspsrv"},
+        PortRecord{476, "tcp", "tn-tl-fd1", "tn-tl-fd1"},
+        PortRecord{477, "tcp", "ss7ns", "ss7ns"},
+        PortRecord{478, "tcp", "spsc", "spsc"},
+        PortRecord{479, "tcp", "iafserver", "iafserver"},
+        PortRecord{480, "tcp", "loadsrv", "iafdbase"},
+        PortRecord{481, "tcp", "dvs", "dvs"},
+        PortRecord{482, "tcp", "bgs-nsi", "bgs-nsi"},
+        PortRecord{483, "tcp", "ulpnet", "ulpnet"},
+        PortRecord{484, "tcp", "integra-sme", "Integra Software Management Environment"},
+        PortRecord{485, "tcp", "powerburst", "Air Soft Power Burst"},
+        PortRecord{486, "tcp", "sstats", "avian"},
+        PortRecord{487, "tcp", "saft", "saft Simple Asynchronous File Transfer"},
+        PortRecord{488, "tcp", "gss-http", "gss-http"},
+        PortRecord{489, "tcp", "nest-protocol", "nest-protocol"},
+        PortRecord{490, "tcp", "micom-pfs", "micom-pfs"},
+        PortRecord{491, "tcp", "go-login", "go-login"},
+        PortRecord{492, "tcp", "ticf-1", "Transport Independent Convergence for FNA"},
+        PortRecord{493, "tcp", "ticf-2", "Transport Independent Convergence for FNA"},
+        PortRecord{494, "tcp", "pov-ray", "pov-ray"},
+        PortRecord{495, "tcp", "intecourier", "intecourier"},
+        PortRecord{496, "tcp", "pim-rp-disc", "pim-rp-disc"},
+        PortRecord{497, "tcp", "retrospect", "Retrospect backup and restore service"},
+        PortRecord{498, "tcp", "siam", "siam"},
+        PortRecord{499, "tcp", "iso-ill", "ISO ILL Protocol"},
+        PortRecord{500, "tcp", "isakmp", "isakmp"},
+        PortRecord{501, "tcp", "stmf", "stmf"},
+        PortRecord{502, "tcp", "mbap", "Modbus Application Protocol"},
+        PortRecord{503, "tcp", "intrinsa", "intrinsa"},
+        PortRecord{504, "tcp", "citadel", "citadel"},
+        PortRecord{505, "tcp", "mailbox-lm", "mailbox-lm"},
+        PortRecord{506, "tcp", "ohimsrv", "ohimsrv"},
+        PortRecord{507, "tcp", "crs", "crs"},
+        PortRecord{508, "tcp", "xvttp", "xvttp"},
+        PortRecord{509, "tcp", "snare", "snare"},
+        PortRecord{510, "tcp", "fcp", "FirstClass Protocol"},
+        PortRecord{511, "tcp", "passgo", "passgo"},
+        PortRecord{512, "tcp", "exec", "exec"},
+        PortRecord{513, "tcp", "login", "login"},
+        PortRecord{514, "tcp", "shell", "shell"},
+        PortRecord{515, "tcp", "printer", "printer"},
+        PortRecord{516, "tcp", "videotex", "videotex"},
+        PortRecord{517, "tcp", "talk", "talk"},
+        PortRecord{518, "tcp", "ntalk", "(talkd)"},
+        PortRecord{519, "tcp", "utime", "unixtime"},
+        PortRecord{520, "tcp", "efs", "efs"},
+        PortRecord{521, "tcp", "ripng", "ripng"},
+        PortRecord{522, "tcp", "ulp", "ulp"},
+        PortRecord{523, "tcp", "ibm-db2", "ibm-db2"},
+        PortRecord{524, "tcp", "ncp", "ncp"},
+        PortRecord{525, "tcp", "timed", "timeserver"},
+        PortRecord{526, "tcp", "tempo", "newdate"},
+        PortRecord{527, "tcp", "stx", "Stock IXChange"},
+        PortRecord{528, "tcp", "custix", "Customer IXChange"},
+        PortRecord{529, "tcp", "irc", "irc"},
+        PortRecord{530, "tcp", "courier", "rpc"},
+        PortRecord{531, "tcp", "conference", "chat"},
+        PortRecord{532, "tcp", "netnews", "readnews"},
+        PortRecord{533, "tcp", "netwall", "for emergency broadcasts"},
+        PortRecord{534, "tcp", "mm-admin", "mm-admin"},
+        PortRecord{535, "tcp", "iiop", "iiop"},
+        PortRecord{536, "tcp", "opalis-rdv", "opalis-rdv"},
+        PortRecord{537, "tcp", "nmsp", "Networked Media Streaming Protocol"},
+        PortRecord{538, "tcp", "gdomap", "gdomap"},
+        PortRecord{539, "tcp", "apertus-ldp", "Apertus Technologies Load Determination"},
+        PortRecord{540, "tcp", "uucp", "uucpd"},
+        PortRecord{541, "tcp", "uucp-rlogin", "uucp-rlogin"},
+        PortRecord{542, "tcp", "commerce", "commerce"},
+        PortRecord{543, "tcp", "klogin", "Kerberos (v4/v5)"},
+        PortRecord{544, "tcp", "kshell", "kshell"},
+        PortRecord{545, "tcp", "ekshell", "ekshell"},
+        PortRecord{546, "tcp", "dhcpv6-client", "DHCPv6 Client"},
+        PortRecord{547, "tcp", "dhcpv6-server", "DHCPv6 Server"},
+        PortRecord{548, "tcp", "afp", "afp"},
+        PortRecord{549, "tcp", "idfp", "idfp"},
+        PortRecord{550, "tcp", "new-rwho", "new-who"},
+        PortRecord{551, "tcp", "cybercash", "cybercash"},
+        PortRecord{552, "tcp", "deviceshare", "devshr-nts"},
+        PortRecord{553, "tcp", "pirp", "pirp"},
+        PortRecord{554, "tcp", "rtsp", "rtsp"},
+        PortRecord{555, "tcp", "dsf", "dsf"},
+        PortRecord{556, "tcp", "remotefs", "remotefs"},
+        PortRecord{557, "tcp", "openvms-sysipc", "openvms-sysipc"},
+        PortRecord{558, "tcp", "sdnskmp", "sdnskmp"},
+        PortRecord{559, "tcp", "teedtap", "teedtap"},
+        PortRecord{560, "tcp", "rmonitor", "rmonitord"},
+        PortRecord{561, "tcp", "monitor", "monitor"},
+        PortRecord{562, "tcp", "chshell", "chcmd"},
+        PortRecord{563, "tcp", "snews", "snews"},
+        PortRecord{564, "tcp", "9pfs", "plan 9 file service"},
+        PortRecord{565, "tcp", "whoami", "whoami"},
+        PortRecord{566, "tcp", "streettalk", "streettalk"},
+        PortRecord{567, "tcp", "banyan-rpc", "banyan-rpc"},
+        PortRecord{568, "tcp", "ms-shuttle", "ms-shuttle"},
+        PortRecord{569, "tcp", "ms-rome", "ms-rome"},
+        PortRecord{570, "tcp", "meter", "demon"},
+        PortRecord{571, "tcp", "umeter", "umeter"},
+        PortRecord{572, "tcp", "sonar", "sonar"},
+        PortRecord{573, "tcp", "banyan-vip", "banyan-vip"},
+        PortRecord{574, "tcp", "ftp-agent", "File Transfer Protocol - Software Agent System"},
+        PortRecord{575, "tcp", "vemmi", "vemmi"},
+        PortRecord{576, "tcp", "ipcd", "ipcd"},
+        PortRecord{577, "tcp", "vnas", "vnas"},
+        PortRecord{578, "tcp", "ipdd", "ipdd"},
+        PortRecord{579, "tcp", "decbsrv", "decbsrv"},
+        PortRecord{580, "tcp", "sntp-heartbeat", "SNTP HEARTBEAT"},
+        PortRecord{581, "tcp", "bdp", "Bundle Discovery Protocol"},
+        PortRecord{582, "tcp", "scc-security", "SCC Security"},
+        PortRecord{583, "tcp", "philips-vc", "Philips Video-Conferencing"},
+        PortRecord{584, "tcp", "keyserver", "Key Server"},
+        PortRecord{585, "tcp", "imap4-ssl", "IMAP4+SSL (use of 585 not recommended)"},
+        PortRecord{586, "tcp", "password-chg", "Password Change"},
+        PortRecord{587, "tcp", "submission", "Message Submission"},
+        PortRecord{588, "tcp", "cal", "cal"},
+        PortRecord{589, "tcp", "eyelink", "eyelink"},
+        PortRecord{590, "tcp", "tns-cml", "TNS CML"},
+        PortRecord{591, "tcp", "http-alt", "Hypertext Transfer Protocol (Alternate)"},
+        PortRecord{592, "tcp", "eudora-set", "Eudora Set"},
+        PortRecord{593, "tcp", "http-rpc-epmap", "Hypertext Transfer Protocol RPC Ep Map"},
+        PortRecord{594, "tcp", "tpip", "tpip"},
+        PortRecord{595, "tcp", "cab-protocol", "CAB Protocol"},
+        PortRecord{596, "tcp", "smsd", "smsd"},
+        PortRecord{597, "tcp", "ptcnameservice", "PTC Name Service"},
+        PortRecord{598, "tcp", "sco-websrvrmg3", "SCO Web Server Manager 3"},
+        PortRecord{599, "tcp", "acp", "Aeolon Core Protocol"},
+        PortRecord{600, "tcp", "ipcserver", "Sun IPC server"},
+        PortRecord{601, "tcp", "syslog-conn", "Reliable Syslog Service"},
+        PortRecord{602, "tcp", "xmlrpc-beep", "XML-RPC over BEEP"},
+        PortRecord{603, "tcp", "mnotes", "mnotes"},
+        PortRecord{604, "tcp", "tunnel", "tunnel"},
+        PortRecord{605, "tcp", "soap-beep", "SOAP over BEEP"},
+        PortRecord{606, "tcp", "urm", "Cray Unified Resource Manager"},
+        PortRecord{607, "tcp", "nqs", "nqs"},
+        PortRecord{608, "tcp", "sift-uft", "Sender-Initiated/Unsolicited File Transfer"},
+        PortRecord{609, "tcp", "npmp-trap", "npmp-trap"},
+        PortRecord{610, "tcp", "npmp-local", "npmp-local"},
+        PortRecord{611, "tcp", "npmp-gui", "npmp-gui"},
+        PortRecord{612, "tcp", "hmmp-ind", "HMMP Indication"},
+        PortRecord{613, "tcp", "hmmp-op", "HMMP Operation"},
+        PortRecord{614, "tcp", "sshell", "SSL Shell"},
+        PortRecord{615, "tcp", "sco-inetmgr", "Internet Configuration Manager"},
+        PortRecord{616, "tcp", "sco-sysmgr", "SCO System Administration Server"},
+        PortRecord{617, "tcp", "sco-dtmgr", "sco-dtmgr"},
+        PortRecord{618, "tcp", "dei-icda", "dei-icda"},
+        PortRecord{619, "tcp", "compaq-evm", "Compaq EVM"},
+        PortRecord{620, "tcp", "sco-websrvrmgr", "SCO WebServer Manager"},
+        PortRecord{621, "tcp", "escp-ip", "ESCP"},
+        PortRecord{622, "tcp", "collaborator", "collaborator"},
+        PortRecord{623, "tcp", "oob-ws-http", "oob-ws-http"},
+        PortRecord{624, "tcp", "cryptoadmin", "Crypto Admin"},
+        PortRecord{625, "tcp", "apple-xsrvr-admin", "apple-xsrvr-admin"},
+        PortRecord{626, "tcp", "apple-imap-admin", "apple-imap-admin"},
+        PortRecord{627, "tcp", "passgo-tivoli", "PassGo Tivoli"},
+        PortRecord{628, "tcp", "qmqp", "Qmail Quick Mail Queueing"},
+        PortRecord{629, "tcp", "3com-amp3", "3Com AMP3"},
+        PortRecord{630, "tcp", "rda", "rda"},
+        PortRecord{631, "tcp", "ipp", "ipp"},
+        PortRecord{632, "tcp", "bmpp", "bmpp"},
+        PortRecord{633, "tcp", "servstat", "Service Status update (Sterling Software)"},
+        PortRecord{634, "tcp", "ginad", "ginad"},
+        PortRecord{635, "tcp", "rlzdbase", "RLZ DBase"},
+        PortRecord{636, "tcp", "ldapssl", "ldapssl"},
+        PortRecord{637, "tcp", "lanserver", "lanserver"},
+        PortRecord{638, "tcp", "mcns-sec", "mcns-sec"},
+        PortRecord{639, "tcp", "msdp", "msdp"},
+        PortRecord{640, "tcp", "entrust-sps", "entrust-sps"},
+        PortRecord{641, "tcp", "repcmd", "repcmd"},
+        PortRecord{642, "tcp", "esro-emsdp", "ESRO-EMSDP V1.3"},
+        PortRecord{643, "tcp", "sanity", "sanity"},
+        PortRecord{644, "tcp", "dwr", "dwr"},
+        PortRecord{645, "tcp", "pssc", "pssc"},
+        PortRecord{646, "tcp", "ldp", "Label Distribution"},
+        PortRecord{647, "tcp", "dhcp-failover", "DHCP Failover"},
+        PortRecord{648, "tcp", "rrp", "Registry Registrar Protocol (RRP)"},
+        PortRecord{649, "tcp", "cadview-3d", "Cadview-3d - streaming 3d models over the internet"},
+        PortRecord{650, "tcp", "obex", "obex"},
+        PortRecord{651, "tcp", "ieee-mms", "IEEE MMS"},
+        PortRecord{652, "tcp", "hello-port", "HELLO_PORT"},
+        PortRecord{653, "tcp", "repscmd", "RepCmd"},
+        PortRecord{654, "tcp", "aodv", "aodv"},
+        PortRecord{655, "tcp", "tinc", "tinc"},
+        PortRecord{656, "tcp", "spmp", "spmp"},
+        PortRecord{657, "tcp", "rmc", "rmc"},
+        PortRecord{658, "tcp", "tenfold", "tenfold"},
+        PortRecord{660, "tcp", "mac-srvr-admin", "MacOS Server Admin"},
+        PortRecord{661, "tcp", "hap", "hap"},
+        PortRecord{662, "tcp", "pftp", "pftp"},
+        PortRecord{663, "tcp", "purenoise", "purenoise"},
+        PortRecord{664, "tcp", "secure-aux-bus", "secure-aux-bus"},
+        PortRecord{665, "tcp", "sun-dr", "Sun DR"},
+        PortRecord{666, "tcp", "doom", "doom"},
+        PortRecord{667, "tcp", "disclose", "campaign contribution disclosures - SDR Technologies"},
+        PortRecord{668, "tcp", "mecomm", "mecomm"},
+        PortRecord{669, "tcp", "meregister", "meregister"},
+        PortRecord{670, "tcp", "vacdsm-sws", "vacdsm-sws"},
+        PortRecord{671, "tcp", "vacdsm-app", "vacdsm-app"},
+        PortRecord{672, "tcp", "vpps-qua", "vpps-qua"},
+        PortRecord{673, "tcp", "cimplex", "cimplex"},
+        PortRecord{674, "tcp", "acap", "ACAP server of Communigate (www.stalker.com)"},
+        PortRecord{675, "tcp", "dctp", "dctp"},
+        PortRecord{676, "tcp", "vpps-via", "VPPS Via"},
+        PortRecord{677, "tcp", "vpp", "Virtual Presence Protocol"},
+        PortRecord{678, "tcp", "ggf-ncp", "GNU Generation Foundation NCP"},
+        PortRecord{679, "tcp", "mrm", "mrm"},
+        PortRecord{680, "tcp", "entrust-aaas", "entrust-aaas"},
+        PortRecord{681, "tcp", "entrust-aams", "entrust-aams"},
+        PortRecord{682, "tcp", "xfr", "xfr"},
+        PortRecord{683, "tcp", "corba-iiop", "CORBA IIOP"},
+        PortRecord{684, "tcp", "corba-iiop-ssl", "CORBA IIOP SSL"},
+        PortRecord{685, "tcp", "mdc-portmapper", "MDC Port Mapper"},
+        PortRecord{686, "tcp", "hcp-wismar", "Hardware Control Protocol Wismar"},
+        PortRecord{687, "tcp", "asipregistry", "asipregistry"},
+        PortRecord{688, "tcp", "realm-rusd", "ApplianceWare managment protocol"},
+        PortRecord{689, "tcp", "nmap", "nmap"},
+        PortRecord{690, "tcp", "vatp", "vatp"},
+        PortRecord{691, "tcp", "resvc", "resvc"},
+        PortRecord{692, "tcp", "hyperwave-isp", "hyperwave-isp"},
+        PortRecord{693, "tcp", "connendp", "almanid Connection Endpoint"},
+        PortRecord{694, "tcp", "ha-cluster", "ha-cluster"},
+        PortRecord{695, "tcp", "ieee-mms-ssl", "ieee-mms-ssl"},
+        PortRecord{696, "tcp", "rushd", "rushd"},
+        PortRecord{697, "tcp", "uuidgen", "uuidgen"},
+        PortRecord{698, "tcp", "olsr", "olsr"},
+        PortRecord{699, "tcp", "accessnetwork", "Access Network"},
+        PortRecord{700, "tcp", "epp", "Extensible Provisioning Protocol"},
+        PortRecord{701, "tcp", "lmp", "Link Management Protocol (LMP)"},
+        PortRecord{702, "tcp", "iris-beep", "IRIS over BEEP"},
+        PortRecord{704, "tcp", "elcsd", "errlog copy/server daemon"},
+        PortRecord{705, "tcp", "agentx", "agentx"},
+        PortRecord{706, "tcp", "silc", "Secure Internet Live Conferencing"},
+        PortRecord{707, "tcp", "borland-dsj", "Borland DSJ"},
+        PortRecord{709, "tcp", "entrustmanager", "entrustmanager"},
+        PortRecord{710, "tcp", "entrust-ash", "Entrust Administration Service Handler"},
+        PortRecord{711, "tcp", "cisco-tdp", "Cisco TDP"},
+        PortRecord{712, "tcp", "tbrpf", "tbrpf"},
+        PortRecord{713, "tcp", "iris-xpc", "IRIS over XPC"},
+        PortRecord{714, "tcp", "iris-xpcs", "IRIS over XPCS"},
+        PortRecord{715, "tcp", "iris-lwz", "iris-lwz"},
+        PortRecord{716, "tcp", "pana", "PANA Messages"},
+        PortRecord{723, "tcp", "omfs", "OpenMosix File System"},
+        PortRecord{729, "tcp", "netviewdm1", "IBM NetView DM/6000 Server/Client"},
+        PortRecord{730, "tcp", "netviewdm2", "IBM NetView DM/6000 send/tcp"},
+        PortRecord{731, "tcp", "netviewdm3", "IBM NetView DM/6000 receive/tcp"},
+        PortRecord{740, "tcp", "netcp", "NETscout Control Protocol"},
+        PortRecord{741, "tcp", "netgw", "netgw"},
+        PortRecord{742, "tcp", "netrcs", "Network based Rev. Cont. Sys."},
+        PortRecord{744, "tcp", "flexlm", "Flexible License Manager"},
+        PortRecord{747, "tcp", "fujitsu-dev", "Fujitsu Device Control"},
+        PortRecord{748, "tcp", "ris-cm", "Russell Info Sci Calendar Manager"},
+        PortRecord{749, "tcp", "kerberos-adm", "kerberos-adm"},
+        PortRecord{750, "tcp", "kerberos", "kerberos"},
+        PortRecord{751, "tcp", "kerberos_master", "kerberos_master"},
+        PortRecord{752, "tcp", "qrh", "qrh"},
+        PortRecord{753, "tcp", "rrh", "rrh"},
+        PortRecord{754, "tcp", "krb_prop", "krb_prop"},
+        PortRecord{758, "tcp", "nlogin", "nlogin"},
+        PortRecord{759, "tcp", "con", "con"},
+        PortRecord{760, "tcp", "krbupdate", "krbupdate"},
+        PortRecord{761, "tcp", "kpasswd", "kpasswd"},
+        PortRecord{762, "tcp", "quotad", "quotad"},
+        PortRecord{763, "tcp", "cycleserv", "cycleserv"},
+        PortRecord{764, "tcp", "omserv", "omserv"},
+        PortRecord{765, "tcp", "webster", "webster"},
+        PortRecord{767, "tcp", "phonebook", "phone"},
+        PortRecord{769, "tcp", "vid", "vid"},
+        PortRecord{770, "tcp", "cadlock", "cadlock"},
+        PortRecord{771, "tcp", "rtip", "rtip"},
+        PortRecord{772, "tcp", "cycleserv2", "cycleserv2"},
+        PortRecord{773, "tcp", "submit", "notify"},
+        PortRecord{774, "tcp", "rpasswd", "rpasswd"},
+        PortRecord{775, "tcp", "entomb", "entomb"},
+        PortRecord{776, "tcp", "wpages", "wpages"},
+        PortRecord{777, "tcp", "multiling-http", "Multiling Hypertext Transfer Protocol"},
+        PortRecord{780, "tcp", "wpgs", "wpgs"},
+        PortRecord{781, "tcp", "hp-collector", "hp performance data collector"},
+        PortRecord{782, "tcp", "hp-managed-node", "hp performance data managed node"},
+        PortRecord{783, "tcp", "spamassassin", "Apache SpamAssassin spamd"},
+        PortRecord{786, "tcp", "concert", "concert"},
+        PortRecord{787, "tcp", "qsc", "qsc"},
+        PortRecord{799, "tcp", "controlit", "Remotely possible"},
+        PortRecord{800, "tcp", "mdbs_daemon", "mdbs-daemon"},
+        PortRecord{801, "tcp", "device", "device"},
+        PortRecord{802, "tcp", "mbap-s", "Modbus Application Protocol Secure"},
+        PortRecord{808, "tcp", "ccproxy-http", "CCProxy HTTP/Gopher/FTP (over HTTP) proxy"},
+        PortRecord{810, "tcp", "fcp-udp", "fcp-udp"},
+        PortRecord{828, "tcp", "itm-mcell-s", "itm-mcell-s"},
+        PortRecord{829, "tcp", "pkix-3-ca-ra", "PKIX-3 CA/RA"},
+        PortRecord{830, "tcp", "netconf-ssh", "NETCONF over SSH"},
+        PortRecord{831, "tcp", "netconf-beep", "NETCONF over BEEP"},
+        PortRecord{832, "tcp", "netconfsoaphttp", "NETCONF for SOAP over HTTPS"},
+        PortRecord{833, "tcp", "netconfsoapbeep", "NETCONF for SOAP over BEEP"},
+        PortRecord{847, "tcp", "dhcp-failover2", "dhcp-failover 2"},
+        PortRecord{848, "tcp", "gdoi", "gdoi"},
+        PortRecord{853, "tcp", "domain-s", "DNS query-response protocol run over TLS/DTLS"},
+        PortRecord{854, "tcp", "dlep", "Dynamic Link Exchange Protocol (DLEP)"},
+        PortRecord{860, "tcp", "iscsi", "iscsi"},
+        PortRecord{861, "tcp", "owamp-control", "owamp-control"},
+        PortRecord{862, "tcp", "twamp-control", "twamp-control"},
+        PortRecord{871, "tcp", "supfilesrv", "SUP server"},
+        PortRecord{873, "tcp", "rsync", "Rsync server"},
+        PortRecord{886, "tcp", "iclcnet-locate", "ICL coNETion locate server"},
+        PortRecord{887, "tcp", "iclcnet_svinfo", "iclcnet_svinfo"},
+        PortRecord{888, "tcp", "accessbuilder", "accessbuilder"},
+        PortRecord{898, "tcp", "sun-manageconsole", "Solaris Management Console Java listener (Solaris 8 & 9)"},
+        PortRecord{900, "tcp", "omginitialrefs", "OMG Initial Refs"},
+        PortRecord{901, "tcp", "samba-swat", "samba-swat"},
+        PortRecord{902, "tcp", "iss-realsecure", "iss-realsecure"},
+        PortRecord{903, "tcp", "iss-console-mgr", "iss-console-mgr"},
+        PortRecord{910, "tcp", "kink", "Kerberized Internet Negotiation of Keys (KINK)"},
+        PortRecord{911, "tcp", "xact-backup", "xact-backup"},
+        PortRecord{912, "tcp", "apex-mesh", "APEX relay-relay service"},
+        PortRecord{913, "tcp", "apex-edge", "APEX endpoint-relay service"},
+        PortRecord{950, "tcp", "oftep-rpc", "Often RPC.statd (on Redhat Linux)"},
+        PortRecord{953, "tcp", "rndc", "rndc"},
+        PortRecord{975, "tcp", "securenetpro-sensor", "securenetpro-sensor"},
+        PortRecord{989, "tcp", "ftps-data", "File Transfer Protocol (Data) over TLS/SSL"},
+        PortRecord{990, "tcp", "ftps", "File Transfer Protocol (Control) over TLS/SSL"},
+        PortRecord{991, "tcp", "nas", "Netnews Administration System"},
+        PortRecord{992, "tcp", "telnets", "Telnet Protocol over TLS/SSL"},
+        PortRecord{993, "tcp", "imaps", "imaps"},
+        PortRecord{994, "tcp", "ircs", "Internet Relay Chat over TLS/SSL"},
+        PortRecord{995, "tcp", "pop3s", "pop3s"},
+        PortRecord{996, "tcp", "xtreelic", "xtreelic"},
+        PortRecord{997, "tcp", "maitrd", "maitrd"},
+        PortRecord{998, "tcp", "busboy", "puparp"},
+        PortRecord{999, "tcp", "garcon", "garcon"},
+        PortRecord{1000, "tcp", "cadlock", "cadlock2"},
+        PortRecord{1001, "tcp", "webpush", "HTTP Web Push"},
+        PortRecord{1002, "tcp", "windows-icfw", "Windows Internet Connection Firewall"},
+        PortRecord{1008, "tcp", "ufsd", "ufsdUFS-aware server"},
+        PortRecord{1010, "tcp", "surf", "surf"},
+        PortRecord{1021, "tcp", "exp1", "exp1"},
+        PortRecord{1022, "tcp", "exp2", "exp2"},
+        PortRecord{1023, "tcp", "netvenuechat", "Nortel NetVenue Chat/Notification/Intercom"},
+        PortRecord{1024, "tcp", "kdm", "K Display Manager (KDE version of xdm)"},
+        PortRecord{1025, "tcp", "NFS-or-IIS", "NFS-or-IIS"},
+        PortRecord{1026, "tcp", "LSA-or-nterm", "LSA-or-nterm"},
+        PortRecord{1027, "tcp", "IIS", "IIS"},
+        PortRecord{1029, "tcp", "ms-lsa", "ms-lsa"},
+        PortRecord{1030, "tcp", "iad1", "BBN IAD"},
+        PortRecord{1031, "tcp", "iad2", "BBN IAD"},
+        PortRecord{1032, "tcp", "iad3", "BBN IAD"},
+        PortRecord{1033, "tcp", "netinfo", "netinfo"},
+        PortRecord{1034, "tcp", "zincite-a", "zincite-a"},
+        PortRecord{1035, "tcp", "multidropper", "multidropper"},
+        PortRecord{1036, "tcp", "nsstp", "Nebula Secure Segment Transfer Protocol"},
+        PortRecord{1037, "tcp", "ams", "ams"},
+        PortRecord{1038, "tcp", "mtqp", "Message Tracking Query Protocol"},
+        PortRecord{1039, "tcp", "sbl", "Streamlined Blackhole"},
+        PortRecord{1040, "tcp", "netsaint", "netsaint"},
+        PortRecord{1041, "tcp", "danf-ak2", "AK2 Product"},
+        PortRecord{1042, "tcp", "afrog", "Subnet Roaming"},
+        PortRecord{1043, "tcp", "boinc", "boinc"},
+        PortRecord{1044, "tcp", "dcutility", "Dev Consortium Utility"},
+        PortRecord{1045, "tcp", "fpitp", "Fingerprint Image Transfer Protocol"},
+        PortRecord{1046, "tcp", "wfremotertm", "WebFilter Remote Monitor"},
+        PortRecord{1047, "tcp", "neod1", "Sun's NEO Object Request Broker"},
+        PortRecord{1048, "tcp", "neod2", "Sun's NEO Object Request Broker"},
+        PortRecord{1049, "tcp", "td-postman", "Tobit David Postman VPMN"},
+        PortRecord{1050, "tcp", "java-or-OTGfileshare", "java-or-OTGfileshare"},
+        PortRecord{1051, "tcp", "optima-vnet", "Optima VNET"},
+        PortRecord{1052, "tcp", "ddt", "ddt"},
+        PortRecord{1053, "tcp", "remote-as", "Remote Assistant (RA)"},
+        PortRecord{1054, "tcp", "brvread", "brvread"},
+        PortRecord{1055, "tcp", "ansyslmd", "ANSYS - License Manager"},
+        PortRecord{1056, "tcp", "vfo", "vfo"},
+        PortRecord{1057, "tcp", "startron", "startron"},
+        PortRecord{1058, "tcp", "nim", "nim"},
+        PortRecord{1059, "tcp", "nimreg", "nimreg"},
+        PortRecord{1060, "tcp", "polestar", "polestar"},
+        PortRecord{1061, "tcp", "kiosk", "kiosk"},
+        PortRecord{1062, "tcp", "veracity", "veracity"},
+        PortRecord{1063, "tcp", "kyoceranetdev", "kyoceranetdev"},
+        PortRecord{1064, "tcp", "jstel", "jstel"},
+        PortRecord{1065, "tcp", "syscomlan", "syscomlan"},
+        PortRecord{1066, "tcp", "fpo-fns", "fpo-fns"},
+        PortRecord{1067, "tcp", "instl_boots", "instl_boots"},
+        PortRecord{1068, "tcp", "instl_bootc", "instl_bootc"},
+        PortRecord{1069, "tcp", "cognex-insight", "cognex-insight"},
+        PortRecord{1070, "tcp", "gmrupdateserv", "gmrupdateserv"},
+        PortRecord{1071, "tcp", "bsquare-voip", "bsquare-voip"},
+        PortRecord{1072, "tcp", "cardax", "cardax"},
+        PortRecord{1073, "tcp", "bridgecontrol", "Bridge Control"},
+        PortRecord{1074, "tcp", "warmspotMgmt", "Warmspot Management Protocol"},
+        PortRecord{1075, "tcp", "rdrmshc", "rdrmshc"},
+        PortRecord{1076, "tcp", "sns_credit", "sns_credit"},
+        PortRecord{1077, "tcp", "imgames", "imgames"},
+        PortRecord{1078, "tcp", "avocent-proxy", "Avocent Proxy Protocol"},
+        PortRecord{1079, "tcp", "asprovatalk", "asprovatalk"},
+        PortRecord{1080, "tcp", "socks", "socks"},
+        PortRecord{1081, "tcp", "pvuniwien", "pvuniwien"},
+        PortRecord{1082, "tcp", "amt-esd-prot", "amt-esd-prot"},
+        PortRecord{1083, "tcp", "ansoft-lm-1", "Anasoft License Manager"},
+        PortRecord{1084, "tcp", "ansoft-lm-2", "Anasoft License Manager"},
+        PortRecord{1085, "tcp", "webobjects", "Web Objects"},
+        PortRecord{1086, "tcp", "cplscrambler-lg", "CPL Scrambler Logging"},
+        PortRecord{1087, "tcp", "cplscrambler-in", "CPL Scrambler Internal"},
+        PortRecord{1088, "tcp", "cplscrambler-al", "CPL Scrambler Alarm Log"},
+        PortRecord{1089, "tcp", "ff-annunc", "FF Annunciation"},
+        PortRecord{1090, "tcp", "ff-fms", "FF Fieldbus Message Specification"},
+        PortRecord{1091, "tcp", "ff-sm", "FF System Management"},
+        PortRecord{1092, "tcp", "obrpd", "Open Business Reporting Protocol"},
+        PortRecord{1093, "tcp", "proofd", "proofd"},
+        PortRecord{1094, "tcp", "rootd", "rootd"},
+        PortRecord{1095, "tcp", "nicelink", "nicelink"},
+        PortRecord{1096, "tcp", "cnrprotocol", "Common Name Resolution Protocol"},
+        PortRecord{1097, "tcp", "sunclustermgr", "Sun Cluster Manager"},
+        PortRecord{1098, "tcp", "rmiactivation", "RMI Activation"},
+        PortRecord{1099, "tcp", "rmiregistry", "RMI Registry"},
+        PortRecord{1100, "tcp", "mctp", "mctp"},
+        PortRecord{1101, "tcp", "pt2-discover", "pt2-discover"},
+        PortRecord{1102, "tcp", "adobeserver-1", "ADOBE SERVER 1"},
+        PortRecord{1103, "tcp", "xaudio", "xaudio"},
+        PortRecord{1104, "tcp", "xrl", "xrl"},
+        PortRecord{1105, "tcp", "ftranhc", "ftranhc"},
+        PortRecord{1106, "tcp", "isoipsigport-1", "isoipsigport-1"},
+        PortRecord{1107, "tcp", "isoipsigport-2", "isoipsigport-2"},
+        PortRecord{1108, "tcp", "ratio-adp", "ratio-adp"},
+        PortRecord{1109, "tcp", "kpop", "Pop with Kerberos"},
+        PortRecord{1110, "tcp", "nfsd-status", "nfsd-status"},
+        PortRecord{1111, "tcp", "lmsocialserver", "LM Social Server"},
+        PortRecord{1112, "tcp", "msql", "msql"},
+        PortRecord{1113, "tcp", "ltp-deepspace", "Licklider Transmission Protocol"},
+        PortRecord{1114, "tcp", "mini-sql", "Mini SQL"},
+        PortRecord{1115, "tcp", "ardus-trns", "ARDUS Transfer"},
+        PortRecord{1116, "tcp", "ardus-cntl", "ARDUS Control"},
+        PortRecord{1117, "tcp", "ardus-mtrns", "ARDUS Multicast Transfer"},
+        PortRecord{1118, "tcp", "sacred", "sacred"},
+        PortRecord{1119, "tcp", "bnetgame", "Battle.net Chat/Game Protocol"},
+        PortRecord{1120, "tcp", "bnetfile", "Battle.net File Transfer Protocol"},
+        PortRecord{1121, "tcp", "rmpp", "Datalode RMPP"},
+        PortRecord{1122, "tcp", "availant-mgr", "availant-mgr"},
+        PortRecord{1123, "tcp", "murray", "murray"},
+        PortRecord{1124, "tcp", "hpvmmcontrol", "HP VMM Control"},
+        PortRecord{1125, "tcp", "hpvmmagent", "HP VMM Agent"},
+        PortRecord{1126, "tcp", "hpvmmdata", "HP VMM Agent"},
+        PortRecord{1127, "tcp", "supfiledbg", "supfiledbg"},
+        PortRecord{1128, "tcp", "saphostctrl", "SAPHostControl over SOAP/HTTP"},
+        PortRecord{1129, "tcp", "saphostctrls", "SAPHostControl over SOAP/HTTPS"},
+        PortRecord{1130, "tcp", "casp", "CAC App Service Protocol"},
+        PortRecord{1131, "tcp", "caspssl", "CAC App Service Protocol Encripted"},
+        PortRecord{1132, "tcp", "kvm-via-ip", "KVM-via-IP Management Service"},
+        PortRecord{1133, "tcp", "dfn", "Data Flow Network"},
+        PortRecord{1134, "tcp", "aplx", "MicroAPL APLX"},
+        PortRecord{1135, "tcp", "omnivision", "OmniVision Communication Service"},
+        PortRecord{1136, "tcp", "hhb-gateway", "HHB Gateway Control"},
+        PortRecord{1137, "tcp", "trim", "TRIM Workgroup Service"},
+        PortRecord{1138, "tcp", "encrypted_admin", "encrypted_admin"},
+        PortRecord{1139, "tcp", "cce3x", "cce3x"},
+        PortRecord{1140, "tcp", "autonoc", "AutoNOC Network Operations Protocol"},
+        PortRecord{1141, "tcp", "mxomss", "User Message Service"},
+        PortRecord{1142, "tcp", "edtools", "User Discovery Service"},
+        PortRecord{1143, "tcp", "imyx", "Infomatryx Exchange"},
+        PortRecord{1144, "tcp", "fuscript", "Fusion Script"},
+        PortRecord{1145, "tcp", "x9-icue", "X9 iCue Show Control"},
+        PortRecord{1146, "tcp", "audit-transfer", "audit transfer"},
+        PortRecord{1147, "tcp", "capioverlan", "capioverlan"},
+        PortRecord{1148, "tcp", "elfiq-repl", "Elfiq Replication Service"},
+        PortRecord{1149, "tcp", "bvtsonar", "bvtsonar"},
+        PortRecord{1150, "tcp", "blaze", "Blaze File Server"},
+        PortRecord{1151, "tcp", "unizensus", "Unizensus Login Server"},
+        PortRecord{1152, "tcp", "winpoplanmess", "Winpopup LAN Messenger"},
+        PortRecord{1153, "tcp", "c1222-acse", "ANSI C12.22 Port"},
+        PortRecord{1154, "tcp", "resacommunity", "Community Service"},
+        PortRecord{1155, "tcp", "nfa", "Network File Access"},
+        PortRecord{1156, "tcp", "iascontrol-oms", "iasControl OMS"},
+        PortRecord{1157, "tcp", "iascontrol", "Oracle iASControl"},
+        PortRecord{1158, "tcp", "lsnr", "lsnr"},
+        PortRecord{1159, "tcp", "oracle-oms", "Oracle OMS"},
+        PortRecord{1160, "tcp", "olsv", "DB Lite Mult-User Server"},
+        PortRecord{1161, "tcp", "health-polling", "Health Polling"},
+        PortRecord{1162, "tcp", "health-trap", "Health Trap"},
+        PortRecord{1163, "tcp", "sddp", "SmartDialer Data Protocol"},
+        PortRecord{1164, "tcp", "qsm-proxy", "QSM Proxy Service"},
+        PortRecord{1165, "tcp", "qsm-gui", "QSM GUI Service"},
+        PortRecord{1166, "tcp", "qsm-remote", "QSM RemoteExec"},
+        PortRecord{1167, "tcp", "cisco-ipsla", "Cisco IP SLAs Control Protocol"},
+        PortRecord{1168, "tcp", "vchat", "VChat Conference Service"},
+        PortRecord{1169, "tcp", "tripwire", "tripwire"},
+        PortRecord{1170, "tcp", "atc-lm", "AT+C License Manager"},
+        PortRecord{1171, "tcp", "atc-appserver", "AT+C FmiApplicationServer"},
+        PortRecord{1172, "tcp", "dnap", "DNA Protocol"},
+        PortRecord{1173, "tcp", "d-cinema-rrp", "D-Cinema Request-Response"},
+        PortRecord{1174, "tcp", "fnet-remote-ui", "FlashNet Remote Admin"},
+        PortRecord{1175, "tcp", "dossier", "Dossier Server"},
+        PortRecord{1176, "tcp", "indigo-server", "Indigo Home Server"},
+        PortRecord{1177, "tcp", "dkmessenger", "DKMessenger Protocol"},
+        PortRecord{1178, "tcp", "skkserv", "skkserv"},
+        PortRecord{1179, "tcp", "b2n", "Backup To Neighbor"},
+        PortRecord{1180, "tcp", "mc-client", "Millicent Client Proxy"},
+        PortRecord{1181, "tcp", "3comnetman", "3Com Net Management"},
+        PortRecord{1182, "tcp", "accelenet", "accelenet"},
+        PortRecord{1183, "tcp", "llsurfup-http", "LL Surfup HTTP"},
+        PortRecord{1184, "tcp", "llsurfup-https", "LL Surfup HTTPS"},
+        PortRecord{1185, "tcp", "catchpole", "Catchpole port"},
+        PortRecord{1186, "tcp", "mysql-cluster", "MySQL Cluster Manager"},
+        PortRecord{1187, "tcp", "alias", "Alias Service"},
+        PortRecord{1188, "tcp", "hp-webadmin", "HP Web Admin"},
+        PortRecord{1189, "tcp", "unet", "Unet Connection"},
+        PortRecord{1190, "tcp", "commlinx-avl", "CommLinx GPS / AVL System"},
+        PortRecord{1191, "tcp", "gpfs", "General Parallel File System"},
+        PortRecord{1192, "tcp", "caids-sensor", "caids sensors channel"},
+        PortRecord{1193, "tcp", "fiveacross", "Five Across Server"},
+        PortRecord{1194, "tcp", "openvpn", "openvpn"},
+        PortRecord{1195, "tcp", "rsf-1", "RSF-1 clustering"},
+        PortRecord{1196, "tcp", "netmagic", "Network Magic"},
+        PortRecord{1197, "tcp", "carrius-rshell", "Carrius Remote Access"},
+        PortRecord{1198, "tcp", "cajo-discovery", "cajo reference discovery"},
+        PortRecord{1199, "tcp", "dmidi", "dmidi"},
+        PortRecord{1200, "tcp", "scol", "scol"},
+        PortRecord{1201, "tcp", "nucleus-sand", "Nucleus Sand Database Server"},
+        PortRecord{1202, "tcp", "caiccipc", "caiccipc"},
+        PortRecord{1203, "tcp", "ssslic-mgr", "License Validation"},
+        PortRecord{1204, "tcp", "ssslog-mgr", "Log Request Listener"},
+        PortRecord{1205, "tcp", "accord-mgc", "accord-mgc"},
+        PortRecord{1206, "tcp", "anthony-data", "Anthony Data"},
+        PortRecord{1207, "tcp", "metasage", "metasage"},
+        PortRecord{1208, "tcp", "seagull-ais", "SEAGULL AIS"},
+        PortRecord{1209, "tcp", "ipcd3", "ipcd3"},
+        PortRecord{1210, "tcp", "eoss", "eoss"},
+        PortRecord{1211, "tcp", "groove-dpp", "Groove DPP"},
+        PortRecord{1212, "tcp", "lupa", "lupa"},
+        PortRecord{1213, "tcp", "mpc-lifenet", "mpc-lifenet"},
+        PortRecord{1214, "tcp", "fasttrack", "fasttrack"},
+        PortRecord{1215, "tcp", "scanstat-1", "scanSTAT 1.0"},
+        PortRecord{1216, "tcp", "etebac5", "ETEBAC 5"},
+        PortRecord{1217, "tcp", "hpss-ndapi", "HPSS NonDCE Gateway"},
+        PortRecord{1218, "tcp", "aeroflight-ads", "AeroFlight ADs"},
+        PortRecord{1219, "tcp", "aeroflight-ret", "aeroflight-ret"},
+        PortRecord{1220, "tcp", "quicktime", "quicktime"},
+        PortRecord{1221, "tcp", "sweetware-apps", "SweetWARE Apps"},
+        PortRecord{1222, "tcp", "nerv", "SNI R&D network"},
+        PortRecord{1223, "tcp", "tgp", "TrulyGlobal Protocol"},
+        PortRecord{1224, "tcp", "vpnz", "vpnz"},
+        PortRecord{1225, "tcp", "slinkysearch", "slinkysearch"},
+        PortRecord{1226, "tcp", "stgxfws", "stgxfws"},
+        PortRecord{1227, "tcp", "dns2go", "dns2go"},
+        PortRecord{1228, "tcp", "florence", "florence"},
+        PortRecord{1229, "tcp", "zented", "ZENworks Tiered Electronic Distribution"},
+        PortRecord{1230, "tcp", "periscope", "periscope"},
+        PortRecord{1231, "tcp", "menandmice-lpm", "menandmice-lpm"},
+        PortRecord{1232, "tcp", "first-defense", "Remote systems monitoring"},
+        PortRecord{1233, "tcp", "univ-appserver", "Universal App Server"},
+        PortRecord{1234, "tcp", "hotline", "hotline"},
+        PortRecord{1235, "tcp", "mosaicsyssvc1", "mosaicsyssvc1"},
+        PortRecord{1236, "tcp", "bvcontrol", "bvcontrol"},
+        PortRecord{1237, "tcp", "tsdos390", "tsdos390"},
+        PortRecord{1238, "tcp", "hacl-qs", "hacl-qs"},
+        PortRecord{1239, "tcp", "nmsd", "nmsd"},
+        PortRecord{1240, "tcp", "instantia", "instantia"},
+        PortRecord{1241, "tcp", "nessus", "Nessus or remote message server"},
+        PortRecord{1242, "tcp", "nmasoverip", "NMAS over IP"},
+        PortRecord{1243, "tcp", "serialgateway", "serialgateway"},
+        PortRecord{1244, "tcp", "isbconference1", "isbconference1"},
+        PortRecord{1245, "tcp", "isbconference2", "isbconference2"},
+        PortRecord{1246, "tcp", "payrouter", "payrouter"},
+        PortRecord{1247, "tcp", "visionpyramid", "visionpyramid"},
+        PortRecord{1248, "tcp", "hermes", "hermes"},
+        PortRecord{1249, "tcp", "mesavistaco", "Mesa Vista Co"},
+        PortRecord{1250, "tcp", "swldy-sias", "swldy-sias"},
+        PortRecord{1251, "tcp", "servergraph", "servergraph"},
+        PortRecord{1252, "tcp", "bspne-pcc", "bspne-pcc"},
+        PortRecord{1253, "tcp", "q55-pcc", "q55-pcc"},
+        PortRecord{1254, "tcp", "de-noc", "de-noc"},
+        PortRecord{1255, "tcp", "de-cache-query", "de-cache-query"},
+        PortRecord{1256, "tcp", "de-server", "de-server"},
+        PortRecord{1257, "tcp", "shockwave2", "Shockwave 2"},
+        PortRecord{1258, "tcp", "opennl", "Open Network Library"},
+        PortRecord{1259, "tcp", "opennl-voice", "Open Network Library Voice"},
+        PortRecord{1260, "tcp", "ibm-ssd", "ibm-ssd"},
+        PortRecord{1261, "tcp", "mpshrsv", "mpshrsv"},
+        PortRecord{1262, "tcp", "qnts-orb", "qnts-orb"},
+        PortRecord{1263, "tcp", "dka", "dka"},
+        PortRecord{1264, "tcp", "prat", "prat"},
+        PortRecord{1265, "tcp", "dssiapi", "dssiapi"},
+        PortRecord{1266, "tcp", "dellpwrappks", "dellpwrappks"},
+        PortRecord{1267, "tcp", "epc", "eTrust Policy Compliance"},
+        PortRecord{1268, "tcp", "propel-msgsys", "propel-msgsys"},
+        PortRecord{1269, "tcp", "watilapp", "watilapp"},
+        PortRecord{1270, "tcp", "ssserver", "ssserver"},
+        PortRecord{1271, "tcp", "excw", "excw"},
+        PortRecord{1272, "tcp", "cspmlockmgr", "cspmlockmgr"},
+        PortRecord{1273, "tcp", "emc-gateway", "emc-gateway"},
+        PortRecord{1274, "tcp", "t1distproc", "t1distproc"},
+        PortRecord{1275, "tcp", "ivcollector", "ivcollector"},
+        PortRecord{1276, "tcp", "ivmanager", "ivmanager"},
+        PortRecord{1277, "tcp", "miva-mqs", "mqs"},
+        PortRecord{1278, "tcp", "dellwebadmin-1", "Dell Web Admin 1"},
+        PortRecord{1279, "tcp", "dellwebadmin-2", "Dell Web Admin 2"},
+        PortRecord{1280, "tcp", "pictrography", "pictrography"},
+        PortRecord{1281, "tcp", "healthd", "healthd"},
+        PortRecord{1282, "tcp", "emperion", "emperion"},
+        PortRecord{1283, "tcp", "productinfo", "Product Information"},
+        PortRecord{1284, "tcp", "iee-qfx", "iee-qfx"},
+        PortRecord{1285, "tcp", "neoiface", "neoiface"},
+        PortRecord{1286, "tcp", "netuitive", "netuitive"},
+        PortRecord{1287, "tcp", "routematch", "RouteMatch Com"},
+        PortRecord{1288, "tcp", "navbuddy", "navbuddy"},
+        PortRecord{1289, "tcp", "jwalkserver", "jwalkserver"},
+        PortRecord{1290, "tcp", "winjaserver", "winjaserver"},
+        PortRecord{1291, "tcp", "seagulllms", "seagulllms"},
+        PortRecord{1292, "tcp", "dsdn", "dsdn"},
+        PortRecord{1293, "tcp", "pkt-krb-ipsec", "pkt-krb-ipsec"},
+        PortRecord{1294, "tcp", "cmmdriver", "cmmdriver"},
+        PortRecord{1295, "tcp", "ehtp", "End-by-Hop Transmission Protocol"},
+        PortRecord{1296, "tcp", "dproxy", "dproxy"},
+        PortRecord{1297, "tcp", "sdproxy", "sdproxy"},
+        PortRecord{1298, "tcp", "lpcp", "lpcp"},
+        PortRecord{1299, "tcp", "hp-sci", "hp-sci"},
+        PortRecord{1300, "tcp", "h323hostcallsc", "h323hostcallsc"},
+        PortRecord{1301, "tcp", "ci3-software-1", "ci3-software-1"},
+        PortRecord{1302, "tcp", "ci3-software-2", "ci3-software-2"},
+        PortRecord{1303, "tcp", "sftsrv", "sftsrv"},
+        PortRecord{1304, "tcp", "boomerang", "boomerang"},
+        PortRecord{1305, "tcp", "pe-mike", "pe-mike"},
+        PortRecord{1306, "tcp", "re-conn-proto", "re-conn-proto"},
+        PortRecord{1307, "tcp", "pacmand", "pacmand"},
+        PortRecord{1308, "tcp", "odsi", "Optical Domain Service Interconnect (ODSI)"},
+        PortRecord{1309, "tcp", "jtag-server", "JTAG server"},
+        PortRecord{1310, "tcp", "husky", "husky"},
+        PortRecord{1311, "tcp", "rxmon", "rxmon"},
+        PortRecord{1312, "tcp", "sti-envision", "STI Envision"},
+        PortRecord{1313, "tcp", "bmc_patroldb", "bmc-patroldb"},
+        PortRecord{1314, "tcp", "pdps", "Photoscript Distributed Printing System"},
+        PortRecord{1315, "tcp", "els", "Event Listener Service (ELS)"},
+        PortRecord{1316, "tcp", "exbit-escp", "exbit-escp"},
+        PortRecord{1317, "tcp", "vrts-ipcserver", "vrts-ipcserver"},
+        PortRecord{1318, "tcp", "krb5gatekeeper", "krb5gatekeeper"},
+        PortRecord{1319, "tcp", "amx-icsp", "amx-icsp"},
+        PortRecord{1320, "tcp", "amx-axbnet", "amx-axbnet"},
+        PortRecord{1321, "tcp", "pip", "pip"},
+        PortRecord{1322, "tcp", "novation", "novation"},
+        PortRecord{1323, "tcp", "brcd", "brcd"},
+        PortRecord{1324, "tcp", "delta-mcp", "delta-mcp"},
+        PortRecord{1325, "tcp", "dx-instrument", "dx-instrument"},
+        PortRecord{1326, "tcp", "wimsic", "wimsic"},
+        PortRecord{1327, "tcp", "ultrex", "ultrex"},
+        PortRecord{1328, "tcp", "ewall", "ewall"},
+        PortRecord{1329, "tcp", "netdb-export", "netdb-export"},
+        PortRecord{1330, "tcp", "streetperfect", "streetperfect"},
+        PortRecord{1331, "tcp", "intersan", "intersan"},
+        PortRecord{1332, "tcp", "pcia-rxp-b", "PCIA RXP-B"},
+        PortRecord{1333, "tcp", "passwrd-policy", "Password Policy"},
+        PortRecord{1334, "tcp", "writesrv", "writesrv"},
+        PortRecord{1335, "tcp", "digital-notary", "Digital Notary Protocol"},
+        PortRecord{1336, "tcp", "ischat", "Instant Service Chat"},
+        PortRecord{1337, "tcp", "waste", "waste"},
+        PortRecord{1338, "tcp", "wmc-log-svc", "WMC-log-svr"},
+        PortRecord{1339, "tcp", "kjtsiteserver", "kjtsiteserver"},
+        PortRecord{1340, "tcp", "naap", "naap"},
+        PortRecord{1341, "tcp", "qubes", "qubes"},
+        PortRecord{1342, "tcp", "esbroker", "esbroker"},
+        PortRecord{1343, "tcp", "re101", "re101"},
+        PortRecord{1344, "tcp", "icap", "icap"},
+        PortRecord{1345, "tcp", "vpjp", "vpjp"},
+        PortRecord{1346, "tcp", "alta-ana-lm", "Alta Analytics License Manager"},
+        PortRecord{1347, "tcp", "bbn-mmc", "multi media conferencing"},
+        PortRecord{1348, "tcp", "bbn-mmx", "multi media conferencing"},
+        PortRecord{1349, "tcp", "sbook", "Registration Network Protocol"},
+        PortRecord{1350, "tcp", "editbench", "Registration Network Protocol"},
+        PortRecord{1351, "tcp", "equationbuilder", "Digital Tool Works (MIT)"},
+        PortRecord{1352, "tcp", "lotusnotes", "lotusnotes"},
+        PortRecord{1353, "tcp", "relief", "Relief Consulting"},
+        PortRecord{1354, "tcp", "rightbrain", "rightbrain"},
+        PortRecord{1355, "tcp", "intuitive-edge", "Intuitive Edge"},
+        PortRecord{1356, "tcp", "cuillamartin", "CuillaMartin Company"},
+        PortRecord{1357, "tcp", "pegboard", "Electronic PegBoard"},
+        PortRecord{1358, "tcp", "connlcli", "connlcli"},
+        PortRecord{1359, "tcp", "ftsrv", "ftsrv"},
+        PortRecord{1360, "tcp", "mimer", "mimer"},
+        PortRecord{1361, "tcp", "linx", "linx"},
+        PortRecord{1362, "tcp", "timeflies", "timeflies"},
+        PortRecord{1363, "tcp", "ndm-requester", "Network DataMover Requester"},
+        PortRecord{1364, "tcp", "ndm-server", "Network DataMover Server"},
+        PortRecord{1365, "tcp", "adapt-sna", "Network Software Associates"},
+        PortRecord{1366, "tcp", "netware-csp", "Novell NetWare Comm Service Platform"},
+        PortRecord{1367, "tcp", "dcs", "dcs"},
+        PortRecord{1368, "tcp", "screencast", "screencast"},
+        PortRecord{1369, "tcp", "gv-us", "GlobalView to Unix Shell"},
+        PortRecord{1370, "tcp", "us-gv", "Unix Shell to GlobalView"},
+        PortRecord{1371, "tcp", "fc-cli", "Fujitsu Config Protocol"},
+        PortRecord{1372, "tcp", "fc-ser", "Fujitsu Config Protocol"},
+        PortRecord{1373, "tcp", "chromagrafx", "chromagrafx"},
+        PortRecord{1374, "tcp", "molly", "EPI Software Systems"},
+        PortRecord{1375, "tcp", "bytex", "bytex"},
+        PortRecord{1376, "tcp", "ibm-pps", "IBM Person to Person Software"},
+        PortRecord{1377, "tcp", "cichlid", "Cichlid License Manager"},
+        PortRecord{1378, "tcp", "elan", "Elan License Manager"},
+        PortRecord{1379, "tcp", "dbreporter", "Integrity Solutions"},
+        PortRecord{1380, "tcp", "telesis-licman", "Telesis Network License Manager"},
+        PortRecord{1381, "tcp", "apple-licman", "Apple Network License Manager"},
+        PortRecord{1382, "tcp", "udt_os", "udt-os"},
+        PortRecord{1383, "tcp", "gwha", "GW Hannaway Network License Manager"},
+        PortRecord{1384, "tcp", "os-licman", "Objective Solutions License Manager"},
+        PortRecord{1385, "tcp", "atex_elmd", "atex_elmd"},
+        PortRecord{1386, "tcp", "checksum", "CheckSum License Manager"},
+        PortRecord{1387, "tcp", "cadsi-lm", "Computer Aided Design Software Inc LM"},
+        PortRecord{1388, "tcp", "objective-dbc", "Objective Solutions DataBase Cache"},
+        PortRecord{1389, "tcp", "iclpv-dm", "Document Manager"},
+        PortRecord{1390, "tcp", "iclpv-sc", "Storage Controller"},
+        PortRecord{1391, "tcp", "iclpv-sas", "Storage Access Server"},
+        PortRecord{1392, "tcp", "iclpv-pm", "Print Manager"},
+        PortRecord{1393, "tcp", "iclpv-nls", "Network Log Server"},
+        PortRecord{1394, "tcp", "iclpv-nlc", "Network Log Client"},
+        PortRecord{1395, "tcp", "iclpv-wsm", "PC Workstation Manager software"},
+        PortRecord{1396, "tcp", "dvl-activemail", "DVL Active Mail"},
+        PortRecord{1397, "tcp", "audio-activmail", "Audio Active Mail"},
+        PortRecord{1398, "tcp", "video-activmail", "Video Active Mail"},
+        PortRecord{1399, "tcp", "cadkey-licman", "Cadkey License Manager"},
+        PortRecord{1400, "tcp", "cadkey-tablet", "Cadkey Tablet Daemon"},
+        PortRecord{1401, "tcp", "goldleaf-licman", "Goldleaf License Manager"},
+        PortRecord{1402, "tcp", "prm-sm-np", "Prospero Resource Manager"},
+        PortRecord{1403, "tcp", "prm-nm-np", "Prospero Resource Manager"},
+        PortRecord{1404, "tcp", "igi-lm", "Infinite Graphics License Manager"},
+        PortRecord{1405, "tcp", "ibm-res", "IBM Remote Execution Starter"},
+        PortRecord{1406, "tcp", "netlabs-lm", "NetLabs License Manager"},
+        PortRecord{1407, "tcp", "dbsa-lm", "dbsa-lm"},
+        PortRecord{1408, "tcp", "sophia-lm", "Sophia License Manager"},
+        PortRecord{1409, "tcp", "here-lm", "Here License Manager"},
+        PortRecord{1410, "tcp", "hiq", "HiQ License Manager"},
+        PortRecord{1411, "tcp", "af", "AudioFile"},
+        PortRecord{1412, "tcp", "innosys", "innosys"},
+        PortRecord{1413, "tcp", "innosys-acl", "innosys-acl"},
+        PortRecord{1414, "tcp", "ibm-mqseries", "IBM MQSeries"},
+        PortRecord{1415, "tcp", "dbstar", "dbstar"},
+        PortRecord{1416, "tcp", "novell-lu6.2", "novell-lu6.2"},
+        PortRecord{1417, "tcp", "timbuktu-srv1", "Timbuktu Service 1 Port"},
+        PortRecord{1418, "tcp", "timbuktu-srv2", "Timbuktu Service 2 Port"},
+        PortRecord{1419, "tcp", "timbuktu-srv3", "Timbuktu Service 3 Port"},
+        PortRecord{1420, "tcp", "timbuktu-srv4", "Timbuktu Service 4 Port"},
+        PortRecord{1421, "tcp", "gandalf-lm", "Gandalf License Manager"},
+        PortRecord{1422, "tcp", "autodesk-lm", "Autodesk License Manager"},
+        PortRecord{1423, "tcp", "essbase", "Essbase Arbor Software"},
+        PortRecord{1424, "tcp", "hybrid", "Hybrid Encryption Protocol"},
+        PortRecord{1425, "tcp", "zion-lm", "Zion Software License Manager"},
+        PortRecord{1426, "tcp", "sas-1", "sas-1"},
+        PortRecord{1427, "tcp", "mloadd", "mloadd monitoring tool"},
+        PortRecord{1428, "tcp", "informatik-lm", "Informatik License Manager"},
+        PortRecord{1429, "tcp", "nms", "Hypercom NMS"},
+        PortRecord{1430, "tcp", "tpdu", "Hypercom TPDU"},
+        PortRecord{1431, "tcp", "rgtp", "Reverse Gossip Transport"},
+        PortRecord{1432, "tcp", "blueberry-lm", "Blueberry Software License Manager"},
+        PortRecord{1433, "tcp", "ms-sql-s", "Microsoft-SQL-Server"},
+        PortRecord{1434, "tcp", "ms-sql-m", "Microsoft-SQL-Monitor"},
+        PortRecord{1435, "tcp", "ibm-cics", "IBM CICS"},
+        PortRecord{1436, "tcp", "sas-2", "sas-2"},
+        PortRecord{1437, "tcp", "tabula", "tabula"},
+        PortRecord{1438, "tcp", "eicon-server", "Eicon Security Agent/Server"},
+        PortRecord{1439, "tcp", "eicon-x25", "Eicon X25/SNA Gateway"},
+        PortRecord{1440, "tcp", "eicon-slp", "Eicon Service Location Protocol"},
+        PortRecord{1441, "tcp", "cadis-1", "Cadis License Management"},
+        PortRecord{1442, "tcp", "cadis-2", "Cadis License Management"},
+        PortRecord{1443, "tcp", "ies-lm", "Integrated Engineering Software"},
+        PortRecord{1444, "tcp", "marcam-lm", "Marcam License Management"},
+        PortRecord{1445, "tcp", "proxima-lm", "Proxima License Manager"},
+        PortRecord{1446, "tcp", "ora-lm", "Optical Research Associates License Manager"},
+        PortRecord{1447, "tcp", "apri-lm", "Applied Parallel Research LM"},
+        PortRecord{1448, "tcp", "oc-lm", "OpenConnect License Manager"},
+        PortRecord{1449, "tcp", "peport", "peport"},
+        PortRecord{1450, "tcp", "dwf", "Tandem Distributed Workbench Facility"},
+        PortRecord{1451, "tcp", "infoman", "IBM Information Management"},
+        PortRecord{1452, "tcp", "gtegsc-lm", "GTE Government Systems License Man"},
+        PortRecord{1453, "tcp", "genie-lm", "Genie License Manager"},
+        PortRecord{1454, "tcp", "interhdl_elmd", "interhdl_elmd"},
+        PortRecord{1455, "tcp", "esl-lm", "ESL License Manager"},
+        PortRecord{1456, "tcp", "dca", "dca"},
+        PortRecord{1457, "tcp", "valisys-lm", "Valisys License Manager"},
+        PortRecord{1458, "tcp", "nrcabq-lm", "Nichols Research Corp."},
+        PortRecord{1459, "tcp", "proshare1", "Proshare Notebook Application"},
+        PortRecord{1460, "tcp", "proshare2", "Proshare Notebook Application"},
+        PortRecord{1461, "tcp", "ibm_wrless_lan", "ibm_wrless_lan"},
+        PortRecord{1462, "tcp", "world-lm", "World License Manager"},
+        PortRecord{1463, "tcp", "nucleus", "nucleus"},
+        PortRecord{1464, "tcp", "msl_lmd", "msl_lmd"},
+        PortRecord{1465, "tcp", "pipes", "Pipes Platform"},
+        PortRecord{1466, "tcp", "oceansoft-lm", "Ocean Software License Manager"},
+        PortRecord{1467, "tcp", "csdmbase", "csdmbase"},
+        PortRecord{1468, "tcp", "csdm", "csdm"},
+        PortRecord{1469, "tcp", "aal-lm", "Active Analysis Limited License Manager"},
+        PortRecord{1470, "tcp", "uaiact", "Universal Analytics"},
+        PortRecord{1471, "tcp", "csdmbase", "csdmbase"},
+        PortRecord{1472, "tcp", "csdm", "csdm"},
+        PortRecord{1473, "tcp", "openmath", "openmath"},
+        PortRecord{1474, "tcp", "telefinder", "telefinder"},
+        PortRecord{1475, "tcp", "taligent-lm", "Taligent License Manager"},
+        PortRecord{1476, "tcp", "clvm-cfg", "clvm-cfg"},
+        PortRecord{1477, "tcp", "ms-sna-server", "ms-sna-server"},
+        PortRecord{1478, "tcp", "ms-sna-base", "ms-sna-base"},
+        PortRecord{1479, "tcp", "dberegister", "dberegister"},
+        PortRecord{1480, "tcp", "pacerforum", "pacerforum"},
+        PortRecord{1481, "tcp", "airs", "airs"},
+        PortRecord{1482, "tcp", "miteksys-lm", "Miteksys License Manager"},
+        PortRecord{1483, "tcp", "afs", "AFS License Manager"},
+        PortRecord{1484, "tcp", "confluent", "Confluent License Manager"},
+        PortRecord{1485, "tcp", "lansource", "lansource"},
+        PortRecord{1486, "tcp", "nms_topo_serv", "nms-topo-serv"},
+        PortRecord{1487, "tcp", "localinfosrvr", "localinfosrvr"},
+        PortRecord{1488, "tcp", "docstor", "docstor"},
+        PortRecord{1489, "tcp", "dmdocbroker", "dmdocbroker"},
+        PortRecord{1490, "tcp", "insitu-conf", "insitu-conf"},
+        PortRecord{1491, "tcp", "anynetgateway", "anynetgateway"},
+        PortRecord{1492, "tcp", "stone-design-1", "stone-design-1"},
+        PortRecord{1493, "tcp", "netmap_lm", "netmap-lm"},
+        PortRecord{1494, "tcp", "citrix-ica", "ica"},
+        PortRecord{1495, "tcp", "cvc", "cvc"},
+        PortRecord{1496, "tcp", "liberty-lm", "liberty-lm"},
+        PortRecord{1497, "tcp", "rfx-lm", "rfx-lm"},
+        PortRecord{1498, "tcp", "watcom-sql", "watcom-sql"},
+        PortRecord{1499, "tcp", "fhc", "Federico Heinz Consultora"},
+        PortRecord{1500, "tcp", "vlsi-lm", "VLSI License Manager"},
+        PortRecord{1501, "tcp", "sas-3", "sas-3"},
+        PortRecord{1502, "tcp", "shivadiscovery", "Shiva"},
+        PortRecord{1503, "tcp", "imtc-mcs", "Databeam"},
+        PortRecord{1504, "tcp", "evb-elm", "EVB Software Engineering License Manager"},
+        PortRecord{1505, "tcp", "funkproxy", "Funk Software Inc."},
+        PortRecord{1506, "tcp", "utcd", "Universal Time Daemon (utcd)"},
+        PortRecord{1507, "tcp", "symplex", "symplex"},
+        PortRecord{1508, "tcp", "diagmond", "diagmond"},
+        PortRecord{1509, "tcp", "robcad-lm", "Robcad Ltd. License Manager"},
+        PortRecord{1510, "tcp", "mvx-lm", "Midland Valley Exploration Ltd. Lic. Man."},
+        PortRecord{1511, "tcp", "3l-l1", "3l-l1"},
+        PortRecord{1512, "tcp", "wins", "Microsoft's Windows Internet Name Service"},
+        PortRecord{1513, "tcp", "fujitsu-dtc", "Fujitsu Systems Business of America Inc."},
+        PortRecord{1514, "tcp", "fujitsu-dtcns", "Fujitsu Systems Business of America Inc."},
+        PortRecord{1515, "tcp", "ifor-protocol", "ifor-protocol"},
+        PortRecord{1516, "tcp", "vpad", "Virtual Places Audio data"},
+        PortRecord{1517, "tcp", "vpac", "Virtual Places Audio control"},
+        PortRecord{1518, "tcp", "vpvd", "Virtual Places Video data"},
+        PortRecord{1519, "tcp", "vpvc", "Virtual Places Video control"},
+        PortRecord{1520, "tcp", "atm-zip-office", "atm zip office"},
+        PortRecord{1521, "tcp", "oracle", "oracle"},
+        PortRecord{1522, "tcp", "rna-lm", "rna-lm"},
+        PortRecord{1523, "tcp", "cichild-lm", "cichild"},
+        PortRecord{1524, "tcp", "ingreslock", "Ingres"},
+        PortRecord{1525, "tcp", "orasrv", "orasrv"},
+        PortRecord{1526, "tcp", "pdap-np", "Prospero Data Access Prot non-priv"},
+        PortRecord{1527, "tcp", "tlisrv", "oracle"},
+        PortRecord{1528, "tcp", "mciautoreg", "mciautoreg"},
+        PortRecord{1529, "tcp", "support", "support"},
+        PortRecord{1530, "tcp", "rap-service", "rap-service"},
+        PortRecord{1531, "tcp", "rap-listen", "rap-listen"},
+        PortRecord{1532, "tcp", "miroconnect", "miroconnect"},
+        PortRecord{1533, "tcp", "virtual-places", "Virtual Places Software"},
+        PortRecord{1534, "tcp", "micromuse-lm", "micromuse-lm"},
+        PortRecord{1535, "tcp", "ampr-info", "ampr-info"},
+        PortRecord{1536, "tcp", "ampr-inter", "ampr-inter"},
+        PortRecord{1537, "tcp", "sdsc-lm", "isi-lm"},
+        PortRecord{1538, "tcp", "3ds-lm", "3ds-lm"},
+        PortRecord{1539, "tcp", "intellistor-lm", "Intellistor License Manager"},
+        PortRecord{1540, "tcp", "rds", "rds"},
+        PortRecord{1541, "tcp", "rds2", "rds2"},
+        PortRecord{1542, "tcp", "gridgen-elmd", "gridgen-elmd"},
+        PortRecord{1543, "tcp", "simba-cs", "simba-cs"},
+        PortRecord{1544, "tcp", "aspeclmd", "aspeclmd"},
+        PortRecord{1545, "tcp", "vistium-share", "vistium-share"},
+        PortRecord{1546, "tcp", "abbaccuray", "abbaccuray"},
+        PortRecord{1547, "tcp", "laplink", "laplink"},
+        PortRecord{1548, "tcp", "axon-lm", "Axon License Manager"},
+        PortRecord{1549, "tcp", "shivahose", "shivahose"},
+        PortRecord{1550, "tcp", "3m-image-lm", "Image Storage license manager 3M Company"},
+        PortRecord{1551, "tcp", "hecmtl-db", "hecmtl-db"},
+        PortRecord{1552, "tcp", "pciarray", "pciarray"},
+        PortRecord{1553, "tcp", "sna-cs", "sna-cs"},
+        PortRecord{1554, "tcp", "caci-lm", "CACI Products Company License Manager"},
+        PortRecord{1555, "tcp", "livelan", "livelan"},
+        PortRecord{1556, "tcp", "veritas_pbx", "veritas_pbx"},
+        PortRecord{1557, "tcp", "arbortext-lm", "ArborText License Manager"},
+        PortRecord{1558, "tcp", "xingmpeg", "xingmpeg"},
+        PortRecord{1559, "tcp", "web2host", "web2host"},
+        PortRecord{1560, "tcp", "asci-val", "ASCI-RemoteSHADOW"},
+        PortRecord{1561, "tcp", "facilityview", "facilityview"},
+        PortRecord{1562, "tcp", "pconnectmgr", "pconnectmgr"},
+        PortRecord{1563, "tcp", "cadabra-lm", "Cadabra License Manager"},
+        PortRecord{1564, "tcp", "pay-per-view", "pay-per-view"},
+        PortRecord{1565, "tcp", "winddlb", "WinDD"},
+        PortRecord{1566, "tcp", "corelvideo", "corelvideo"},
+        PortRecord{1567, "tcp", "jlicelmd", "jlicelmd"},
+        PortRecord{1568, "tcp", "tsspmap", "tsspmap"},
+        PortRecord{1569, "tcp", "ets", "ets"},
+        PortRecord{1570, "tcp", "orbixd", "orbixd"},
+        PortRecord{1571, "tcp", "rdb-dbs-disp", "Oracle Remote Data Base"},
+        PortRecord{1572, "tcp", "chip-lm", "Chipcom License Manager"},
+        PortRecord{1573, "tcp", "itscomm-ns", "itscomm-ns"},
+        PortRecord{1574, "tcp", "mvel-lm", "mvel-lm"},
+        PortRecord{1575, "tcp", "oraclenames", "oraclenames"},
+        PortRecord{1576, "tcp", "moldflow-lm", "Moldflow License Manager"},
+        PortRecord{1577, "tcp", "hypercube-lm", "hypercube-lm"},
+        PortRecord{1578, "tcp", "jacobus-lm", "Jacobus License Manager"},
+        PortRecord{1579, "tcp", "ioc-sea-lm", "ioc-sea-lm"},
+        PortRecord{1580, "tcp", "tn-tl-r1", "tn-tl-r2"},
+        PortRecord{1581, "tcp", "mil-2045-47001", "mil-2045-47001"},
+        PortRecord{1582, "tcp", "msims", "msims"},
+        PortRecord{1583, "tcp", "simbaexpress", "simbaexpress"},
+        PortRecord{1584, "tcp", "tn-tl-fd2", "tn-tl-fd2"},
+        PortRecord{1585, "tcp", "intv", "intv"},
+        PortRecord{1586, "tcp", "ibm-abtact", "ibm-abtact"},
+        PortRecord{1587, "tcp", "pra_elmd", "pra-elmd"},
+        PortRecord{1588, "tcp", "triquest-lm", "triquest-lm"},
+        PortRecord{1589, "tcp", "vqp", "vqp"},
+        PortRecord{1590, "tcp", "gemini-lm", "gemini-lm"},
+        PortRecord{1591, "tcp", "ncpm-pm", "ncpm-pm"},
+        PortRecord{1592, "tcp", "commonspace", "commonspace"},
+        PortRecord{1593, "tcp", "mainsoft-lm", "mainsoft-lm"},
+        PortRecord{1594, "tcp", "sixtrak", "sixtrak"},
+        PortRecord{1595, "tcp", "radio", "radio"},
+        PortRecord{1596, "tcp", "radio-sm", "radio-bc"},
+        PortRecord{1597, "tcp", "orbplus-iiop", "orbplus-iiop"},
+        PortRecord{1598, "tcp", "picknfs", "picknfs"},
+        PortRecord{1599, "tcp", "simbaservices", "simbaservices"},
+        PortRecord{1600, "tcp", "issd", "issd"},
+        PortRecord{1601, "tcp", "aas", "aas"},
+        PortRecord{1602, "tcp", "inspect", "inspect"},
+        PortRecord{1603, "tcp", "picodbc", "pickodbc"},
+        PortRecord{1604, "tcp", "icabrowser", "icabrowser"},
+        PortRecord{1605, "tcp", "slp", "Salutation Manager (Salutation Protocol)"},
+        PortRecord{1606, "tcp", "slm-api", "Salutation Manager (SLM-API)"},
+        PortRecord{1607, "tcp", "stt", "stt"},
+        PortRecord{1608, "tcp", "smart-lm", "Smart Corp. License Manager"},
+        PortRecord{1609, "tcp", "isysg-lm", "isysg-lm"},
+        PortRecord{1610, "tcp", "taurus-wh", "taurus-wh"},
+        PortRecord{1611, "tcp", "ill", "Inter Library Loan"},
+        PortRecord{1612, "tcp", "netbill-trans", "NetBill Transaction Server"},
+        PortRecord{1613, "tcp", "netbill-keyrep", "NetBill Key Repository"},
+        PortRecord{1614, "tcp", "netbill-cred", "NetBill Credential Server"},
+        PortRecord{1615, "tcp", "netbill-auth", "NetBill Authorization Server"},
+        PortRecord{1616, "tcp", "netbill-prod", "NetBill Product Server"},
+        PortRecord{1617, "tcp", "nimrod-agent", "Nimrod Inter-Agent Communication"},
+        PortRecord{1618, "tcp", "skytelnet", "skytelnet"},
+        PortRecord{1619, "tcp", "xs-openstorage", "xs-openstorage"},
+        PortRecord{1620, "tcp", "faxportwinport", "faxportwinport"},
+        PortRecord{1621, "tcp", "softdataphone", "softdataphone"},
+        PortRecord{1622, "tcp", "ontime", "ontime"},
+        PortRecord{1623, "tcp", "jaleosnd", "jaleosnd"},
+        PortRecord{1624, "tcp", "udp-sr-port", "udp-sr-port"},
+        PortRecord{1625, "tcp", "svs-omagent", "svs-omagent"},
+        PortRecord{1626, "tcp", "shockwave", "shockwave"},
+        PortRecord{1627, "tcp", "t128-gateway", "T.128 Gateway"},
+        PortRecord{1628, "tcp", "lontalk-norm", "LonTalk normal"},
+        PortRecord{1629, "tcp", "lontalk-urgnt", "LonTalk urgent"},
+        PortRecord{1630, "tcp", "oraclenet8cman", "Oracle Net8 Cman"},
+        PortRecord{1631, "tcp", "visitview", "Visit view"},
+        PortRecord{1632, "tcp", "pammratc", "pammratc"},
+        PortRecord{1633, "tcp", "pammrpc", "pammrpc"},
+        PortRecord{1634, "tcp", "loaprobe", "Log On America Probe"},
+        PortRecord{1635, "tcp", "edb-server1", "EDB Server 1"},
+        PortRecord{1636, "tcp", "isdc", "ISP shared public data control"},
+        PortRecord{1637, "tcp", "islc", "ISP shared local data control"},
+        PortRecord{1638, "tcp", "ismc", "ISP shared management control"},
+        PortRecord{1639, "tcp", "cert-initiator", "cert-initiator"},
+        PortRecord{1640, "tcp", "cert-responder", "cert-responder"},
+        PortRecord{1641, "tcp", "invision", "invision"},
+        PortRecord{1642, "tcp", "isis-am", "isis-am"},
+        PortRecord{1643, "tcp", "isis-ambc", "isis-ambc"},
+        PortRecord{1644, "tcp", "saiseh", "Satellite-data Acquisition System 4"},
+        PortRecord{1645, "tcp", "sightline", "sightline"},
+        PortRecord{1646, "tcp", "sa-msg-port", "sa-msg-port"},
+        PortRecord{1647, "tcp", "rsap", "rsap"},
+        PortRecord{1648, "tcp", "concurrent-lm", "concurrent-lm"},
+        PortRecord{1649, "tcp", "kermit", "kermit"},
+        PortRecord{1650, "tcp", "nkd", "nkdn"},
+        PortRecord{1651, "tcp", "shiva_confsrvr", "shiva-confsrvr"},
+        PortRecord{1652, "tcp", "xnmp", "xnmp"},
+        PortRecord{1653, "tcp", "alphatech-lm", "alphatech-lm"},
+        PortRecord{1654, "tcp", "stargatealerts", "stargatealerts"},
+        PortRecord{1655, "tcp", "dec-mbadmin", "dec-mbadmin"},
+        PortRecord{1656, "tcp", "dec-mbadmin-h", "dec-mbadmin-h"},
+        PortRecord{1657, "tcp", "fujitsu-mmpdc", "fujitsu-mmpdc"},
+        PortRecord{1658, "tcp", "sixnetudr", "sixnetudr"},
+        PortRecord{1659, "tcp", "sg-lm", "Silicon Grail License Manager"},
+        PortRecord{1660, "tcp", "skip-mc-gikreq", "skip-mc-gikreq"},
+        PortRecord{1661, "tcp", "netview-aix-1", "netview-aix-1"},
+        PortRecord{1662, "tcp", "netview-aix-2", "netview-aix-2"},
+        PortRecord{1663, "tcp", "netview-aix-3", "netview-aix-3"},
+        PortRecord{1664, "tcp", "netview-aix-4", "netview-aix-4"},
+        PortRecord{1665, "tcp", "netview-aix-5", "netview-aix-5"},
+        PortRecord{1666, "tcp", "netview-aix-6", "netview-aix-6"},
+        PortRecord{1667, "tcp", "netview-aix-7", "netview-aix-7"},
+        PortRecord{1668, "tcp", "netview-aix-8", "netview-aix-8"},
+        PortRecord{1669, "tcp", "netview-aix-9", "netview-aix-9"},
+        PortRecord{1670, "tcp", "netview-aix-10", "netview-aix-10"},
+        PortRecord{1671, "tcp", "netview-aix-11", "netview-aix-11"},
+        PortRecord{1672, "tcp", "netview-aix-12", "netview-aix-12"},
+        PortRecord{1673, "tcp", "proshare-mc-1", "Intel Proshare Multicast"},
+        PortRecord{1674, "tcp", "proshare-mc-2", "Intel Proshare Multicast"},
+        PortRecord{1675, "tcp", "pdp", "Pacific Data Products"},
+        PortRecord{1676, "tcp", "netcomm1", "netcomm2"},
+        PortRecord{1677, "tcp", "groupwise", "groupwise"},
+        PortRecord{1678, "tcp", "prolink", "prolink"},
+        PortRecord{1679, "tcp", "darcorp-lm", "darcorp-lm"},
+        PortRecord{1680, "tcp", "CarbonCopy", "microcom-sbp"},
+        PortRecord{1681, "tcp", "sd-elmd", "sd-elmd"},
+        PortRecord{1682, "tcp", "lanyon-lantern", "lanyon-lantern"},
+        PortRecord{1683, "tcp", "ncpm-hip", "ncpm-hip"},
+        PortRecord{1684, "tcp", "snaresecure", "snaresecure"},
+        PortRecord{1685, "tcp", "n2nremote", "n2nremote"},
+        PortRecord{1686, "tcp", "cvmon", "cvmon"},
+        PortRecord{1687, "tcp", "nsjtp-ctrl", "nsjtp-ctrl"},
+        PortRecord{1688, "tcp", "nsjtp-data", "nsjtp-data"},
+        PortRecord{1689, "tcp", "firefox", "firefox"},
+        PortRecord{1690, "tcp", "ng-umds", "ng-umds"},
+        PortRecord{1691, "tcp", "empire-empuma", "empire-empuma"},
+        PortRecord{1692, "tcp", "sstsys-lm", "sstsys-lm"},
+        PortRecord{1693, "tcp", "rrirtr", "rrirtr"},
+        PortRecord{1694, "tcp", "rrimwm", "rrimwm"},
+        PortRecord{1695, "tcp", "rrilwm", "rrilwm"},
+        PortRecord{1696, "tcp", "rrifmm", "rrifmm"},
+        PortRecord{1697, "tcp", "rrisat", "rrisat"},
+        PortRecord{1698, "tcp", "rsvp-encap-1", "RSVP-ENCAPSULATION-1"},
+        PortRecord{1699, "tcp", "rsvp-encap-2", "RSVP-ENCAPSULATION-2"},
+        PortRecord{1700, "tcp", "mps-raft", "mps-raft"},
+        PortRecord{1701, "tcp", "l2f", "l2tp"},
+        PortRecord{1702, "tcp", "deskshare", "deskshare"},
+        PortRecord{1703, "tcp", "hb-engine", "hb-engine"},
+        PortRecord{1704, "tcp", "bcs-broker", "bcs-broker"},
+        PortRecord{1705, "tcp", "slingshot", "slingshot"},
+        PortRecord{1706, "tcp", "jetform", "jetform"},
+        PortRecord{1707, "tcp", "vdmplay", "vdmplay"},
+        PortRecord{1708, "tcp", "gat-lmd", "gat-lmd"},
+        PortRecord{1709, "tcp", "centra", "centra"},
+        PortRecord{1710, "tcp", "impera", "impera"},
+        PortRecord{1711, "tcp", "pptconference", "pptconference"},
+        PortRecord{1712, "tcp", "registrar", "resource monitoring service"},
+        PortRecord{1713, "tcp", "conferencetalk", "conferencetalk"},
+        PortRecord{1714, "tcp", "sesi-lm", "sesi-lm"},
+        PortRecord{1715, "tcp", "houdini-lm", "houdini-lm"},
+        PortRecord{1716, "tcp", "xmsg", "xmsg"},
+        PortRecord{1717, "tcp", "fj-hdnet", "fj-hdnet"},
+        PortRecord{1718, "tcp", "h323gatedisc", "H.323 Multicast Gatekeeper Discover"},
+        PortRecord{1719, "tcp", "h323gatestat", "H.323 Unicast Gatekeeper Signaling"},
+        PortRecord{1720, "tcp", "h323q931", "h323q931"},
+        PortRecord{1721, "tcp", "caicci", "caicci"},
+        PortRecord{1722, "tcp", "hks-lm", "HKS License Manager"},
+        PortRecord{1723, "tcp", "pptp", "Point-to-point tunnelling protocol"},
+        PortRecord{1724, "tcp", "csbphonemaster", "csbphonemaster"},
+        PortRecord{1725, "tcp", "iden-ralp", "iden-ralp"},
+        PortRecord{1726, "tcp", "iberiagames", "iberiagames"},
+        PortRecord{1727, "tcp", "winddx", "winddx"},
+        PortRecord{1728, "tcp", "telindus", "telindus"},
+        PortRecord{1729, "tcp", "citynl", "CityNL License Management"},
+        PortRecord{1730, "tcp", "roketz", "roketz"},
+        PortRecord{1731, "tcp", "msiccp", "msiccp"},
+        PortRecord{1732, "tcp", "proxim", "proxim"},
+        PortRecord{1733, "tcp", "siipat", "SIMS - SIIPAT Protocol for Alarm Transmission"},
+        PortRecord{1734, "tcp", "cambertx-lm", "Camber Corporation License Management"},
+        PortRecord{1735, "tcp", "privatechat", "privatechat"},
+        PortRecord{1736, "tcp", "street-stream", "street-stream"},
+        PortRecord{1737, "tcp", "ultimad", "ultimad"},
+        PortRecord{1738, "tcp", "gamegen1", "gamegen1"},
+        PortRecord{1739, "tcp", "webaccess", "webaccess"},
+        PortRecord{1740, "tcp", "encore", "encore"},
+        PortRecord{1741, "tcp", "cisco-net-mgmt", "cisco-net-mgmt"},
+        PortRecord{1742, "tcp", "3Com-nsd", "3Com-nsd"},
+        PortRecord{1743, "tcp", "cinegrfx-lm", "Cinema Graphics License Manager"},
+        PortRecord{1744, "tcp", "ncpm-ft", "ncpm-ft"},
+        PortRecord{1745, "tcp", "remote-winsock", "remote-winsock"},
+        PortRecord{1746, "tcp", "ftrapid-1", "ftrapid-1"},
+        PortRecord{1747, "tcp", "ftrapid-2", "ftrapid-2"},
+        PortRecord{1748, "tcp", "oracle-em1", "oracle-em1"},
+        PortRecord{1749, "tcp", "aspen-services", "aspen-services"},
+        PortRecord{1750, "tcp", "sslp", "Simple Socket Library's PortMaster"},
+        PortRecord{1751, "tcp", "swiftnet", "swiftnet"},
+        PortRecord{1752, "tcp", "lofr-lm", "Leap of Faith Research License Manager"},
+        PortRecord{1753, "tcp", "predatar-comms", "Predatar Comms Service"},
+        PortRecord{1754, "tcp", "oracle-em2", "oracle-em2"},
+        PortRecord{1755, "tcp", "wms", "wms"},
+        PortRecord{1756, "tcp", "capfast-lmd", "capfast-lmd"},
+        PortRecord{1757, "tcp", "cnhrp", "cnhrp"},
+        PortRecord{1758, "tcp", "tftp-mcast", "tftp-mcast"},
+        PortRecord{1759, "tcp", "spss-lm", "SPSS License Manager"},
+        PortRecord{1760, "tcp", "www-ldap-gw", "www-ldap-gw"},
+        PortRecord{1761, "tcp", "landesk-rc", "landesk-rc"},
+        PortRecord{1762, "tcp", "landesk-rc", "landesk-rc"},
+        PortRecord{1763, "tcp", "landesk-rc", "landesk-rc"},
+        PortRecord{1764, "tcp", "landesk-rc", "landesk-rc"},
+        PortRecord{1765, "tcp", "cft-4", "cft-4"},
+        PortRecord{1766, "tcp", "cft-5", "cft-5"},
+        PortRecord{1767, "tcp", "cft-6", "cft-6"},
+        PortRecord{1768, "tcp", "cft-7", "cft-7"},
+        PortRecord{1769, "tcp", "bmc-net-adm", "bmc-net-adm"},
+        PortRecord{1770, "tcp", "bmc-net-svc", "bmc-net-svc"},
+        PortRecord{1771, "tcp", "vaultbase", "vaultbase"},
+        PortRecord{1772, "tcp", "essweb-gw", "EssWeb Gateway"},
+        PortRecord{1773, "tcp", "kmscontrol", "kmscontrol"},
+        PortRecord{1774, "tcp", "global-dtserv", "global-dtserv"},
+        PortRecord{1775, "tcp", "vdab", "data interchange between visual processing containers"},
+        PortRecord{1776, "tcp", "femis", "Federal Emergency Management Information System"},
+        PortRecord{1777, "tcp", "powerguardian", "powerguardian"},
+        PortRecord{1778, "tcp", "prodigy-intrnet", "prodigy-internet"},
+        PortRecord{1779, "tcp", "pharmasoft", "pharmasoft"},
+        PortRecord{1780, "tcp", "dpkeyserv", "dpkeyserv"},
+        PortRecord{1781, "tcp", "answersoft-lm", "answersoft-lm"},
+        PortRecord{1782, "tcp", "hp-hcip", "hp-hcip"},
+        PortRecord{1784, "tcp", "finle-lm", "Finle License Manager"},
+        PortRecord{1785, "tcp", "windlm", "Wind River Systems License Manager"},
+        PortRecord{1786, "tcp", "funk-logger", "funk-logger"},
+        PortRecord{1787, "tcp", "funk-license", "funk-license"},
+        PortRecord{1788, "tcp", "psmond", "psmond"},
+        PortRecord{1789, "tcp", "hello", "hello"},
+        PortRecord{1790, "tcp", "nmsp", "Narrative Media Streaming Protocol"},
+        PortRecord{1791, "tcp", "ea1", "ea1"},
+        PortRecord{1792, "tcp", "ibm-dt-2", "ibm-dt-2"},
+        PortRecord{1793, "tcp", "rsc-robot", "rsc-robot"},
+        PortRecord{1794, "tcp", "cera-bcm", "cera-bcm"},
+        PortRecord{1795, "tcp", "dpi-proxy", "dpi-proxy"},
+        PortRecord{1796, "tcp", "vocaltec-admin", "Vocaltec Server Administration"},
+        PortRecord{1797, "tcp", "uma", "uma"},
+        PortRecord{1798, "tcp", "etp", "Event Transfer Protocol"},
+        PortRecord{1799, "tcp", "netrisk", "netrisk"},
+        PortRecord{1800, "tcp", "ansys-lm", "ANSYS-License manager"},
+        PortRecord{1801, "tcp", "msmq", "msmq"},
+        PortRecord{1802, "tcp", "concomp1", "concomp1"},
+        PortRecord{1803, "tcp", "hp-hcip-gwy", "hp-hcip-gwy"},
+        PortRecord{1804, "tcp", "enl", "enl"},
+        PortRecord{1805, "tcp", "enl-name", "enl-name"},
+        PortRecord{1806, "tcp", "musiconline", "musiconline"},
+        PortRecord{1807, "tcp", "fhsp", "Fujitsu Hot Standby Protocol"},
+        PortRecord{1808, "tcp", "oracle-vp2", "oracle-vp2"},
+        PortRecord{1809, "tcp", "oracle-vp1", "oracle-vp1"},
+        PortRecord{1810, "tcp", "jerand-lm", "Jerand License Manager"},
+        PortRecord{1811, "tcp", "scientia-sdb", "scientia-sdb"},
+        PortRecord{1812, "tcp", "radius", "RADIUS"},
+        PortRecord{1813, "tcp", "radius-acct", "RADIUS Accounting"},
+        PortRecord{1814, "tcp", "tdp-suite", "TDP Suite"},
+        PortRecord{1815, "tcp", "mmpft", "mmpft"},
+        PortRecord{1816, "tcp", "harp", "harp"},
+        PortRecord{1817, "tcp", "rkb-oscs", "rkb-oscs"},
+        PortRecord{1818, "tcp", "etftp", "Enhanced Trivial File Transfer Protocol"},
+        PortRecord{1819, "tcp", "plato-lm", "Plato License Manager"},
+        PortRecord{1820, "tcp", "mcagent", "mcagent"},
+        PortRecord{1821, "tcp", "donnyworld", "donnyworld"},
+        PortRecord{1822, "tcp", "es-elmd", "es-elmd"},
+        PortRecord{1823, "tcp", "unisys-lm", "Unisys Natural Language License Manager"},
+        PortRecord{1824, "tcp", "metrics-pas", "metrics-pas"},
+        PortRecord{1825, "tcp", "direcpc-video", "DirecPC Video"},
+        PortRecord{1826, "tcp", "ardt", "ardt"},
+        PortRecord{1827, "tcp", "pcm", "pcm"},
+        PortRecord{1828, "tcp", "itm-mcell-u", "itm-mcell-u"},
+        PortRecord{1829, "tcp", "optika-emedia", "Optika eMedia"},
+        PortRecord{1830, "tcp", "net8-cman", "Oracle Net8 CMan Admin"},
+        PortRecord{1831, "tcp", "myrtle", "myrtle"},
+        PortRecord{1832, "tcp", "tht-treasure", "ThoughtTreasure"},
+        PortRecord{1833, "tcp", "udpradio", "udpradio"},
+        PortRecord{1834, "tcp", "ardusuni", "ARDUS Unicast"},
+        PortRecord{1835, "tcp", "ardusmul", "ARDUS Multicast"},
+        PortRecord{1836, "tcp", "ste-smsc", "ste-smsc"},
+        PortRecord{1837, "tcp", "csoft1", "csoft1"},
+        PortRecord{1838, "tcp", "talnet", "talnet"},
+        PortRecord{1839, "tcp", "netopia-vo1", "netopia-vo1"},
+        PortRecord{1840, "tcp", "netopia-vo2", "netopia-vo2"},
+        PortRecord{1841, "tcp", "netopia-vo3", "netopia-vo3"},
+        PortRecord{1842, "tcp", "netopia-vo4", "netopia-vo4"},
+        PortRecord{1843, "tcp", "netopia-vo5", "netopia-vo5"},
+        PortRecord{1844, "tcp", "direcpc-dll", "direcpc-dll"},
+        PortRecord{1845, "tcp", "altalink", "altalink"},
+        PortRecord{1846, "tcp", "tunstall-pnc", "Tunstall PNC"},
+        PortRecord{1847, "tcp", "slp-notify", "SLP Notification"},
+        PortRecord{1848, "tcp", "fjdocdist", "fjdocdist"},
+        PortRecord{1849, "tcp", "alpha-sms", "alpha-sms"},
+        PortRecord{1850, "tcp", "gsi", "gsi"},
+        PortRecord{1851, "tcp", "ctcd", "ctcd"},
+        PortRecord{1852, "tcp", "virtual-time", "Virtual Time"},
+        PortRecord{1853, "tcp", "vids-avtp", "vids-avtp"},
+        PortRecord{1854, "tcp", "buddy-draw", "Buddy Draw"},
+        PortRecord{1855, "tcp", "fiorano-rtrsvc", "Fiorano RtrSvc"},
+        PortRecord{1856, "tcp", "fiorano-msgsvc", "Fiorano MsgSvc"},
+        PortRecord{1857, "tcp", "datacaptor", "datacaptor"},
+        PortRecord{1858, "tcp", "privateark", "privateark"},
+        PortRecord{1859, "tcp", "gammafetchsvr", "Gamma Fetcher Server"},
+        PortRecord{1860, "tcp", "sunscalar-svc", "SunSCALAR Services"},
+        PortRecord{1861, "tcp", "lecroy-vicp", "LeCroy VICP"},
+        PortRecord{1862, "tcp", "mysql-cm-agent", "MySQL Cluster Manager Agent"},
+        PortRecord{1863, "tcp", "msnp", "MSN Messenger"},
+        PortRecord{1864, "tcp", "paradym-31", "paradym-31"},
+        PortRecord{1865, "tcp", "entp", "entp"},
+        PortRecord{1866, "tcp", "swrmi", "swrmi"},
+        PortRecord{1867, "tcp", "udrive", "udrive"},
+        PortRecord{1868, "tcp", "viziblebrowser", "viziblebrowser"},
+        PortRecord{1869, "tcp", "transact", "transact"},
+        PortRecord{1870, "tcp", "sunscalar-dns", "SunSCALAR DNS Service"},
+        PortRecord{1871, "tcp", "canocentral0", "Cano Central 0"},
+        PortRecord{1872, "tcp", "canocentral1", "Cano Central 1"},
+        PortRecord{1873, "tcp", "fjmpjps", "fjmpjps"},
+        PortRecord{1874, "tcp", "fjswapsnp", "fjswapsnp"},
+        PortRecord{1875, "tcp", "westell-stats", "westell stats"},
+        PortRecord{1876, "tcp", "ewcappsrv", "ewcappsrv"},
+        PortRecord{1877, "tcp", "hp-webqosdb", "hp-webqosdb"},
+        PortRecord{1878, "tcp", "drmsmc", "drmsmc"},
+        PortRecord{1879, "tcp", "nettgain-nms", "NettGain NMS"},
+        PortRecord{1880, "tcp", "vsat-control", "Gilat VSAT Control"},
+        PortRecord{1881, "tcp", "ibm-mqseries2", "IBM WebSphere MQ Everyplace"},
+        PortRecord{1882, "tcp", "ecsqdmn", "CA eTrust Common Services"},
+        PortRecord{1883, "tcp", "mqtt", "Message Queuing Telemetry Transport Protocol"},
+        PortRecord{1884, "tcp", "idmaps", "Internet Distance Map Svc"},
+        PortRecord{1885, "tcp", "vrtstrapserver", "Veritas Trap Server"},
+        PortRecord{1886, "tcp", "leoip", "Leonardo over IP"},
+        PortRecord{1887, "tcp", "filex-lport", "FileX Listening Port"},
+        PortRecord{1888, "tcp", "ncconfig", "NC Config Port"},
+        PortRecord{1889, "tcp", "unify-adapter", "Unify Web Adapter Service"},
+        PortRecord{1890, "tcp", "wilkenlistener", "wilkenlistener"},
+        PortRecord{1891, "tcp", "childkey-notif", "ChildKey Notification"},
+        PortRecord{1892, "tcp", "childkey-ctrl", "ChildKey Control"},
+        PortRecord{1893, "tcp", "elad", "ELAD Protocol"},
+        PortRecord{1894, "tcp", "o2server-port", "O2Server Port"},
+        PortRecord{1896, "tcp", "b-novative-ls", "b-novative license server"},
+        PortRecord{1897, "tcp", "metaagent", "metaagent"},
+        PortRecord{1898, "tcp", "cymtec-port", "Cymtec secure management"},
+        PortRecord{1899, "tcp", "mc2studios", "mc2studios"},
+        PortRecord{1900, "tcp", "upnp", "Simple Service Discovery Protocol (Universal Plug and Play)"},
+        PortRecord{1901, "tcp", "fjicl-tep-a", "Fujitsu ICL Terminal Emulator Program A"},
+        PortRecord{1902, "tcp", "fjicl-tep-b", "Fujitsu ICL Terminal Emulator Program B"},
+        PortRecord{1903, "tcp", "linkname", "Local Link Name Resolution"},
+        PortRecord{1904, "tcp", "fjicl-tep-c", "Fujitsu ICL Terminal Emulator Program C"},
+        PortRecord{1905, "tcp", "sugp", "Secure UP.Link Gateway Protocol"},
+        PortRecord{1906, "tcp", "tpmd", "TPortMapperReq"},
+        PortRecord{1907, "tcp", "intrastar", "intrastar"},
+        PortRecord{1908, "tcp", "dawn", "dawn"},
+        PortRecord{1909, "tcp", "global-wlink", "Global World Link"},
+        PortRecord{1910, "tcp", "ultrabac", "UltraBac Software communications port"},
+        PortRecord{1911, "tcp", "mtp", "Starlight Networks Multimedia Transport Protocol"},
+        PortRecord{1912, "tcp", "rhp-iibp", "rhp-iibp"},
+        PortRecord{1913, "tcp", "armadp", "armadp"},
+        PortRecord{1914, "tcp", "elm-momentum", "elm-momentum"},
+        PortRecord{1915, "tcp", "facelink", "facelink"},
+        PortRecord{1916, "tcp", "persona", "Persoft Persona"},
+        PortRecord{1917, "tcp", "noagent", "noagent"},
+        PortRecord{1918, "tcp", "can-nds", "IBM Tivole Directory Service - NDS"},
+        PortRecord{1919, "tcp", "can-dch", "IBM Tivoli Directory Service - DCH"},
+        PortRecord{1920, "tcp", "can-ferret", "IBM Tivoli Directory Service - FERRET"},
+        PortRecord{1921, "tcp", "noadmin", "noadmin"},
+        PortRecord{1922, "tcp", "tapestry", "tapestry"},
+        PortRecord{1923, "tcp", "spice", "spice"},
+        PortRecord{1924, "tcp", "xiip", "xiip"},
+        PortRecord{1925, "tcp", "discovery-port", "Surrogate Discovery Port"},
+        PortRecord{1926, "tcp", "egs", "Evolution Game Server"},
+        PortRecord{1927, "tcp", "videte-cipc", "Videte CIPC Port"},
+        PortRecord{1928, "tcp", "emsd-port", "Expnd Maui Srvr Dscovr"},
+        PortRecord{1929, "tcp", "bandwiz-system", "Bandwiz System - Server"},
+        PortRecord{1930, "tcp", "driveappserver", "Drive AppServer"},
+        PortRecord{1931, "tcp", "amdsched", "AMD SCHED"},
+        PortRecord{1932, "tcp", "ctt-broker", "CTT Broker"},
+        PortRecord{1933, "tcp", "xmapi", "IBM LM MT Agent"},
+        PortRecord{1934, "tcp", "xaapi", "IBM LM Appl Agent"},
+        PortRecord{1935, "tcp", "rtmp", "rtmp"},
+        PortRecord{1936, "tcp", "jetcmeserver", "JetCmeServer Server Port"},
+        PortRecord{1937, "tcp", "jwserver", "JetVWay Server Port"},
+        PortRecord{1938, "tcp", "jwclient", "JetVWay Client Port"},
+        PortRecord{1939, "tcp", "jvserver", "JetVision Server Port"},
+        PortRecord{1940, "tcp", "jvclient", "JetVision Client Port"},
+        PortRecord{1941, "tcp", "dic-aida", "dic-aida"},
+        PortRecord{1942, "tcp", "res", "Real Enterprise Service"},
+        PortRecord{1943, "tcp", "beeyond-media", "Beeyond Media"},
+        PortRecord{1944, "tcp", "close-combat", "close-combat"},
+        PortRecord{1945, "tcp", "dialogic-elmd", "dialogic-elmd"},
+        PortRecord{1946, "tcp", "tekpls", "tekpls"},
+        PortRecord{1947, "tcp", "sentinelsrm", "sentinelsrm"},
+        PortRecord{1948, "tcp", "eye2eye", "eye2eye"},
+        PortRecord{1949, "tcp", "ismaeasdaqlive", "ISMA Easdaq Live"},
+        PortRecord{1950, "tcp", "ismaeasdaqtest", "ISMA Easdaq Test"},
+        PortRecord{1951, "tcp", "bcs-lmserver", "bcs-lmserver"},
+        PortRecord{1952, "tcp", "mpnjsc", "mpnjsc"},
+        PortRecord{1953, "tcp", "rapidbase", "Rapid Base"},
+        PortRecord{1954, "tcp", "abr-api", "ABR-API (diskbridge)"},
+        PortRecord{1955, "tcp", "abr-secure", "ABR-Secure Data (diskbridge)"},
+        PortRecord{1956, "tcp", "vrtl-vmf-ds", "Vertel VMF DS"},
+        PortRecord{1957, "tcp", "unix-status", "unix-status"},
+        PortRecord{1958, "tcp", "dxadmind", "CA Administration Daemon"},
+        PortRecord{1959, "tcp", "simp-all", "SIMP Channel"},
+        PortRecord{1960, "tcp", "nasmanager", "Merit DAC NASmanager"},
+        PortRecord{1961, "tcp", "bts-appserver", "BTS APPSERVER"},
+        PortRecord{1962, "tcp", "biap-mp", "biap-mp"},
+        PortRecord{1963, "tcp", "webmachine", "webmachine"},
+        PortRecord{1964, "tcp", "solid-e-engine", "SOLID E ENGINE"},
+        PortRecord{1965, "tcp", "tivoli-npm", "Tivoli NPM"},
+        PortRecord{1966, "tcp", "slush", "slush"},
+        PortRecord{1967, "tcp", "sns-quote", "SNS Quote"},
+        PortRecord{1968, "tcp", "lipsinc", "lipsinc"},
+        PortRecord{1969, "tcp", "lipsinc1", "LIPSinc 1"},
+        PortRecord{1970, "tcp", "netop-rc", "NetOp Remote Control"},
+        PortRecord{1971, "tcp", "netop-school", "NetOp School"},
+        PortRecord{1972, "tcp", "intersys-cache", "Cache"},
+        PortRecord{1973, "tcp", "dlsrap", "Data Link Switching Remote Access Protocol"},
+        PortRecord{1974, "tcp", "drp", "drp"},
+        PortRecord{1975, "tcp", "tcoflashagent", "TCO Flash Agent"},
+        PortRecord{1976, "tcp", "tcoregagent", "TCO Reg Agent"},
+        PortRecord{1977, "tcp", "tcoaddressbook", "TCO Address Book"},
+        PortRecord{1978, "tcp", "unisql", "unisql"},
+        PortRecord{1979, "tcp", "unisql-java", "UniSQL Java"},
+        PortRecord{1980, "tcp", "pearldoc-xact", "PearlDoc XACT"},
+        PortRecord{1981, "tcp", "p2pq", "p2pq"},
+        PortRecord{1982, "tcp", "estamp", "Evidentiary Timestamp"},
+        PortRecord{1983, "tcp", "lhtp", "Loophole Test Protocol"},
+        PortRecord{1984, "tcp", "bigbrother", "bigbrother"},
+        PortRecord{1985, "tcp", "hsrp", "Hot Standby Router Protocol"},
+        PortRecord{1986, "tcp", "licensedaemon", "Cisco license management"},
+        PortRecord{1987, "tcp", "tr-rsrb-p1", "Cisco RSRB Priority 1 port"},
+        PortRecord{1988, "tcp", "tr-rsrb-p2", "Cisco RSRB Priority 2 port"},
+        PortRecord{1989, "tcp", "tr-rsrb-p3", "tr-rsrb-p3"},
+        PortRecord{1990, "tcp", "stun-p1", "Cisco STUN Priority 1 port"},
+        PortRecord{1991, "tcp", "stun-p2", "Cisco STUN Priority 2 port"},
+        PortRecord{1992, "tcp", "stun-p3", "stun-p3"},
+        PortRecord{1993, "tcp", "snmp-tcp-port", "Cisco SNMP TCP port"},
+        PortRecord{1994, "tcp", "stun-port", "Cisco serial tunnel port"},
+        PortRecord{1995, "tcp", "perf-port", "Cisco perf port"},
+        PortRecord{1996, "tcp", "tr-rsrb-port", "Cisco Remote SRB port"},
+        PortRecord{1997, "tcp", "gdp-port", "Cisco Gateway Discovery Protocol"},
+        PortRecord{1998, "tcp", "x25-svc-port", "Cisco X.25 service (XOT)"},
+        PortRecord{1999, "tcp", "tcp-id-port", "Cisco identification port"},
+        PortRecord{2000, "tcp", "cisco-sccp", "cisco-sccp"},
+        PortRecord{2001, "tcp", "dc", "dc"},
+        PortRecord{2002, "tcp", "globe", "globe"},
+        PortRecord{2003, "tcp", "finger", "finger"},
+        PortRecord{2004, "tcp", "mailbox", "mailbox"},
+        PortRecord{2005, "tcp", "deslogin", "deslogin"},
+        PortRecord{2006, "tcp", "invokator", "invokator"},
+        PortRecord{2007, "tcp", "dectalk", "raid-am"},
+        PortRecord{2008, "tcp", "conf", "terminaldb"},
+        PortRecord{2009, "tcp", "news", "whosockami"},
+        PortRecord{2010, "tcp", "search", "search"},
+        PortRecord{2011, "tcp", "raid-cc", "raid-cc"},
+        PortRecord{2012, "tcp", "ttyinfo", "raid-ac"},
+        PortRecord{2013, "tcp", "raid-am", "raid-cd"},
+        PortRecord{2014, "tcp", "troff", "raid-sf"},
+        PortRecord{2015, "tcp", "cypress", "raid-cs"},
+        PortRecord{2016, "tcp", "bootserver", "bootserver"},
+        PortRecord{2017, "tcp", "cypress-stat", "bootclient"},
+        PortRecord{2018, "tcp", "terminaldb", "rellpack"},
+        PortRecord{2019, "tcp", "whosockami", "about"},
+        PortRecord{2020, "tcp", "xinupageserver", "xinupageserver"},
+        PortRecord{2021, "tcp", "servexec", "xinuexpansion1"},
+        PortRecord{2022, "tcp", "down", "xinuexpansion2"},
+        PortRecord{2023, "tcp", "xinuexpansion3", "xinuexpansion3"},
+        PortRecord{2024, "tcp", "xinuexpansion4", "xinuexpansion4"},
+        PortRecord{2025, "tcp", "ellpack", "xribs"},
+        PortRecord{2026, "tcp", "scrabble", "scrabble"},
+        PortRecord{2027, "tcp", "shadowserver", "shadowserver"},
+        PortRecord{2028, "tcp", "submitserver", "submitserver"},
+        PortRecord{2029, "tcp", "hsrpv6", "Hot Standby Router Protocol IPv6"},
+        PortRecord{2030, "tcp", "device2", "device2"},
+        PortRecord{2031, "tcp", "mobrien-chat", "mobrien-chat"},
+        PortRecord{2032, "tcp", "blackboard", "blackboard"},
+        PortRecord{2033, "tcp", "glogger", "glogger"},
+        PortRecord{2034, "tcp", "scoremgr", "scoremgr"},
+        PortRecord{2035, "tcp", "imsldoc", "imsldoc"},
+        PortRecord{2036, "tcp", "e-dpnet", "Ethernet WS DP network"},
+        PortRecord{2037, "tcp", "applus", "APplus Application Server"},
+        PortRecord{2038, "tcp", "objectmanager", "objectmanager"},
+        PortRecord{2039, "tcp", "prizma", "Prizma Monitoring Service"},
+        PortRecord{2040, "tcp", "lam", "lam"},
+        PortRecord{2041, "tcp", "interbase", "interbase"},
+        PortRecord{2042, "tcp", "isis", "isis"},
+        PortRecord{2043, "tcp", "isis-bcast", "isis-bcast"},
+        PortRecord{2044, "tcp", "rimsl", "rimsl"},
+        PortRecord{2045, "tcp", "cdfunc", "cdfunc"},
+        PortRecord{2046, "tcp", "sdfunc", "sdfunc"},
+        PortRecord{2047, "tcp", "dls", "dls"},
+        PortRecord{2048, "tcp", "dls-monitor", "dls-monitor"},
+        PortRecord{2049, "tcp", "nfs", "networked file system"},
+        PortRecord{2050, "tcp", "av-emb-config", "Avaya EMB Config Port"},
+        PortRecord{2051, "tcp", "epnsdp", "epnsdp"},
+        PortRecord{2052, "tcp", "clearvisn", "clearVisn Services Port"},
+        PortRecord{2053, "tcp", "knetd", "knetd"},
+        PortRecord{2054, "tcp", "weblogin", "Weblogin Port"},
+        PortRecord{2055, "tcp", "iop", "Iliad-Odyssey Protocol"},
+        PortRecord{2056, "tcp", "omnisky", "OmniSky Port"},
+        PortRecord{2057, "tcp", "rich-cp", "Rich Content Protocol"},
+        PortRecord{2058, "tcp", "newwavesearch", "NewWaveSearchables RMI"},
+        PortRecord{2059, "tcp", "bmc-messaging", "BMC Messaging Service"},
+        PortRecord{2060, "tcp", "teleniumdaemon", "Telenium Daemon IF"},
+        PortRecord{2061, "tcp", "netmount", "netmount"},
+        PortRecord{2062, "tcp", "icg-swp", "ICG SWP Port"},
+        PortRecord{2063, "tcp", "icg-bridge", "ICG Bridge Port"},
+        PortRecord{2064, "tcp", "dnet-keyproxy", "dnet-keyproxy"},
+        PortRecord{2065, "tcp", "dlsrpn", "Data Link Switch Read Port Number"},
+        PortRecord{2066, "tcp", "aura", "AVM USB Remote Architecture"},
+        PortRecord{2067, "tcp", "dlswpn", "Data Link Switch Write Port Number"},
+        PortRecord{2068, "tcp", "avocentkvm", "avocentkvm"},
+        PortRecord{2069, "tcp", "event-port", "HTTP Event Port"},
+        PortRecord{2070, "tcp", "ah-esp-encap", "AH and ESP Encapsulated in UDP packet"},
+        PortRecord{2071, "tcp", "acp-port", "Axon Control Protocol"},
+        PortRecord{2072, "tcp", "msync", "GlobeCast mSync"},
+        PortRecord{2073, "tcp", "gxs-data-port", "DataReel Database Socket"},
+        PortRecord{2074, "tcp", "vrtl-vmf-sa", "Vertel VMF SA"},
+        PortRecord{2075, "tcp", "newlixengine", "Newlix ServerWare Engine"},
+        PortRecord{2076, "tcp", "newlixconfig", "Newlix JSPConfig"},
+        PortRecord{2077, "tcp", "tsrmagt", "Old Tivoli Storage Manager"},
+        PortRecord{2078, "tcp", "tpcsrvr", "IBM Total Productivity Center Server"},
+        PortRecord{2079, "tcp", "idware-router", "IDWARE Router Port"},
+        PortRecord{2080, "tcp", "autodesk-nlm", "Autodesk NLM (FLEXlm)"},
+        PortRecord{2081, "tcp", "kme-trap-port", "KME PRINTER TRAP PORT"},
+        PortRecord{2082, "tcp", "infowave", "Infowave Mobility Server"},
+        PortRecord{2083, "tcp", "radsec", "Secure Radius Service"},
+        PortRecord{2084, "tcp", "sunclustergeo", "SunCluster Geographic"},
+        PortRecord{2085, "tcp", "ada-cip", "ADA Control"},
+        PortRecord{2086, "tcp", "gnunet", "gnunet"},
+        PortRecord{2087, "tcp", "eli", "ELI - Event Logging Integration"},
+        PortRecord{2088, "tcp", "ip-blf", "IP Busy Lamp Field"},
+        PortRecord{2089, "tcp", "sep", "Security Encapsulation Protocol - SEP"},
+        PortRecord{2090, "tcp", "lrp", "Load Report Protocol"},
+        PortRecord{2091, "tcp", "prp", "prp"},
+        PortRecord{2092, "tcp", "descent3", "Descent 3"},
+        PortRecord{2093, "tcp", "nbx-cc", "NBX CC"},
+        PortRecord{2094, "tcp", "nbx-au", "NBX AU"},
+        PortRecord{2095, "tcp", "nbx-ser", "NBX SER"},
+        PortRecord{2096, "tcp", "nbx-dir", "NBX DIR"},
+        PortRecord{2097, "tcp", "jetformpreview", "Jet Form Preview"},
+        PortRecord{2098, "tcp", "dialog-port", "Dialog Port"},
+        PortRecord{2099, "tcp", "h2250-annex-g", "h2250-annex-g"},
+        PortRecord{2100, "tcp", "amiganetfs", "Amiga Network Filesystem"},
+        PortRecord{2101, "tcp", "rtcm-sc104", "rtcm-sc104"},
+        PortRecord{2102, "tcp", "zephyr-srv", "Zephyr server"},
+        PortRecord{2103, "tcp", "zephyr-clt", "Zephyr serv-hm connection"},
+        PortRecord{2104, "tcp", "zephyr-hm", "Zephyr hostmanager"},
+        PortRecord{2105, "tcp", "eklogin", "eklogin"},
+        PortRecord{2106, "tcp", "ekshell", "ekshell"},
+        PortRecord{2107, "tcp", "msmq-mgmt", "msmq-mgmt"},
+        PortRecord{2108, "tcp", "rkinit", "rkinit"},
+        PortRecord{2109, "tcp", "ergolight", "ergolight"},
+        PortRecord{2110, "tcp", "umsp", "umsp"},
+        PortRecord{2111, "tcp", "kx", "kx"},
+        PortRecord{2112, "tcp", "kip", "kip"},
+        PortRecord{2113, "tcp", "hsl-storm", "HSL StoRM"},
+        PortRecord{2114, "tcp", "newheights", "newheights"},
+        PortRecord{2115, "tcp", "kdm", "Key Distribution Manager"},
+        PortRecord{2116, "tcp", "ccowcmr", "ccowcmr"},
+        PortRecord{2117, "tcp", "mentaclient", "mentaclient"},
+        PortRecord{2118, "tcp", "mentaserver", "mentaserver"},
+        PortRecord{2119, "tcp", "gsigatekeeper", "gsigatekeeper"},
+        PortRecord{2120, "tcp", "kauth", "kauth"},
+        PortRecord{2121, "tcp", "ccproxy-ftp", "CCProxy File Transfer Protocol"},
+        PortRecord{2122, "tcp", "caupc-remote", "CauPC Remote Control"},
+        PortRecord{2123, "tcp", "gtp-control", "GTP-Control Plane (3GPP)"},
+        PortRecord{2124, "tcp", "elatelink", "elatelink"},
+        PortRecord{2125, "tcp", "lockstep", "lockstep"},
+        PortRecord{2126, "tcp", "pktcable-cops", "pktcable-cops"},
+        PortRecord{2127, "tcp", "index-pc-wb", "index-pc-wb"},
+        PortRecord{2128, "tcp", "net-steward", "Net Steward Control"},
+        PortRecord{2129, "tcp", "cs-live", "cs-live.com"},
+        PortRecord{2130, "tcp", "xds", "xds"},
+        PortRecord{2131, "tcp", "avantageb2b", "avantageb2b"},
+        PortRecord{2132, "tcp", "solera-epmap", "SoleraTec End Point Map"},
+        PortRecord{2133, "tcp", "zymed-zpp", "zymed-zpp"},
+        PortRecord{2134, "tcp", "avenue", "avenue"},
+        PortRecord{2135, "tcp", "gris", "Grid Resource Information Server"},
+        PortRecord{2136, "tcp", "appworxsrv", "appworxsrv"},
+        PortRecord{2137, "tcp", "connect", "connect"},
+        PortRecord{2138, "tcp", "unbind-cluster", "unbind-cluster"},
+        PortRecord{2139, "tcp", "ias-auth", "ias-auth"},
+        PortRecord{2140, "tcp", "ias-reg", "ias-reg"},
+        PortRecord{2141, "tcp", "ias-admind", "ias-admind"},
+        PortRecord{2142, "tcp", "tdmoip", "TDM OVER IP"},
+        PortRecord{2143, "tcp", "lv-jc", "Live Vault Job Control"},
+        PortRecord{2144, "tcp", "lv-ffx", "Live Vault Fast Object Transfer"},
+        PortRecord{2145, "tcp", "lv-pici", "Live Vault Remote Diagnostic Console Support"},
+        PortRecord{2146, "tcp", "lv-not", "Live Vault Admin Event Notification"},
+        PortRecord{2147, "tcp", "lv-auth", "Live Vault Authentication"},
+        PortRecord{2148, "tcp", "veritas-ucl", "veritas-ucl"},
+        PortRecord{2149, "tcp", "acptsys", "acptsys"},
+        PortRecord{2150, "tcp", "dynamic3d", "dynamic3d"},
+        PortRecord{2151, "tcp", "docent", "docent"},
+        PortRecord{2152, "tcp", "gtp-user", "GTP-User Plane (3GPP)"},
+        PortRecord{2153, "tcp", "ctlptc", "Control Protocol"},
+        PortRecord{2154, "tcp", "stdptc", "Standard Protocol"},
+        PortRecord{2155, "tcp", "brdptc", "Bridge Protocol"},
+        PortRecord{2156, "tcp", "trp", "Talari Reliable Protocol"},
+        PortRecord{2157, "tcp", "xnds", "Xerox Network Document Scan Protocol"},
+        PortRecord{2158, "tcp", "touchnetplus", "TouchNetPlus Service"},
+        PortRecord{2159, "tcp", "gdbremote", "GDB Remote Debug Port"},
+        PortRecord{2160, "tcp", "apc-2160", "APC 2160"},
+        PortRecord{2161, "tcp", "apc-agent", "apc-agent"},
+        PortRecord{2162, "tcp", "navisphere", "navisphere"},
+        PortRecord{2163, "tcp", "navisphere-sec", "Navisphere Secure"},
+        PortRecord{2164, "tcp", "ddns-v3", "Dynamic DNS Version 3"},
+        PortRecord{2165, "tcp", "x-bone-api", "X-Bone API"},
+        PortRecord{2166, "tcp", "iwserver", "iwserver"},
+        PortRecord{2167, "tcp", "raw-serial", "Raw Async Serial Link"},
+        PortRecord{2168, "tcp", "easy-soft-mux", "easy-soft Multiplexer"},
+        PortRecord{2169, "tcp", "brain", "Backbone for Academic Information Notification (BRAIN)"},
+        PortRecord{2170, "tcp", "eyetv", "EyeTV Server Port"},
+        PortRecord{2171, "tcp", "msfw-storage", "MS Firewall Storage"},
+        PortRecord{2172, "tcp", "msfw-s-storage", "MS Firewall SecureStorage"},
+        PortRecord{2173, "tcp", "msfw-replica", "MS Firewall Replication"},
+        PortRecord{2174, "tcp", "msfw-array", "MS Firewall Intra Array"},
+        PortRecord{2175, "tcp", "airsync", "Microsoft Desktop AirSync Protocol"},
+        PortRecord{2176, "tcp", "rapi", "Microsoft ActiveSync Remote API"},
+        PortRecord{2177, "tcp", "qwave", "qWAVE Bandwidth Estimate"},
+        PortRecord{2178, "tcp", "bitspeer", "Peer Services for BITS"},
+        PortRecord{2179, "tcp", "vmrdp", "Microsoft RDP for virtual machines"},
+        PortRecord{2180, "tcp", "mc-gt-srv", "Millicent Vendor Gateway Server"},
+        PortRecord{2181, "tcp", "eforward", "eforward"},
+        PortRecord{2182, "tcp", "cgn-stat", "CGN status"},
+        PortRecord{2183, "tcp", "cgn-config", "Code Green configuration"},
+        PortRecord{2184, "tcp", "nvd", "NVD User"},
+        PortRecord{2185, "tcp", "onbase-dds", "OnBase Distributed Disk Services"},
+        PortRecord{2186, "tcp", "gtaua", "Guy-Tek Automated Update Applications"},
+        PortRecord{2187, "tcp", "ssmc", "ssmc"},
+        PortRecord{2188, "tcp", "radware-rpm", "Radware Resource Pool Manager"},
+        PortRecord{2189, "tcp", "radware-rpm-s", "Secure Radware Resource Pool Manager"},
+        PortRecord{2190, "tcp", "tivoconnect", "TiVoConnect Beacon"},
+        PortRecord{2191, "tcp", "tvbus", "TvBus Messaging"},
+        PortRecord{2192, "tcp", "asdis", "ASDIS software management"},
+        PortRecord{2193, "tcp", "drwcs", "Dr.Web Enterprise Management Service"},
+        PortRecord{2197, "tcp", "mnp-exchange", "MNP data exchange"},
+        PortRecord{2198, "tcp", "onehome-remote", "OneHome Remote Access"},
+        PortRecord{2199, "tcp", "onehome-help", "OneHome Service Port"},
+        PortRecord{2200, "tcp", "ici", "ici"},
+        PortRecord{2201, "tcp", "ats", "Advanced Training System Program"},
+        PortRecord{2202, "tcp", "imtc-map", "Int. Multimedia Teleconferencing Cosortium"},
+        PortRecord{2203, "tcp", "b2-runtime", "b2 Runtime Protocol"},
+        PortRecord{2204, "tcp", "b2-license", "b2 License Server"},
+        PortRecord{2205, "tcp", "jps", "Java Presentation Server"},
+        PortRecord{2206, "tcp", "hpocbus", "HP OpenCall bus"},
+        PortRecord{2207, "tcp", "hpssd", "HP Status and Services"},
+        PortRecord{2208, "tcp", "hpiod", "HP I/O Backend"},
+        PortRecord{2209, "tcp", "rimf-ps", "HP RIM for Files Portal Service"},
+        PortRecord{2210, "tcp", "noaaport", "NOAAPORT Broadcast Network"},
+        PortRecord{2211, "tcp", "emwin", "emwin"},
+        PortRecord{2212, "tcp", "leecoposserver", "LeeCO POS Server Service"},
+        PortRecord{2213, "tcp", "kali", "kali"},
+        PortRecord{2214, "tcp", "rpi", "RDQ Protocol Interface"},
+        PortRecord{2215, "tcp", "ipcore", "IPCore.co.za GPRS"},
+        PortRecord{2216, "tcp", "vtu-comms", "VTU data service"},
+        PortRecord{2217, "tcp", "gotodevice", "GoToDevice Device Management"},
+        PortRecord{2218, "tcp", "bounzza", "Bounzza IRC Proxy"},
+        PortRecord{2219, "tcp", "netiq-ncap", "NetIQ NCAP Protocol"},
+        PortRecord{2220, "tcp", "netiq", "NetIQ End2End"},
+        PortRecord{2221, "tcp", "rockwell-csp1", "rockwell-csp1"},
+        PortRecord{2222, "tcp", "EtherNetIP-1", "EtherNetIP-1"},
+        PortRecord{2223, "tcp", "rockwell-csp2", "Rockwell CSP2"},
+        PortRecord{2224, "tcp", "efi-mg", "Easy Flexible Internet/Multiplayer Games"},
+        PortRecord{2225, "tcp", "rcip-itu", "Resource Connection Initiation Protocol"},
+        PortRecord{2226, "tcp", "di-drm", "Digital Instinct DRM"},
+        PortRecord{2227, "tcp", "di-msg", "DI Messaging Service"},
+        PortRecord{2228, "tcp", "ehome-ms", "eHome Message Server"},
+        PortRecord{2229, "tcp", "datalens", "DataLens Service"},
+        PortRecord{2230, "tcp", "queueadm", "MetaSoft Job Queue Administration Service"},
+        PortRecord{2231, "tcp", "wimaxasncp", "WiMAX ASN Control Plane Protocol"},
+        PortRecord{2232, "tcp", "ivs-video", "IVS Video default"},
+        PortRecord{2233, "tcp", "infocrypt", "infocrypt"},
+        PortRecord{2234, "tcp", "directplay", "directplay"},
+        PortRecord{2235, "tcp", "sercomm-wlink", "sercomm-wlink"},
+        PortRecord{2236, "tcp", "nani", "nani"},
+        PortRecord{2237, "tcp", "optech-port1-lm", "Optech Port1 License Manager"},
+        PortRecord{2238, "tcp", "aviva-sna", "AVIVA SNA SERVER"},
+        PortRecord{2239, "tcp", "imagequery", "Image Query"},
+        PortRecord{2240, "tcp", "recipe", "recipe"},
+        PortRecord{2241, "tcp", "ivsd", "IVS Daemon"},
+        PortRecord{2242, "tcp", "foliocorp", "Folio Remote Server"},
+        PortRecord{2243, "tcp", "magicom", "Magicom Protocol"},
+        PortRecord{2244, "tcp", "nmsserver", "NMS Server"},
+        PortRecord{2245, "tcp", "hao", "hao"},
+        PortRecord{2246, "tcp", "pc-mta-addrmap", "PacketCable MTA Addr Map"},
+        PortRecord{2247, "tcp", "antidotemgrsvr", "Antidote Deployment Manager Service"},
+        PortRecord{2248, "tcp", "ums", "User Management Service"},
+        PortRecord{2249, "tcp", "rfmp", "RISO File Manager Protocol"},
+        PortRecord{2250, "tcp", "remote-collab", "remote-collab"},
+        PortRecord{2251, "tcp", "dif-port", "Distributed Framework Port"},
+        PortRecord{2252, "tcp", "njenet-ssl", "NJENET using SSL"},
+        PortRecord{2253, "tcp", "dtv-chan-req", "DTV Channel Request"},
+        PortRecord{2254, "tcp", "seispoc", "Seismic P.O.C. Port"},
+        PortRecord{2255, "tcp", "vrtp", "VRTP - ViRtue Transfer Protocol"},
+        PortRecord{2256, "tcp", "pcc-mfp", "PCC MFP"},
+        PortRecord{2257, "tcp", "simple-tx-rx", "simple text/file transfer"},
+        PortRecord{2258, "tcp", "rcts", "Rotorcraft Communications Test System"},
+        PortRecord{2259, "tcp", "acd-pm", "Accedian Performance Measurement"},
+        PortRecord{2260, "tcp", "apc-2260", "APC 2260"},
+        PortRecord{2261, "tcp", "comotionmaster", "CoMotion Master Server"},
+        PortRecord{2262, "tcp", "comotionback", "CoMotion Backup Server"},
+        PortRecord{2263, "tcp", "ecwcfg", "ECweb Configuration Service"},
+        PortRecord{2264, "tcp", "apx500api-1", "Audio Precision Apx500 API Port 1"},
+        PortRecord{2265, "tcp", "apx500api-2", "Audio Precision Apx500 API Port 2"},
+        PortRecord{2266, "tcp", "mfserver", "mfserver"},
+        PortRecord{2267, "tcp", "ontobroker", "ontobroker"},
+        PortRecord{2268, "tcp", "amt", "amt"},
+        PortRecord{2269, "tcp", "mikey", "mikey"},
+        PortRecord{2270, "tcp", "starschool", "starschool"},
+        PortRecord{2271, "tcp", "mmcals", "Secure Meeting Maker Scheduling"},
+        PortRecord{2272, "tcp", "mmcal", "Meeting Maker Scheduling"},
+        PortRecord{2273, "tcp", "mysql-im", "MySQL Instance Manager"},
+        PortRecord{2274, "tcp", "pcttunnell", "PCTTunneller"},
+        PortRecord{2275, "tcp", "ibridge-data", "iBridge Conferencing"},
+        PortRecord{2276, "tcp", "ibridge-mgmt", "iBridge Management"},
+        PortRecord{2277, "tcp", "bluectrlproxy", "Bt device control proxy"},
+        PortRecord{2278, "tcp", "s3db", "Simple Stacked Sequences Database"},
+        PortRecord{2279, "tcp", "xmquery", "xmquery"},
+        PortRecord{2280, "tcp", "lnvpoller", "lnvpoller"},
+        PortRecord{2281, "tcp", "lnvconsole", "lnvconsole"},
+        PortRecord{2282, "tcp", "lnvalarm", "lnvalarm"},
+        PortRecord{2283, "tcp", "lnvstatus", "lnvstatus"},
+        PortRecord{2284, "tcp", "lnvmaps", "lnvmaps"},
+        PortRecord{2285, "tcp", "lnvmailmon", "lnvmailmon"},
+        PortRecord{2286, "tcp", "nas-metering", "nas-metering"},
+        PortRecord{2287, "tcp", "dna", "dna"},
+        PortRecord{2288, "tcp", "netml", "netml"},
+        PortRecord{2289, "tcp", "dict-lookup", "Lookup dict server"},
+        PortRecord{2290, "tcp", "sonus-logging", "Sonus Logging Services"},
+        PortRecord{2291, "tcp", "eapsp", "EPSON Advanced Printer Share Protocol"},
+        PortRecord{2292, "tcp", "mib-streaming", "Sonus Element Management Services"},
+        PortRecord{2293, "tcp", "npdbgmngr", "Network Platform Debug Manager"},
+        PortRecord{2294, "tcp", "konshus-lm", "Konshus License Manager (FLEX)"},
+        PortRecord{2295, "tcp", "advant-lm", "Advant License Manager"},
+        PortRecord{2296, "tcp", "theta-lm", "Theta License Manager (Rainbow)"},
+        PortRecord{2297, "tcp", "d2k-datamover1", "D2K DataMover 1"},
+        PortRecord{2298, "tcp", "d2k-datamover2", "D2K DataMover 2"},
+        PortRecord{2299, "tcp", "pc-telecommute", "PC Telecommute"},
+        PortRecord{2300, "tcp", "cvmmon", "cvmmon"},
+        PortRecord{2301, "tcp", "compaqdiag", "compaqdiag"},
+        PortRecord{2302, "tcp", "binderysupport", "Bindery Support"},
+        PortRecord{2303, "tcp", "proxy-gateway", "Proxy Gateway"},
+        PortRecord{2304, "tcp", "attachmate-uts", "Attachmate UTS"},
+        PortRecord{2305, "tcp", "mt-scaleserver", "MT ScaleServer"},
+        PortRecord{2306, "tcp", "tappi-boxnet", "TAPPI BoxNet"},
+        PortRecord{2307, "tcp", "pehelp", "pehelp"},
+        PortRecord{2308, "tcp", "sdhelp", "sdhelp"},
+        PortRecord{2309, "tcp", "sdserver", "SD Server"},
+        PortRecord{2310, "tcp", "sdclient", "SD Client"},
+        PortRecord{2311, "tcp", "messageservice", "Message Service"},
+        PortRecord{2312, "tcp", "wanscaler", "WANScaler Communication Service"},
+        PortRecord{2313, "tcp", "iapp", "IAPP (Inter Access Point Protocol)"},
+        PortRecord{2314, "tcp", "cr-websystems", "CR WebSystems"},
+        PortRecord{2315, "tcp", "precise-sft", "Precise Sft."},
+        PortRecord{2316, "tcp", "sent-lm", "SENT License Manager"},
+        PortRecord{2317, "tcp", "attachmate-g32", "Attachmate G32"},
+        PortRecord{2318, "tcp", "cadencecontrol", "Cadence Control"},
+        PortRecord{2319, "tcp", "infolibria", "infolibria"},
+        PortRecord{2320, "tcp", "siebel-ns", "Siebel NS"},
+        PortRecord{2321, "tcp", "rdlap", "rdlap"},
+        PortRecord{2322, "tcp", "ofsd", "ofsd"},
+        PortRecord{2323, "tcp", "3d-nfsd", "3d-nfsd"},
+        PortRecord{2324, "tcp", "cosmocall", "cosmocall"},
+        PortRecord{2325, "tcp", "ansysli", "ANSYS Licensing Interconnect"},
+        PortRecord{2326, "tcp", "idcp", "idcp"},
+        PortRecord{2327, "tcp", "xingcsm", "xingcsm"},
+        PortRecord{2328, "tcp", "netrix-sftm", "Netrix SFTM"},
+        PortRecord{2329, "tcp", "nvd", "nvd"},
+        PortRecord{2330, "tcp", "tscchat", "tscchat"},
+        PortRecord{2331, "tcp", "agentview", "agentview"},
+        PortRecord{2332, "tcp", "rcc-host", "RCC Host"},
+        PortRecord{2333, "tcp", "snapp", "snapp"},
+        PortRecord{2334, "tcp", "ace-client", "ACE Client Auth"},
+        PortRecord{2335, "tcp", "ace-proxy", "ACE Proxy"},
+        PortRecord{2336, "tcp", "appleugcontrol", "Apple UG Control"},
+        PortRecord{2337, "tcp", "ideesrv", "ideesrv"},
+        PortRecord{2338, "tcp", "norton-lambert", "Norton Lambert"},
+        PortRecord{2339, "tcp", "3com-webview", "3Com WebView"},
+        PortRecord{2340, "tcp", "wrs_registry", "wrs_registry"},
+        PortRecord{2341, "tcp", "xiostatus", "XIO Status"},
+        PortRecord{2342, "tcp", "manage-exec", "Seagate Manage Exec"},
+        PortRecord{2343, "tcp", "nati-logos", "nati logos"},
+        PortRecord{2344, "tcp", "fcmsys", "fcmsys"},
+        PortRecord{2345, "tcp", "dbm", "dbm"},
+        PortRecord{2346, "tcp", "redstorm_join", "redstorm_join"},
+        PortRecord{2347, "tcp", "redstorm_find", "redstorm_find"},
+        PortRecord{2348, "tcp", "redstorm_info", "redstorm_info"},
+        PortRecord{2349, "tcp", "redstorm_diag", "redstorm_diag"},
+        PortRecord{2350, "tcp", "psbserver", "Pharos Booking Server"},
+        PortRecord{2351, "tcp", "psrserver", "psrserver"},
+        PortRecord{2352, "tcp", "pslserver", "pslserver"},
+        PortRecord{2353, "tcp", "pspserver", "pspserver"},
+        PortRecord{2354, "tcp", "psprserver", "psprserver"},
+        PortRecord{2355, "tcp", "psdbserver", "psdbserver"},
+        PortRecord{2356, "tcp", "gxtelmd", "GXT License Managemant"},
+        PortRecord{2357, "tcp", "unihub-server", "UniHub Server"},
+        PortRecord{2358, "tcp", "futrix", "futrix"},
+        PortRecord{2359, "tcp", "flukeserver", "flukeserver"},
+        PortRecord{2360, "tcp", "nexstorindltd", "nexstorindltd"},
+        PortRecord{2361, "tcp", "tl1", "tl1"},
+        PortRecord{2362, "tcp", "digiman", "digiman"},
+        PortRecord{2363, "tcp", "mediacntrlnfsd", "Media Central NFSD"},
+        PortRecord{2364, "tcp", "oi-2000", "oi-2000"},
+        PortRecord{2365, "tcp", "dbref", "dbref"},
+        PortRecord{2366, "tcp", "qip-login", "qip-login"},
+        PortRecord{2367, "tcp", "service-ctrl", "Service Control"},
+        PortRecord{2368, "tcp", "opentable", "opentable"},
+        PortRecord{2370, "tcp", "l3-hbmon", "l3-hbmon"},
+        PortRecord{2371, "tcp", "worldwire", "worldwire"},
+        PortRecord{2372, "tcp", "lanmessenger", "lanmessenger"},
+        PortRecord{2373, "tcp", "remographlm", "Remograph License Manager"},
+        PortRecord{2374, "tcp", "hydra", "Hydra RPC"},
+        PortRecord{2375, "tcp", "docker", "docker"},
+        PortRecord{2376, "tcp", "docker", "docker"},
+        PortRecord{2377, "tcp", "swarm", "RPC interface for Docker Swarm"},
+        PortRecord{2379, "tcp", "etcd-client", "etcd client communication"},
+        PortRecord{2380, "tcp", "etcd-server", "etcd server to server communication"},
+        PortRecord{2381, "tcp", "compaq-https", "Compaq HTTPS"},
+        PortRecord{2382, "tcp", "ms-olap3", "Microsoft OLAP"},
+        PortRecord{2383, "tcp", "ms-olap4", "ms-olap4"},
+        PortRecord{2384, "tcp", "sd-request", "sd-request"},
+        PortRecord{2385, "tcp", "sd-data", "sd-data"},
+        PortRecord{2386, "tcp", "virtualtape", "Virtual Tape"},
+        PortRecord{2387, "tcp", "vsamredirector", "VSAM Redirector"},
+        PortRecord{2388, "tcp", "mynahautostart", "MYNAH AutoStart"},
+        PortRecord{2389, "tcp", "ovsessionmgr", "OpenView Session Mgr"},
+        PortRecord{2390, "tcp", "rsmtp", "rsmtp"},
+        PortRecord{2391, "tcp", "3com-net-mgmt", "3COM Net Management"},
+        PortRecord{2392, "tcp", "tacticalauth", "Tactical Auth"},
+        PortRecord{2393, "tcp", "ms-olap1", "ms-olap1"},
+        PortRecord{2394, "tcp", "ms-olap2", "ms-olap2"},
+        PortRecord{2395, "tcp", "lan900_remote", "lan900_remote"},
+        PortRecord{2396, "tcp", "wusage", "wusage"},
+        PortRecord{2397, "tcp", "ncl", "ncl"},
+        PortRecord{2398, "tcp", "orbiter", "orbiter"},
+        PortRecord{2399, "tcp", "fmpro-fdal", "FileMaker Inc. - Data Access Layer"},
+        PortRecord{2400, "tcp", "opequus-server", "OpEquus Server"},
+        PortRecord{2401, "tcp", "cvspserver", "CVS network server"},
+        PortRecord{2402, "tcp", "taskmaster2000", "TaskMaster 2000 Server"},
+        PortRecord{2403, "tcp", "taskmaster2000", "TaskMaster 2000 Web"},
+        PortRecord{2404, "tcp", "iec-104", "IEC 60870-5-104 process control over IP"},
+        PortRecord{2405, "tcp", "trc-netpoll", "TRC Netpoll"},
+        PortRecord{2406, "tcp", "jediserver", "jediserver"},
+        PortRecord{2407, "tcp", "orion", "orion"},
+        PortRecord{2408, "tcp", "optimanet", "optimanet"},
+        PortRecord{2409, "tcp", "sns-protocol", "SNS Protocol"},
+        PortRecord{2410, "tcp", "vrts-registry", "VRTS Registry"},
+        PortRecord{2411, "tcp", "netwave-ap-mgmt", "Netwave AP Management"},
+        PortRecord{2412, "tcp", "cdn", "cdn"},
+        PortRecord{2413, "tcp", "orion-rmi-reg", "orion-rmi-reg"},
+        PortRecord{2414, "tcp", "beeyond", "beeyond"},
+        PortRecord{2415, "tcp", "codima-rtp", "Codima Remote Transaction Protocol"},
+        PortRecord{2416, "tcp", "rmtserver", "RMT Server"},
+        PortRecord{2417, "tcp", "composit-server", "Composit Server"},
+        PortRecord{2418, "tcp", "cas", "cas"},
+        PortRecord{2419, "tcp", "attachmate-s2s", "Attachmate S2S"},
+        PortRecord{2420, "tcp", "dslremote-mgmt", "DSL Remote Management"},
+        PortRecord{2421, "tcp", "g-talk", "g-talk"},
+        PortRecord{2422, "tcp", "crmsbits", "crmsbits"},
+        PortRecord{2423, "tcp", "rnrp", "rnrp"},
+        PortRecord{2424, "tcp", "kofax-svr", "kofax-svr"},
+        PortRecord{2425, "tcp", "fjitsuappmgr", "Fujitsu App Manager"},
+        PortRecord{2426, "tcp", "vcmp", "VeloCloud MultiPath Protocol"},
+        PortRecord{2427, "tcp", "mgcp-gateway", "Media Gateway Control Protocol Gateway"},
+        PortRecord{2428, "tcp", "ott", "One Way Trip Time"},
+        PortRecord{2429, "tcp", "ft-role", "ft-role"},
+        PortRecord{2430, "tcp", "venus", "venus"},
+        PortRecord{2431, "tcp", "venus-se", "venus-se"},
+        PortRecord{2432, "tcp", "codasrv", "codasrv"},
+        PortRecord{2433, "tcp", "codasrv-se", "codasrv-se"},
+        PortRecord{2434, "tcp", "pxc-epmap", "pxc-epmap"},
+        PortRecord{2435, "tcp", "optilogic", "optilogic"},
+        PortRecord{2436, "tcp", "topx", "TOP/X"},
+        PortRecord{2437, "tcp", "unicontrol", "unicontrol"},
+        PortRecord{2438, "tcp", "msp", "msp"},
+        PortRecord{2439, "tcp", "sybasedbsynch", "sybasedbsynch"},
+        PortRecord{2440, "tcp", "spearway", "Spearway Lockers"},
+        PortRecord{2441, "tcp", "pvsw-inet", "Pervasive I*net Data Server"},
+        PortRecord{2442, "tcp", "netangel", "netangel"},
+        PortRecord{2443, "tcp", "powerclientcsf", "PowerClient Central Storage Facility"},
+        PortRecord{2444, "tcp", "btpp2sectrans", "BT PP2 Sectrans"},
+        PortRecord{2445, "tcp", "dtn1", "dtn1"},
+        PortRecord{2446, "tcp", "bues_service", "bues-service"},
+        PortRecord{2447, "tcp", "ovwdb", "OpenView NNM Daemon"},
+        PortRecord{2448, "tcp", "hpppssvr", "hpppsvr"},
+        PortRecord{2449, "tcp", "ratl", "ratl"},
+        PortRecord{2450, "tcp", "netadmin", "netadmin"},
+        PortRecord{2451, "tcp", "netchat", "netchat"},
+        PortRecord{2452, "tcp", "snifferclient", "snifferclient"},
+        PortRecord{2453, "tcp", "madge-ltd", "madge ltd"},
+        PortRecord{2454, "tcp", "indx-dds", "indx-dds"},
+        PortRecord{2455, "tcp", "wago-io-system", "wago-io-system"},
+        PortRecord{2456, "tcp", "altav-remmgt", "altav-remmgt"},
+        PortRecord{2457, "tcp", "rapido-ip", "Rapido_IP"},
+        PortRecord{2458, "tcp", "griffin", "griffin"},
+        PortRecord{2459, "tcp", "community", "xrpl"},
+        PortRecord{2460, "tcp", "ms-theater", "ms-theater"},
+        PortRecord{2461, "tcp", "qadmifoper", "qadmifoper"},
+        PortRecord{2462, "tcp", "qadmifevent", "qadmifevent"},
+        PortRecord{2463, "tcp", "lsi-raid-mgmt", "LSI RAID Management"},
+        PortRecord{2464, "tcp", "direcpc-si", "DirecPC SI"},
+        PortRecord{2465, "tcp", "lbm", "Load Balance Management"},
+        PortRecord{2466, "tcp", "lbf", "Load Balance Forwarding"},
+        PortRecord{2467, "tcp", "high-criteria", "High Criteria"},
+        PortRecord{2468, "tcp", "qip-msgd", "qip_msgd"},
+        PortRecord{2469, "tcp", "mti-tcs-comm", "mti-tcs-comm"},
+        PortRecord{2470, "tcp", "taskman-port", "taskman port"},
+        PortRecord{2471, "tcp", "seaodbc", "seaodbc"},
+        PortRecord{2472, "tcp", "c3", "c3"},
+        PortRecord{2473, "tcp", "aker-cdp", "aker-cdp"},
+        PortRecord{2474, "tcp", "vitalanalysis", "Vital Analysis"},
+        PortRecord{2475, "tcp", "ace-server", "ACE Server"},
+        PortRecord{2476, "tcp", "ace-svr-prop", "ACE Server Propagation"},
+        PortRecord{2477, "tcp", "ssm-cvs", "SecurSight Certificate Valifation Service"},
+        PortRecord{2478, "tcp", "ssm-cssps", "SecurSight Authentication Server (SSL)"},
+        PortRecord{2479, "tcp", "ssm-els", "SecurSight Event Logging Server (SSL)"},
+        PortRecord{2480, "tcp", "powerexchange", "Informatica PowerExchange Listener"},
+        PortRecord{2481, "tcp", "giop", "Oracle GIOP"},
+        PortRecord{2482, "tcp", "giop-ssl", "Oracle GIOP SSL"},
+        PortRecord{2483, "tcp", "ttc", "Oracle TTC"},
+        PortRecord{2484, "tcp", "ttc-ssl", "Oracle TTC SSL"},
+        PortRecord{2485, "tcp", "netobjects1", "Net Objects1"},
+        PortRecord{2486, "tcp", "netobjects2", "Net Objects2"},
+        PortRecord{2487, "tcp", "pns", "Policy Notice Service"},
+        PortRecord{2488, "tcp", "moy-corp", "Moy Corporation"},
+        PortRecord{2489, "tcp", "tsilb", "tsilb"},
+        PortRecord{2490, "tcp", "qip-qdhcp", "qip_qdhcp"},
+        PortRecord{2491, "tcp", "conclave-cpp", "Conclave CPP"},
+        PortRecord{2492, "tcp", "groove", "groove"},
+        PortRecord{2493, "tcp", "talarian-mqs", "Talarian MQS"},
+        PortRecord{2494, "tcp", "bmc-ar", "BMC AR"},
+        PortRecord{2495, "tcp", "fast-rem-serv", "Fast Remote Services"},
+        PortRecord{2496, "tcp", "dirgis", "dirgis"},
+        PortRecord{2497, "tcp", "quaddb", "Quad DB"},
+        PortRecord{2498, "tcp", "odn-castraq", "odn-castraq"},
+        PortRecord{2499, "tcp", "unicontrol", "unicontrol"},
+        PortRecord{2500, "tcp", "rtsserv", "Resource Tracking system server"},
+        PortRecord{2501, "tcp", "rtsclient", "Resource Tracking system client"},
+        PortRecord{2502, "tcp", "kentrox-prot", "Kentrox Protocol"},
+        PortRecord{2503, "tcp", "nms-dpnss", "nms-dpnss"},
+        PortRecord{2504, "tcp", "wlbs", "wlbs"},
+        PortRecord{2505, "tcp", "ppcontrol", "PowerPlay Control"},
+        PortRecord{2506, "tcp", "jbroker", "jbroker"},
+        PortRecord{2507, "tcp", "spock", "spock"},
+        PortRecord{2508, "tcp", "jdatastore", "jdatastore"},
+        PortRecord{2509, "tcp", "fjmpss", "fjmpss"},
+        PortRecord{2510, "tcp", "fjappmgrbulk", "fjappmgrbulk"},
+        PortRecord{2511, "tcp", "metastorm", "metastorm"},
+        PortRecord{2512, "tcp", "citrixima", "Citrix IMA"},
+        PortRecord{2513, "tcp", "citrixadmin", "Citrix ADMIN"},
+        PortRecord{2514, "tcp", "facsys-ntp", "Facsys NTP"},
+        PortRecord{2515, "tcp", "facsys-router", "Facsys Router"},
+        PortRecord{2516, "tcp", "maincontrol", "Main Control"},
+        PortRecord{2517, "tcp", "call-sig-trans", "call-sig-trans"},
+        PortRecord{2518, "tcp", "willy", "willy"},
+        PortRecord{2519, "tcp", "globmsgsvc", "globmsgsvc"},
+        PortRecord{2520, "tcp", "pvsw", "Pervasive Listener"},
+        PortRecord{2521, "tcp", "adaptecmgr", "Adaptec Manager"},
+        PortRecord{2522, "tcp", "windb", "windb"},
+        PortRecord{2523, "tcp", "qke-llc-v3", "Qke LLC V.3"},
+        PortRecord{2524, "tcp", "optiwave-lm", "Optiwave License Management"},
+        PortRecord{2525, "tcp", "ms-v-worlds", "MS V-Worlds"},
+        PortRecord{2526, "tcp", "ema-sent-lm", "EMA License Manager"},
+        PortRecord{2527, "tcp", "iqserver", "IQ Server"},
+        PortRecord{2528, "tcp", "ncr_ccl", "ncr_ccl"},
+        PortRecord{2529, "tcp", "utsftp", "UTS FTP"},
+        PortRecord{2530, "tcp", "vrcommerce", "VR Commerce"},
+        PortRecord{2531, "tcp", "ito-e-gui", "ITO-E GUI"},
+        PortRecord{2532, "tcp", "ovtopmd", "ovtopmd"},
+        PortRecord{2533, "tcp", "snifferserver", "snifferserver"},
+        PortRecord{2534, "tcp", "combox-web-acc", "Combox Web Access"},
+        PortRecord{2535, "tcp", "madcap", "madcap"},
+        PortRecord{2536, "tcp", "btpp2audctr1", "btpp2audctr1"},
+        PortRecord{2537, "tcp", "upgrade", "Upgrade Protocol"},
+        PortRecord{2538, "tcp", "vnwk-prapi", "vnwk-prapi"},
+        PortRecord{2539, "tcp", "vsiadmin", "VSI Admin"},
+        PortRecord{2540, "tcp", "lonworks", "lonworks"},
+        PortRecord{2541, "tcp", "lonworks2", "lonworks2"},
+        PortRecord{2542, "tcp", "udrawgraph", "uDraw(Graph)"},
+        PortRecord{2543, "tcp", "reftek", "reftek"},
+        PortRecord{2544, "tcp", "novell-zen", "Management Daemon Refresh"},
+        PortRecord{2545, "tcp", "sis-emt", "sis-emt"},
+        PortRecord{2546, "tcp", "vytalvaultbrtp", "vytalvaultbrtp"},
+        PortRecord{2547, "tcp", "vytalvaultvsmp", "vytalvaultvsmp"},
+        PortRecord{2548, "tcp", "vytalvaultpipe", "vytalvaultpipe"},
+        PortRecord{2549, "tcp", "ipass", "ipass"},
+        PortRecord{2550, "tcp", "ads", "ads"},
+        PortRecord{2551, "tcp", "isg-uda-server", "ISG UDA Server"},
+        PortRecord{2552, "tcp", "call-logging", "Call Logging"},
+        PortRecord{2553, "tcp", "efidiningport", "efidiningport"},
+        PortRecord{2554, "tcp", "vcnet-link-v10", "VCnet-Link v10"},
+        PortRecord{2555, "tcp", "compaq-wcp", "Compaq WCP"},
+        PortRecord{2556, "tcp", "nicetec-nmsvc", "nicetec-nmsvc"},
+        PortRecord{2557, "tcp", "nicetec-mgmt", "nicetec-mgmt"},
+        PortRecord{2558, "tcp", "pclemultimedia", "PCLE Multi Media"},
+        PortRecord{2559, "tcp", "lstp", "lstp"},
+        PortRecord{2560, "tcp", "labrat", "labrat"},
+        PortRecord{2561, "tcp", "mosaixcc", "mosaixcc"},
+        PortRecord{2562, "tcp", "delibo", "delibo"},
+        PortRecord{2563, "tcp", "cti-redwood", "CTI Redwood"},
+        PortRecord{2564, "tcp", "hp-3000-telnet", "HP 3000 NS/VT block mode Telnet"},
+        PortRecord{2565, "tcp", "coord-svr", "Coordinator Server"},
+        PortRecord{2566, "tcp", "pcs-pcw", "pcs-pcw"},
+        PortRecord{2567, "tcp", "clp", "Cisco Line Protocol"},
+        PortRecord{2568, "tcp", "spamtrap", "SPAM TRAP"},
+        PortRecord{2569, "tcp", "sonuscallsig", "Sonus Call Signal"},
+        PortRecord{2570, "tcp", "hs-port", "HS Port"},
+        PortRecord{2571, "tcp", "cecsvc", "cecsvc"},
+        PortRecord{2572, "tcp", "ibp", "ibp"},
+        PortRecord{2573, "tcp", "trustestablish", "Trust Establish"},
+        PortRecord{2574, "tcp", "blockade-bpsp", "Blockade BPSP"},
+        PortRecord{2575, "tcp", "hl7", "hl7"},
+        PortRecord{2576, "tcp", "tclprodebugger", "TCL Pro Debugger"},
+        PortRecord{2577, "tcp", "scipticslsrvr", "Scriptics Lsrvr"},
+        PortRecord{2578, "tcp", "rvs-isdn-dcp", "RVS ISDN DCP"},
+        PortRecord{2579, "tcp", "mpfoncl", "mpfoncl"},
+        PortRecord{2580, "tcp", "tributary", "tributary"},
+        PortRecord{2581, "tcp", "argis-te", "ARGIS TE"},
+        PortRecord{2582, "tcp", "argis-ds", "ARGIS DS"},
+        PortRecord{2583, "tcp", "mon", "mon"},
+        PortRecord{2584, "tcp", "cyaserv", "cyaserv"},
+        PortRecord{2585, "tcp", "netx-server", "NETX Server"},
+        PortRecord{2586, "tcp", "netx-agent", "NETX Agent"},
+        PortRecord{2587, "tcp", "masc", "masc"},
+        PortRecord{2588, "tcp", "privilege", "privilege"},
+        PortRecord{2589, "tcp", "quartus-tcl", "quartus tcl"},
+        PortRecord{2590, "tcp", "idotdist", "idotdist"},
+        PortRecord{2591, "tcp", "maytagshuffle", "Maytag Shuffle"},
+        PortRecord{2592, "tcp", "netrek", "netrek"},
+        PortRecord{2593, "tcp", "mns-mail", "MNS Mail Notice Service"},
+        PortRecord{2594, "tcp", "dts", "Data Base Server"},
+        PortRecord{2595, "tcp", "worldfusion1", "World Fusion 1"},
+        PortRecord{2596, "tcp", "worldfusion2", "World Fusion 2"},
+        PortRecord{2597, "tcp", "homesteadglory", "Homestead Glory"},
+        PortRecord{2598, "tcp", "citriximaclient", "Citrix MA Client"},
+        PortRecord{2599, "tcp", "snapd", "Snap Discovery"},
+        PortRecord{2600, "tcp", "zebrasrv", "zebrasrv"},
+        PortRecord{2601, "tcp", "zebra", "zebra"},
+        PortRecord{2602, "tcp", "ripd", "ripd"},
+        PortRecord{2603, "tcp", "ripngd", "ripngd"},
+        PortRecord{2604, "tcp", "ospfd", "ospfd"},
+        PortRecord{2605, "tcp", "bgpd", "bgpd"},
+        PortRecord{2606, "tcp", "netmon", "Dell Netmon"},
+        PortRecord{2607, "tcp", "connection", "Dell Connection"},
+        PortRecord{2608, "tcp", "wag-service", "Wag Service"},
+        PortRecord{2609, "tcp", "system-monitor", "System Monitor"},
+        PortRecord{2610, "tcp", "versa-tek", "VersaTek"},
+        PortRecord{2611, "tcp", "lionhead", "lionhead"},
+        PortRecord{2612, "tcp", "qpasa-agent", "Qpasa Agent"},
+        PortRecord{2613, "tcp", "smntubootstrap", "smntubootstrap"},
+        PortRecord{2614, "tcp", "neveroffline", "Never Offline"},
+        PortRecord{2615, "tcp", "firepower", "firepower"},
+        PortRecord{2616, "tcp", "appswitch-emp", "appswitch-emp"},
+        PortRecord{2617, "tcp", "cmadmin", "Clinical Context Managers"},
+        PortRecord{2618, "tcp", "priority-e-com", "Priority E-Com"},
+        PortRecord{2619, "tcp", "bruce", "bruce"},
+        PortRecord{2620, "tcp", "lpsrecommender", "lpsrecommender"},
+        PortRecord{2621, "tcp", "miles-apart", "Miles Apart Jukebox Server"},
+        PortRecord{2622, "tcp", "metricadbc", "metricadbc"},
+        PortRecord{2623, "tcp", "lmdp", "lmdp"},
+        PortRecord{2624, "tcp", "aria", "aria"},
+        PortRecord{2625, "tcp", "blwnkl-port", "Blwnkl Port"},
+        PortRecord{2626, "tcp", "gbjd816", "gbjd816"},
+        PortRecord{2627, "tcp", "webster", "webster"},
+        PortRecord{2628, "tcp", "dict", "Dictionary service (RFC2229)"},
+        PortRecord{2629, "tcp", "sitaraserver", "Sitara Server"},
+        PortRecord{2630, "tcp", "sitaramgmt", "Sitara Management"},
+        PortRecord{2631, "tcp", "sitaradir", "Sitara Dir"},
+        PortRecord{2632, "tcp", "irdg-post", "IRdg Post"},
+        PortRecord{2633, "tcp", "interintelli", "interintelli"},
+        PortRecord{2634, "tcp", "pk-electronics", "PK Electronics"},
+        PortRecord{2635, "tcp", "backburner", "Back Burner"},
+        PortRecord{2636, "tcp", "solve", "solve"},
+        PortRecord{2637, "tcp", "imdocsvc", "Import Document Service"},
+        PortRecord{2638, "tcp", "sybase", "sybase"},
+        PortRecord{2639, "tcp", "aminet", "aminet"},
+        PortRecord{2640, "tcp", "sai_sentlm", "sai_sentlm"},
+        PortRecord{2641, "tcp", "hdl-srv", "HDL Server"},
+        PortRecord{2642, "tcp", "tragic", "tragic"},
+        PortRecord{2643, "tcp", "gte-samp", "gte-samp"},
+        PortRecord{2644, "tcp", "travsoft-ipx-t", "Travsoft IPX Tunnel"},
+        PortRecord{2645, "tcp", "novell-ipx-cmd", "Novell IPX CMD"},
+        PortRecord{2646, "tcp", "and-lm", "AND License Manager"},
+        PortRecord{2647, "tcp", "syncserver", "syncserver"},
+        PortRecord{2648, "tcp", "upsnotifyprot", "upsnotifyprot"},
+        PortRecord{2649, "tcp", "vpsipport", "vpsipport"},
+        PortRecord{2650, "tcp", "eristwoguns", "eristwoguns"},
+        PortRecord{2651, "tcp", "ebinsite", "ebinsite"},
+        PortRecord{2652, "tcp", "interpathpanel", "interpathpanel"},
+        PortRecord{2653, "tcp", "sonus", "sonus"},
+        PortRecord{2654, "tcp", "corel_vncadmin", "corel_vncadmin"},
+        PortRecord{2655, "tcp", "unglue", "UNIX Nt Glue"},
+        PortRecord{2656, "tcp", "kana", "kana"},
+        PortRecord{2657, "tcp", "sns-dispatcher", "SNS Dispatcher"},
+        PortRecord{2658, "tcp", "sns-admin", "SNS Admin"},
+        PortRecord{2659, "tcp", "sns-query", "SNS Query"},
+        PortRecord{2660, "tcp", "gcmonitor", "GC Monitor"},
+        PortRecord{2661, "tcp", "olhost", "olhost"},
+        PortRecord{2662, "tcp", "bintec-capi", "bintec-capi"},
+        PortRecord{2663, "tcp", "bintec-tapi", "bintec-tapi"},
+        PortRecord{2664, "tcp", "patrol-mq-gm", "Patrol for MQ GM"},
+        PortRecord{2665, "tcp", "patrol-mq-nm", "Patrol for MQ NM"},
+        PortRecord{2666, "tcp", "extensis", "extensis"},
+        PortRecord{2667, "tcp", "alarm-clock-s", "Alarm Clock Server"},
+        PortRecord{2668, "tcp", "alarm-clock-c", "Alarm Clock Client"},
+        PortRecord{2669, "tcp", "toad", "toad"},
+        PortRecord{2670, "tcp", "tve-announce", "TVE Announce"},
+        PortRecord{2671, "tcp", "newlixreg", "newlixreg"},
+        PortRecord{2672, "tcp", "nhserver", "nhserver"},
+        PortRecord{2673, "tcp", "firstcall42", "First Call 42"},
+        PortRecord{2674, "tcp", "ewnn", "ewnn"},
+        PortRecord{2675, "tcp", "ttc-etap", "TTC ETAP"},
+        PortRecord{2676, "tcp", "simslink", "simslink"},
+        PortRecord{2677, "tcp", "gadgetgate1way", "Gadget Gate 1 Way"},
+        PortRecord{2678, "tcp", "gadgetgate2way", "Gadget Gate 2 Way"},
+        PortRecord{2679, "tcp", "syncserverssl", "Sync Server SSL"},
+        PortRecord{2680, "tcp", "pxc-sapxom", "pxc-sapxom"},
+        PortRecord{2681, "tcp", "mpnjsomb", "mpnjsomb"},
+        PortRecord{2683, "tcp", "ncdloadbalance", "ncdloadbalance"},
+        PortRecord{2684, "tcp", "mpnjsosv", "mpnjsosv"},
+        PortRecord{2685, "tcp", "mpnjsocl", "mpnjsocl"},
+        PortRecord{2686, "tcp", "mpnjsomg", "mpnjsomg"},
+        PortRecord{2687, "tcp", "pq-lic-mgmt", "pq-lic-mgmt"},
+        PortRecord{2688, "tcp", "md-cg-http", "md-cf-http"},
+        PortRecord{2689, "tcp", "fastlynx", "fastlynx"},
+        PortRecord{2690, "tcp", "hp-nnm-data", "HP NNM Embedded Database"},
+        PortRecord{2691, "tcp", "itinternet", "ITInternet ISM Server"},
+        PortRecord{2692, "tcp", "admins-lms", "Admins LMS"},
+        PortRecord{2694, "tcp", "pwrsevent", "pwrsevent"},
+        PortRecord{2695, "tcp", "vspread", "vspread"},
+        PortRecord{2696, "tcp", "unifyadmin", "Unify Admin"},
+        PortRecord{2697, "tcp", "oce-snmp-trap", "Oce SNMP Trap Port"},
+        PortRecord{2698, "tcp", "mck-ivpip", "mck-ivpip"},
+        PortRecord{2699, "tcp", "csoft-plusclnt", "Csoft Plus Client"},
+        PortRecord{2700, "tcp", "tqdata", "tqdata"},
+        PortRecord{2701, "tcp", "sms-rcinfo", "SMS RCINFO"},
+        PortRecord{2702, "tcp", "sms-xfer", "SMS XFER"},
+        PortRecord{2703, "tcp", "sms-chat", "SMS CHAT"},
+        PortRecord{2704, "tcp", "sms-remctrl", "SMS REMCTRL"},
+        PortRecord{2705, "tcp", "sds-admin", "SDS Admin"},
+        PortRecord{2706, "tcp", "ncdmirroring", "NCD Mirroring"},
+        PortRecord{2707, "tcp", "emcsymapiport", "emcsymapiport"},
+        PortRecord{2708, "tcp", "banyan-net", "banyan-net"},
+        PortRecord{2709, "tcp", "supermon", "supermon"},
+        PortRecord{2710, "tcp", "sso-service", "SSO Service"},
+        PortRecord{2711, "tcp", "sso-control", "SSO Control"},
+        PortRecord{2712, "tcp", "aocp", "Axapta Object Communication Protocol"},
+        PortRecord{2713, "tcp", "raventbs", "Raven Trinity Broker Service"},
+        PortRecord{2714, "tcp", "raventdm", "Raven Trinity Data Mover"},
+        PortRecord{2715, "tcp", "hpstgmgr2", "hpstgmgr2"},
+        PortRecord{2716, "tcp", "inova-ip-disco", "Inova IP Disco"},
+        PortRecord{2717, "tcp", "pn-requester", "PN REQUESTER"},
+        PortRecord{2718, "tcp", "pn-requester2", "PN REQUESTER 2"},
+        PortRecord{2719, "tcp", "scan-change", "Scan & Change"},
+        PortRecord{2720, "tcp", "wkars", "wkars"},
+        PortRecord{2721, "tcp", "smart-diagnose", "Smart Diagnose"},
+        PortRecord{2722, "tcp", "proactivesrvr", "Proactive Server"},
+        PortRecord{2723, "tcp", "watchdog-nt", "WatchDog NT Protocol"},
+        PortRecord{2724, "tcp", "qotps", "qotps"},
+        PortRecord{2725, "tcp", "msolap-ptp2", "msolap-ptp2"},
+        PortRecord{2726, "tcp", "tams", "tams"},
+        PortRecord{2727, "tcp", "mgcp-callagent", "Media Gateway Control Protocol Call Agent"},
+        PortRecord{2728, "tcp", "sqdr", "sqdr"},
+        PortRecord{2729, "tcp", "tcim-control", "TCIM Control"},
+        PortRecord{2730, "tcp", "nec-raidplus", "NEC RaidPlus"},
+        PortRecord{2731, "tcp", "fyre-messanger", "fyre-messanger"},
+        PortRecord{2732, "tcp", "g5m", "g5m"},
+        PortRecord{2733, "tcp", "signet-ctf", "Signet CTF"},
+        PortRecord{2734, "tcp", "ccs-software", "CCS Software"},
+        PortRecord{2735, "tcp", "netiq-mc", "NetIQ Monitor Console"},
+        PortRecord{2736, "tcp", "radwiz-nms-srv", "RADWIZ NMS SRV"},
+        PortRecord{2737, "tcp", "srp-feedback", "SRP Feedback"},
+        PortRecord{2738, "tcp", "ndl-tcp-ois-gw", "NDL TCP-OSI Gateway"},
+        PortRecord{2739, "tcp", "tn-timing", "TN Timing"},
+        PortRecord{2740, "tcp", "alarm", "alarm"},
+        PortRecord{2741, "tcp", "tsb", "tsb"},
+        PortRecord{2742, "tcp", "tsb2", "tsb2"},
+        PortRecord{2743, "tcp", "murx", "murx"},
+        PortRecord{2744, "tcp", "honyaku", "honyaku"},
+        PortRecord{2745, "tcp", "urbisnet", "urbisnet"},
+        PortRecord{2746, "tcp", "cpudpencap", "cpudpencap"},
+        PortRecord{2747, "tcp", "fjippol-swrly", "fjippol-swrly"},
+        PortRecord{2748, "tcp", "fjippol-polsvr", "fjippol-polsvr"},
+        PortRecord{2749, "tcp", "fjippol-cnsl", "fjippol-cnsl"},
+        PortRecord{2750, "tcp", "fjippol-port1", "fjippol-port1"},
+        PortRecord{2751, "tcp", "fjippol-port2", "fjippol-port2"},
+        PortRecord{2752, "tcp", "rsisysaccess", "RSISYS ACCESS"},
+        PortRecord{2753, "tcp", "de-spot", "de-spot"},
+        PortRecord{2754, "tcp", "apollo-cc", "APOLLO CC"},
+        PortRecord{2755, "tcp", "expresspay", "Express Pay"},
+        PortRecord{2756, "tcp", "simplement-tie", "simplement-tie"},
+        PortRecord{2757, "tcp", "cnrp", "cnrp"},
+        PortRecord{2758, "tcp", "apollo-status", "APOLLO Status"},
+        PortRecord{2759, "tcp", "apollo-gms", "APOLLO GMS"},
+        PortRecord{2760, "tcp", "sabams", "Saba MS"},
+        PortRecord{2761, "tcp", "dicom-iscl", "DICOM ISCL"},
+        PortRecord{2762, "tcp", "dicom-tls", "DICOM TLS"},
+        PortRecord{2763, "tcp", "desktop-dna", "Desktop DNA"},
+        PortRecord{2764, "tcp", "data-insurance", "Data Insurance"},
+        PortRecord{2765, "tcp", "qip-audup", "qip-audup"},
+        PortRecord{2766, "tcp", "listen", "listen"},
+        PortRecord{2767, "tcp", "uadtc", "uadtc"},
+        PortRecord{2768, "tcp", "uacs", "uacs"},
+        PortRecord{2769, "tcp", "exce", "exce"},
+        PortRecord{2770, "tcp", "veronica", "veronica"},
+        PortRecord{2771, "tcp", "vergencecm", "Vergence CM"},
+        PortRecord{2772, "tcp", "auris", "auris"},
+        PortRecord{2773, "tcp", "rbakcup1", "RBackup Remote Backup"},
+        PortRecord{2774, "tcp", "rbakcup2", "RBackup Remote Backup"},
+        PortRecord{2775, "tcp", "smpp", "smpp"},
+        PortRecord{2776, "tcp", "ridgeway1", "Ridgeway Systems & Software"},
+        PortRecord{2777, "tcp", "ridgeway2", "Ridgeway Systems & Software"},
+        PortRecord{2778, "tcp", "gwen-sonya", "gwen-sonya"},
+        PortRecord{2779, "tcp", "lbc-sync", "LBC Sync"},
+        PortRecord{2780, "tcp", "lbc-control", "LBC Control"},
+        PortRecord{2781, "tcp", "whosells", "whosells"},
+        PortRecord{2782, "tcp", "everydayrc", "everydayrc"},
+        PortRecord{2783, "tcp", "aises", "aises"},
+        PortRecord{2784, "tcp", "www-dev", "world wide web - development"},
+        PortRecord{2785, "tcp", "aic-np", "aic-np"},
+        PortRecord{2786, "tcp", "aic-oncrpc", "aic-oncrpc - Destiny MCD database"},
+        PortRecord{2787, "tcp", "piccolo", "piccolo - Cornerstone Software"},
+        PortRecord{2788, "tcp", "fryeserv", "NetWare Loadable Module - Seagate Software"},
+        PortRecord{2789, "tcp", "media-agent", "Media Agent"},
+        PortRecord{2790, "tcp", "plgproxy", "PLG Proxy"},
+        PortRecord{2791, "tcp", "mtport-regist", "MT Port Registrator"},
+        PortRecord{2792, "tcp", "f5-globalsite", "f5-globalsite"},
+        PortRecord{2793, "tcp", "initlsmsad", "initlsmsad"},
+        PortRecord{2795, "tcp", "livestats", "livestats"},
+        PortRecord{2796, "tcp", "ac-tech", "ac-tech"},
+        PortRecord{2797, "tcp", "esp-encap", "esp-encap"},
+        PortRecord{2798, "tcp", "tmesis-upshot", "tmesis-upshot"},
+        PortRecord{2799, "tcp", "icon-discover", "ICON Discover"},
+        PortRecord{2800, "tcp", "acc-raid", "ACC RAID"},
+        PortRecord{2801, "tcp", "igcp", "igcp"},
+        PortRecord{2802, "tcp", "veritas-tcp1", "veritas-tcp1"},
+        PortRecord{2803, "tcp", "btprjctrl", "btprjctrl"},
+        PortRecord{2804, "tcp", "dvr-esm", "March Networks Digital Video Recorders and Enterprise Service Manager products"},
+        PortRecord{2805, "tcp", "wta-wsp-s", "WTA WSP-S"},
+        PortRecord{2806, "tcp", "cspuni", "cspuni"},
+        PortRecord{2807, "tcp", "cspmulti", "cspmulti"},
+        PortRecord{2808, "tcp", "j-lan-p", "j-lan-p"},
+        PortRecord{2809, "tcp", "corbaloc", "corbaloc"},
+        PortRecord{2810, "tcp", "netsteward", "Active Net Steward"},
+        PortRecord{2811, "tcp", "gsiftp", "GSI FTP"},
+        PortRecord{2812, "tcp", "atmtcp", "Commonly Monit HTTP Daemon"},
+        PortRecord{2813, "tcp", "llm-pass", "llm-pass"},
+        PortRecord{2814, "tcp", "llm-csv", "llm-csv"},
+        PortRecord{2815, "tcp", "lbc-measure", "LBC Measurement"},
+        PortRecord{2816, "tcp", "lbc-watchdog", "LBC Watchdog"},
+        PortRecord{2817, "tcp", "nmsigport", "NMSig Port"},
+        PortRecord{2818, "tcp", "rmlnk", "rmlnk"},
+        PortRecord{2819, "tcp", "fc-faultnotify", "FC Fault Notification"},
+        PortRecord{2820, "tcp", "univision", "univision"},
+        PortRecord{2821, "tcp", "vrts-at-port", "VERITAS Authentication Service"},
+        PortRecord{2822, "tcp", "ka0wuc", "ka0wuc"},
+        PortRecord{2823, "tcp", "cqg-netlan", "CQG Net/LAN"},
+        PortRecord{2824, "tcp", "cqg-netlan-1", "cqg-netlan-1"},
+        PortRecord{2826, "tcp", "slc-systemlog", "slc systemlog"},
+        PortRecord{2827, "tcp", "slc-ctrlrloops", "slc ctrlrloops"},
+        PortRecord{2828, "tcp", "itm-lm", "ITM License Manager"},
+        PortRecord{2829, "tcp", "silkp1", "silkp1"},
+        PortRecord{2830, "tcp", "silkp2", "silkp2"},
+        PortRecord{2831, "tcp", "silkp3", "silkp3"},
+        PortRecord{2832, "tcp", "silkp4", "silkp4"},
+        PortRecord{2833, "tcp", "glishd", "glishd"},
+        PortRecord{2834, "tcp", "evtp", "evtp"},
+        PortRecord{2835, "tcp", "evtp-data", "evtp-data"},
+        PortRecord{2836, "tcp", "catalyst", "catalyst"},
+        PortRecord{2837, "tcp", "repliweb", "repliweb"},
+        PortRecord{2838, "tcp", "starbot", "starbot"},
+        PortRecord{2839, "tcp", "nmsigport", "nmsigport"},
+        PortRecord{2840, "tcp", "l3-exprt", "l3-exprt"},
+        PortRecord{2841, "tcp", "l3-ranger", "l3-ranger"},
+        PortRecord{2842, "tcp", "l3-hawk", "l3-hawk"},
+        PortRecord{2843, "tcp", "pdnet", "pdnet"},
+        PortRecord{2844, "tcp", "bpcp-poll", "BPCP POLL"},
+        PortRecord{2845, "tcp", "bpcp-trap", "BPCP TRAP"},
+        PortRecord{2846, "tcp", "aimpp-hello", "AIMPP Hello"},
+        PortRecord{2847, "tcp", "aimpp-port-req", "AIMPP Port Req"},
+        PortRecord{2848, "tcp", "amt-blc-port", "amt-blc-port"},
+        PortRecord{2849, "tcp", "fxp", "fxp"},
+        PortRecord{2850, "tcp", "metaconsole", "metaconsole"},
+        PortRecord{2851, "tcp", "webemshttp", "webemshttp"},
+        PortRecord{2852, "tcp", "bears-01", "bears-01"},
+        PortRecord{2853, "tcp", "ispipes", "ispipes"},
+        PortRecord{2854, "tcp", "infomover", "infomover"},
+        PortRecord{2855, "tcp", "msrp", "MSRP over TCP"},
+        PortRecord{2856, "tcp", "cesdinv", "cesdinv"},
+        PortRecord{2857, "tcp", "simctlp", "SimCtIP"},
+        PortRecord{2858, "tcp", "ecnp", "ecnp"},
+        PortRecord{2859, "tcp", "activememory", "Active Memory"},
+        PortRecord{2860, "tcp", "dialpad-voice1", "Dialpad Voice 1"},
+        PortRecord{2861, "tcp", "dialpad-voice2", "Dialpad Voice 2"},
+        PortRecord{2862, "tcp", "ttg-protocol", "TTG Protocol"},
+        PortRecord{2863, "tcp", "sonardata", "Sonar Data"},
+        PortRecord{2864, "tcp", "astromed-main", "astromed-main"},
+        PortRecord{2865, "tcp", "pit-vpn", "pit-vpn"},
+        PortRecord{2866, "tcp", "iwlistener", "iwlistener"},
+        PortRecord{2867, "tcp", "esps-portal", "esps-portal"},
+        PortRecord{2868, "tcp", "npep-messaging", "npep-messaging"},
+        PortRecord{2869, "tcp", "icslap", "Simple Service Discovery Protocol (Universal Plug and Play)"},
+        PortRecord{2870, "tcp", "daishi", "daishi"},
+        PortRecord{2871, "tcp", "msi-selectplay", "MSI Select Play"},
+        PortRecord{2872, "tcp", "radix", "radix"},
+        PortRecord{2874, "tcp", "dxmessagebase1", "DX Message Base Transport Protocol"},
+        PortRecord{2875, "tcp", "dxmessagebase2", "DX Message Base Transport Protocol"},
+        PortRecord{2876, "tcp", "sps-tunnel", "SPS Tunnel"},
+        PortRecord{2877, "tcp", "bluelance", "bluelance"},
+        PortRecord{2878, "tcp", "aap", "aap"},
+        PortRecord{2879, "tcp", "ucentric-ds", "ucentric-ds"},
+        PortRecord{2880, "tcp", "synapse", "Synapse Transport"},
+        PortRecord{2881, "tcp", "ndsp", "ndsp"},
+        PortRecord{2882, "tcp", "ndtp", "ndtp"},
+        PortRecord{2883, "tcp", "ndnp", "ndnp"},
+        PortRecord{2884, "tcp", "flashmsg", "Flash Msg"},
+        PortRecord{2885, "tcp", "topflow", "topflow"},
+        PortRecord{2886, "tcp", "responselogic", "responselogic"},
+        PortRecord{2887, "tcp", "aironetddp", "aironet"},
+        PortRecord{2888, "tcp", "spcsdlobby", "spcsdlobby"},
+        PortRecord{2889, "tcp", "rsom", "rsom"},
+        PortRecord{2890, "tcp", "cspclmulti", "cspclmulti"},
+        PortRecord{2891, "tcp", "cinegrfx-elmd", "CINEGRFX-ELMD License Manager"},
+        PortRecord{2892, "tcp", "snifferdata", "snifferdata"},
+        PortRecord{2893, "tcp", "vseconnector", "vseconnector"},
+        PortRecord{2894, "tcp", "abacus-remote", "abacus-remote"},
+        PortRecord{2895, "tcp", "natuslink", "NATUS LINK"},
+        PortRecord{2896, "tcp", "ecovisiong6-1", "ecovisiong6-1"},
+        PortRecord{2897, "tcp", "citrix-rtmp", "Citrix RTMP"},
+        PortRecord{2898, "tcp", "appliance-cfg", "appliance-cfg"},
+        PortRecord{2899, "tcp", "powergemplus", "powergemplus"},
+        PortRecord{2900, "tcp", "quicksuite", "quicksuite"},
+        PortRecord{2901, "tcp", "allstorcns", "allstorcns"},
+        PortRecord{2902, "tcp", "netaspi", "NET ASPI"},
+        PortRecord{2903, "tcp", "extensisportfolio", "extensisportfolio"},
+        PortRecord{2904, "tcp", "m2ua", "SIGTRAN M2UA"},
+        PortRecord{2905, "tcp", "m3ua", "SIGTRAN M3UA"},
+        PortRecord{2906, "tcp", "caller9", "caller9"},
+        PortRecord{2907, "tcp", "webmethods-b2b", "WEBMETHODS B2B"},
+        PortRecord{2908, "tcp", "mao", "mao"},
+        PortRecord{2909, "tcp", "funk-dialout", "Funk Dialout"},
+        PortRecord{2910, "tcp", "tdaccess", "tdaccess"},
+        PortRecord{2911, "tcp", "blockade", "blockade"},
+        PortRecord{2912, "tcp", "epicon", "epicon"},
+        PortRecord{2913, "tcp", "boosterware", "Booster Ware"},
+        PortRecord{2914, "tcp", "gamelobby", "Game Lobby"},
+        PortRecord{2915, "tcp", "tksocket", "TK Socket"},
+        PortRecord{2916, "tcp", "elvin_server", "elvin_server"},
+        PortRecord{2917, "tcp", "elvin_client", "elvin_client"},
+        PortRecord{2918, "tcp", "kastenchasepad", "Kasten Chase Pad"},
+        PortRecord{2919, "tcp", "roboer", "roboer"},
+        PortRecord{2920, "tcp", "roboeda", "roboeda"},
+        PortRecord{2921, "tcp", "cesdcdman", "CESD Contents Delivery Management"},
+        PortRecord{2922, "tcp", "cesdcdtrn", "CESD Contents Delivery Data Transfer"},
+        PortRecord{2923, "tcp", "wta-wsp-wtp-s", "wta-wsp-wtp-s"},
+        PortRecord{2924, "tcp", "precise-vip", "precise-vip"},
+        PortRecord{2926, "tcp", "mobile-file-dl", "mobile-file-dl"},
+        PortRecord{2927, "tcp", "unimobilectrl", "unimobilectrl"},
+        PortRecord{2928, "tcp", "redstone-cpss", "redstone-cpss"},
+        PortRecord{2929, "tcp", "amx-webadmin", "amx-webadmin"},
+        PortRecord{2930, "tcp", "amx-weblinx", "amx-weblinx"},
+        PortRecord{2931, "tcp", "circle-x", "circle-x"},
+        PortRecord{2932, "tcp", "incp", "incp"},
+        PortRecord{2933, "tcp", "4-tieropmgw", "4-TIER OPM GW"},
+        PortRecord{2934, "tcp", "4-tieropmcli", "4-TIER OPM CLI"},
+        PortRecord{2935, "tcp", "qtp", "qtp"},
+        PortRecord{2936, "tcp", "otpatch", "otpatch"},
+        PortRecord{2937, "tcp", "pnaconsult-lm", "pnaconsult-lm"},
+        PortRecord{2938, "tcp", "sm-pas-1", "sm-pas-1"},
+        PortRecord{2939, "tcp", "sm-pas-2", "sm-pas-2"},
+        PortRecord{2940, "tcp", "sm-pas-3", "sm-pas-3"},
+        PortRecord{2941, "tcp", "sm-pas-4", "sm-pas-4"},
+        PortRecord{2942, "tcp", "sm-pas-5", "sm-pas-5"},
+        PortRecord{2943, "tcp", "ttnrepository", "ttnrepository"},
+        PortRecord{2944, "tcp", "megaco-h248", "Megaco H-248 (Text)"},
+        PortRecord{2945, "tcp", "h248-binary", "Megaco H-248 (Binary)"},
+        PortRecord{2946, "tcp", "fjsvmpor", "fjsvmpor"},
+        PortRecord{2947, "tcp", "gpsd", "GPS Daemon request/response protocol"},
+        PortRecord{2948, "tcp", "wap-push", "WAP PUSH"},
+        PortRecord{2949, "tcp", "wap-pushsecure", "WAP PUSH SECURE"},
+        PortRecord{2950, "tcp", "esip", "esip"},
+        PortRecord{2951, "tcp", "ottp", "ottp"},
+        PortRecord{2952, "tcp", "mpfwsas", "mpfwsas"},
+        PortRecord{2953, "tcp", "ovalarmsrv", "ovalarmsrv"},
+        PortRecord{2954, "tcp", "ovalarmsrv-cmd", "ovalarmsrv-cmd"},
+        PortRecord{2955, "tcp", "csnotify", "csnotify"},
+        PortRecord{2956, "tcp", "ovrimosdbman", "ovrimosdbman"},
+        PortRecord{2957, "tcp", "jmact5", "JAMCT5"},
+        PortRecord{2958, "tcp", "jmact6", "JAMCT6"},
+        PortRecord{2959, "tcp", "rmopagt", "rmopagt"},
+        PortRecord{2960, "tcp", "dfoxserver", "dfoxserver"},
+        PortRecord{2961, "tcp", "boldsoft-lm", "boldsoft-lm"},
+        PortRecord{2962, "tcp", "iph-policy-cli", "iph-policy-cli"},
+        PortRecord{2963, "tcp", "iph-policy-adm", "iph-policy-adm"},
+        PortRecord{2964, "tcp", "bullant-srap", "BULLANT SRAP"},
+        PortRecord{2965, "tcp", "bullant-rap", "BULLANT RAP"},
+        PortRecord{2966, "tcp", "idp-infotrieve", "idp-infotrieve"},
+        PortRecord{2967, "tcp", "symantec-av", "symantec-av"},
+        PortRecord{2968, "tcp", "enpp", "enpp"},
+        PortRecord{2969, "tcp", "essp", "essp"},
+        PortRecord{2970, "tcp", "index-net", "index-net"},
+        PortRecord{2971, "tcp", "netclip", "NetClip clipboard daemon"},
+        PortRecord{2972, "tcp", "pmsm-webrctl", "PMSM Webrctl"},
+        PortRecord{2973, "tcp", "svnetworks", "SV Networks"},
+        PortRecord{2974, "tcp", "signal", "signal"},
+        PortRecord{2975, "tcp", "fjmpcm", "Fujitsu Configuration Management Service"},
+        PortRecord{2976, "tcp", "cns-srv-port", "CNS Server Port"},
+        PortRecord{2977, "tcp", "ttc-etap-ns", "TTCs Enterprise Test Access Protocol - NS"},
+        PortRecord{2978, "tcp", "ttc-etap-ds", "TTCs Enterprise Test Access Protocol - DS"},
+        PortRecord{2979, "tcp", "h263-video", "H.263 Video Streaming"},
+        PortRecord{2980, "tcp", "wimd", "Instant Messaging Service"},
+        PortRecord{2981, "tcp", "mylxamport", "mylxamport"},
+        PortRecord{2982, "tcp", "iwb-whiteboard", "iwb-whiteboard"},
+        PortRecord{2983, "tcp", "netplan", "netplan"},
+        PortRecord{2984, "tcp", "hpidsadmin", "hpidsadmin"},
+        PortRecord{2985, "tcp", "hpidsagent", "hpidsagent"},
+        PortRecord{2986, "tcp", "stonefalls", "stonefalls"},
+        PortRecord{2987, "tcp", "identify", "identify"},
+        PortRecord{2988, "tcp", "hippad", "HIPPA Reporting Protocol"},
+        PortRecord{2989, "tcp", "zarkov", "ZARKOV Intelligent Agent Communication"},
+        PortRecord{2990, "tcp", "boscap", "boscap"},
+        PortRecord{2991, "tcp", "wkstn-mon", "wkstn-mon"},
+        PortRecord{2992, "tcp", "avenyo", "Avenyo Server"},
+        PortRecord{2993, "tcp", "veritas-vis1", "VERITAS VIS1"},
+        PortRecord{2994, "tcp", "veritas-vis2", "VERITAS VIS2"},
+        PortRecord{2995, "tcp", "idrs", "idrs"},
+        PortRecord{2996, "tcp", "vsixml", "vsixml"},
+        PortRecord{2997, "tcp", "rebol", "rebol"},
+        PortRecord{2998, "tcp", "iss-realsec", "iss-realsec"},
+        PortRecord{2999, "tcp", "remoteware-un", "RemoteWare Unassigned"},
+        PortRecord{3000, "tcp", "ppp", "ppp"},
+        PortRecord{3001, "tcp", "nessus", "nessus"},
+        PortRecord{3002, "tcp", "exlm-agent", "exlm-agent"},
+        PortRecord{3003, "tcp", "cgms", "cgms"},
+        PortRecord{3004, "tcp", "csoftragent", "Csoft Agent"},
+        PortRecord{3005, "tcp", "deslogin", "deslogin"},
+        PortRecord{3006, "tcp", "deslogind", "deslogind"},
+        PortRecord{3007, "tcp", "lotusmtap", "Lotus Mail Tracking Agent Protocol"},
+        PortRecord{3008, "tcp", "midnight-tech", "Midnight Technologies"},
+        PortRecord{3009, "tcp", "pxc-ntfy", "pxc-ntfy"},
+        PortRecord{3010, "tcp", "gw", "gw"},
+        PortRecord{3011, "tcp", "trusted-web", "Trusted Web"},
+        PortRecord{3012, "tcp", "twsdss", "Trusted Web Client"},
+        PortRecord{3013, "tcp", "gilatskysurfer", "Gilat Sky Surfer"},
+        PortRecord{3014, "tcp", "broker_service", "broker_service"},
+        PortRecord{3015, "tcp", "nati-dstp", "NATI DSTP"},
+        PortRecord{3016, "tcp", "notify_srvr", "notify_srvr"},
+        PortRecord{3017, "tcp", "event_listener", "event_listener"},
+        PortRecord{3018, "tcp", "srvc_registry", "srvc_registry"},
+        PortRecord{3019, "tcp", "resource_mgr", "resource_mgr"},
+        PortRecord{3020, "tcp", "cifs", "cifs"},
+        PortRecord{3021, "tcp", "agriserver", "AGRI Server"},
+        PortRecord{3022, "tcp", "csregagent", "csregagent"},
+        PortRecord{3023, "tcp", "magicnotes", "magicnotes"},
+        PortRecord{3024, "tcp", "nds_sso", "nds-sso"},
+        PortRecord{3025, "tcp", "slnp", "slnp"},
+        PortRecord{3026, "tcp", "agri-gateway", "AGRI Gateway"},
+        PortRecord{3027, "tcp", "LiebDevMgmt_C", "LiebDevMgmt-C"},
+        PortRecord{3028, "tcp", "LiebDevMgmt_DM", "LiebDevMgmt-DM"},
+        PortRecord{3029, "tcp", "LiebDevMgmt_A", "LiebDevMgmt-A"},
+        PortRecord{3030, "tcp", "arepa-cas", "Arepa Cas"},
+        PortRecord{3031, "tcp", "eppc", "Remote AppleEvents/PPC Toolbox"},
+        PortRecord{3032, "tcp", "redwood-chat", "Redwood Chat"},
+        PortRecord{3033, "tcp", "pdb", "pdb"},
+        PortRecord{3034, "tcp", "osmosis-aeea", "Osmosis / Helix (R) AEEA Port"},
+        PortRecord{3035, "tcp", "fjsv-gssagt", "FJSV gssagt"},
+        PortRecord{3036, "tcp", "hagel-dump", "Hagel DUMP"},
+        PortRecord{3037, "tcp", "hp-san-mgmt", "HP SAN Mgmt"},
+        PortRecord{3038, "tcp", "santak-ups", "Santak UPS"},
+        PortRecord{3039, "tcp", "cogitate", "Cogitate Inc."},
+        PortRecord{3040, "tcp", "tomato-springs", "Tomato Springs"},
+        PortRecord{3041, "tcp", "di-traceware", "di-traceware"},
+        PortRecord{3042, "tcp", "journee", "journee"},
+        PortRecord{3043, "tcp", "brp", "Broadcast Routing Protocol"},
+        PortRecord{3044, "tcp", "epp", "Endpoint Protocol"},
+        PortRecord{3045, "tcp", "slnp", "slnp"},
+        PortRecord{3046, "tcp", "di-ase", "di-ase"},
+        PortRecord{3047, "tcp", "hlserver", "Fast Security HL Server"},
+        PortRecord{3048, "tcp", "pctrader", "Sierra Net PC Trader"},
+        PortRecord{3049, "tcp", "cfs", "cfs"},
+        PortRecord{3050, "tcp", "gds_db", "gds-db"},
+        PortRecord{3051, "tcp", "galaxy-server", "Galaxy Server"},
+        PortRecord{3052, "tcp", "powerchute", "powerchute"},
+        PortRecord{3053, "tcp", "dsom-server", "dsom-server"},
+        PortRecord{3054, "tcp", "amt-cnf-prot", "AMT CNF PROT"},
+        PortRecord{3055, "tcp", "policyserver", "Policy Server"},
+        PortRecord{3056, "tcp", "cdl-server", "CDL Server"},
+        PortRecord{3057, "tcp", "goahead-fldup", "GoAhead FldUp"},
+        PortRecord{3058, "tcp", "videobeans", "videobeans"},
+        PortRecord{3059, "tcp", "qsoft", "qsoft"},
+        PortRecord{3060, "tcp", "interserver", "interserver"},
+        PortRecord{3061, "tcp", "cautcpd", "cautcpd"},
+        PortRecord{3062, "tcp", "ncacn-ip-tcp", "ncacn-ip-tcp"},
+        PortRecord{3063, "tcp", "ncadg-ip-udp", "ncadg-ip-udp"},
+        PortRecord{3064, "tcp", "dnet-tstproxy", "dnet-tstproxy"},
+        PortRecord{3065, "tcp", "slinterbase", "slinterbase"},
+        PortRecord{3066, "tcp", "netattachsdmp", "netattachsdmp"},
+        PortRecord{3067, "tcp", "fjhpjp", "fjhpjp"},
+        PortRecord{3068, "tcp", "ls3bcast", "ls3 Broadcast"},
+        PortRecord{3069, "tcp", "ls3", "ls3"},
+        PortRecord{3070, "tcp", "mgxswitch", "mgxswitch"},
+        PortRecord{3071, "tcp", "csd-mgmt-port", "csd-mgmt-port"},
+        PortRecord{3072, "tcp", "csd-monitor", "ContinuStor Monitor Port"},
+        PortRecord{3073, "tcp", "vcrp", "Very simple chatroom prot"},
+        PortRecord{3074, "tcp", "xbox", "Xbox game port"},
+        PortRecord{3075, "tcp", "orbix-locator", "Orbix 2000 Locator"},
+        PortRecord{3076, "tcp", "orbix-config", "Orbix 2000 Config"},
+        PortRecord{3077, "tcp", "orbix-loc-ssl", "Orbix 2000 Locator SSL"},
+        PortRecord{3078, "tcp", "orbix-cfg-ssl", "Orbix 2000 Locator SSL"},
+        PortRecord{3079, "tcp", "lv-frontpanel", "LV Front Panel"},
+        PortRecord{3080, "tcp", "stm_pproc", "stm-pproc"},
+        PortRecord{3081, "tcp", "tl1-lv", "tl1-lv"},
+        PortRecord{3082, "tcp", "tl1-raw", "tl1-raw"},
+        PortRecord{3083, "tcp", "tl1-telnet", "Telnet Protocol"},
+        PortRecord{3084, "tcp", "itm-mccs", "itm-mccs"},
+        PortRecord{3085, "tcp", "pcihreq", "pcihreq"},
+        PortRecord{3086, "tcp", "sj3", "sj3"},
+        PortRecord{3087, "tcp", "asoki-sma", "Asoki SMA"},
+        PortRecord{3088, "tcp", "xdtp", "eXtensible Data Transfer Protocol"},
+        PortRecord{3089, "tcp", "ptk-alink", "ParaTek Agent Linking"},
+        PortRecord{3090, "tcp", "stss", "Senforce Session Services"},
+        PortRecord{3091, "tcp", "1ci-smcs", "1Ci Server Management"},
+        PortRecord{3093, "tcp", "rapidmq-center", "Jiiva RapidMQ Center"},
+        PortRecord{3094, "tcp", "rapidmq-reg", "Jiiva RapidMQ Registry"},
+        PortRecord{3095, "tcp", "panasas", "panasas"},
+        PortRecord{3096, "tcp", "ndl-aps", "Active Print Server Port"},
+        PortRecord{3098, "tcp", "umm-port", "Universal Message Manager"},
+        PortRecord{3099, "tcp", "chmd", "CHIPSY Machine Daemon"},
+        PortRecord{3100, "tcp", "opcon-xps", "OpCon/xps"},
+        PortRecord{3101, "tcp", "hp-pxpib", "HP PolicyXpert PIB Server"},
+        PortRecord{3102, "tcp", "slslavemon", "SoftlinK Slave Mon Port"},
+        PortRecord{3103, "tcp", "autocuesmi", "Autocue SMI Protocol"},
+        PortRecord{3104, "tcp", "autocuelog", "autocuelog"},
+        PortRecord{3105, "tcp", "cardbox", "cardbox"},
+        PortRecord{3106, "tcp", "cardbox-http", "Cardbox Hypertext Transfer Protocol"},
+        PortRecord{3107, "tcp", "business", "Business protocol"},
+        PortRecord{3108, "tcp", "geolocate", "Geolocate protocol"},
+        PortRecord{3109, "tcp", "personnel", "Personnel protocol"},
+        PortRecord{3110, "tcp", "sim-control", "simulator control port"},
+        PortRecord{3111, "tcp", "wsynch", "Web Synchronous Services"},
+        PortRecord{3112, "tcp", "ksysguard", "KDE System Guard"},
+        PortRecord{3113, "tcp", "cs-auth-svr", "CS-Authenticate Svr Port"},
+        PortRecord{3114, "tcp", "ccmad", "CCM AutoDiscover"},
+        PortRecord{3115, "tcp", "mctet-master", "MCTET Master"},
+        PortRecord{3116, "tcp", "mctet-gateway", "MCTET Gateway"},
+        PortRecord{3117, "tcp", "mctet-jserv", "MCTET Jserv"},
+        PortRecord{3118, "tcp", "pkagent", "pkagent"},
+        PortRecord{3119, "tcp", "d2000kernel", "D2000 Kernel Port"},
+        PortRecord{3120, "tcp", "d2000webserver", "D2000 Webserver Port"},
+        PortRecord{3121, "tcp", "pcmk-remote", "The pacemaker remote (pcmk-remote) service extends high availability functionality outside of the Linux cluster into remote nodes."},
+        PortRecord{3122, "tcp", "vtr-emulator", "MTI VTR Emulator port"},
+        PortRecord{3123, "tcp", "edix", "EDI Translation Protocol"},
+        PortRecord{3124, "tcp", "beacon-port", "Beacon Port"},
+        PortRecord{3125, "tcp", "a13-an", "A13-AN Interface"},
+        PortRecord{3127, "tcp", "ctx-bridge", "CTX Bridge Port"},
+        PortRecord{3128, "tcp", "squid-http", "squid-http"},
+        PortRecord{3129, "tcp", "netport-id", "NetPort Discovery Port"},
+        PortRecord{3130, "tcp", "icpv2", "icpv2"},
+        PortRecord{3131, "tcp", "netbookmark", "Net Book Mark"},
+        PortRecord{3132, "tcp", "ms-rule-engine", "Microsoft Business Rule Engine Update Service"},
+        PortRecord{3133, "tcp", "prism-deploy", "Prism Deploy User Port"},
+        PortRecord{3134, "tcp", "ecp", "Extensible Code Protocol"},
+        PortRecord{3135, "tcp", "peerbook-port", "PeerBook Port"},
+        PortRecord{3136, "tcp", "grubd", "Grub Server Port"},
+        PortRecord{3137, "tcp", "rtnt-1", "rtnt-1 data packets"},
+        PortRecord{3138, "tcp", "rtnt-2", "rtnt-2 data packets"},
+        PortRecord{3139, "tcp", "incognitorv", "Incognito Rendez-Vous"},
+        PortRecord{3140, "tcp", "ariliamulti", "Arilia Multiplexor"},
+        PortRecord{3141, "tcp", "vmodem", "vmodem"},
+        PortRecord{3142, "tcp", "apt-cacher", "apt-cacher"},
+        PortRecord{3143, "tcp", "seaview", "Sea View"},
+        PortRecord{3144, "tcp", "tarantella", "tarantella"},
+        PortRecord{3145, "tcp", "csi-lfap", "csi-lfap"},
+        PortRecord{3146, "tcp", "bears-02", "bears-02"},
+        PortRecord{3147, "tcp", "rfio", "rfio"},
+        PortRecord{3148, "tcp", "nm-game-admin", "NetMike Game Administrator"},
+        PortRecord{3149, "tcp", "nm-game-server", "NetMike Game Server"},
+        PortRecord{3150, "tcp", "nm-asses-admin", "NetMike Assessor Administrator"},
+        PortRecord{3151, "tcp", "nm-assessor", "NetMike Assessor"},
+        PortRecord{3152, "tcp", "feitianrockey", "FeiTian Port"},
+        PortRecord{3153, "tcp", "s8-client-port", "S8Cargo Client Port"},
+        PortRecord{3154, "tcp", "ccmrmi", "ON RMI Registry"},
+        PortRecord{3155, "tcp", "jpegmpeg", "JpegMpeg Port"},
+        PortRecord{3156, "tcp", "indura", "Indura Collector"},
+        PortRecord{3157, "tcp", "e3consultants", "CCC Listener Port"},
+        PortRecord{3158, "tcp", "stvp", "SmashTV Protocol"},
+        PortRecord{3159, "tcp", "navegaweb-port", "NavegaWeb Tarification"},
+        PortRecord{3160, "tcp", "tip-app-server", "TIP Application Server"},
+        PortRecord{3161, "tcp", "doc1lm", "DOC1 License Manager"},
+        PortRecord{3162, "tcp", "sflm", "sflm"},
+        PortRecord{3163, "tcp", "res-sap", "res-sap"},
+        PortRecord{3164, "tcp", "imprs", "imprs"},
+        PortRecord{3165, "tcp", "newgenpay", "Newgenpay Engine Service"},
+        PortRecord{3166, "tcp", "sossecollector", "Quest Spotlight Out-Of-Process Collector"},
+        PortRecord{3167, "tcp", "nowcontact", "Now Contact Public Server"},
+        PortRecord{3168, "tcp", "poweronnud", "Now Up-to-Date Public Server"},
+        PortRecord{3169, "tcp", "serverview-as", "serverview-as"},
+        PortRecord{3170, "tcp", "serverview-asn", "serverview-asn"},
+        PortRecord{3171, "tcp", "serverview-gf", "serverview-gf"},
+        PortRecord{3172, "tcp", "serverview-rm", "serverview-rm"},
+        PortRecord{3173, "tcp", "serverview-icc", "serverview-icc"},
+        PortRecord{3174, "tcp", "armi-server", "ARMI Server"},
+        PortRecord{3175, "tcp", "t1-e1-over-ip", "T1_E1_Over_IP"},
+        PortRecord{3176, "tcp", "ars-master", "ARS Master"},
+        PortRecord{3177, "tcp", "phonex-port", "Phonex Protocol"},
+        PortRecord{3178, "tcp", "radclientport", "Radiance UltraEdge Port"},
+        PortRecord{3179, "tcp", "h2gf-w-2m", "H2GF W.2m Handover prot."},
+        PortRecord{3180, "tcp", "mc-brk-srv", "Millicent Broker Server"},
+        PortRecord{3181, "tcp", "bmcpatrolagent", "BMC Patrol Agent"},
+        PortRecord{3182, "tcp", "bmcpatrolrnvu", "BMC Patrol Rendezvous"},
+        PortRecord{3183, "tcp", "cops-tls", "COPS/TLS"},
+        PortRecord{3184, "tcp", "apogeex-port", "ApogeeX Port"},
+        PortRecord{3185, "tcp", "smpppd", "SuSE Meta PPPD"},
+        PortRecord{3186, "tcp", "iiw-port", "IIW Monitor User Port"},
+        PortRecord{3187, "tcp", "odi-port", "Open Design Listen Port"},
+        PortRecord{3188, "tcp", "brcm-comm-port", "Broadcom Port"},
+        PortRecord{3189, "tcp", "pcle-infex", "Pinnacle Sys InfEx Port"},
+        PortRecord{3190, "tcp", "csvr-proxy", "ConServR Proxy"},
+        PortRecord{3191, "tcp", "csvr-sslproxy", "ConServR SSL Proxy"},
+        PortRecord{3192, "tcp", "firemonrcc", "FireMon Revision Control"},
+        PortRecord{3193, "tcp", "spandataport", "spandataport"},
+        PortRecord{3194, "tcp", "magbind", "Rockstorm MAG protocol"},
+        PortRecord{3195, "tcp", "ncu-1", "Network Control Unit"},
+        PortRecord{3196, "tcp", "ncu-2", "Network Control Unit"},
+        PortRecord{3197, "tcp", "embrace-dp-s", "Embrace Device Protocol Server"},
+        PortRecord{3198, "tcp", "embrace-dp-c", "Embrace Device Protocol Client"},
+        PortRecord{3199, "tcp", "dmod-workspace", "DMOD WorkSpace"},
+        PortRecord{3200, "tcp", "tick-port", "Press-sense Tick Port"},
+        PortRecord{3201, "tcp", "cpq-tasksmart", "cpq-tasksmart"},
+        PortRecord{3202, "tcp", "intraintra", "intraintra"},
+        PortRecord{3203, "tcp", "netwatcher-mon", "Network Watcher Monitor"},
+        PortRecord{3204, "tcp", "netwatcher-db", "Network Watcher DB Access"},
+        PortRecord{3205, "tcp", "isns", "iSNS Server Port"},
+        PortRecord{3206, "tcp", "ironmail", "IronMail POP Proxy"},
+        PortRecord{3207, "tcp", "vx-auth-port", "Veritas Authentication Port"},
+        PortRecord{3208, "tcp", "pfu-prcallback", "PFU PR Callback"},
+        PortRecord{3209, "tcp", "netwkpathengine", "HP OpenView Network Path Engine Server"},
+        PortRecord{3210, "tcp", "flamenco-proxy", "Flamenco Networks Proxy"},
+        PortRecord{3211, "tcp", "avsecuremgmt", "Avocent Secure Management"},
+        PortRecord{3212, "tcp", "surveyinst", "Survey Instrument"},
+        PortRecord{3213, "tcp", "neon24x7", "NEON 24X7 Mission Control"},
+        PortRecord{3214, "tcp", "jmq-daemon-1", "JMQ Daemon Port 1"},
+        PortRecord{3215, "tcp", "jmq-daemon-2", "JMQ Daemon Port 2"},
+        PortRecord{3216, "tcp", "ferrari-foam", "Ferrari electronic FOAM"},
+        PortRecord{3217, "tcp", "unite", "Unified IP & Telecom Environment"},
+        PortRecord{3218, "tcp", "smartpackets", "EMC SmartPackets"},
+        PortRecord{3219, "tcp", "wms-messenger", "WMS Messenger"},
+        PortRecord{3220, "tcp", "xnm-ssl", "XML NM over SSL"},
+        PortRecord{3221, "tcp", "xnm-clear-text", "XML NM over TCP"},
+        PortRecord{3222, "tcp", "glbp", "Gateway Load Balancing Pr"},
+        PortRecord{3223, "tcp", "digivote", "DIGIVOTE (R) Vote-Server"},
+        PortRecord{3224, "tcp", "aes-discovery", "AES Discovery Port"},
+        PortRecord{3225, "tcp", "fcip-port", "FCIP"},
+        PortRecord{3226, "tcp", "isi-irp", "ISI Industry Software IRP"},
+        PortRecord{3227, "tcp", "dwnmshttp", "DiamondWave NMS Server"},
+        PortRecord{3228, "tcp", "dwmsgserver", "DiamondWave MSG Server"},
+        PortRecord{3229, "tcp", "global-cd-port", "Global CD Port"},
+        PortRecord{3230, "tcp", "sftdst-port", "Software Distributor Port"},
+        PortRecord{3231, "tcp", "vidigo", "VidiGo communication (previous was: Delta Solutions Direct)"},
+        PortRecord{3232, "tcp", "mdtp", "MDT port"},
+        PortRecord{3233, "tcp", "whisker", "WhiskerControl main port"},
+        PortRecord{3234, "tcp", "alchemy", "Alchemy Server"},
+        PortRecord{3235, "tcp", "mdap-port", "mdap-port"},
+        PortRecord{3236, "tcp", "apparenet-ts", "appareNet Test Server"},
+        PortRecord{3237, "tcp", "apparenet-tps", "appareNet Test Packet Sequencer"},
+        PortRecord{3238, "tcp", "apparenet-as", "appareNet Analysis Server"},
+        PortRecord{3239, "tcp", "apparenet-ui", "appareNet User Interface"},
+        PortRecord{3240, "tcp", "triomotion", "Trio Motion Control Port"},
+        PortRecord{3241, "tcp", "sysorb", "SysOrb Monitoring Server"},
+        PortRecord{3242, "tcp", "sdp-id-port", "Session Description ID"},
+        PortRecord{3243, "tcp", "timelot", "Timelot Port"},
+        PortRecord{3244, "tcp", "onesaf", "onesaf"},
+        PortRecord{3245, "tcp", "vieo-fe", "VIEO Fabric Executive"},
+        PortRecord{3246, "tcp", "dvt-system", "DVT SYSTEM PORT"},
+        PortRecord{3247, "tcp", "dvt-data", "DVT DATA LINK"},
+        PortRecord{3248, "tcp", "procos-lm", "PROCOS LM"},
+        PortRecord{3249, "tcp", "ssp", "State Sync Protocol"},
+        PortRecord{3250, "tcp", "hicp", "HMS hicp port"},
+        PortRecord{3251, "tcp", "sysscanner", "Sys Scanner"},
+        PortRecord{3252, "tcp", "dhe", "DHE port"},
+        PortRecord{3253, "tcp", "pda-data", "PDA Data"},
+        PortRecord{3254, "tcp", "pda-sys", "PDA System"},
+        PortRecord{3255, "tcp", "semaphore", "Semaphore Connection Port"},
+        PortRecord{3256, "tcp", "cpqrpm-agent", "Compaq RPM Agent Port"},
+        PortRecord{3257, "tcp", "cpqrpm-server", "Compaq RPM Server Port"},
+        PortRecord{3258, "tcp", "ivecon-port", "Ivecon Server Port"},
+        PortRecord{3259, "tcp", "epncdp2", "Epson Network Common Devi"},
+        PortRecord{3260, "tcp", "iscsi", "iscsi"},
+        PortRecord{3261, "tcp", "winshadow", "winshadow"},
+        PortRecord{3262, "tcp", "necp", "necp"},
+        PortRecord{3263, "tcp", "ecolor-imager", "E-Color Enterprise Imager"},
+        PortRecord{3264, "tcp", "ccmail", "cc:mail/lotus"},
+        PortRecord{3265, "tcp", "altav-tunnel", "Altav Tunnel"},
+        PortRecord{3266, "tcp", "ns-cfg-server", "NS CFG Server"},
+        PortRecord{3267, "tcp", "ibm-dial-out", "IBM Dial Out"},
+        PortRecord{3268, "tcp", "globalcatLDAP", "globalcatLDAP"},
+        PortRecord{3269, "tcp", "globalcatLDAPssl", "globalcatLDAPssl"},
+        PortRecord{3270, "tcp", "verismart", "verismart"},
+        PortRecord{3271, "tcp", "csoft-prev", "CSoft Prev Port"},
+        PortRecord{3272, "tcp", "user-manager", "Fujitsu User Manager"},
+        PortRecord{3273, "tcp", "sxmp", "Simple Extensible Multiplexed Protocol"},
+        PortRecord{3274, "tcp", "ordinox-server", "Ordinox Server"},
+        PortRecord{3275, "tcp", "samd", "samd"},
+        PortRecord{3276, "tcp", "maxim-asics", "Maxim ASICs"},
+        PortRecord{3277, "tcp", "awg-proxy", "AWG Proxy"},
+        PortRecord{3278, "tcp", "lkcmserver", "LKCM Server"},
+        PortRecord{3279, "tcp", "admind", "admind"},
+        PortRecord{3280, "tcp", "vs-server", "VS Server"},
+        PortRecord{3281, "tcp", "sysopt", "sysopt"},
+        PortRecord{3282, "tcp", "datusorb", "datusorb"},
+        PortRecord{3283, "tcp", "netassistant", "netassistant"},
+        PortRecord{3284, "tcp", "4talk", "4talk"},
+        PortRecord{3285, "tcp", "plato", "plato"},
+        PortRecord{3286, "tcp", "e-net", "e-net"},
+        PortRecord{3287, "tcp", "directvdata", "directvdata"},
+        PortRecord{3288, "tcp", "cops", "cops"},
+        PortRecord{3289, "tcp", "enpc", "enpc"},
+        PortRecord{3290, "tcp", "caps-lm", "CAPS LOGISTICS TOOLKIT - LM"},
+        PortRecord{3291, "tcp", "sah-lm", "S A Holditch & Associates - LM"},
+        PortRecord{3292, "tcp", "meetingmaker", "meetingmaker"},
+        PortRecord{3293, "tcp", "fg-fps", "fg-fps"},
+        PortRecord{3294, "tcp", "fg-gip", "fg-gip"},
+        PortRecord{3295, "tcp", "dyniplookup", "Dynamic IP Lookup"},
+        PortRecord{3296, "tcp", "rib-slm", "Rib License Manager"},
+        PortRecord{3297, "tcp", "cytel-lm", "Cytel License Manager"},
+        PortRecord{3298, "tcp", "deskview", "deskview"},
+        PortRecord{3299, "tcp", "saprouter", "pdrncs"},
+        PortRecord{3300, "tcp", "ceph", "Ceph monitor"},
+        PortRecord{3302, "tcp", "mcs-fastmail", "MCS Fastmail"},
+        PortRecord{3303, "tcp", "opsession-clnt", "OP Session Client"},
+        PortRecord{3304, "tcp", "opsession-srvr", "OP Session Server"},
+        PortRecord{3305, "tcp", "odette-ftp", "Odette File Transfer Protocol"},
+        PortRecord{3306, "tcp", "mysql", "MySQL Database Server"},
+        PortRecord{3307, "tcp", "opsession-prxy", "OP Session Proxy"},
+        PortRecord{3308, "tcp", "tns-server", "TNS Server"},
+        PortRecord{3309, "tcp", "tns-adv", "TNS ADV"},
+        PortRecord{3310, "tcp", "dyna-access", "Dyna Access"},
+        PortRecord{3311, "tcp", "mcns-tel-ret", "MCNS Tel Ret"},
+        PortRecord{3312, "tcp", "appman-server", "Application Management Server"},
+        PortRecord{3313, "tcp", "uorb", "Unify Object Broker"},
+        PortRecord{3314, "tcp", "uohost", "Unify Object Host"},
+        PortRecord{3315, "tcp", "cdid", "cdid"},
+        PortRecord{3316, "tcp", "aicc-cmi", "AICC/CMI"},
+        PortRecord{3317, "tcp", "vsaiport", "VSAI PORT"},
+        PortRecord{3318, "tcp", "ssrip", "Swith to Swith Routing Information Protocol"},
+        PortRecord{3319, "tcp", "sdt-lmd", "SDT License Manager"},
+        PortRecord{3320, "tcp", "officelink2000", "Office Link 2000"},
+        PortRecord{3321, "tcp", "vnsstr", "vnsstr"},
+        PortRecord{3322, "tcp", "active-net", "Active Networks"},
+        PortRecord{3323, "tcp", "active-net", "Active Networks"},
+        PortRecord{3324, "tcp", "active-net", "Active Networks"},
+        PortRecord{3325, "tcp", "active-net", "Active Networks"},
+        PortRecord{3326, "tcp", "sftu", "sftu"},
+        PortRecord{3327, "tcp", "bbars", "bbars"},
+        PortRecord{3328, "tcp", "egptlm", "Eaglepoint License Manager"},
+        PortRecord{3329, "tcp", "hp-device-disc", "HP Device Disc"},
+        PortRecord{3330, "tcp", "mcs-calypsoicf", "MCS Calypso ICF"},
+        PortRecord{3331, "tcp", "mcs-messaging", "MCS Messaging"},
+        PortRecord{3332, "tcp", "mcs-mailsvr", "MCS Mail Server"},
+        PortRecord{3333, "tcp", "dec-notes", "DEC Notes"},
+        PortRecord{3334, "tcp", "directv-web", "Direct TV Webcasting"},
+        PortRecord{3335, "tcp", "directv-soft", "Direct TV Software Updates"},
+        PortRecord{3336, "tcp", "directv-tick", "Direct TV Tickers"},
+        PortRecord{3337, "tcp", "directv-catlg", "Direct TV Data Catalog"},
+        PortRecord{3338, "tcp", "anet-b", "OMF data b"},
+        PortRecord{3339, "tcp", "anet-l", "OMF data l"},
+        PortRecord{3340, "tcp", "anet-m", "OMF data m"},
+        PortRecord{3341, "tcp", "anet-h", "OMF data h"},
+        PortRecord{3342, "tcp", "webtie", "webtie"},
+        PortRecord{3343, "tcp", "ms-cluster-net", "MS Cluster Net"},
+        PortRecord{3344, "tcp", "bnt-manager", "BNT Manager"},
+        PortRecord{3345, "tcp", "influence", "influence"},
+        PortRecord{3346, "tcp", "trnsprntproxy", "Trnsprnt Proxy"},
+        PortRecord{3347, "tcp", "phoenix-rpc", "Phoenix RPC"},
+        PortRecord{3348, "tcp", "pangolin-laser", "Pangolin Laser"},
+        PortRecord{3349, "tcp", "chevinservices", "Chevin Services"},
+        PortRecord{3350, "tcp", "findviatv", "findviatv"},
+        PortRecord{3351, "tcp", "btrieve", "Btrieve port"},
+        PortRecord{3352, "tcp", "ssql", "Scalable SQL"},
+        PortRecord{3353, "tcp", "fatpipe", "fatpipe"},
+        PortRecord{3354, "tcp", "suitjd", "suitjd"},
+        PortRecord{3355, "tcp", "ordinox-dbase", "Ordinox Dbase"},
+        PortRecord{3356, "tcp", "upnotifyps", "upnotifyps"},
+        PortRecord{3357, "tcp", "adtech-test", "Adtech Test IP"},
+        PortRecord{3358, "tcp", "mpsysrmsvr", "Mp Sys Rmsvr"},
+        PortRecord{3359, "tcp", "wg-netforce", "WG NetForce"},
+        PortRecord{3360, "tcp", "kv-server", "KV Server"},
+        PortRecord{3361, "tcp", "kv-agent", "KV Agent"},
+        PortRecord{3362, "tcp", "dj-ilm", "DJ ILM"},
+        PortRecord{3363, "tcp", "nati-vi-server", "NATI Vi Server"},
+        PortRecord{3364, "tcp", "creativeserver", "Creative Server"},
+        PortRecord{3365, "tcp", "contentserver", "Content Server"},
+        PortRecord{3366, "tcp", "creativepartnr", "Creative Partner"},
+        PortRecord{3367, "tcp", "satvid-datalnk", "Satellite Video Data Link"},
+        PortRecord{3368, "tcp", "satvid-datalnk", "Satellite Video Data Link"},
+        PortRecord{3369, "tcp", "satvid-datalnk", "Satellite Video Data Link"},
+        PortRecord{3370, "tcp", "satvid-datalnk", "Satellite Video Data Link"},
+        PortRecord{3371, "tcp", "satvid-datalnk", "Satellite Video Data Link"},
+        PortRecord{3372, "tcp", "msdtc", "msdtc"},
+        PortRecord{3373, "tcp", "lavenir-lm", "Lavenir License Manager"},
+        PortRecord{3374, "tcp", "cluster-disc", "Cluster Disc"},
+        PortRecord{3375, "tcp", "vsnm-agent", "VSNM Agent"},
+        PortRecord{3376, "tcp", "cdbroker", "CD Broker"},
+        PortRecord{3377, "tcp", "cogsys-lm", "Cogsys Network License Manager"},
+        PortRecord{3378, "tcp", "wsicopy", "wsicopy"},
+        PortRecord{3379, "tcp", "socorfs", "socorfs"},
+        PortRecord{3380, "tcp", "sns-channels", "SNS Channels"},
+        PortRecord{3381, "tcp", "geneous", "geneous"},
+        PortRecord{3382, "tcp", "fujitsu-neat", "Fujitsu Network Enhanced Antitheft function"},
+        PortRecord{3383, "tcp", "esp-lm", "Enterprise Software Products License Manager"},
+        PortRecord{3384, "tcp", "hp-clic", "hp-clic"},
+        PortRecord{3385, "tcp", "qnxnetman", "qnxnetman"},
+        PortRecord{3386, "tcp", "gprs-data", "gprs-data"},
+        PortRecord{3387, "tcp", "backroomnet", "Back Room Net"},
+        PortRecord{3388, "tcp", "cbserver", "CB Server"},
+        PortRecord{3389, "tcp", "ms-wbt-server", "ms-wbt-server"},
+        PortRecord{3390, "tcp", "dsc", "Distributed Service Coordinator"},
+        PortRecord{3391, "tcp", "savant", "savant"},
+        PortRecord{3392, "tcp", "efi-lm", "EFI License Management"},
+        PortRecord{3393, "tcp", "d2k-tapestry1", "D2K Tapestry Client to Server"},
+        PortRecord{3394, "tcp", "d2k-tapestry2", "D2K Tapestry Server to Server"},
+        PortRecord{3395, "tcp", "dyna-lm", "Dyna License Manager (Elam)"},
+        PortRecord{3396, "tcp", "printer_agent", "printer_agent"},
+        PortRecord{3397, "tcp", "saposs", "saposs"},
+        PortRecord{3398, "tcp", "sapcomm", "sapcomm"},
+        PortRecord{3399, "tcp", "sapeps", "sapeps"},
+        PortRecord{3400, "tcp", "csms2", "csms2"},
+        PortRecord{3401, "tcp", "filecast", "filecast"},
+        PortRecord{3402, "tcp", "fxaengine-net", "FXa Engine Network Port"},
+        PortRecord{3405, "tcp", "nokia-ann-ch1", "Nokia Announcement ch 1"},
+        PortRecord{3406, "tcp", "nokia-ann-ch2", "Nokia Announcement ch 2"},
+        PortRecord{3407, "tcp", "ldap-admin", "LDAP admin server port"},
+        PortRecord{3408, "tcp", "BESApi", "BES Api Port"},
+        PortRecord{3409, "tcp", "networklens", "NetworkLens Event Port"},
+        PortRecord{3410, "tcp", "networklenss", "NetworkLens SSL Event"},
+        PortRecord{3411, "tcp", "biolink-auth", "BioLink Authenteon server"},
+        PortRecord{3412, "tcp", "xmlblaster", "xmlblaster"},
+        PortRecord{3413, "tcp", "svnet", "SpecView Networking"},
+        PortRecord{3414, "tcp", "wip-port", "BroadCloud WIP Port"},
+        PortRecord{3415, "tcp", "bcinameservice", "BCI Name Service"},
+        PortRecord{3416, "tcp", "commandport", "AirMobile IS Command Port"},
+        PortRecord{3417, "tcp", "csvr", "ConServR file translation"},
+        PortRecord{3418, "tcp", "rnmap", "Remote nmap"},
+        PortRecord{3419, "tcp", "softaudit", "softaudit"},
+        PortRecord{3420, "tcp", "ifcp-port", "iFCP User Port"},
+        PortRecord{3421, "tcp", "bmap", "Bull Apprise portmapper"},
+        PortRecord{3422, "tcp", "rusb-sys-port", "Remote USB System Port"},
+        PortRecord{3423, "tcp", "xtrm", "xTrade Reliable Messaging"},
+        PortRecord{3424, "tcp", "xtrms", "xTrade over TLS/SSL"},
+        PortRecord{3425, "tcp", "agps-port", "AGPS Access Port"},
+        PortRecord{3426, "tcp", "arkivio", "Arkivio Storage Protocol"},
+        PortRecord{3427, "tcp", "websphere-snmp", "WebSphere SNMP"},
+        PortRecord{3428, "tcp", "twcss", "2Wire CSS"},
+        PortRecord{3429, "tcp", "gcsp", "GCSP user port"},
+        PortRecord{3430, "tcp", "ssdispatch", "Scott Studios Dispatch"},
+        PortRecord{3431, "tcp", "ndl-als", "Active License Server Port"},
+        PortRecord{3432, "tcp", "osdcp", "Secure Device Protocol"},
+        PortRecord{3433, "tcp", "alta-smp", "alta-smp"},
+        PortRecord{3434, "tcp", "opencm", "OpenCM Server"},
+        PortRecord{3435, "tcp", "pacom", "Pacom Security User Port"},
+        PortRecord{3436, "tcp", "gc-config", "GuardControl Exchange Protocol"},
+        PortRecord{3437, "tcp", "autocueds", "Autocue Directory Service"},
+        PortRecord{3438, "tcp", "spiral-admin", "Spiralcraft Admin"},
+        PortRecord{3439, "tcp", "hri-port", "HRI Interface Port"},
+        PortRecord{3440, "tcp", "ans-console", "Net Steward Mgmt Console"},
+        PortRecord{3441, "tcp", "connect-client", "OC Connect Client"},
+        PortRecord{3442, "tcp", "connect-server", "OC Connect Server"},
+        PortRecord{3443, "tcp", "ov-nnm-websrv", "OpenView Network Node Manager WEB Server"},
+        PortRecord{3444, "tcp", "denali-server", "Denali Server"},
+        PortRecord{3445, "tcp", "monp", "monp"},
+        PortRecord{3446, "tcp", "3comfaxrpc", "3Com FAX RPC port"},
+        PortRecord{3447, "tcp", "directnet", "DirectNet IM System"},
+        PortRecord{3448, "tcp", "dnc-port", "Discovery and Net Config"},
+        PortRecord{3449, "tcp", "hotu-chat", "HotU Chat"},
+        PortRecord{3450, "tcp", "castorproxy", "castorproxy"},
+        PortRecord{3451, "tcp", "asam", "ASAM Services"},
+        PortRecord{3452, "tcp", "sabp-signal", "SABP-Signalling Protocol"},
+        PortRecord{3453, "tcp", "pscupd", "pscupd"},
+        PortRecord{3454, "tcp", "mira", "Apple Remote Access Protocol"},
+        PortRecord{3455, "tcp", "prsvp", "RSVP Port"},
+        PortRecord{3456, "tcp", "vat", "VAT default data"},
+        PortRecord{3457, "tcp", "vat-control", "VAT default control"},
+        PortRecord{3458, "tcp", "d3winosfi", "d3winosfi"},
+        PortRecord{3459, "tcp", "integral", "TIP Integral"},
+        PortRecord{3460, "tcp", "edm-manager", "EDM Manger"},
+        PortRecord{3461, "tcp", "edm-stager", "EDM Stager"},
+        PortRecord{3462, "tcp", "track", "track"},
+        PortRecord{3463, "tcp", "edm-adm-notify", "EDM ADM Notify"},
+        PortRecord{3464, "tcp", "edm-mgr-sync", "EDM MGR Sync"},
+        PortRecord{3465, "tcp", "edm-mgr-cntrl", "EDM MGR Cntrl"},
+        PortRecord{3466, "tcp", "workflow", "workflow"},
+        PortRecord{3467, "tcp", "rcst", "rcst"},
+        PortRecord{3468, "tcp", "ttcmremotectrl", "TTCM Remote Controll"},
+        PortRecord{3469, "tcp", "pluribus", "pluribus"},
+        PortRecord{3470, "tcp", "jt400", "jt400"},
+        PortRecord{3471, "tcp", "jt400-ssl", "jt400-ssl"},
+        PortRecord{3472, "tcp", "jaugsremotec-1", "JAUGS N-G Remotec 1"},
+        PortRecord{3473, "tcp", "jaugsremotec-2", "JAUGS N-G Remotec 2"},
+        PortRecord{3474, "tcp", "ttntspauto", "TSP Automation"},
+        PortRecord{3475, "tcp", "genisar-port", "Genisar Comm Port"},
+        PortRecord{3476, "tcp", "nppmp", "NVIDIA Mgmt Protocol"},
+        PortRecord{3477, "tcp", "ecomm", "eComm link port"},
+        PortRecord{3478, "tcp", "stun", "stun"},
+        PortRecord{3479, "tcp", "twrpc", "2Wire RPC"},
+        PortRecord{3480, "tcp", "plethora", "Secure Virtual Workspace"},
+        PortRecord{3481, "tcp", "cleanerliverc", "CleanerLive remote ctrl"},
+        PortRecord{3482, "tcp", "vulture", "Vulture Monitoring System"},
+        PortRecord{3483, "tcp", "slim-devices", "Slim Devices Protocol"},
+        PortRecord{3484, "tcp", "gbs-stp", "GBS SnapTalk Protocol"},
+        PortRecord{3485, "tcp", "celatalk", "celatalk"},
+        PortRecord{3486, "tcp", "ifsf-hb-port", "IFSF Heartbeat Port"},
+        PortRecord{3487, "tcp", "ltctcp", "ltctcp"},
+        PortRecord{3488, "tcp", "fs-rh-srv", "FS Remote Host Server"},
+        PortRecord{3489, "tcp", "dtp-dia", "DTP/DIA"},
+        PortRecord{3490, "tcp", "colubris", "Colubris Management Port"},
+        PortRecord{3491, "tcp", "swr-port", "SWR Port"},
+        PortRecord{3492, "tcp", "tvdumtray-port", "TVDUM Tray Port"},
+        PortRecord{3493, "tcp", "nut", "Network UPS Tools"},
+        PortRecord{3494, "tcp", "ibm3494", "IBM 3494"},
+        PortRecord{3495, "tcp", "seclayer-tcp", "securitylayer over tcp"},
+        PortRecord{3496, "tcp", "seclayer-tls", "securitylayer over tls"},
+        PortRecord{3497, "tcp", "ipether232port", "ipether232port"},
+        PortRecord{3498, "tcp", "dashpas-port", "DASHPAS user port"},
+        PortRecord{3499, "tcp", "sccip-media", "SccIP Media"},
+        PortRecord{3500, "tcp", "rtmp-port", "RTMP Port"},
+        PortRecord{3501, "tcp", "isoft-p2p", "isoft-p2p"},
+        PortRecord{3502, "tcp", "avinstalldisc", "Avocent Install Discovery"},
+        PortRecord{3503, "tcp", "lsp-ping", "MPLS LSP-echo Port"},
+        PortRecord{3504, "tcp", "ironstorm", "IronStorm game server"},
+        PortRecord{3505, "tcp", "ccmcomm", "CCM communications port"},
+        PortRecord{3506, "tcp", "apc-3506", "APC 3506"},
+        PortRecord{3507, "tcp", "nesh-broker", "Nesh Broker Port"},
+        PortRecord{3508, "tcp", "interactionweb", "Interaction Web"},
+        PortRecord{3509, "tcp", "vt-ssl", "Virtual Token SSL Port"},
+        PortRecord{3510, "tcp", "xss-port", "XSS Port"},
+        PortRecord{3511, "tcp", "webmail-2", "WebMail/2"},
+        PortRecord{3512, "tcp", "aztec", "Aztec Distribution Port"},
+        PortRecord{3513, "tcp", "arcpd", "Adaptec Remote Protocol"},
+        PortRecord{3514, "tcp", "must-p2p", "MUST Peer to Peer"},
+        PortRecord{3515, "tcp", "must-backplane", "MUST Backplane"},
+        PortRecord{3516, "tcp", "smartcard-port", "Smartcard Port"},
+        PortRecord{3517, "tcp", "802-11-iapp", "IEEE 802.11 WLANs WG IAPP"},
+        PortRecord{3518, "tcp", "artifact-msg", "Artifact Message Server"},
+        PortRecord{3519, "tcp", "nvmsgd", "nvmsgd"},
+        PortRecord{3520, "tcp", "galileolog", "Netvion Galileo Log Port"},
+        PortRecord{3521, "tcp", "mc3ss", "Telequip Labs MC3SS"},
+        PortRecord{3522, "tcp", "nssocketport", "DO over NSSocketPort"},
+        PortRecord{3523, "tcp", "odeumservlink", "Odeum Serverlink"},
+        PortRecord{3524, "tcp", "ecmport", "ECM Server port"},
+        PortRecord{3525, "tcp", "eisport", "EIS Server port"},
+        PortRecord{3526, "tcp", "starquiz-port", "starQuiz Port"},
+        PortRecord{3527, "tcp", "beserver-msg-q", "VERITAS Backup Exec Server"},
+        PortRecord{3528, "tcp", "jboss-iiop", "JBoss IIOP"},
+        PortRecord{3529, "tcp", "jboss-iiop-ssl", "JBoss IIOP/SSL"},
+        PortRecord{3530, "tcp", "gf", "Grid Friendly"},
+        PortRecord{3531, "tcp", "peerenabler", "peerenabler"},
+        PortRecord{3532, "tcp", "raven-rmp", "Raven Remote Management Control"},
+        PortRecord{3533, "tcp", "raven-rdp", "Raven Remote Management Data"},
+        PortRecord{3534, "tcp", "urld-port", "URL Daemon Port"},
+        PortRecord{3535, "tcp", "ms-la", "ms-la"},
+        PortRecord{3536, "tcp", "snac", "snac"},
+        PortRecord{3537, "tcp", "ni-visa-remote", "Remote NI-VISA port"},
+        PortRecord{3538, "tcp", "ibm-diradm", "IBM Directory Server"},
+        PortRecord{3539, "tcp", "ibm-diradm-ssl", "IBM Directory Server SSL"},
+        PortRecord{3540, "tcp", "pnrp-port", "PNRP User Port"},
+        PortRecord{3541, "tcp", "voispeed-port", "VoiSpeed Port"},
+        PortRecord{3542, "tcp", "hacl-monitor", "HA cluster monitor"},
+        PortRecord{3543, "tcp", "qftest-lookup", "qftest Lookup Port"},
+        PortRecord{3544, "tcp", "teredo", "Teredo Port"},
+        PortRecord{3545, "tcp", "camac", "CAMAC equipment"},
+        PortRecord{3547, "tcp", "symantec-sim", "Symantec SIM"},
+        PortRecord{3548, "tcp", "interworld", "interworld"},
+        PortRecord{3549, "tcp", "tellumat-nms", "Tellumat MDR NMS"},
+        PortRecord{3550, "tcp", "ssmpp", "Secure SMPP"},
+        PortRecord{3551, "tcp", "apcupsd", "Apcupsd Information Port"},
+        PortRecord{3552, "tcp", "taserver", "TeamAgenda Server Port"},
+        PortRecord{3553, "tcp", "rbr-discovery", "Red Box Recorder ADP"},
+        PortRecord{3554, "tcp", "questnotify", "Quest Notification Server"},
+        PortRecord{3555, "tcp", "razor", "Vipul's Razor"},
+        PortRecord{3556, "tcp", "sky-transport", "Sky Transport Protocol"},
+        PortRecord{3557, "tcp", "personalos-001", "PersonalOS Comm Port"},
+        PortRecord{3558, "tcp", "mcp-port", "MCP user port"},
+        PortRecord{3559, "tcp", "cctv-port", "CCTV control port"},
+        PortRecord{3560, "tcp", "iniserve-port", "INIServe port"},
+        PortRecord{3561, "tcp", "bmc-onekey", "bmc-onekey"},
+        PortRecord{3562, "tcp", "sdbproxy", "sdbproxy"},
+        PortRecord{3563, "tcp", "watcomdebug", "Watcom Debug"},
+        PortRecord{3564, "tcp", "esimport", "Electromed SIM port"},
+        PortRecord{3565, "tcp", "m2pa", "M2PA"},
+        PortRecord{3566, "tcp", "quest-data-hub", "Quest Data Hub"},
+        PortRecord{3567, "tcp", "oap", "oap"},
+        PortRecord{3568, "tcp", "oap-s", "oap-s"},
+        PortRecord{3569, "tcp", "mbg-ctrl", "Meinberg Control Service"},
+        PortRecord{3570, "tcp", "mccwebsvr-port", "MCC Web Server Port"},
+        PortRecord{3571, "tcp", "megardsvr-port", "MegaRAID Server Port"},
+        PortRecord{3572, "tcp", "megaregsvrport", "Registration Server Port"},
+        PortRecord{3573, "tcp", "tag-ups-1", "Advantage Group UPS Suite"},
+        PortRecord{3574, "tcp", "dmaf-server", "dmaf-server"},
+        PortRecord{3575, "tcp", "ccm-port", "Coalsere CCM Port"},
+        PortRecord{3576, "tcp", "cmc-port", "Coalsere CMC Port"},
+        PortRecord{3577, "tcp", "config-port", "Configuration Port"},
+        PortRecord{3578, "tcp", "data-port", "Data Port"},
+        PortRecord{3579, "tcp", "ttat3lb", "Tarantella Load Balancing"},
+        PortRecord{3580, "tcp", "nati-svrloc", "NATI-ServiceLocator"},
+        PortRecord{3581, "tcp", "kfxaclicensing", "Ascent Capture Licensing"},
+        PortRecord{3582, "tcp", "press", "PEG PRESS Server"},
+        PortRecord{3583, "tcp", "canex-watch", "CANEX Watch System"},
+        PortRecord{3584, "tcp", "u-dbap", "U-DBase Access Protocol"},
+        PortRecord{3585, "tcp", "emprise-lls", "Emprise License Server"},
+        PortRecord{3586, "tcp", "emprise-lsc", "License Server Console"},
+        PortRecord{3587, "tcp", "p2pgroup", "Peer to Peer Grouping"},
+        PortRecord{3588, "tcp", "sentinel", "Sentinel Server"},
+        PortRecord{3589, "tcp", "isomair", "isomair"},
+        PortRecord{3590, "tcp", "wv-csp-sms", "WV CSP SMS Binding"},
+        PortRecord{3591, "tcp", "gtrack-server", "LOCANIS G-TRACK Server"},
+        PortRecord{3592, "tcp", "gtrack-ne", "LOCANIS G-TRACK NE Port"},
+        PortRecord{3593, "tcp", "bpmd", "BP Model Debugger"},
+        PortRecord{3594, "tcp", "mediaspace", "mediaspace"},
+        PortRecord{3595, "tcp", "shareapp", "shareapp"},
+        PortRecord{3596, "tcp", "iw-mmogame", "Illusion Wireless MMOG"},
+        PortRecord{3597, "tcp", "a14", "A14 (AN-to-SC/MM)"},
+        PortRecord{3598, "tcp", "a15", "A15 (AN-to-AN)"},
+        PortRecord{3599, "tcp", "quasar-server", "Quasar Accounting Server"},
+        PortRecord{3600, "tcp", "trap-daemon", "text relay-answer"},
+        PortRecord{3601, "tcp", "visinet-gui", "Visinet Gui"},
+        PortRecord{3602, "tcp", "infiniswitchcl", "InfiniSwitch Mgr Client"},
+        PortRecord{3603, "tcp", "int-rcv-cntrl", "Integrated Rcvr Control"},
+        PortRecord{3604, "tcp", "bmc-jmx-port", "BMC JMX Port"},
+        PortRecord{3605, "tcp", "comcam-io", "ComCam IO Port"},
+        PortRecord{3606, "tcp", "splitlock", "Splitlock Server"},
+        PortRecord{3607, "tcp", "precise-i3", "Precise I3"},
+        PortRecord{3608, "tcp", "trendchip-dcp", "Trendchip control protocol"},
+        PortRecord{3609, "tcp", "cpdi-pidas-cm", "CPDI PIDAS Connection Mon"},
+        PortRecord{3610, "tcp", "echonet", "echonet"},
+        PortRecord{3611, "tcp", "six-degrees", "Six Degrees Port"},
+        PortRecord{3612, "tcp", "hp-dataprotect", "hp-dataprotect"},
+        PortRecord{3613, "tcp", "alaris-disc", "Alaris Device Discovery"},
+        PortRecord{3614, "tcp", "sigma-port", "sigma-port"},
+        PortRecord{3615, "tcp", "start-network", "Start Messaging Network"},
+        PortRecord{3616, "tcp", "cd3o-protocol", "cd3o Control Protocol"},
+        PortRecord{3617, "tcp", "sharp-server", "ATI SHARP Logic Engine"},
+        PortRecord{3618, "tcp", "aairnet-1", "AAIR-Network 1"},
+        PortRecord{3619, "tcp", "aairnet-2", "AAIR-Network 2"},
+        PortRecord{3620, "tcp", "ep-pcp", "EPSON Projector Control Port"},
+        PortRecord{3621, "tcp", "ep-nsp", "EPSON Network Screen Port"},
+        PortRecord{3622, "tcp", "ff-lr-port", "FF LAN Redundancy Port"},
+        PortRecord{3623, "tcp", "haipe-discover", "HAIPIS Dynamic Discovery"},
+        PortRecord{3624, "tcp", "dist-upgrade", "Distributed Upgrade Port"},
+        PortRecord{3625, "tcp", "volley", "volley"},
+        PortRecord{3626, "tcp", "bvcdaemon-port", "bvControl Daemon"},
+        PortRecord{3627, "tcp", "jamserverport", "Jam Server Port"},
+        PortRecord{3628, "tcp", "ept-machine", "EPT Machine Interface"},
+        PortRecord{3629, "tcp", "escvpnet", "ESC/VP.net"},
+        PortRecord{3630, "tcp", "cs-remote-db", "C&S Remote Database Port"},
+        PortRecord{3631, "tcp", "cs-services", "C&S Web Services Port"},
+        PortRecord{3632, "tcp", "distccd", "distccd"},
+        PortRecord{3633, "tcp", "wacp", "Wyrnix AIS port"},
+        PortRecord{3634, "tcp", "hlibmgr", "hNTSP Library Manager"},
+        PortRecord{3635, "tcp", "sdo", "Simple Distributed Objects"},
+        PortRecord{3636, "tcp", "servistaitsm", "servistaitsm"},
+        PortRecord{3637, "tcp", "scservp", "Customer Service Port"},
+        PortRecord{3638, "tcp", "ehp-backup", "EHP Backup Protocol"},
+        PortRecord{3639, "tcp", "xap-ha", "Extensible Automation"},
+        PortRecord{3640, "tcp", "netplay-port1", "Netplay Port 1"},
+        PortRecord{3641, "tcp", "netplay-port2", "Netplay Port 2"},
+        PortRecord{3642, "tcp", "juxml-port", "Juxml Replication port"},
+        PortRecord{3643, "tcp", "audiojuggler", "audiojuggler"},
+        PortRecord{3644, "tcp", "ssowatch", "ssowatch"},
+        PortRecord{3645, "tcp", "cyc", "cyc"},
+        PortRecord{3646, "tcp", "xss-srv-port", "XSS Server Port"},
+        PortRecord{3647, "tcp", "splitlock-gw", "Splitlock Gateway"},
+        PortRecord{3648, "tcp", "fjcp", "Fujitsu Cooperation Port"},
+        PortRecord{3649, "tcp", "nmmp", "Nishioka Miyuki Msg Protocol"},
+        PortRecord{3650, "tcp", "prismiq-plugin", "PRISMIQ VOD plug-in"},
+        PortRecord{3651, "tcp", "xrpc-registry", "XRPC Registry"},
+        PortRecord{3652, "tcp", "vxcrnbuport", "VxCR NBU Default Port"},
+        PortRecord{3653, "tcp", "tsp", "Tunnel Setup Protocol"},
+        PortRecord{3654, "tcp", "vaprtm", "VAP RealTime Messenger"},
+        PortRecord{3655, "tcp", "abatemgr", "ActiveBatch Exec Agent"},
+        PortRecord{3656, "tcp", "abatjss", "ActiveBatch Job Scheduler"},
+        PortRecord{3657, "tcp", "immedianet-bcn", "ImmediaNet Beacon"},
+        PortRecord{3658, "tcp", "ps-ams", "PlayStation AMS (Secure)"},
+        PortRecord{3659, "tcp", "apple-sasl", "Apple SASL"},
+        PortRecord{3660, "tcp", "can-nds-ssl", "IBM Tivoli Directory Service using SSL"},
+        PortRecord{3661, "tcp", "can-ferret-ssl", "IBM Tivoli Directory Service using SSL"},
+        PortRecord{3662, "tcp", "pserver", "pserver"},
+        PortRecord{3663, "tcp", "dtp", "DIRECWAY Tunnel Protocol"},
+        PortRecord{3664, "tcp", "ups-engine", "UPS Engine Port"},
+        PortRecord{3665, "tcp", "ent-engine", "Enterprise Engine Port"},
+        PortRecord{3666, "tcp", "eserver-pap", "eserver-pap"},
+        PortRecord{3667, "tcp", "infoexch", "IBM Information Exchange"},
+        PortRecord{3668, "tcp", "dell-rm-port", "Dell Remote Management"},
+        PortRecord{3669, "tcp", "casanswmgmt", "CA SAN Switch Management"},
+        PortRecord{3670, "tcp", "smile", "SMILE TCP/UDP Interface"},
+        PortRecord{3671, "tcp", "efcp", "e Field Control (EIBnet)"},
+        PortRecord{3672, "tcp", "lispworks-orb", "LispWorks ORB"},
+        PortRecord{3673, "tcp", "mediavault-gui", "Openview Media Vault GUI"},
+        PortRecord{3674, "tcp", "wininstall-ipc", "WinINSTALL IPC Port"},
+        PortRecord{3675, "tcp", "calltrax", "CallTrax Data Port"},
+        PortRecord{3676, "tcp", "va-pacbase", "VisualAge Pacbase server"},
+        PortRecord{3677, "tcp", "roverlog", "RoverLog IPC"},
+        PortRecord{3678, "tcp", "ipr-dglt", "DataGuardianLT"},
+        PortRecord{3679, "tcp", "newton-dock", "newton-dock"},
+        PortRecord{3680, "tcp", "npds-tracker", "NPDS Tracker"},
+        PortRecord{3681, "tcp", "bts-x73", "BTS X73 Port"},
+        PortRecord{3682, "tcp", "cas-mapi", "EMC SmartPackets-MAPI"},
+        PortRecord{3683, "tcp", "bmc-ea", "BMC EDV/EA"},
+        PortRecord{3684, "tcp", "faxstfx-port", "FAXstfX"},
+        PortRecord{3685, "tcp", "dsx-agent", "DS Expert Agent"},
+        PortRecord{3686, "tcp", "tnmpv2", "Trivial Network Management"},
+        PortRecord{3687, "tcp", "simple-push", "simple-push"},
+        PortRecord{3688, "tcp", "simple-push-s", "simple-push Secure"},
+        PortRecord{3689, "tcp", "rendezvous", "rendezvous"},
+        PortRecord{3690, "tcp", "svn", "Subversion"},
+        PortRecord{3691, "tcp", "magaya-network", "Magaya Network Port"},
+        PortRecord{3692, "tcp", "intelsync", "Brimstone IntelSync"},
+        PortRecord{3693, "tcp", "easl", "Emergency Automatic Structure Lockdown System"},
+        PortRecord{3695, "tcp", "bmc-data-coll", "BMC Data Collection"},
+        PortRecord{3696, "tcp", "telnetcpcd", "Telnet Com Port Control"},
+        PortRecord{3697, "tcp", "nw-license", "nw-license"},
+        PortRecord{3698, "tcp", "sagectlpanel", "sagectlpanel"},
+        PortRecord{3699, "tcp", "kpn-icw", "Internet Call Waiting"},
+        PortRecord{3700, "tcp", "lrs-paging", "LRS NetPage"},
+        PortRecord{3701, "tcp", "netcelera", "netcelera"},
+        PortRecord{3702, "tcp", "ws-discovery", "Web Service Discovery"},
+        PortRecord{3703, "tcp", "adobeserver-3", "Adobe Server 3"},
+        PortRecord{3704, "tcp", "adobeserver-4", "Adobe Server 4"},
+        PortRecord{3705, "tcp", "adobeserver-5", "Adobe Server 5"},
+        PortRecord{3706, "tcp", "rt-event", "Real-Time Event Port"},
+        PortRecord{3707, "tcp", "rt-event-s", "Real-Time Event Secure Port"},
+        PortRecord{3708, "tcp", "sun-as-iiops", "Sun App Svr - Naming"},
+        PortRecord{3709, "tcp", "ca-idms", "CA-IDMS Server"},
+        PortRecord{3710, "tcp", "portgate-auth", "PortGate Authentication"},
+        PortRecord{3711, "tcp", "edb-server2", "EBD Server 2"},
+        PortRecord{3712, "tcp", "sentinel-ent", "Sentinel Enterprise"},
+        PortRecord{3713, "tcp", "tftps", "TFTP over TLS"},
+        PortRecord{3714, "tcp", "delos-dms", "DELOS Direct Messaging"},
+        PortRecord{3715, "tcp", "anoto-rendezv", "Anoto Rendezvous Port"},
+        PortRecord{3716, "tcp", "wv-csp-sms-cir", "WV CSP SMS CIR Channel"},
+        PortRecord{3717, "tcp", "wv-csp-udp-cir", "WV CSP UDP/IP CIR Channel"},
+        PortRecord{3718, "tcp", "opus-services", "OPUS Server Port"},
+        PortRecord{3719, "tcp", "itelserverport", "iTel Server Port"},
+        PortRecord{3720, "tcp", "ufastro-instr", "UF Astro. Instr. Services"},
+        PortRecord{3721, "tcp", "xsync", "xsync"},
+        PortRecord{3722, "tcp", "xserveraid", "Xserve RAID"},
+        PortRecord{3723, "tcp", "sychrond", "Sychron Service Daemon"},
+        PortRecord{3724, "tcp", "blizwow", "World of Warcraft"},
+        PortRecord{3725, "tcp", "na-er-tip", "Netia NA-ER Port"},
+        PortRecord{3726, "tcp", "array-manager", "array-manager"},
+        PortRecord{3727, "tcp", "e-mdu", "Ericsson Mobile Data Unit"},
+        PortRecord{3728, "tcp", "e-woa", "Ericsson Web on Air"},
+        PortRecord{3729, "tcp", "fksp-audit", "Fireking Audit Port"},
+        PortRecord{3730, "tcp", "client-ctrl", "Client Control"},
+        PortRecord{3731, "tcp", "smap", "Service Manager"},
+        PortRecord{3732, "tcp", "m-wnn", "Mobile Wnn"},
+        PortRecord{3733, "tcp", "multip-msg", "Multipuesto Msg Port"},
+        PortRecord{3734, "tcp", "synel-data", "Synel Data Collection Port"},
+        PortRecord{3735, "tcp", "pwdis", "Password Distribution"},
+        PortRecord{3736, "tcp", "rs-rmi", "RealSpace RMI"},
+        PortRecord{3737, "tcp", "xpanel", "XPanel Daemon"},
+        PortRecord{3738, "tcp", "versatalk", "versaTalk Server Port"},
+        PortRecord{3739, "tcp", "launchbird-lm", "Launchbird LicenseManager"},
+        PortRecord{3740, "tcp", "heartbeat", "Heartbeat Protocol"},
+        PortRecord{3741, "tcp", "wysdma", "WysDM Agent"},
+        PortRecord{3742, "tcp", "cst-port", "CST - Configuration & Service Tracker"},
+        PortRecord{3743, "tcp", "ipcs-command", "IP Control Systems Ltd."},
+        PortRecord{3744, "tcp", "sasg", "sasg"},
+        PortRecord{3745, "tcp", "gw-call-port", "GWRTC Call Port"},
+        PortRecord{3746, "tcp", "linktest", "LXPRO.COM LinkTest"},
+        PortRecord{3747, "tcp", "linktest-s", "LXPRO.COM LinkTest SSL"},
+        PortRecord{3748, "tcp", "webdata", "webdata"},
+        PortRecord{3749, "tcp", "cimtrak", "cimtrak"},
+        PortRecord{3750, "tcp", "cbos-ip-port", "cbos-ip-port"},
+        PortRecord{3751, "tcp", "gprs-cube", "CommLinx GPRS Cube"},
+        PortRecord{3752, "tcp", "vipremoteagent", "Vigil-IP RemoteAgent"},
+        PortRecord{3753, "tcp", "nattyserver", "NattyServer Port"},
+        PortRecord{3754, "tcp", "timestenbroker", "TimesTen Broker Port"},
+        PortRecord{3755, "tcp", "sas-remote-hlp", "SAS Remote Help Server"},
+        PortRecord{3756, "tcp", "canon-capt", "Canon CAPT Port"},
+        PortRecord{3757, "tcp", "grf-port", "GRF Server Port"},
+        PortRecord{3758, "tcp", "apw-registry", "apw RMI registry"},
+        PortRecord{3759, "tcp", "exapt-lmgr", "Exapt License Manager"},
+        PortRecord{3760, "tcp", "adtempusclient", "adtempusclient"},
+        PortRecord{3761, "tcp", "gsakmp", "gsakmp port"},
+        PortRecord{3762, "tcp", "gbs-smp", "GBS SnapMail Protocol"},
+        PortRecord{3763, "tcp", "xo-wave", "XO Wave Control Port"},
+        PortRecord{3764, "tcp", "mni-prot-rout", "MNI Protected Routing"},
+        PortRecord{3765, "tcp", "rtraceroute", "Remote Traceroute"},
+        PortRecord{3766, "tcp", "sitewatch-s", "SSL e-watch sitewatch server"},
+        PortRecord{3767, "tcp", "listmgr-port", "ListMGR Port"},
+        PortRecord{3768, "tcp", "rblcheckd", "rblcheckd server daemon"},
+        PortRecord{3769, "tcp", "haipe-otnk", "HAIPE Network Keying"},
+        PortRecord{3770, "tcp", "cindycollab", "Cinderella Collaboration"},
+        PortRecord{3771, "tcp", "paging-port", "RTP Paging Port"},
+        PortRecord{3772, "tcp", "ctp", "Chantry Tunnel Protocol"},
+        PortRecord{3773, "tcp", "ctdhercules", "ctdhercules"},
+        PortRecord{3774, "tcp", "zicom", "zicom"},
+        PortRecord{3775, "tcp", "ispmmgr", "ISPM Manager Port"},
+        PortRecord{3776, "tcp", "dvcprov-port", "Device Provisioning Port"},
+        PortRecord{3777, "tcp", "jibe-eb", "Jibe EdgeBurst"},
+        PortRecord{3778, "tcp", "c-h-it-port", "Cutler-Hammer IT Port"},
+        PortRecord{3779, "tcp", "cognima", "Cognima Replication"},
+        PortRecord{3780, "tcp", "nnp", "Nuzzler Network Protocol"},
+        PortRecord{3781, "tcp", "abcvoice-port", "ABCvoice server port"},
+        PortRecord{3782, "tcp", "iso-tp0s", "Secure ISO TP0 port"},
+        PortRecord{3783, "tcp", "bim-pem", "Impact Mgr./PEM Gateway"},
+        PortRecord{3784, "tcp", "bfd-control", "BFD Control Protocol"},
+        PortRecord{3785, "tcp", "bfd-echo", "BFD Echo Protocol"},
+        PortRecord{3786, "tcp", "upstriggervsw", "VSW Upstrigger port"},
+        PortRecord{3787, "tcp", "fintrx", "fintrx"},
+        PortRecord{3788, "tcp", "isrp-port", "SPACEWAY Routing port"},
+        PortRecord{3789, "tcp", "remotedeploy", "RemoteDeploy Administration Port [July 2003]"},
+        PortRecord{3790, "tcp", "quickbooksrds", "QuickBooks RDS"},
+        PortRecord{3791, "tcp", "tvnetworkvideo", "TV NetworkVideo Data port"},
+        PortRecord{3792, "tcp", "sitewatch", "e-Watch Corporation SiteWatch"},
+        PortRecord{3793, "tcp", "dcsoftware", "DataCore Software"},
+        PortRecord{3794, "tcp", "jaus", "JAUS Robots"},
+        PortRecord{3795, "tcp", "myblast", "myBLAST Mekentosj port"},
+        PortRecord{3796, "tcp", "spw-dialer", "Spaceway Dialer"},
+        PortRecord{3797, "tcp", "idps", "idps"},
+        PortRecord{3798, "tcp", "minilock", "minilock"},
+        PortRecord{3799, "tcp", "radius-dynauth", "RADIUS Dynamic Authorization"},
+        PortRecord{3800, "tcp", "pwgpsi", "Print Services Interface"},
+        PortRecord{3801, "tcp", "ibm-mgr", "ibm manager service"},
+        PortRecord{3802, "tcp", "vhd", "vhd"},
+        PortRecord{3803, "tcp", "soniqsync", "soniqsync"},
+        PortRecord{3804, "tcp", "iqnet-port", "Harman IQNet Port"},
+        PortRecord{3805, "tcp", "tcpdataserver", "ThorGuard Server Port"},
+        PortRecord{3806, "tcp", "wsmlb", "Remote System Manager"},
+        PortRecord{3807, "tcp", "spugna", "SpuGNA Communication Port"},
+        PortRecord{3808, "tcp", "sun-as-iiops-ca", "Sun App Svr-IIOPClntAuth"},
+        PortRecord{3809, "tcp", "apocd", "Java Desktop System Configuration Agent"},
+        PortRecord{3810, "tcp", "wlanauth", "WLAN AS server"},
+        PortRecord{3811, "tcp", "amp", "amp"},
+        PortRecord{3812, "tcp", "neto-wol-server", "netO WOL Server"},
+        PortRecord{3813, "tcp", "rap-ip", "Rhapsody Interface Protocol"},
+        PortRecord{3814, "tcp", "neto-dcs", "netO DCS"},
+        PortRecord{3815, "tcp", "lansurveyorxml", "LANsurveyor XML"},
+        PortRecord{3816, "tcp", "sunlps-http", "Sun Local Patch Server"},
+        PortRecord{3817, "tcp", "tapeware", "Yosemite Tech Tapeware"},
+        PortRecord{3818, "tcp", "crinis-hb", "Crinis Heartbeat"},
+        PortRecord{3819, "tcp", "epl-slp", "EPL Sequ Layer Protocol"},
+        PortRecord{3820, "tcp", "scp", "Siemens AuD SCP"},
+        PortRecord{3821, "tcp", "pmcp", "ATSC PMCP Standard"},
+        PortRecord{3822, "tcp", "acp-discovery", "Compute Pool Discovery"},
+        PortRecord{3823, "tcp", "acp-conduit", "Compute Pool Conduit"},
+        PortRecord{3824, "tcp", "acp-policy", "Compute Pool Policy"},
+        PortRecord{3825, "tcp", "ffserver", "Antera FlowFusion Process Simulation"},
+        PortRecord{3826, "tcp", "wormux", "wormux"},
+        PortRecord{3827, "tcp", "netmpi", "Netadmin Systems MPI service"},
+        PortRecord{3828, "tcp", "neteh", "Netadmin Systems Event Handler"},
+        PortRecord{3829, "tcp", "neteh-ext", "Netadmin Systems Event Handler External"},
+        PortRecord{3830, "tcp", "cernsysmgmtagt", "Cerner System Management Agent"},
+        PortRecord{3831, "tcp", "dvapps", "Docsvault Application Service"},
+        PortRecord{3832, "tcp", "xxnetserver", "xxnetserver"},
+        PortRecord{3833, "tcp", "aipn-auth", "AIPN LS Authentication"},
+        PortRecord{3834, "tcp", "spectardata", "Spectar Data Stream Service"},
+        PortRecord{3835, "tcp", "spectardb", "Spectar Database Rights Service"},
+        PortRecord{3836, "tcp", "markem-dcp", "MARKEM NEXTGEN DCP"},
+        PortRecord{3837, "tcp", "mkm-discovery", "MARKEM Auto-Discovery"},
+        PortRecord{3838, "tcp", "sos", "Scito Object Server"},
+        PortRecord{3839, "tcp", "amx-rms", "AMX Resource Management Suite"},
+        PortRecord{3840, "tcp", "flirtmitmir", "www.FlirtMitMir.de"},
+        PortRecord{3841, "tcp", "zfirm-shiprush3", "zfirm-shiprush3"},
+        PortRecord{3842, "tcp", "nhci", "NHCI status port"},
+        PortRecord{3843, "tcp", "quest-agent", "Quest Common Agent"},
+        PortRecord{3844, "tcp", "rnm", "rnm"},
+        PortRecord{3845, "tcp", "v-one-spp", "V-ONE Single Port Proxy"},
+        PortRecord{3846, "tcp", "an-pcp", "Astare Network PCP"},
+        PortRecord{3847, "tcp", "msfw-control", "MS Firewall Control"},
+        PortRecord{3848, "tcp", "item", "IT Environmental Monitor"},
+        PortRecord{3849, "tcp", "spw-dnspreload", "spw-dnspreload"},
+        PortRecord{3850, "tcp", "qtms-bootstrap", "QTMS Bootstrap Protocol"},
+        PortRecord{3851, "tcp", "spectraport", "SpectraTalk Port"},
+        PortRecord{3852, "tcp", "sse-app-config", "SSE App Configuration"},
+        PortRecord{3853, "tcp", "sscan", "SONY scanning protocol"},
+        PortRecord{3854, "tcp", "stryker-com", "Stryker Comm Port"},
+        PortRecord{3855, "tcp", "opentrac", "opentrac"},
+        PortRecord{3856, "tcp", "informer", "informer"},
+        PortRecord{3857, "tcp", "trap-port", "Trap Port"},
+        PortRecord{3858, "tcp", "trap-port-mom", "Trap Port MOM"},
+        PortRecord{3859, "tcp", "nav-port", "Navini Port"},
+        PortRecord{3860, "tcp", "sasp", "Server/Application State Protocol (SASP)"},
+        PortRecord{3861, "tcp", "winshadow-hd", "winShadow Host Discovery"},
+        PortRecord{3862, "tcp", "giga-pocket", "giga-pocket"},
+        PortRecord{3863, "tcp", "asap-tcp", "RSerPool ASAP (TCP)"},
+        PortRecord{3864, "tcp", "asap-tcp-tls", "RSerPool ASAP/TLS (TCP)"},
+        PortRecord{3865, "tcp", "xpl", "xpl automation protocol"},
+        PortRecord{3866, "tcp", "dzdaemon", "Sun SDViz DZDAEMON Port"},
+        PortRecord{3867, "tcp", "dzoglserver", "Sun SDViz DZOGLSERVER Port"},
+        PortRecord{3868, "tcp", "diameter", "DIAMETER"},
+        PortRecord{3869, "tcp", "ovsam-mgmt", "hp OVSAM MgmtServer Disco"},
+        PortRecord{3870, "tcp", "ovsam-d-agent", "hp OVSAM HostAgent Disco"},
+        PortRecord{3871, "tcp", "avocent-adsap", "Avocent DS Authorization"},
+        PortRecord{3872, "tcp", "oem-agent", "OEM Agent"},
+        PortRecord{3873, "tcp", "fagordnc", "fagordnc"},
+        PortRecord{3874, "tcp", "sixxsconfig", "SixXS Configuration"},
+        PortRecord{3875, "tcp", "pnbscada", "pnbscada"},
+        PortRecord{3876, "tcp", "dl_agent", "dl_agent"},
+        PortRecord{3877, "tcp", "xmpcr-interface", "XMPCR Interface Port"},
+        PortRecord{3878, "tcp", "fotogcad", "FotoG CAD interface"},
+        PortRecord{3879, "tcp", "appss-lm", "appss license manager"},
+        PortRecord{3880, "tcp", "igrs", "igrs"},
+        PortRecord{3881, "tcp", "idac", "Data Acquisition and Control"},
+        PortRecord{3882, "tcp", "msdts1", "DTS Service Port"},
+        PortRecord{3883, "tcp", "vrpn", "VR Peripheral Network"},
+        PortRecord{3884, "tcp", "softrack-meter", "SofTrack Metering"},
+        PortRecord{3885, "tcp", "topflow-ssl", "TopFlow SSL"},
+        PortRecord{3886, "tcp", "nei-management", "NEI management port"},
+        PortRecord{3887, "tcp", "ciphire-data", "Ciphire Data Transport"},
+        PortRecord{3888, "tcp", "ciphire-serv", "Ciphire Services"},
+        PortRecord{3889, "tcp", "dandv-tester", "D and V Tester Control Port"},
+        PortRecord{3890, "tcp", "ndsconnect", "Niche Data Server Connect"},
+        PortRecord{3891, "tcp", "rtc-pm-port", "Oracle RTC-PM port"},
+        PortRecord{3892, "tcp", "pcc-image-port", "pcc-image-port"},
+        PortRecord{3893, "tcp", "cgi-starapi", "CGI StarAPI Server"},
+        PortRecord{3894, "tcp", "syam-agent", "SyAM Agent Port"},
+        PortRecord{3895, "tcp", "syam-smc", "SyAm SMC Service Port"},
+        PortRecord{3896, "tcp", "sdo-tls", "Simple Distributed Objects over TLS"},
+        PortRecord{3897, "tcp", "sdo-ssh", "Simple Distributed Objects over SSH"},
+        PortRecord{3898, "tcp", "senip", "IAS Inc. SmartEye NET Internet Protocol"},
+        PortRecord{3899, "tcp", "itv-control", "ITV Port"},
+        PortRecord{3900, "tcp", "udt_os", "udt_os"},
+        PortRecord{3901, "tcp", "nimsh", "NIM Service Handler"},
+        PortRecord{3902, "tcp", "nimaux", "NIMsh Auxiliary Port"},
+        PortRecord{3903, "tcp", "charsetmgr", "charsetmgr"},
+        PortRecord{3904, "tcp", "omnilink-port", "Arnet Omnilink Port"},
+        PortRecord{3905, "tcp", "mupdate", "Mailbox Update (MUPDATE) protocol"},
+        PortRecord{3906, "tcp", "topovista-data", "TopoVista elevation data"},
+        PortRecord{3907, "tcp", "imoguia-port", "Imoguia Port"},
+        PortRecord{3908, "tcp", "hppronetman", "HP Procurve NetManagement"},
+        PortRecord{3909, "tcp", "surfcontrolcpa", "SurfControl CPA"},
+        PortRecord{3910, "tcp", "prnrequest", "Printer Request Port"},
+        PortRecord{3911, "tcp", "prnstatus", "Printer Status Port"},
+        PortRecord{3912, "tcp", "gbmt-stars", "Global Maintech Stars"},
+        PortRecord{3913, "tcp", "listcrt-port", "ListCREATOR Port"},
+        PortRecord{3914, "tcp", "listcrt-port-2", "ListCREATOR Port 2"},
+        PortRecord{3915, "tcp", "agcat", "Auto-Graphics Cataloging"},
+        PortRecord{3916, "tcp", "wysdmc", "WysDM Controller"},
+        PortRecord{3917, "tcp", "aftmux", "aftmux"},
+        PortRecord{3918, "tcp", "pktcablemmcops", "PacketCableMultimediaCOPS"},
+        PortRecord{3919, "tcp", "hyperip", "hyperip"},
+        PortRecord{3920, "tcp", "exasoftport1", "Exasoft IP Port"},
+        PortRecord{3921, "tcp", "herodotus-net", "Herodotus Net"},
+        PortRecord{3922, "tcp", "sor-update", "Soronti Update Port"},
+        PortRecord{3923, "tcp", "symb-sb-port", "Symbian Service Broker"},
+        PortRecord{3924, "tcp", "mpl-gprs-port", "mpl-gprs-port"},
+        PortRecord{3925, "tcp", "zmp", "Zoran Media Port"},
+        PortRecord{3926, "tcp", "winport", "winport"},
+        PortRecord{3927, "tcp", "natdataservice", "ScsTsr"},
+        PortRecord{3928, "tcp", "netboot-pxe", "PXE NetBoot Manager"},
+        PortRecord{3929, "tcp", "smauth-port", "AMS Port"},
+        PortRecord{3930, "tcp", "syam-webserver", "Syam Web Server Port"},
+        PortRecord{3931, "tcp", "msr-plugin-port", "MSR Plugin Port"},
+        PortRecord{3932, "tcp", "dyn-site", "Dynamic Site System"},
+        PortRecord{3933, "tcp", "plbserve-port", "PL/B App Server User Port"},
+        PortRecord{3934, "tcp", "sunfm-port", "PL/B File Manager Port"},
+        PortRecord{3935, "tcp", "sdp-portmapper", "SDP Port Mapper Protocol"},
+        PortRecord{3936, "tcp", "mailprox", "mailprox"},
+        PortRecord{3937, "tcp", "dvbservdsc", "DVB Service Discovery"},
+        PortRecord{3938, "tcp", "dbcontrol_agent", "dbcontrol_agent"},
+        PortRecord{3939, "tcp", "aamp", "Anti-virus Application Management Port"},
+        PortRecord{3940, "tcp", "xecp-node", "XeCP Node Service"},
+        PortRecord{3941, "tcp", "homeportal-web", "Home Portal Web Server"},
+        PortRecord{3942, "tcp", "srdp", "satellite distribution"},
+        PortRecord{3943, "tcp", "tig", "TetraNode Ip Gateway"},
+        PortRecord{3944, "tcp", "sops", "S-Ops Management"},
+        PortRecord{3945, "tcp", "emcads", "EMCADS Server Port"},
+        PortRecord{3946, "tcp", "backupedge", "BackupEDGE Server"},
+        PortRecord{3947, "tcp", "ccp", "Connect and Control Protocol"},
+        PortRecord{3948, "tcp", "apdap", "Anton Paar Device Administration Protocol"},
+        PortRecord{3949, "tcp", "drip", "Dynamic Routing Information Protocol"},
+        PortRecord{3950, "tcp", "namemunge", "Name Munging"},
+        PortRecord{3951, "tcp", "pwgippfax", "PWG IPP Facsimile"},
+        PortRecord{3952, "tcp", "i3-sessionmgr", "I3 Session Manager"},
+        PortRecord{3953, "tcp", "xmlink-connect", "Eydeas XMLink Connect"},
+        PortRecord{3954, "tcp", "adrep", "AD Replication RPC"},
+        PortRecord{3955, "tcp", "p2pcommunity", "p2pcommunity"},
+        PortRecord{3956, "tcp", "gvcp", "GigE Vision Control"},
+        PortRecord{3957, "tcp", "mqe-broker", "MQEnterprise Broker"},
+        PortRecord{3958, "tcp", "mqe-agent", "MQEnterprise Agent"},
+        PortRecord{3959, "tcp", "treehopper", "Tree Hopper Networking"},
+        PortRecord{3960, "tcp", "bess", "Bess Peer Assessment"},
+        PortRecord{3961, "tcp", "proaxess", "ProAxess Server"},
+        PortRecord{3962, "tcp", "sbi-agent", "SBI Agent Protocol"},
+        PortRecord{3963, "tcp", "thrp", "Teran Hybrid Routing Protocol"},
+        PortRecord{3964, "tcp", "sasggprs", "SASG GPRS"},
+        PortRecord{3965, "tcp", "ati-ip-to-ncpe", "Avanti IP to NCPE API"},
+        PortRecord{3966, "tcp", "bflckmgr", "BuildForge Lock Manager"},
+        PortRecord{3967, "tcp", "ppsms", "PPS Message Service"},
+        PortRecord{3968, "tcp", "ianywhere-dbns", "iAnywhere DBNS"},
+        PortRecord{3969, "tcp", "landmarks", "Landmark Messages"},
+        PortRecord{3970, "tcp", "lanrevagent", "LANrev Agent"},
+        PortRecord{3971, "tcp", "lanrevserver", "LANrev Server"},
+        PortRecord{3972, "tcp", "iconp", "ict-control Protocol"},
+        PortRecord{3973, "tcp", "progistics", "ConnectShip Progistics"},
+        PortRecord{3974, "tcp", "citysearch", "Remote Applicant Tracking Service"},
+        PortRecord{3975, "tcp", "airshot", "Air Shot"},
+        PortRecord{3976, "tcp", "opswagent", "opswagent"},
+        PortRecord{3977, "tcp", "opswmanager", "Opsware Manager"},
+        PortRecord{3978, "tcp", "secure-cfg-svr", "Secured Configuration Server"},
+        PortRecord{3979, "tcp", "smwan", "Smith Micro Wide Area Network Service"},
+        PortRecord{3980, "tcp", "acms", "Aircraft Cabin Management System"},
+        PortRecord{3981, "tcp", "starfish", "Starfish System Admin"},
+        PortRecord{3982, "tcp", "eis", "ESRI Image Server"},
+        PortRecord{3983, "tcp", "eisp", "ESRI Image Service"},
+        PortRecord{3984, "tcp", "mapper-nodemgr", "MAPPER network node manager"},
+        PortRecord{3985, "tcp", "mapper-mapethd", "MAPPER TCP/IP server"},
+        PortRecord{3986, "tcp", "mapper-ws_ethd", "mapper-ws_ethd"},
+        PortRecord{3987, "tcp", "centerline", "centerline"},
+        PortRecord{3988, "tcp", "dcs-config", "DCS Configuration Port"},
+        PortRecord{3989, "tcp", "bv-queryengine", "BindView-Query Engine"},
+        PortRecord{3990, "tcp", "bv-is", "BindView-IS"},
+        PortRecord{3991, "tcp", "bv-smcsrv", "BindView-SMCServer"},
+        PortRecord{3992, "tcp", "bv-ds", "BindView-DirectoryServer"},
+        PortRecord{3993, "tcp", "bv-agent", "BindView-Agent"},
+        PortRecord{3995, "tcp", "iss-mgmt-ssl", "ISS Management Svcs SSL"},
+        PortRecord{3996, "tcp", "abcsoftware", "abcsoftware-01"},
+        PortRecord{3997, "tcp", "agentsease-db", "aes_db"},
+        PortRecord{3998, "tcp", "dnx", "Distributed Nagios Executor Service"},
+        PortRecord{3999, "tcp", "remoteanything", "remoteanything"},
+        PortRecord{4000, "tcp", "remoteanything", "remoteanything"},
+        PortRecord{4001, "tcp", "newoak", "newoak"},
+        PortRecord{4002, "tcp", "mlchat-proxy", "mlchat-proxy"},
+        PortRecord{4003, "tcp", "pxc-splr-ft", "pxc-splr-ft"},
+        PortRecord{4004, "tcp", "pxc-roid", "pxc-roid"},
+        PortRecord{4005, "tcp", "pxc-pin", "pxc-pin"},
+        PortRecord{4006, "tcp", "pxc-spvr", "pxc-spvr"},
+        PortRecord{4007, "tcp", "pxc-splr", "pxc-splr"},
+        PortRecord{4008, "tcp", "netcheque", "NetCheque accounting"},
+        PortRecord{4009, "tcp", "chimera-hwm", "Chimera HWM"},
+        PortRecord{4010, "tcp", "samsung-unidex", "Samsung Unidex"},
+        PortRecord{4011, "tcp", "altserviceboot", "Alternate Service Boot"},
+        PortRecord{4012, "tcp", "pda-gate", "PDA Gate"},
+        PortRecord{4013, "tcp", "acl-manager", "ACL Manager"},
+        PortRecord{4014, "tcp", "taiclock", "taiclock"},
+        PortRecord{4015, "tcp", "talarian-mcast1", "Talarian Mcast"},
+        PortRecord{4016, "tcp", "talarian-mcast2", "Talarian Mcast"},
+        PortRecord{4017, "tcp", "talarian-mcast3", "Talarian Mcast"},
+        PortRecord{4018, "tcp", "talarian-mcast4", "Talarian Mcast"},
+        PortRecord{4019, "tcp", "talarian-mcast5", "Talarian Mcast"},
+        PortRecord{4020, "tcp", "trap", "TRAP Port"},
+        PortRecord{4021, "tcp", "nexus-portal", "Nexus Portal"},
+        PortRecord{4022, "tcp", "dnox", "dnox"},
+        PortRecord{4023, "tcp", "esnm-zoning", "ESNM Zoning Port"},
+        PortRecord{4024, "tcp", "tnp1-port", "TNP1 User Port"},
+        PortRecord{4025, "tcp", "partimage", "Partition Image Port"},
+        PortRecord{4026, "tcp", "as-debug", "Graphical Debug Server"},
+        PortRecord{4027, "tcp", "bxp", "bitxpress"},
+        PortRecord{4028, "tcp", "dtserver-port", "DTServer Port"},
+        PortRecord{4029, "tcp", "ip-qsig", "IP Q signaling protocol"},
+        PortRecord{4030, "tcp", "jdmn-port", "Accell/JSP Daemon Port"},
+        PortRecord{4031, "tcp", "suucp", "UUCP over SSL"},
+        PortRecord{4032, "tcp", "vrts-auth-port", "VERITAS Authorization Service"},
+        PortRecord{4033, "tcp", "sanavigator", "SANavigator Peer Port"},
+        PortRecord{4034, "tcp", "ubxd", "Ubiquinox Daemon"},
+        PortRecord{4035, "tcp", "wap-push-http", "WAP Push OTA-HTTP port"},
+        PortRecord{4036, "tcp", "wap-push-https", "WAP Push OTA-HTTP secure"},
+        PortRecord{4037, "tcp", "ravehd", "RaveHD network control"},
+        PortRecord{4038, "tcp", "fazzt-ptp", "Fazzt Point-To-Point"},
+        PortRecord{4039, "tcp", "fazzt-admin", "Fazzt Administration"},
+        PortRecord{4040, "tcp", "yo-main", "Yo.net main service"},
+        PortRecord{4041, "tcp", "houston", "Rocketeer-Houston"},
+        PortRecord{4042, "tcp", "ldxp", "ldxp"},
+        PortRecord{4043, "tcp", "nirp", "Neighbour Identity Resolution"},
+        PortRecord{4044, "tcp", "ltp", "Location Tracking Protocol"},
+        PortRecord{4045, "tcp", "lockd", "lockd"},
+        PortRecord{4046, "tcp", "acp-proto", "Accounting Protocol"},
+        PortRecord{4047, "tcp", "ctp-state", "Context Transfer Protocol"},
+        PortRecord{4049, "tcp", "wafs", "Wide Area File Services"},
+        PortRecord{4050, "tcp", "cisco-wafs", "Wide Area File Services"},
+        PortRecord{4051, "tcp", "cppdp", "Cisco Peer to Peer Distribution Protocol"},
+        PortRecord{4052, "tcp", "interact", "VoiceConnect Interact"},
+        PortRecord{4053, "tcp", "ccu-comm-1", "CosmoCall Universe Communications Port 1"},
+        PortRecord{4054, "tcp", "ccu-comm-2", "CosmoCall Universe Communications Port 2"},
+        PortRecord{4055, "tcp", "ccu-comm-3", "CosmoCall Universe Communications Port 3"},
+        PortRecord{4056, "tcp", "lms", "Location Message Service"},
+        PortRecord{4057, "tcp", "wfm", "Servigistics WFM server"},
+        PortRecord{4058, "tcp", "kingfisher", "Kingfisher protocol"},
+        PortRecord{4059, "tcp", "dlms-cosem", "DLMS/COSEM"},
+        PortRecord{4060, "tcp", "dsmeter_iatc", "dsmeter_iatc"},
+        PortRecord{4061, "tcp", "ice-location", "Ice Location Service (TCP)"},
+        PortRecord{4062, "tcp", "ice-slocation", "Ice Location Service (SSL)"},
+        PortRecord{4063, "tcp", "ice-router", "Ice Firewall Traversal Service (TCP)"},
+        PortRecord{4064, "tcp", "ice-srouter", "Ice Firewall Traversal Service (SSL)"},
+        PortRecord{4065, "tcp", "avanti_cdp", "avanti_cdp"},
+        PortRecord{4066, "tcp", "pmas", "Performance Measurement and Analysis"},
+        PortRecord{4067, "tcp", "idp", "Information Distribution Protocol"},
+        PortRecord{4068, "tcp", "ipfltbcst", "IP Fleet Broadcast"},
+        PortRecord{4069, "tcp", "minger", "Minger Email Address Validation Service"},
+        PortRecord{4070, "tcp", "tripe", "Trivial IP Encryption (TrIPE)"},
+        PortRecord{4071, "tcp", "aibkup", "Automatically Incremental Backup"},
+        PortRecord{4072, "tcp", "zieto-sock", "Zieto Socket Communications"},
+        PortRecord{4073, "tcp", "iRAPP", "iRAPP"},
+        PortRecord{4074, "tcp", "cequint-cityid", "Cequint City ID UI trigger"},
+        PortRecord{4075, "tcp", "perimlan", "ISC Alarm Message Service"},
+        PortRecord{4076, "tcp", "seraph", "Seraph DCS"},
+        PortRecord{4077, "tcp", "ascomalarm", "Ascom IP Alarming"},
+        PortRecord{4078, "tcp", "cssp", "Coordinated Security Service Protocol"},
+        PortRecord{4079, "tcp", "santools", "SANtools Diagnostic Server"},
+        PortRecord{4080, "tcp", "lorica-in", "Lorica inside facing"},
+        PortRecord{4081, "tcp", "lorica-in-sec", "Lorica inside facing (SSL)"},
+        PortRecord{4082, "tcp", "lorica-out", "Lorica outside facing"},
+        PortRecord{4083, "tcp", "lorica-out-sec", "Lorica outside facing (SSL)"},
+        PortRecord{4084, "tcp", "fortisphere-vm", "Fortisphere VM Service"},
+        PortRecord{4085, "tcp", "ezmessagesrv", "EZNews Newsroom Message Service"},
+        PortRecord{4086, "tcp", "ftsync", "Firewall/NAT state table synchronization"},
+        PortRecord{4087, "tcp", "applusservice", "APplus Service"},
+        PortRecord{4088, "tcp", "npsp", "Noah Printing Service Protocol"},
+        PortRecord{4089, "tcp", "opencore", "OpenCORE Remote Control Service"},
+        PortRecord{4090, "tcp", "omasgport", "OMA BCAST Service Guide"},
+        PortRecord{4091, "tcp", "ewinstaller", "EminentWare Installer"},
+        PortRecord{4092, "tcp", "ewdgs", "EminentWare DGS"},
+        PortRecord{4093, "tcp", "pvxpluscs", "Pvx Plus CS Host"},
+        PortRecord{4094, "tcp", "sysrqd", "sysrq daemon"},
+        PortRecord{4095, "tcp", "xtgui", "xtgui information service"},
+        PortRecord{4096, "tcp", "bre", "BRE (Bridge Relay Element)"},
+        PortRecord{4097, "tcp", "patrolview", "Patrol View"},
+        PortRecord{4098, "tcp", "drmsfsd", "drmsfsd"},
+        PortRecord{4099, "tcp", "dpcp", "dpcp"},
+        PortRecord{4100, "tcp", "igo-incognito", "IGo Incognito Data Port"},
+        PortRecord{4101, "tcp", "brlp-0", "Braille protocol"},
+        PortRecord{4102, "tcp", "brlp-1", "Braille protocol"},
+        PortRecord{4103, "tcp", "brlp-2", "Braille protocol"},
+        PortRecord{4104, "tcp", "brlp-3", "Braille protocol"},
+        PortRecord{4105, "tcp", "shofarplayer", "shofarplayer"},
+        PortRecord{4106, "tcp", "synchronite", "synchronite"},
+        PortRecord{4107, "tcp", "j-ac", "JDL Accounting LAN Service"},
+        PortRecord{4108, "tcp", "accel", "accel"},
+        PortRecord{4109, "tcp", "izm", "Instantiated Zero-control Messaging"},
+        PortRecord{4110, "tcp", "g2tag", "G2 RFID Tag Telemetry Data"},
+        PortRecord{4111, "tcp", "xgrid", "xgrid"},
+        PortRecord{4112, "tcp", "apple-vpns-rp", "Apple VPN Server Reporting Protocol"},
+        PortRecord{4113, "tcp", "aipn-reg", "AIPN LS Registration"},
+        PortRecord{4114, "tcp", "jomamqmonitor", "jomamqmonitor"},
+        PortRecord{4115, "tcp", "cds", "CDS Transfer Agent"},
+        PortRecord{4116, "tcp", "smartcard-tls", "smartcard-tls"},
+        PortRecord{4117, "tcp", "hillrserv", "Hillr Connection Manager"},
+        PortRecord{4118, "tcp", "netscript", "Netadmin Systems NETscript service"},
+        PortRecord{4119, "tcp", "assuria-slm", "Assuria Log Manager"},
+        PortRecord{4120, "tcp", "minirem", "MiniRem Remote Telemetry and Control"},
+        PortRecord{4121, "tcp", "e-builder", "e-Builder Application Communication"},
+        PortRecord{4122, "tcp", "fprams", "Fiber Patrol Alarm Service"},
+        PortRecord{4123, "tcp", "z-wave", "z-wave"},
+        PortRecord{4124, "tcp", "tigv2", "Rohill TetraNode Ip Gateway v2"},
+        PortRecord{4125, "tcp", "rww", "rww"},
+        PortRecord{4126, "tcp", "ddrepl", "Data Domain Replication Service"},
+        PortRecord{4127, "tcp", "unikeypro", "NetUniKeyServer"},
+        PortRecord{4128, "tcp", "nufw", "NuFW decision delegation protocol"},
+        PortRecord{4129, "tcp", "nuauth", "NuFW authentication protocol"},
+        PortRecord{4130, "tcp", "fronet", "FRONET message protocol"},
+        PortRecord{4131, "tcp", "stars", "Global Maintech Stars"},
+        PortRecord{4132, "tcp", "nuts_dem", "nuts_dem"},
+        PortRecord{4133, "tcp", "nuts_bootp", "nuts_bootp"},
+        PortRecord{4134, "tcp", "nifty-hmi", "NIFTY-Serve HMI protocol"},
+        PortRecord{4135, "tcp", "cl-db-attach", "Classic Line Database Server Attach"},
+        PortRecord{4136, "tcp", "cl-db-request", "Classic Line Database Server Request"},
+        PortRecord{4137, "tcp", "cl-db-remote", "Classic Line Database Server Remote"},
+        PortRecord{4138, "tcp", "nettest", "nettest"},
+        PortRecord{4139, "tcp", "thrtx", "Imperfect Networks Server"},
+        PortRecord{4140, "tcp", "cedros_fds", "cedros_fds"},
+        PortRecord{4141, "tcp", "oirtgsvc", "Workflow Server"},
+        PortRecord{4142, "tcp", "oidocsvc", "Document Server"},
+        PortRecord{4143, "tcp", "oidsr", "Document Replication"},
+        PortRecord{4144, "tcp", "wincim", "Windows PC compuserve.com protocol"},
+        PortRecord{4145, "tcp", "vvr-control", "VVR Control"},
+        PortRecord{4146, "tcp", "tgcconnect", "TGCConnect Beacon"},
+        PortRecord{4147, "tcp", "vrxpservman", "Multum Service Manager"},
+        PortRecord{4148, "tcp", "hhb-handheld", "HHB Handheld Client"},
+        PortRecord{4149, "tcp", "agslb", "A10 GSLB Service"},
+        PortRecord{4150, "tcp", "PowerAlert-nsa", "PowerAlert Network Shutdown Agent"},
+        PortRecord{4151, "tcp", "menandmice_noh", "menandmice_noh"},
+        PortRecord{4152, "tcp", "idig_mux", "idig_mux"},
+        PortRecord{4153, "tcp", "mbl-battd", "MBL Remote Battery Monitoring"},
+        PortRecord{4154, "tcp", "atlinks", "atlinks device discovery"},
+        PortRecord{4155, "tcp", "bzr", "Bazaar version control system"},
+        PortRecord{4156, "tcp", "stat-results", "STAT Results"},
+        PortRecord{4157, "tcp", "stat-scanner", "STAT Scanner Control"},
+        PortRecord{4158, "tcp", "stat-cc", "STAT Command Center"},
+        PortRecord{4159, "tcp", "nss", "Network Security Service"},
+        PortRecord{4160, "tcp", "jini-discovery", "Jini Discovery"},
+        PortRecord{4161, "tcp", "omscontact", "OMS Contact"},
+        PortRecord{4162, "tcp", "omstopology", "OMS Topology"},
+        PortRecord{4163, "tcp", "silverpeakpeer", "Silver Peak Peer Protocol"},
+        PortRecord{4164, "tcp", "silverpeakcomm", "Silver Peak Communication Protocol"},
+        PortRecord{4165, "tcp", "altcp", "ArcLink over Ethernet"},
+        PortRecord{4166, "tcp", "joost", "Joost Peer to Peer Protocol"},
+        PortRecord{4167, "tcp", "ddgn", "DeskDirect Global Network"},
+        PortRecord{4168, "tcp", "pslicser", "PrintSoft License Server"},
+        PortRecord{4169, "tcp", "iadt", "iadt"},
+        PortRecord{4170, "tcp", "d-cinema-csp", "SMPTE Content Synchonization Protocol"},
+        PortRecord{4171, "tcp", "ml-svnet", "Maxlogic Supervisor Communication"},
+        PortRecord{4172, "tcp", "pcoip", "PC over IP"},
+        PortRecord{4173, "tcp", "mma-discovery", "MMA Device Discovery"},
+        PortRecord{4174, "tcp", "smcluster", "smcluster"},
+        PortRecord{4175, "tcp", "bccp", "Brocade Cluster Communication Protocol"},
+        PortRecord{4176, "tcp", "tl-ipcproxy", "Translattice Cluster IPC Proxy"},
+        PortRecord{4177, "tcp", "wello", "Wello P2P pubsub service"},
+        PortRecord{4178, "tcp", "storman", "storman"},
+        PortRecord{4179, "tcp", "MaxumSP", "Maxum Services"},
+        PortRecord{4180, "tcp", "httpx", "httpx"},
+        PortRecord{4181, "tcp", "macbak", "macbak"},
+        PortRecord{4182, "tcp", "pcptcpservice", "Production Company Pro TCP Service"},
+        PortRecord{4183, "tcp", "gmmp", "gmmp"},
+        PortRecord{4184, "tcp", "universe_suite", "universe_suite"},
+        PortRecord{4185, "tcp", "wcpp", "Woven Control Plane Protocol"},
+        PortRecord{4186, "tcp", "boxbackupstore", "Box Backup Store Service"},
+        PortRecord{4187, "tcp", "csc_proxy", "csc_proxy"},
+        PortRecord{4188, "tcp", "vatata", "Vatata Peer to Peer Protocol"},
+        PortRecord{4189, "tcp", "pcep", "Path Computation Element Communication Protocol"},
+        PortRecord{4190, "tcp", "sieve", "ManageSieve Protocol"},
+        PortRecord{4191, "tcp", "dsmipv6", "Dual Stack MIPv6 NAT Traversal"},
+        PortRecord{4192, "tcp", "azeti", "azeti"},
+        PortRecord{4193, "tcp", "pvxplusio", "PxPlus remote file srvr"},
+        PortRecord{4195, "tcp", "aws-wsp", "AWS protocol for cloud remoting solution"},
+        PortRecord{4197, "tcp", "hctl", "Harman HControl Protocol"},
+        PortRecord{4199, "tcp", "eims-admin", "eims-admin"},
+        PortRecord{4200, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4201, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4202, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4203, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4204, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4205, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4206, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4207, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4208, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4209, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4210, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4211, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4212, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4213, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4214, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4215, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4216, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4217, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4218, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4219, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4220, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4221, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4222, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4223, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4224, "tcp", "xtell", "Xtell messenging server"},
+        PortRecord{4225, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4226, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4227, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4228, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4229, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4230, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4231, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4232, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4233, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4234, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4235, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4236, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4237, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4238, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4239, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4240, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4241, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4242, "tcp", "vrml-multi-use", "VRML Multi User Systems or CrashPlan"},
+        PortRecord{4243, "tcp", "vrml-multi-use", "VRML Multi User Systems or CrashPlan"},
+        PortRecord{4244, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4245, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4246, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4247, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4248, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4249, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4250, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4251, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4252, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4253, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4254, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4255, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4256, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4257, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4258, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4259, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4260, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4261, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4262, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4263, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4264, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4265, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4266, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4267, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4268, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4269, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4270, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4271, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4272, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4273, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4274, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4275, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4276, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4277, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4278, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4279, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4280, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4281, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4282, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4283, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4284, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4285, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4286, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4287, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4288, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4289, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4290, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4291, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4292, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4293, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4294, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4295, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4296, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4297, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4298, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4299, "tcp", "vrml-multi-use", "VRML Multi User Systems"},
+        PortRecord{4300, "tcp", "corelccam", "Corel CCam"},
+        PortRecord{4301, "tcp", "d-data", "Diagnostic Data"},
+        PortRecord{4302, "tcp", "d-data-control", "Diagnostic Data Control"},
+        PortRecord{4303, "tcp", "srcp", "Simple Railroad Command Protocol"},
+        PortRecord{4304, "tcp", "owserver", "One-Wire Filesystem Server"},
+        PortRecord{4305, "tcp", "batman", "better approach to mobile ad-hoc networking"},
+        PortRecord{4306, "tcp", "pinghgl", "Hellgate London"},
+        PortRecord{4307, "tcp", "visicron-vs", "visicron-vs"},
+        PortRecord{4308, "tcp", "compx-lockview", "compx-lockview"},
+        PortRecord{4309, "tcp", "dserver", "Exsequi Appliance Discovery"},
+        PortRecord{4310, "tcp", "mirrtex", "Mir-RT exchange service"},
+        PortRecord{4311, "tcp", "p6ssmc", "P6R Secure Server Management Console"},
+        PortRecord{4312, "tcp", "pscl-mgt", "Parascale Membership Manager"},
+        PortRecord{4313, "tcp", "perrla", "PERRLA User Services"},
+        PortRecord{4314, "tcp", "choiceview-agt", "ChoiceView Agent"},
+        PortRecord{4316, "tcp", "choiceview-clt", "ChoiceView Client"},
+        PortRecord{4320, "tcp", "fdt-rcatp", "FDT Remote Categorization Protocol"},
+        PortRecord{4321, "tcp", "rwhois", "Remote Who Is"},
+        PortRecord{4322, "tcp", "trim-event", "TRIM Event Service"},
+        PortRecord{4323, "tcp", "trim-ice", "TRIM ICE Service"},
+        PortRecord{4324, "tcp", "balour", "Balour Game Server"},
+        PortRecord{4325, "tcp", "geognosisman", "Cadcorp GeognoSIS Manager Service"},
+        PortRecord{4326, "tcp", "geognosis", "Cadcorp GeognoSIS Service"},
+        PortRecord{4327, "tcp", "jaxer-web", "Jaxer Web Protocol"},
+        PortRecord{4328, "tcp", "jaxer-manager", "Jaxer Manager Command Protocol"},
+        PortRecord{4329, "tcp", "publiqare-sync", "PubliQare Distributed Environment Synchronisation Engine"},
+        PortRecord{4330, "tcp", "dey-sapi", "DEY Storage Administration REST API"},
+        PortRecord{4331, "tcp", "ktickets-rest", "ktickets REST API for event management and ticketing systems (embedded POS devices)"},
+        PortRecord{4332, "tcp", "getty-focus", "Getty Images FOCUS service"},
+        PortRecord{4333, "tcp", "msql", "msql"},
+        PortRecord{4334, "tcp", "netconf-ch-ssh", "NETCONF Call Home (SSH)"},
+        PortRecord{4335, "tcp", "netconf-ch-tls", "NETCONF Call Home (TLS)"},
+        PortRecord{4336, "tcp", "restconf-ch-tls", "RESTCONF Call Home (TLS)"},
+        PortRecord{4340, "tcp", "gaia", "Gaia Connector Protocol"},
+        PortRecord{4341, "tcp", "lisp-data", "LISP Data Packets"},
+        PortRecord{4342, "tcp", "lisp-cons", "lisp-cons"},
+        PortRecord{4343, "tcp", "unicall", "unicall"},
+        PortRecord{4344, "tcp", "vinainstall", "vinainstall"},
+        PortRecord{4345, "tcp", "m4-network-as", "Macro 4 Network AS"},
+        PortRecord{4346, "tcp", "elanlm", "ELAN LM"},
+        PortRecord{4347, "tcp", "lansurveyor", "LAN Surveyor"},
+        PortRecord{4348, "tcp", "itose", "itose"},
+        PortRecord{4349, "tcp", "fsportmap", "File System Port Map"},
+        PortRecord{4350, "tcp", "net-device", "Net Device"},
+        PortRecord{4351, "tcp", "plcy-net-svcs", "PLCY Net Services"},
+        PortRecord{4352, "tcp", "pjlink", "Projector Link"},
+        PortRecord{4353, "tcp", "f5-iquery", "F5 iQuery"},
+        PortRecord{4354, "tcp", "qsnet-trans", "QSNet Transmitter"},
+        PortRecord{4355, "tcp", "qsnet-workst", "QSNet Workstation"},
+        PortRecord{4356, "tcp", "qsnet-assist", "QSNet Assistant"},
+        PortRecord{4357, "tcp", "qsnet-cond", "QSNet Conductor"},
+        PortRecord{4358, "tcp", "qsnet-nucl", "QSNet Nucleus"},
+        PortRecord{4359, "tcp", "omabcastltkm", "OMA BCAST Long-Term Key Messages"},
+        PortRecord{4360, "tcp", "matrix_vnet", "matrix_vnet"},
+        PortRecord{4361, "tcp", "nacnl", "NavCom Discovery and Control Port"},
+        PortRecord{4362, "tcp", "afore-vdp-disc", "AFORE vNode Discovery protocol"},
+        PortRecord{4366, "tcp", "shadowstream", "ShadowStream System"},
+        PortRecord{4368, "tcp", "wxbrief", "WeatherBrief Direct"},
+        PortRecord{4369, "tcp", "epmd", "Erlang Port Mapper Daemon"},
+        PortRecord{4370, "tcp", "elpro_tunnel", "elpro_tunnel"},
+        PortRecord{4371, "tcp", "l2c-control", "l2c-control"},
+        PortRecord{4372, "tcp", "l2c-data", "LAN2CAN Data"},
+        PortRecord{4373, "tcp", "remctl", "Remote Authenticated Command Service"},
+        PortRecord{4374, "tcp", "psi-ptt", "PSI Push-to-Talk Protocol"},
+        PortRecord{4375, "tcp", "tolteces", "Toltec EasyShare"},
+        PortRecord{4376, "tcp", "bip", "BioAPI Interworking"},
+        PortRecord{4377, "tcp", "cp-spxsvr", "Cambridge Pixel SPx Server"},
+        PortRecord{4378, "tcp", "cp-spxdpy", "Cambridge Pixel SPx Display"},
+        PortRecord{4379, "tcp", "ctdb", "ctdb"},
+        PortRecord{4389, "tcp", "xandros-cms", "Xandros Community Management Service"},
+        PortRecord{4390, "tcp", "wiegand", "Physical Access Control"},
+        PortRecord{4391, "tcp", "apwi-imserver", "American Printware IMServer Protocol"},
+        PortRecord{4392, "tcp", "apwi-rxserver", "American Printware RXServer Protocol"},
+        PortRecord{4393, "tcp", "apwi-rxspooler", "American Printware RXSpooler Protocol"},
+        PortRecord{4394, "tcp", "apwi-disc", "American Printware Discovery"},
+        PortRecord{4395, "tcp", "omnivisionesx", "OmniVision communication for Virtual environments"},
+        PortRecord{4396, "tcp", "fly", "Fly Object Space"},
+        PortRecord{4400, "tcp", "ds-srv", "ASIGRA Services"},
+        PortRecord{4401, "tcp", "ds-srvr", "ASIGRA Televaulting DS-System Service"},
+        PortRecord{4402, "tcp", "ds-clnt", "ASIGRA Televaulting DS-Client Service"},
+        PortRecord{4403, "tcp", "ds-user", "ASIGRA Televaulting DS-Client Monitoring/Management"},
+        PortRecord{4404, "tcp", "ds-admin", "ASIGRA Televaulting DS-System Monitoring/Management"},
+        PortRecord{4405, "tcp", "ds-mail", "ASIGRA Televaulting Message Level Restore service"},
+        PortRecord{4406, "tcp", "ds-slp", "ASIGRA Televaulting DS-Sleeper Service"},
+        PortRecord{4407, "tcp", "nacagent", "Network Access Control Agent"},
+        PortRecord{4408, "tcp", "slscc", "SLS Technology Control Centre"},
+        PortRecord{4409, "tcp", "netcabinet-com", "Net-Cabinet comunication"},
+        PortRecord{4410, "tcp", "itwo-server", "RIB iTWO Application Server"},
+        PortRecord{4411, "tcp", "found", "Found Messaging Protocol"},
+        PortRecord{4412, "tcp", "smallchat", "smallchat"},
+        PortRecord{4413, "tcp", "avi-nms", "avi-nms"},
+        PortRecord{4414, "tcp", "updog", "Updog Monitoring and Status Framework"},
+        PortRecord{4415, "tcp", "brcd-vr-req", "Brocade Virtual Router Request"},
+        PortRecord{4416, "tcp", "pjj-player", "pjj-player"},
+        PortRecord{4417, "tcp", "workflowdir", "Workflow Director Communication"},
+        PortRecord{4418, "tcp", "axysbridge", "AXYS communication protocol"},
+        PortRecord{4419, "tcp", "cbp", "Colnod Binary Protocol"},
+        PortRecord{4420, "tcp", "nvm-express", "nvm-express"},
+        PortRecord{4421, "tcp", "scaleft", "Multi-Platform Remote Management for Cloud Infrastructure"},
+        PortRecord{4422, "tcp", "tsepisp", "TSEP Installation Service Protocol"},
+        PortRecord{4423, "tcp", "thingkit", "thingkit secure mesh"},
+        PortRecord{4425, "tcp", "netrockey6", "NetROCKEY6 SMART Plus Service"},
+        PortRecord{4426, "tcp", "beacon-port-2", "SMARTS Beacon Port"},
+        PortRecord{4427, "tcp", "drizzle", "Drizzle database server"},
+        PortRecord{4428, "tcp", "omviserver", "OMV-Investigation Server-Client"},
+        PortRecord{4429, "tcp", "omviagent", "OMV Investigation Agent-Server"},
+        PortRecord{4430, "tcp", "rsqlserver", "REAL SQL Server"},
+        PortRecord{4431, "tcp", "wspipe", "adWISE Pipe"},
+        PortRecord{4432, "tcp", "l-acoustics", "L-ACOUSTICS management"},
+        PortRecord{4433, "tcp", "vop", "Versile Object Protocol"},
+        PortRecord{4441, "tcp", "netblox", "Netblox Protocol"},
+        PortRecord{4442, "tcp", "saris", "Saris"},
+        PortRecord{4443, "tcp", "pharos", "Pharos"},
+        PortRecord{4444, "tcp", "krb524", "KRB524"},
+        PortRecord{4445, "tcp", "upnotifyp", "UPNOTIFYP"},
+        PortRecord{4446, "tcp", "n1-fwp", "n1-fwp"},
+        PortRecord{4447, "tcp", "n1-rmgmt", "n1-rmgmt"},
+        PortRecord{4448, "tcp", "asc-slmd", "ASC Licence Manager"},
+        PortRecord{4449, "tcp", "privatewire", "privatewire"},
+        PortRecord{4450, "tcp", "camp", "Common ASCII Messaging Protocol"},
+        PortRecord{4451, "tcp", "ctisystemmsg", "CTI System Msg"},
+        PortRecord{4452, "tcp", "ctiprogramload", "CTI Program Load"},
+        PortRecord{4453, "tcp", "nssalertmgr", "NSS Alert Manager"},
+        PortRecord{4454, "tcp", "nssagentmgr", "NSS Agent Manager"},
+        PortRecord{4455, "tcp", "prchat-user", "PR Chat User"},
+        PortRecord{4456, "tcp", "prchat-server", "PR Chat Server"},
+        PortRecord{4457, "tcp", "prRegister", "PR Register"},
+        PortRecord{4458, "tcp", "mcp", "Matrix Configuration Protocol"},
+        PortRecord{4460, "tcp", "ntske", "Network Time Security Key Establishment"},
+        PortRecord{4480, "tcp", "proxy-plus", "Proxy+ HTTP proxy port"},
+        PortRecord{4484, "tcp", "hpssmgmt", "HPSSMGMT service"},
+        PortRecord{4485, "tcp", "assyst-dr", "Assyst Data Repository Service"},
+        PortRecord{4486, "tcp", "icms", "Integrated Client Message Service"},
+        PortRecord{4487, "tcp", "prex-tcp", "Protocol for Remote Execution over TCP"},
+        PortRecord{4488, "tcp", "awacs-ice", "Apple Wide Area Connectivity Service ICE Bootstrap"},
+        PortRecord{4500, "tcp", "sae-urn", "sae-urn"},
+        PortRecord{4502, "tcp", "a25-fap-fgw", "A25 (FAP-FGW)"},
+        PortRecord{4534, "tcp", "armagetronad", "Armagetron Advanced Game Server"},
+        PortRecord{4535, "tcp", "ehs", "Event Heap Server"},
+        PortRecord{4536, "tcp", "ehs-ssl", "Event Heap Server SSL"},
+        PortRecord{4537, "tcp", "wssauthsvc", "WSS Security Service"},
+        PortRecord{4538, "tcp", "swx-gate", "Software Data Exchange Gateway"},
+        PortRecord{4545, "tcp", "worldscores", "worldscores"},
+        PortRecord{4546, "tcp", "sf-lm", "SF License Manager (Sentinel)"},
+        PortRecord{4547, "tcp", "lanner-lm", "Lanner License Manager"},
+        PortRecord{4548, "tcp", "synchromesh", "synchromesh"},
+        PortRecord{4549, "tcp", "aegate", "Aegate PMR Service"},
+        PortRecord{4550, "tcp", "gds-adppiw-db", "Perman I Interbase Server"},
+        PortRecord{4551, "tcp", "ieee-mih", "MIH Services"},
+        PortRecord{4552, "tcp", "menandmice-mon", "Men and Mice Monitoring"},
+        PortRecord{4553, "tcp", "icshostsvc", "ICS host services"},
+        PortRecord{4554, "tcp", "msfrs", "MS FRS Replication"},
+        PortRecord{4555, "tcp", "rsip", "RSIP Port"},
+        PortRecord{4556, "tcp", "dtn-bundle-tcp", "dtn-bundle-tcp"},
+        PortRecord{4557, "tcp", "fax", "fax"},
+        PortRecord{4558, "tcp", "mtcevrunqman", "Marathon everRun Quorum Service Manager"},
+        PortRecord{4559, "tcp", "hylafax", "HylaFAX client-server protocol"},
+        PortRecord{4563, "tcp", "amahi-anywhere", "Amahi Anywhere"},
+        PortRecord{4566, "tcp", "kwtc", "Kids Watch Time Control Service"},
+        PortRecord{4567, "tcp", "tram", "tram"},
+        PortRecord{4568, "tcp", "bmc-reporting", "BMC Reporting"},
+        PortRecord{4569, "tcp", "iax", "Inter-Asterisk eXchange"},
+        PortRecord{4570, "tcp", "deploymentmap", "Service to distribute and update within a site deployment information for Oracle Communications Suite"},
+        PortRecord{4573, "tcp", "cardifftec-back", "A port for communication between a server and client for a custom backup system"},
+        PortRecord{4590, "tcp", "rid", "RID over HTTP/TLS"},
+        PortRecord{4591, "tcp", "l3t-at-an", "HRPD L3T (AT-AN)"},
+        PortRecord{4592, "tcp", "hrpd-ith-at-an", "HRPD-ITH (AT-AN)"},
+        PortRecord{4593, "tcp", "ipt-anri-anri", "IPT (ANRI-ANRI)"},
+        PortRecord{4594, "tcp", "ias-session", "IAS-Session (ANRI-ANRI)"},
+        PortRecord{4595, "tcp", "ias-paging", "IAS-Paging (ANRI-ANRI)"},
+        PortRecord{4596, "tcp", "ias-neighbor", "IAS-Neighbor (ANRI-ANRI)"},
+        PortRecord{4597, "tcp", "a21-an-1xbs", "A21 (AN-1xBS)"},
+        PortRecord{4598, "tcp", "a16-an-an", "A16 (AN-AN)"},
+        PortRecord{4599, "tcp", "a17-an-an", "A17 (AN-AN)"},
+        PortRecord{4600, "tcp", "piranha1", "piranha1"},
+        PortRecord{4601, "tcp", "piranha2", "piranha2"},
+        PortRecord{4602, "tcp", "mtsserver", "EAX MTS Server"},
+        PortRecord{4603, "tcp", "menandmice-upg", "Men & Mice Upgrade Agent"},
+        PortRecord{4604, "tcp", "irp", "Identity Registration Protocol"},
+        PortRecord{4605, "tcp", "sixchat", "Direct End to End Secure Chat Protocol"},
+        PortRecord{4606, "tcp", "sixid", "Secure ID to IP registration and lookup"},
+        PortRecord{4621, "tcp", "ventoso", "Bidirectional single port remote radio VOIP and Control stream"},
+        PortRecord{4646, "tcp", "dots-signal", "Distributed Denial-of-Service Open Threat Signaling (DOTS) Signal Channel"},
+        PortRecord{4658, "tcp", "playsta2-app", "PlayStation2 App Port"},
+        PortRecord{4659, "tcp", "playsta2-lob", "PlayStation2 Lobby Port"},
+        PortRecord{4660, "tcp", "mosmig", "mosmig"},
+        PortRecord{4661, "tcp", "kar2ouche", "Kar2ouche Peer location service"},
+        PortRecord{4662, "tcp", "edonkey", "edonkey"},
+        PortRecord{4663, "tcp", "noteit", "Note It! Message Service"},
+        PortRecord{4664, "tcp", "ems", "Rimage Messaging Server"},
+        PortRecord{4665, "tcp", "contclientms", "Container Client Message Service"},
+        PortRecord{4666, "tcp", "eportcomm", "E-Port Message Service"},
+        PortRecord{4667, "tcp", "mmacomm", "MMA Comm Services"},
+        PortRecord{4668, "tcp", "mmaeds", "MMA EDS Service"},
+        PortRecord{4669, "tcp", "eportcommdata", "E-Port Data Service"},
+        PortRecord{4670, "tcp", "light", "Light packets transfer protocol"},
+        PortRecord{4671, "tcp", "acter", "Bull RSF action server"},
+        PortRecord{4672, "tcp", "rfa", "remote file access server"},
+        PortRecord{4673, "tcp", "cxws", "CXWS Operations"},
+        PortRecord{4674, "tcp", "appiq-mgmt", "AppIQ Agent Management"},
+        PortRecord{4675, "tcp", "dhct-status", "BIAP Device Status"},
+        PortRecord{4676, "tcp", "dhct-alerts", "BIAP Generic Alert"},
+        PortRecord{4677, "tcp", "bcs", "Business Continuity Servi"},
+        PortRecord{4678, "tcp", "traversal", "boundary traversal"},
+        PortRecord{4679, "tcp", "mgesupervision", "MGE UPS Supervision"},
+        PortRecord{4680, "tcp", "mgemanagement", "MGE UPS Management"},
+        PortRecord{4681, "tcp", "parliant", "Parliant Telephony System"},
+        PortRecord{4682, "tcp", "finisar", "finisar"},
+        PortRecord{4683, "tcp", "spike", "Spike Clipboard Service"},
+        PortRecord{4684, "tcp", "rfid-rp1", "RFID Reader Protocol 1.0"},
+        PortRecord{4685, "tcp", "autopac", "Autopac Protocol"},
+        PortRecord{4686, "tcp", "msp-os", "Manina Service Protocol"},
+        PortRecord{4687, "tcp", "nst", "Network Scanner Tool FTP"},
+        PortRecord{4688, "tcp", "mobile-p2p", "Mobile P2P Service"},
+        PortRecord{4689, "tcp", "altovacentral", "Altova DatabaseCentral"},
+        PortRecord{4690, "tcp", "prelude", "Prelude IDS message proto"},
+        PortRecord{4691, "tcp", "mtn", "monotone Netsync Protocol"},
+        PortRecord{4692, "tcp", "conspiracy", "Conspiracy messaging"},
+        PortRecord{4700, "tcp", "netxms-agent", "NetXMS Agent"},
+        PortRecord{4701, "tcp", "netxms-mgmt", "NetXMS Management"},
+        PortRecord{4702, "tcp", "netxms-sync", "NetXMS Server Synchronization"},
+        PortRecord{4703, "tcp", "npqes-test", "Network Performance Quality Evaluation System Test Service"},
+        PortRecord{4704, "tcp", "assuria-ins", "Assuria Insider"},
+        PortRecord{4711, "tcp", "trinity-dist", "Trinity Trust Network Node Communication"},
+        PortRecord{4713, "tcp", "pulseaudio", "Pulse Audio UNIX sound framework"},
+        PortRecord{4725, "tcp", "truckstar", "TruckStar Service"},
+        PortRecord{4726, "tcp", "a26-fap-fgw", "A26 (FAP-FGW)"},
+        PortRecord{4727, "tcp", "fcis", "fcis"},
+        PortRecord{4728, "tcp", "capmux", "CA Port Multiplexer"},
+        PortRecord{4729, "tcp", "gsmtap", "GSM Interface Tap"},
+        PortRecord{4730, "tcp", "gearman", "Gearman Job Queue System"},
+        PortRecord{4731, "tcp", "remcap", "Remote Capture Protocol"},
+        PortRecord{4732, "tcp", "ohmtrigger", "OHM server trigger"},
+        PortRecord{4733, "tcp", "resorcs", "RES Orchestration Catalog Services"},
+        PortRecord{4737, "tcp", "ipdr-sp", "IPDR/SP"},
+        PortRecord{4738, "tcp", "solera-lpn", "SoleraTec Locator"},
+        PortRecord{4739, "tcp", "ipfix", "IP Flow Info Export"},
+        PortRecord{4740, "tcp", "ipfixs", "IP Flow Info Export over TLS"},
+        PortRecord{4741, "tcp", "lumimgrd", "Luminizer Manager"},
+        PortRecord{4742, "tcp", "sicct", "sicct"},
+        PortRecord{4743, "tcp", "openhpid", "openhpi HPI service"},
+        PortRecord{4744, "tcp", "ifsp", "Internet File Synchronization Protocol"},
+        PortRecord{4745, "tcp", "fmp", "Funambol Mobile Push"},
+        PortRecord{4746, "tcp", "intelliadm-disc", "IntelliAdmin Discovery"},
+        PortRecord{4747, "tcp", "buschtrommel", "peer-to-peer file exchange protocol"},
+        PortRecord{4749, "tcp", "profilemac", "Profile for Mac"},
+        PortRecord{4750, "tcp", "ssad", "Simple Service Auto Discovery"},
+        PortRecord{4751, "tcp", "spocp", "Simple Policy Control Protocol"},
+        PortRecord{4752, "tcp", "snap", "Simple Network Audio Protocol"},
+        PortRecord{4753, "tcp", "simon", "simon"},
+        PortRecord{4754, "tcp", "gre-in-udp", "GRE-in-UDP Encapsulation"},
+        PortRecord{4755, "tcp", "gre-udp-dtls", "GRE-in-UDP Encapsulation with DTLS"},
+        PortRecord{4756, "tcp", "RDCenter", "Reticle Decision Center"},
+        PortRecord{4774, "tcp", "converge", "Converge RPC"},
+        PortRecord{4784, "tcp", "bfd-multi-ctl", "BFD Multihop Control"},
+        PortRecord{4785, "tcp", "cncp", "Cisco Nexus Control Protocol"},
+        PortRecord{4786, "tcp", "smart-install", "Smart Install Service"},
+        PortRecord{4787, "tcp", "sia-ctrl-plane", "Service Insertion Architecture (SIA) Control-Plane"},
+        PortRecord{4788, "tcp", "xmcp", "eXtensible Messaging Client Protocol"},
+        PortRecord{4789, "tcp", "vxlan", "Virtual eXtensible Local Area Network (VXLAN)"},
+        PortRecord{4790, "tcp", "vxlan-gpe", "Generic Protocol Extension for Virtual eXtensible Local Area Network (VXLAN)"},
+        PortRecord{4791, "tcp", "roce", "IP Routable RocE"},
+        PortRecord{4800, "tcp", "iims", "Icona Instant Messenging System"},
+        PortRecord{4801, "tcp", "iwec", "Icona Web Embedded Chat"},
+        PortRecord{4802, "tcp", "ilss", "Icona License System Server"},
+        PortRecord{4803, "tcp", "notateit", "notateit"},
+        PortRecord{4804, "tcp", "aja-ntv4-disc", "AJA ntv4 Video System Discovery"},
+        PortRecord{4827, "tcp", "htcp", "htcp"},
+        PortRecord{4837, "tcp", "varadero-0", "varadero-0"},
+        PortRecord{4838, "tcp", "varadero-1", "varadero-1"},
+        PortRecord{4839, "tcp", "varadero-2", "varadero-2"},
+        PortRecord{4840, "tcp", "opcua-tcp", "opcua-tcp"},
+        PortRecord{4841, "tcp", "quosa", "QUOSA Virtual Library Service"},
+        PortRecord{4842, "tcp", "gw-asv", "nCode ICE-flow Library AppServer"},
+        PortRecord{4843, "tcp", "opcua-tls", "OPC UA TCP Protocol over TLS/SSL"},
+        PortRecord{4844, "tcp", "gw-log", "nCode ICE-flow Library LogServer"},
+        PortRecord{4845, "tcp", "wcr-remlib", "WordCruncher Remote Library Service"},
+        PortRecord{4846, "tcp", "contamac_icm", "contamac_icm"},
+        PortRecord{4847, "tcp", "wfc", "Web Fresh Communication"},
+        PortRecord{4848, "tcp", "appserv-http", "App Server - Admin HTTP"},
+        PortRecord{4849, "tcp", "appserv-https", "App Server - Admin HTTPS"},
+        PortRecord{4850, "tcp", "sun-as-nodeagt", "Sun App Server - NA"},
+        PortRecord{4851, "tcp", "derby-repli", "Apache Derby Replication"},
+        PortRecord{4867, "tcp", "unify-debug", "Unify Debugger"},
+        PortRecord{4868, "tcp", "phrelay", "Photon Relay"},
+        PortRecord{4869, "tcp", "phrelaydbg", "Photon Relay Debug"},
+        PortRecord{4870, "tcp", "cc-tracking", "Citcom Tracking Service"},
+        PortRecord{4871, "tcp", "wired", "wired"},
+        PortRecord{4876, "tcp", "tritium-can", "Tritium CAN Bus Bridge Service"},
+        PortRecord{4877, "tcp", "lmcs", "Lighting Management Control System"},
+        PortRecord{4878, "tcp", "inst-discovery", "Agilent Instrument Discovery"},
+        PortRecord{4879, "tcp", "wsdl-event", "WSDL Event Receiver"},
+        PortRecord{4880, "tcp", "hislip", "IVI High-Speed LAN Instrument Protocol"},
+        PortRecord{4881, "tcp", "socp-t", "SOCP Time Synchronization Protocol"},
+        PortRecord{4882, "tcp", "socp-c", "SOCP Control Protocol"},
+        PortRecord{4883, "tcp", "wmlserver", "Meier-Phelps License Server"},
+        PortRecord{4884, "tcp", "hivestor", "HiveStor Distributed File System"},
+        PortRecord{4885, "tcp", "abbs", "abbs"},
+        PortRecord{4888, "tcp", "xcap-portal", "xcap code analysis portal public user access"},
+        PortRecord{4889, "tcp", "xcap-control", "xcap code analysis portal cluster control and administration"},
+        PortRecord{4894, "tcp", "lyskom", "LysKOM Protocol A"},
+        PortRecord{4899, "tcp", "radmin", "radmin"},
+        PortRecord{4900, "tcp", "hfcs", "hfcs"},
+        PortRecord{4901, "tcp", "flr_agent", "flr_agent"},
+        PortRecord{4902, "tcp", "magiccontrol", "magicCONROL RF and Data Interface"},
+        PortRecord{4912, "tcp", "lutap", "Technicolor LUT Access Protocol"},
+        PortRecord{4913, "tcp", "lutcp", "LUTher Control Protocol"},
+        PortRecord{4914, "tcp", "bones", "Bones Remote Control"},
+        PortRecord{4915, "tcp", "frcs", "Fibics Remote Control Service"},
+        PortRecord{4936, "tcp", "an-signaling", "Signal protocol port for autonomic networking"},
+        PortRecord{4937, "tcp", "atsc-mh-ssc", "ATSC-M/H Service Signaling Channel"},
+        PortRecord{4940, "tcp", "eq-office-4940", "Equitrac Office"},
+        PortRecord{4941, "tcp", "eq-office-4941", "Equitrac Office"},
+        PortRecord{4942, "tcp", "eq-office-4942", "Equitrac Office"},
+        PortRecord{4949, "tcp", "munin", "Munin Graphing Framework"},
+        PortRecord{4950, "tcp", "sybasesrvmon", "Sybase Server Monitor"},
+        PortRecord{4951, "tcp", "pwgwims", "PWG WIMS"},
+        PortRecord{4952, "tcp", "sagxtsds", "SAG Directory Server"},
+        PortRecord{4953, "tcp", "dbsyncarbiter", "Synchronization Arbiter"},
+        PortRecord{4969, "tcp", "ccss-qmm", "CCSS QMessageMonitor"},
+        PortRecord{4970, "tcp", "ccss-qsm", "CCSS QSystemMonitor"},
+        PortRecord{4971, "tcp", "burp", "BackUp and Restore Program"},
+        PortRecord{4980, "tcp", "ctxs-vpp", "Citrix Virtual Path"},
+        PortRecord{4984, "tcp", "webyast", "webyast"},
+        PortRecord{4985, "tcp", "gerhcs", "GER HC Standard"},
+        PortRecord{4986, "tcp", "mrip", "Model Railway Interface Program"},
+        PortRecord{4987, "tcp", "maybe-veritas", "maybe-veritas"},
+        PortRecord{4988, "tcp", "smar-se-port2", "SMAR Ethernet Port 2"},
+        PortRecord{4989, "tcp", "parallel", "Parallel for GAUSS (tm)"},
+        PortRecord{4990, "tcp", "busycal", "BusySync Calendar Synch. Protocol"},
+        PortRecord{4991, "tcp", "vrt", "VITA Radio Transport"},
+        PortRecord{4998, "tcp", "maybe-veritas", "maybe-veritas"},
+        PortRecord{4999, "tcp", "hfcs-manager", "hfcs-manager"},
+        PortRecord{5000, "tcp", "upnp", "upnp"},
+        PortRecord{5001, "tcp", "commplex-link", "commplex-link"},
+        PortRecord{5002, "tcp", "rfe", "rfe"},
+        PortRecord{5003, "tcp", "filemaker", "filemaker"},
+        PortRecord{5004, "tcp", "avt-profile-1", "avt-profile-1"},
+        PortRecord{5005, "tcp", "avt-profile-2", "avt-profile-2"},
+        PortRecord{5006, "tcp", "wsm-server", "wsm server"},
+        PortRecord{5007, "tcp", "wsm-server-ssl", "wsm server ssl"},
+        PortRecord{5008, "tcp", "synapsis-edge", "Synapsis EDGE"},
+        PortRecord{5009, "tcp", "airport-admin", "airport-admin"},
+        PortRecord{5010, "tcp", "telelpathstart", "TelepathStart"},
+        PortRecord{5011, "tcp", "telelpathattack", "TelepathAttack"},
+        PortRecord{5012, "tcp", "nsp", "NetOnTap Service"},
+        PortRecord{5013, "tcp", "fmpro-v6", "FileMaker Inc. - Proprietary transport"},
+        PortRecord{5014, "tcp", "onpsocket", "Overlay Network Protocol"},
+        PortRecord{5015, "tcp", "fmwp", "FileMaker Inc. - Web publishing"},
+        PortRecord{5020, "tcp", "zenginkyo-1", "zenginkyo-1"},
+        PortRecord{5021, "tcp", "zenginkyo-2", "zenginkyo-2"},
+        PortRecord{5022, "tcp", "mice", "mice server"},
+        PortRecord{5023, "tcp", "htuilsrv", "Htuil Server for PLD2"},
+        PortRecord{5024, "tcp", "scpi-telnet", "Standard Commands for Programmable Instruments over Telnet"},
+        PortRecord{5025, "tcp", "scpi-raw", "Standard Commands for Programmable Instruments"},
+        PortRecord{5026, "tcp", "strexec-d", "Storix I/O daemon (data)"},
+        PortRecord{5027, "tcp", "strexec-s", "Storix I/O daemon (stat)"},
+        PortRecord{5028, "tcp", "qvr", "Quiqum Virtual Relais"},
+        PortRecord{5029, "tcp", "infobright", "Infobright Database Server"},
+        PortRecord{5030, "tcp", "surfpass", "surfpass"},
+        PortRecord{5031, "tcp", "dmp", "Direct Message Protocol"},
+        PortRecord{5032, "tcp", "signacert-agent", "SignaCert Enterprise Trust Server Agent"},
+        PortRecord{5033, "tcp", "jtnetd-server", "Janstor Secure Data"},
+        PortRecord{5034, "tcp", "jtnetd-status", "Janstor Status"},
+        PortRecord{5042, "tcp", "asnaacceler8db", "asnaacceler8db"},
+        PortRecord{5043, "tcp", "swxadmin", "ShopWorX Administration"},
+        PortRecord{5044, "tcp", "lxi-evntsvc", "LXI Event Service"},
+        PortRecord{5045, "tcp", "osp", "Open Settlement Protocol"},
+        PortRecord{5046, "tcp", "vpm-udp", "Vishay PM UDP Service"},
+        PortRecord{5047, "tcp", "iscape", "iSCAPE Data Broadcasting"},
+        PortRecord{5048, "tcp", "texai", "Texai Message Service"},
+        PortRecord{5049, "tcp", "ivocalize", "iVocalize Web Conference"},
+        PortRecord{5050, "tcp", "mmcc", "multimedia conference control tool"},
+        PortRecord{5051, "tcp", "ida-agent", "ida-agent"},
+        PortRecord{5052, "tcp", "ita-manager", "ITA Manager"},
+        PortRecord{5053, "tcp", "rlm", "rlm"},
+        PortRecord{5054, "tcp", "rlm-admin", "RLM administrative interface"},
+        PortRecord{5055, "tcp", "unot", "unot"},
+        PortRecord{5056, "tcp", "intecom-ps1", "Intecom Pointspan 1"},
+        PortRecord{5057, "tcp", "intecom-ps2", "Intecom Pointspan 2"},
+        PortRecord{5058, "tcp", "locus-disc", "Locus Discovery"},
+        PortRecord{5059, "tcp", "sds", "SIP Directory Services"},
+        PortRecord{5060, "tcp", "sip", "Session Initiation Protocol (SIP)"},
+        PortRecord{5061, "tcp", "sip-tls", "SIP-TLS"},
+        PortRecord{5062, "tcp", "na-localise", "Localisation access"},
+        PortRecord{5063, "tcp", "csrpc", "centrify secure RPC"},
+        PortRecord{5064, "tcp", "ca-1", "Channel Access 1"},
+        PortRecord{5065, "tcp", "ca-2", "Channel Access 2"},
+        PortRecord{5066, "tcp", "stanag-5066", "STANAG-5066-SUBNET-INTF"},
+        PortRecord{5067, "tcp", "authentx", "Authentx Service"},
+        PortRecord{5068, "tcp", "bitforestsrv", "Bitforest Data Service"},
+        PortRecord{5069, "tcp", "i-net-2000-npr", "I/Net 2000-NPR"},
+        PortRecord{5070, "tcp", "vtsas", "VersaTrans Server Agent Service"},
+        PortRecord{5071, "tcp", "powerschool", "powerschool"},
+        PortRecord{5072, "tcp", "ayiya", "Anything In Anything"},
+        PortRecord{5073, "tcp", "tag-pm", "Advantage Group Port Mgr"},
+        PortRecord{5074, "tcp", "alesquery", "ALES Query"},
+        PortRecord{5075, "tcp", "pvaccess", "Experimental Physics and Industrial Control System"},
+        PortRecord{5078, "tcp", "pixelpusher", "PixelPusher pixel data"},
+        PortRecord{5079, "tcp", "cp-spxrpts", "Cambridge Pixel SPx Reports"},
+        PortRecord{5080, "tcp", "onscreen", "OnScreen Data Collection Service"},
+        PortRecord{5081, "tcp", "sdl-ets", "SDL - Ent Trans Server"},
+        PortRecord{5082, "tcp", "qcp", "Qpur Communication Protocol"},
+        PortRecord{5083, "tcp", "qfp", "Qpur File Protocol"},
+        PortRecord{5084, "tcp", "llrp", "EPCglobal Low-Level Reader Protocol"},
+        PortRecord{5085, "tcp", "encrypted-llrp", "EPCglobal Encrypted LLRP"},
+        PortRecord{5086, "tcp", "aprigo-cs", "Aprigo Collection Service"},
+        PortRecord{5087, "tcp", "biotic", "BIOTIC - Binary Internet of Things Interoperable Communication"},
+        PortRecord{5092, "tcp", "magpie", "Magpie Binary"},
+        PortRecord{5093, "tcp", "sentinel-lm", "Sentinel LM"},
+        PortRecord{5094, "tcp", "hart-ip", "hart-ip"},
+        PortRecord{5099, "tcp", "sentlm-srv2srv", "SentLM Srv2Srv"},
+        PortRecord{5100, "tcp", "admd", "admd"},
+        PortRecord{5101, "tcp", "admdog", "admdog"},
+        PortRecord{5102, "tcp", "admeng", "admeng"},
+        PortRecord{5103, "tcp", "actifio-c2c", "Actifio C2C"},
+        PortRecord{5104, "tcp", "tinymessage", "tinymessage"},
+        PortRecord{5105, "tcp", "hughes-ap", "Hughes Association Protocol"},
+        PortRecord{5106, "tcp", "actifioudsagent", "Actifio UDS Agent"},
+        PortRecord{5107, "tcp", "actifioreplic", "Disk to Disk replication between Actifio Clusters"},
+        PortRecord{5111, "tcp", "taep-as-svc", "TAEP AS service"},
+        PortRecord{5112, "tcp", "pm-cmdsvr", "PeerMe Msg Cmd Service"},
+        PortRecord{5114, "tcp", "ev-services", "Enterprise Vault Services"},
+        PortRecord{5115, "tcp", "autobuild", "Symantec Autobuild Service"},
+        PortRecord{5116, "tcp", "emb-proj-cmd", "EPSON Projecter Image Transfer"},
+        PortRecord{5117, "tcp", "gradecam", "GradeCam Image Processing"},
+        PortRecord{5120, "tcp", "barracuda-bbs", "Barracuda Backup Protocol"},
+        PortRecord{5133, "tcp", "nbt-pc", "Policy Commander"},
+        PortRecord{5134, "tcp", "ppactivation", "PP ActivationServer"},
+        PortRecord{5135, "tcp", "erp-scale", "erp-scale"},
+        PortRecord{5136, "tcp", "minotaur-sa", "Minotaur SA"},
+        PortRecord{5137, "tcp", "ctsd", "MyCTS server port"},
+        PortRecord{5145, "tcp", "rmonitor_secure", "rmonitor_secure"},
+        PortRecord{5146, "tcp", "social-alarm", "Social Alarm Service"},
+        PortRecord{5150, "tcp", "atmp", "Ascend Tunnel Management Protocol"},
+        PortRecord{5151, "tcp", "esri_sde", "esri_sde"},
+        PortRecord{5152, "tcp", "sde-discovery", "ESRI SDE Instance Discovery"},
+        PortRecord{5153, "tcp", "toruxserver", "ToruX Game Server"},
+        PortRecord{5154, "tcp", "bzflag", "BZFlag game server"},
+        PortRecord{5155, "tcp", "asctrl-agent", "Oracle asControl Agent"},
+        PortRecord{5156, "tcp", "rugameonline", "Russian Online Game"},
+        PortRecord{5157, "tcp", "mediat", "Mediat Remote Object Exchange"},
+        PortRecord{5161, "tcp", "snmpssh", "SNMP over SSH Transport Model"},
+        PortRecord{5162, "tcp", "snmpssh-trap", "SNMP Notification over SSH Transport Model"},
+        PortRecord{5163, "tcp", "sbackup", "Shadow Backup"},
+        PortRecord{5164, "tcp", "vpa", "vpa"},
+        PortRecord{5165, "tcp", "ife_icorp", "ife_icorp"},
+        PortRecord{5166, "tcp", "winpcs", "WinPCS Service Connection"},
+        PortRecord{5167, "tcp", "scte104", "SCTE104 Connection"},
+        PortRecord{5168, "tcp", "scte30", "SCTE30 Connection"},
+        PortRecord{5172, "tcp", "pcoip-mgmt", "PC over IP Endpoint Management"},
+        PortRecord{5190, "tcp", "aol", "aol"},
+        PortRecord{5191, "tcp", "aol-1", "AmericaOnline1"},
+        PortRecord{5192, "tcp", "aol-2", "AmericaOnline2"},
+        PortRecord{5193, "tcp", "aol-3", "AmericaOnline3"},
+        PortRecord{5194, "tcp", "cpscomm", "CipherPoint Config Service"},
+        PortRecord{5195, "tcp", "ampl-lic", "The protocol is used by a license server and client programs to control use of program licenses that float to networked machines"},
+        PortRecord{5196, "tcp", "ampl-tableproxy", "The protocol is used by two programs that exchange table data used in the AMPL modeling language"},
+        PortRecord{5197, "tcp", "tunstall-lwp", "Tunstall Lone worker device interface"},
+        PortRecord{5200, "tcp", "targus-getdata", "TARGUS GetData"},
+        PortRecord{5201, "tcp", "targus-getdata1", "TARGUS GetData 1"},
+        PortRecord{5202, "tcp", "targus-getdata2", "TARGUS GetData 2"},
+        PortRecord{5203, "tcp", "targus-getdata3", "TARGUS GetData 3"},
+        PortRecord{5209, "tcp", "nomad", "Nomad Device Video Transfer"},
+        PortRecord{5215, "tcp", "noteza", "NOTEZA Data Safety Service"},
+        PortRecord{5221, "tcp", "3exmp", "3eTI Extensible Management Protocol for OAMP"},
+        PortRecord{5222, "tcp", "xmpp-client", "XMPP Client Connection"},
+        PortRecord{5223, "tcp", "hpvirtgrp", "HP Virtual Machine Group Management"},
+        PortRecord{5224, "tcp", "hpvirtctrl", "HP Virtual Machine Console Operations"},
+        PortRecord{5225, "tcp", "hp-server", "HP Server"},
+        PortRecord{5226, "tcp", "hp-status", "HP Status"},
+        PortRecord{5227, "tcp", "perfd", "HP System Performance Metric Service"},
+        PortRecord{5228, "tcp", "hpvroom", "HP Virtual Room Service"},
+        PortRecord{5229, "tcp", "jaxflow", "Netflow/IPFIX/sFlow Collector and Forwarder Management"},
+        PortRecord{5230, "tcp", "jaxflow-data", "JaxMP RealFlow application and protocol data"},
+        PortRecord{5231, "tcp", "crusecontrol", "Remote Control of Scan Software for Cruse Scanners"},
+        PortRecord{5232, "tcp", "sgi-dgl", "sgi-dgl"},
+        PortRecord{5233, "tcp", "enfs", "Etinnae Network File Service"},
+        PortRecord{5234, "tcp", "eenet", "EEnet communications"},
+        PortRecord{5235, "tcp", "galaxy-network", "Galaxy Network Service"},
+        PortRecord{5236, "tcp", "padl2sim", "padl2sim"},
+        PortRecord{5237, "tcp", "mnet-discovery", "m-net discovery"},
+        PortRecord{5245, "tcp", "downtools", "downtools"},
+        PortRecord{5246, "tcp", "capwap-control", "CAPWAP Control Protocol"},
+        PortRecord{5247, "tcp", "capwap-data", "CAPWAP Data Protocol"},
+        PortRecord{5248, "tcp", "caacws", "CA Access Control Web Service"},
+        PortRecord{5249, "tcp", "caaclang2", "CA AC Lang Service"},
+        PortRecord{5250, "tcp", "soagateway", "soagateway"},
+        PortRecord{5251, "tcp", "caevms", "CA eTrust VM Service"},
+        PortRecord{5252, "tcp", "movaz-ssc", "Movaz SSC"},
+        PortRecord{5253, "tcp", "kpdp", "Kohler Power Device Protocol"},
+        PortRecord{5254, "tcp", "logcabin", "LogCabin storage service"},
+        PortRecord{5264, "tcp", "3com-njack-1", "3Com Network Jack Port 1"},
+        PortRecord{5265, "tcp", "3com-njack-2", "3Com Network Jack Port 2"},
+        PortRecord{5269, "tcp", "xmpp-server", "XMPP Server Connection"},
+        PortRecord{5270, "tcp", "xmp", "xmp"},
+        PortRecord{5271, "tcp", "cuelink", "cuelink"},
+        PortRecord{5272, "tcp", "pk", "pk"},
+        PortRecord{5280, "tcp", "xmpp-bosh", "Bidirectional-streams Over Synchronous HTTP (BOSH)"},
+        PortRecord{5281, "tcp", "undo-lm", "Undo License Manager"},
+        PortRecord{5282, "tcp", "transmit-port", "Marimba Transmitter Port"},
+        PortRecord{5298, "tcp", "presence", "XMPP Link-Local Messaging"},
+        PortRecord{5299, "tcp", "nlg-data", "NLG Data Service"},
+        PortRecord{5300, "tcp", "hacl-hb", "HA cluster heartbeat"},
+        PortRecord{5301, "tcp", "hacl-gs", "HA cluster general services"},
+        PortRecord{5302, "tcp", "hacl-cfg", "HA cluster configuration"},
+        PortRecord{5303, "tcp", "hacl-probe", "HA cluster probing"},
+        PortRecord{5304, "tcp", "hacl-local", "HA Cluster Commands"},
+        PortRecord{5305, "tcp", "hacl-test", "HA Cluster Test"},
+        PortRecord{5306, "tcp", "sun-mc-grp", "Sun MC Group"},
+        PortRecord{5307, "tcp", "sco-aip", "SCO AIP"},
+        PortRecord{5308, "tcp", "cfengine", "cfengine"},
+        PortRecord{5309, "tcp", "jprinter", "J Printer"},
+        PortRecord{5310, "tcp", "outlaws", "outlaws"},
+        PortRecord{5312, "tcp", "permabit-cs", "Permabit Client-Server"},
+        PortRecord{5313, "tcp", "rrdp", "Real-time & Reliable Data"},
+        PortRecord{5314, "tcp", "opalis-rbt-ipc", "opalis-rbt-ipc"},
+        PortRecord{5315, "tcp", "hacl-poll", "HA Cluster UDP Polling"},
+        PortRecord{5316, "tcp", "hpdevms", "hpdevms"},
+        PortRecord{5317, "tcp", "hpdevms", "HP Device Monitor Service"},
+        PortRecord{5318, "tcp", "pkix-cmc", "PKIX Certificate Management using CMS (CMC)"},
+        PortRecord{5320, "tcp", "bsfserver-zn", "Webservices-based Zn interface of BSF"},
+        PortRecord{5321, "tcp", "bsfsvr-zn-ssl", "Webservices-based Zn interface of BSF over SSL"},
+        PortRecord{5343, "tcp", "kfserver", "Sculptor Database Server"},
+        PortRecord{5344, "tcp", "xkotodrcp", "xkoto DRCP"},
+        PortRecord{5349, "tcp", "stuns", "stuns"},
+        PortRecord{5350, "tcp", "nat-pmp-status", "nat-pmp-status"},
+        PortRecord{5351, "tcp", "nat-pmp", "nat-pmp"},
+        PortRecord{5352, "tcp", "dns-llq", "DNS Long-Lived Queries"},
+        PortRecord{5353, "tcp", "mdns", "Multicast DNS"},
+        PortRecord{5354, "tcp", "mdnsresponder", "Multicast DNS Responder IPC"},
+        PortRecord{5355, "tcp", "llmnr", "llmnr"},
+        PortRecord{5356, "tcp", "ms-smlbiz", "Microsoft Small Business"},
+        PortRecord{5357, "tcp", "wsdapi", "Web Services for Devices"},
+        PortRecord{5358, "tcp", "wsdapi-s", "WS for Devices Secured"},
+        PortRecord{5359, "tcp", "ms-alerter", "Microsoft Alerter"},
+        PortRecord{5360, "tcp", "ms-sideshow", "Protocol for Windows SideShow"},
+        PortRecord{5361, "tcp", "ms-s-sideshow", "Secure Protocol for Windows SideShow"},
+        PortRecord{5362, "tcp", "serverwsd2", "Microsoft Windows Server WSD2 Service"},
+        PortRecord{5363, "tcp", "net-projection", "Windows Network Projection"},
+        PortRecord{5364, "tcp", "kdnet", "Microsoft Kernel Debugger"},
+        PortRecord{5397, "tcp", "stresstester", "StressTester(tm) Injector"},
+        PortRecord{5398, "tcp", "elektron-admin", "Elektron Administration"},
+        PortRecord{5399, "tcp", "securitychase", "securitychase"},
+        PortRecord{5400, "tcp", "pcduo-old", "pcduo-old"},
+        PortRecord{5401, "tcp", "excerpts", "Excerpt Search Secure"},
+        PortRecord{5402, "tcp", "mftp", "OmniCast MFTP"},
+        PortRecord{5403, "tcp", "hpoms-ci-lstn", "hpoms-ci-lstn"},
+        PortRecord{5404, "tcp", "hpoms-dps-lstn", "hpoms-dps-lstn"},
+        PortRecord{5405, "tcp", "pcduo", "pcduo"},
+        PortRecord{5406, "tcp", "systemics-sox", "Systemics Sox"},
+        PortRecord{5407, "tcp", "foresyte-clear", "foresyte-clear"},
+        PortRecord{5408, "tcp", "foresyte-sec", "foresyte-sec"},
+        PortRecord{5409, "tcp", "salient-dtasrv", "Salient Data Server"},
+        PortRecord{5410, "tcp", "salient-usrmgr", "Salient User Manager"},
+        PortRecord{5411, "tcp", "actnet", "actnet"},
+        PortRecord{5412, "tcp", "continuus", "continuus"},
+        PortRecord{5413, "tcp", "wwiotalk", "wwiotalk"},
+        PortRecord{5414, "tcp", "statusd", "statusd"},
+        PortRecord{5415, "tcp", "ns-server", "NS Server"},
+        PortRecord{5416, "tcp", "sns-gateway", "SNS Gateway"},
+        PortRecord{5417, "tcp", "sns-agent", "SNS Agent"},
+        PortRecord{5418, "tcp", "mcntp", "mcntp"},
+        PortRecord{5419, "tcp", "dj-ice", "dj-ice"},
+        PortRecord{5420, "tcp", "cylink-c", "cylink-c"},
+        PortRecord{5421, "tcp", "netsupport2", "Net Support 2"},
+        PortRecord{5422, "tcp", "salient-mux", "Salient MUX"},
+        PortRecord{5423, "tcp", "virtualuser", "virtualuser"},
+        PortRecord{5424, "tcp", "beyond-remote", "Beyond Remote"},
+        PortRecord{5425, "tcp", "br-channel", "Beyond Remote Command Channel"},
+        PortRecord{5426, "tcp", "devbasic", "devbasic"},
+        PortRecord{5427, "tcp", "sco-peer-tta", "sco-peer-tta"},
+        PortRecord{5428, "tcp", "telaconsole", "telaconsole"},
+        PortRecord{5429, "tcp", "base", "Billing and Accounting System Exchange"},
+        PortRecord{5430, "tcp", "radec-corp", "RADEC CORP"},
+        PortRecord{5431, "tcp", "park-agent", "PARK AGENT"},
+        PortRecord{5432, "tcp", "postgresql", "postgresql"},
+        PortRecord{5433, "tcp", "pyrrho", "Pyrrho DBMS"},
+        PortRecord{5434, "tcp", "sgi-arrayd", "SGI Array Services Daemon"},
+        PortRecord{5435, "tcp", "sceanics", "SCEANICS situation and action notification"},
+        PortRecord{5436, "tcp", "pmip6-cntl", "pmip6-cntl"},
+        PortRecord{5437, "tcp", "pmip6-data", "pmip6-data"},
+        PortRecord{5443, "tcp", "spss", "Pearson HTTPS"},
+        PortRecord{5445, "tcp", "smbdirect", "Server Message Block over Remote Direct Memory Access"},
+        PortRecord{5450, "tcp", "tiepie", "tiepie"},
+        PortRecord{5453, "tcp", "surebox", "surebox"},
+        PortRecord{5454, "tcp", "apc-5454", "APC 5454"},
+        PortRecord{5455, "tcp", "apc-5455", "APC 5455"},
+        PortRecord{5456, "tcp", "apc-5456", "APC 5456"},
+        PortRecord{5461, "tcp", "silkmeter", "silkmeter"},
+        PortRecord{5462, "tcp", "ttl-publisher", "TTL Publisher"},
+        PortRecord{5463, "tcp", "ttlpriceproxy", "TTL Price Proxy"},
+        PortRecord{5464, "tcp", "quailnet", "Quail Networks Object Broker"},
+        PortRecord{5465, "tcp", "netops-broker", "netops-broker"},
+        PortRecord{5470, "tcp", "apsolab-col", "The Apsolab company's data collection protocol (native api)"},
+        PortRecord{5471, "tcp", "apsolab-cols", "The Apsolab company's secure data collection protocol (native api)"},
+        PortRecord{5472, "tcp", "apsolab-tag", "The Apsolab company's dynamic tag protocol"},
+        PortRecord{5473, "tcp", "apsolab-tags", "The Apsolab company's secure dynamic tag protocol"},
+        PortRecord{5474, "tcp", "apsolab-rpc", "The Apsolab company's status query protocol"},
+        PortRecord{5475, "tcp", "apsolab-data", "The Apsolab company's data retrieval protocol"},
+        PortRecord{5490, "tcp", "connect-proxy", "Many HTTP CONNECT proxies"},
+        PortRecord{5500, "tcp", "hotline", "hotline"},
+        PortRecord{5501, "tcp", "fcp-addr-srvr2", "fcp-addr-srvr2"},
+        PortRecord{5502, "tcp", "fcp-srvr-inst1", "fcp-srvr-inst1"},
+        PortRecord{5503, "tcp", "fcp-srvr-inst2", "fcp-srvr-inst2"},
+        PortRecord{5504, "tcp", "fcp-cics-gw1", "fcp-cics-gw1"},
+        PortRecord{5505, "tcp", "checkoutdb", "Checkout Database"},
+        PortRecord{5506, "tcp", "amc", "Amcom Mobile Connect"},
+        PortRecord{5507, "tcp", "psl-management", "PowerSysLab Electrical Management"},
+        PortRecord{5510, "tcp", "secureidprop", "ACE/Server services"},
+        PortRecord{5520, "tcp", "sdlog", "ACE/Server services"},
+        PortRecord{5530, "tcp", "sdserv", "ACE/Server services"},
+        PortRecord{5540, "tcp", "sdreport", "ACE/Server services"},
+        PortRecord{5550, "tcp", "sdadmind", "sdadmind"},
+        PortRecord{5553, "tcp", "sgi-eventmond", "SGI Eventmond Port"},
+        PortRecord{5554, "tcp", "sgi-esphttp", "SGI ESP HTTP"},
+        PortRecord{5555, "tcp", "freeciv", "freeciv"},
+        PortRecord{5556, "tcp", "freeciv", "Freeciv gameplay"},
+        PortRecord{5557, "tcp", "farenet", "Sandlab FARENET"},
+        PortRecord{5560, "tcp", "isqlplus", "Oracle web enabled SQL interface (version 10g+)"},
+        PortRecord{5565, "tcp", "hpe-dp-bura", "hpe-dp-bura"},
+        PortRecord{5566, "tcp", "westec-connect", "Westec Connect"},
+        PortRecord{5567, "tcp", "m-oap", "m-oap"},
+        PortRecord{5568, "tcp", "sdt", "Session Data Transport Multicast"},
+        PortRecord{5569, "tcp", "rdmnet-ctrl", "rdmnet-ctrl"},
+        PortRecord{5573, "tcp", "sdmmp", "SAS Domain Management Messaging Protocol"},
+        PortRecord{5574, "tcp", "lsi-bobcat", "SAS IO Forwarding"},
+        PortRecord{5575, "tcp", "ora-oap", "Oracle Access Protocol"},
+        PortRecord{5579, "tcp", "fdtracks", "FleetDisplay Tracking Service"},
+        PortRecord{5580, "tcp", "tmosms0", "T-Mobile SMS Protocol Message 0"},
+        PortRecord{5581, "tcp", "tmosms1", "T-Mobile SMS Protocol Message 1"},
+        PortRecord{5582, "tcp", "fac-restore", "T-Mobile SMS Protocol Message 3"},
+        PortRecord{5583, "tcp", "tmo-icon-sync", "T-Mobile SMS Protocol Message 2"},
+        PortRecord{5584, "tcp", "bis-web", "BeInSync-Web"},
+        PortRecord{5585, "tcp", "bis-sync", "BeInSync-sync"},
+        PortRecord{5586, "tcp", "att-mt-sms", "Planning to send mobile terminated SMS to the specific port so that the SMS is not visible to the client"},
+        PortRecord{5597, "tcp", "ininmessaging", "inin secure messaging"},
+        PortRecord{5598, "tcp", "mctfeed", "MCT Market Data Feed"},
+        PortRecord{5599, "tcp", "esinstall", "Enterprise Security Remote Install"},
+        PortRecord{5600, "tcp", "esmmanager", "Enterprise Security Manager"},
+        PortRecord{5601, "tcp", "esmagent", "Enterprise Security Agent"},
+        PortRecord{5602, "tcp", "a1-msc", "a1-msc"},
+        PortRecord{5603, "tcp", "a1-bs", "a1-bs"},
+        PortRecord{5604, "tcp", "a3-sdunode", "a3-sdunode"},
+        PortRecord{5605, "tcp", "a4-sdunode", "a4-sdunode"},
+        PortRecord{5618, "tcp", "efr", "Fiscal Registering Protocol"},
+        PortRecord{5627, "tcp", "ninaf", "Node Initiated Network Association Forma"},
+        PortRecord{5628, "tcp", "htrust", "HTrust API"},
+        PortRecord{5629, "tcp", "symantec-sfdb", "Symantec Storage Foundation for Database"},
+        PortRecord{5630, "tcp", "precise-comm", "PreciseCommunication"},
+        PortRecord{5631, "tcp", "pcanywheredata", "pcanywheredata"},
+        PortRecord{5632, "tcp", "pcanywherestat", "pcanywherestat"},
+        PortRecord{5633, "tcp", "beorl", "BE Operations Request Listener"},
+        PortRecord{5634, "tcp", "xprtld", "SF Message Service"},
+        PortRecord{5635, "tcp", "sfmsso", "SFM Authentication Subsystem"},
+        PortRecord{5636, "tcp", "sfm-db-server", "SFMdb - SFM DB server"},
+        PortRecord{5637, "tcp", "cssc", "Symantec CSSC"},
+        PortRecord{5638, "tcp", "flcrs", "Symantec Fingerprint Lookup and Container Reference Service"},
+        PortRecord{5639, "tcp", "ics", "Symantec Integrity Checking Service"},
+        PortRecord{5646, "tcp", "vfmobile", "Ventureforth Mobile"},
+        PortRecord{5666, "tcp", "nrpe", "nrpe"},
+        PortRecord{5670, "tcp", "filemq", "filemq"},
+        PortRecord{5671, "tcp", "amqps", "amqp protocol over TLS/SSL"},
+        PortRecord{5672, "tcp", "amqp", "AMQP"},
+        PortRecord{5673, "tcp", "jms", "JACL Message Server"},
+        PortRecord{5674, "tcp", "hyperscsi-port", "HyperSCSI Port"},
+        PortRecord{5675, "tcp", "v5ua", "V5UA application port"},
+        PortRecord{5676, "tcp", "raadmin", "RA Administration"},
+        PortRecord{5677, "tcp", "questdb2-lnchr", "Quest Central DB2 Launchr"},
+        PortRecord{5678, "tcp", "rrac", "Remote Replication Agent Connection"},
+        PortRecord{5679, "tcp", "activesync", "activesync"},
+        PortRecord{5680, "tcp", "canna", "canna"},
+        PortRecord{5681, "tcp", "ncxcp", "Net-coneX Control Protocol"},
+        PortRecord{5682, "tcp", "brightcore", "BrightCore control & data transfer exchange"},
+        PortRecord{5683, "tcp", "coap", "coap"},
+        PortRecord{5684, "tcp", "coaps", "coaps"},
+        PortRecord{5687, "tcp", "gog-multiplayer", "GOG multiplayer game protocol"},
+        PortRecord{5688, "tcp", "ggz", "GGZ Gaming Zone"},
+        PortRecord{5689, "tcp", "qmvideo", "QM video network management protocol"},
+        PortRecord{5693, "tcp", "rbsystem", "Robert Bosch Data Transfer"},
+        PortRecord{5696, "tcp", "kmip", "Key Management Interoperability Protocol"},
+        PortRecord{5700, "tcp", "supportassist", "Dell SupportAssist data center management"},
+        PortRecord{5705, "tcp", "storageos", "StorageOS REST API"},
+        PortRecord{5713, "tcp", "proshareaudio", "proshare conf audio"},
+        PortRecord{5714, "tcp", "prosharevideo", "proshare conf video"},
+        PortRecord{5715, "tcp", "prosharedata", "proshare conf data"},
+        PortRecord{5716, "tcp", "prosharerequest", "proshare conf request"},
+        PortRecord{5717, "tcp", "prosharenotify", "proshare conf notify"},
+        PortRecord{5718, "tcp", "dpm", "DPM Communication Server"},
+        PortRecord{5719, "tcp", "dpm-agent", "DPM Agent Coordinator"},
+        PortRecord{5720, "tcp", "ms-licensing", "ms-licensing"},
+        PortRecord{5721, "tcp", "dtpt", "Desktop Passthru Service"},
+        PortRecord{5722, "tcp", "msdfsr", "Microsoft DFS Replication Service"},
+        PortRecord{5723, "tcp", "omhs", "Operations Manager - Health Service"},
+        PortRecord{5724, "tcp", "omsdk", "Operations Manager - SDK Service"},
+        PortRecord{5725, "tcp", "ms-ilm", "Microsoft Identity Lifecycle Manager"},
+        PortRecord{5726, "tcp", "ms-ilm-sts", "Microsoft Lifecycle Manager Secure Token Service"},
+        PortRecord{5727, "tcp", "asgenf", "ASG Event Notification Framework"},
+        PortRecord{5728, "tcp", "io-dist-data", "io-dist-data"},
+        PortRecord{5729, "tcp", "openmail", "Openmail User Agent Layer"},
+        PortRecord{5730, "tcp", "unieng", "Steltor's calendar access"},
+        PortRecord{5741, "tcp", "ida-discover1", "IDA Discover Port 1"},
+        PortRecord{5742, "tcp", "ida-discover2", "IDA Discover Port 2"},
+        PortRecord{5743, "tcp", "watchdoc-pod", "Watchdoc NetPOD Protocol"},
+        PortRecord{5744, "tcp", "watchdoc", "Watchdoc Server"},
+        PortRecord{5745, "tcp", "fcopy-server", "fcopy-server"},
+        PortRecord{5746, "tcp", "fcopys-server", "fcopys-server"},
+        PortRecord{5747, "tcp", "tunatic", "Wildbits Tunatic"},
+        PortRecord{5748, "tcp", "tunalyzer", "Wildbits Tunalyzer"},
+        PortRecord{5750, "tcp", "rscd", "Bladelogic Agent Service"},
+        PortRecord{5755, "tcp", "openmailg", "OpenMail Desk Gateway server"},
+        PortRecord{5757, "tcp", "x500ms", "OpenMail X.500 Directory Server"},
+        PortRecord{5766, "tcp", "openmailns", "OpenMail NewMail Server"},
+        PortRecord{5767, "tcp", "s-openmail", "OpenMail Suer Agent Layer (Secure)"},
+        PortRecord{5768, "tcp", "openmailpxy", "OpenMail CMTS Server"},
+        PortRecord{5769, "tcp", "spramsca", "x509solutions Internal CA"},
+        PortRecord{5770, "tcp", "spramsd", "x509solutions Secure Data"},
+        PortRecord{5771, "tcp", "netagent", "netagent"},
+        PortRecord{5777, "tcp", "dali-port", "DALI Port"},
+        PortRecord{5780, "tcp", "vts-rpc", "Visual Tag System RPC"},
+        PortRecord{5781, "tcp", "3par-evts", "3PAR Event Reporting Service"},
+        PortRecord{5782, "tcp", "3par-mgmt", "3PAR Management Service"},
+        PortRecord{5783, "tcp", "3par-mgmt-ssl", "3PAR Management Service with SSL"},
+        PortRecord{5784, "tcp", "ibar", "Cisco Interbox Application Redundancy"},
+        PortRecord{5785, "tcp", "3par-rcopy", "3PAR Inform Remote Copy"},
+        PortRecord{5786, "tcp", "cisco-redu", "redundancy notification"},
+        PortRecord{5787, "tcp", "waascluster", "Cisco WAAS Cluster Protocol"},
+        PortRecord{5793, "tcp", "xtreamx", "XtreamX Supervised Peer message"},
+        PortRecord{5794, "tcp", "spdp", "Simple Peered Discovery Protocol"},
+        PortRecord{5800, "tcp", "vnc-http", "Virtual Network Computer HTTP Access - display 0"},
+        PortRecord{5801, "tcp", "vnc-http-1", "Virtual Network Computer HTTP Access - display 1"},
+        PortRecord{5802, "tcp", "vnc-http-2", "Virtual Network Computer HTTP Access - display 2"},
+        PortRecord{5803, "tcp", "vnc-http-3", "Virtual Network Computer HTTP Access - display 3"},
+        PortRecord{5813, "tcp", "icmpd", "icmpd"},
+        PortRecord{5814, "tcp", "spt-automation", "Support Automation"},
+        PortRecord{5841, "tcp", "shiprush-d-ch", "Z-firm ShipRush interface for web access and bidirectional data"},
+        PortRecord{5842, "tcp", "reversion", "Reversion Backup/Restore"},
+        PortRecord{5859, "tcp", "wherehoo", "wherehoo"},
+        PortRecord{5863, "tcp", "ppsuitemsg", "PlanetPress Suite Messeng"},
+        PortRecord{5868, "tcp", "diameters", "diameters"},
+        PortRecord{5883, "tcp", "jute", "Javascript Unit Test Environment"},
+        PortRecord{5900, "tcp", "vnc", "vnc"},
+        PortRecord{5901, "tcp", "vnc-1", "Virtual Network Computer display 1"},
+        PortRecord{5902, "tcp", "vnc-2", "Virtual Network Computer display 2"},
+        PortRecord{5903, "tcp", "vnc-3", "Virtual Network Computer display 3"},
+        PortRecord{5910, "tcp", "cm", "Context Management"},
+        PortRecord{5911, "tcp", "cpdlc", "Controller Pilot Data Link Communication"},
+        PortRecord{5912, "tcp", "fis", "Flight Information Services"},
+        PortRecord{5913, "tcp", "ads-c", "Automatic Dependent Surveillance"},
+        PortRecord{5938, "tcp", "TeamViewer", "TeamViewer"},
+        PortRecord{5963, "tcp", "indy", "Indy Application Server"},
+        PortRecord{5968, "tcp", "mppolicy-v5", "mppolicy-v5"},
+        PortRecord{5969, "tcp", "mppolicy-mgr", "mppolicy-mgr"},
+        PortRecord{5977, "tcp", "ncd-pref-tcp", "NCD preferences tcp port"},
+        PortRecord{5978, "tcp", "ncd-diag-tcp", "NCD diagnostic tcp port"},
+        PortRecord{5979, "tcp", "ncd-conf-tcp", "NCD configuration tcp port"},
+        PortRecord{5984, "tcp", "couchdb", "couchdb"},
+        PortRecord{5985, "tcp", "wsman", "WBEM WS-Management HTTP"},
+        PortRecord{5986, "tcp", "wsmans", "WBEM WS-Management HTTP over TLS/SSL"},
+        PortRecord{5987, "tcp", "wbem-rmi", "WBEM RMI"},
+        PortRecord{5988, "tcp", "wbem-http", "WBEM CIM-XML (HTTP)"},
+        PortRecord{5989, "tcp", "wbem-https", "WBEM CIM-XML (HTTPS)"},
+        PortRecord{5990, "tcp", "wbem-exp-https", "WBEM Export HTTPS"},
+        PortRecord{5991, "tcp", "nuxsl", "nuxsl"},
+        PortRecord{5992, "tcp", "consul-insight", "Consul InSight Security"},
+        PortRecord{5993, "tcp", "cim-rs", "DMTF WBEM CIM REST"},
+        PortRecord{5997, "tcp", "ncd-pref", "NCD Preferences Telnet Port"},
+        PortRecord{5998, "tcp", "ncd-diag", "NCD Diagnostic Telnet Port"},
+        PortRecord{5999, "tcp", "ncd-conf", "ncd-conf"},
+        PortRecord{6000, "tcp", "X11", "X Window server"},
+        PortRecord{6001, "tcp", "X11:1", "X Window server"},
+        PortRecord{6002, "tcp", "X11:2", "X Window server"},
+        PortRecord{6003, "tcp", "X11:3", "X Window server"},
+        PortRecord{6004, "tcp", "X11:4", "X Window server"},
+        PortRecord{6005, "tcp", "X11:5", "X Window server"},
+        PortRecord{6006, "tcp", "X11:6", "X Window server"},
+        PortRecord{6007, "tcp", "X11:7", "X Window server"},
+        PortRecord{6008, "tcp", "X11:8", "X Window server"},
+        PortRecord{6009, "tcp", "X11:9", "X Window server"},
+        PortRecord{6010, "tcp", "x11", "X Window System"},
+        PortRecord{6011, "tcp", "x11", "X Window System"},
+        PortRecord{6012, "tcp", "x11", "X Window System"},
+        PortRecord{6013, "tcp", "x11", "X Window System"},
+        PortRecord{6014, "tcp", "x11", "X Window System"},
+        PortRecord{6015, "tcp", "x11", "X Window System"},
+        PortRecord{6016, "tcp", "x11", "X Window System"},
+        PortRecord{6017, "tcp", "xmail-ctrl", "XMail CTRL server"},
+        PortRecord{6018, "tcp", "x11", "X Window System"},
+        PortRecord{6019, "tcp", "x11", "X Window System"},
+        PortRecord{6020, "tcp", "x11", "X Window System"},
+        PortRecord{6021, "tcp", "x11", "X Window System"},
+        PortRecord{6022, "tcp", "x11", "X Window System"},
+        PortRecord{6023, "tcp", "x11", "X Window System"},
+        PortRecord{6024, "tcp", "x11", "X Window System"},
+        PortRecord{6025, "tcp", "x11", "X Window System"},
+        PortRecord{6026, "tcp", "x11", "X Window System"},
+        PortRecord{6027, "tcp", "x11", "X Window System"},
+        PortRecord{6028, "tcp", "x11", "X Window System"},
+        PortRecord{6029, "tcp", "x11", "X Window System"},
+        PortRecord{6030, "tcp", "x11", "X Window System"},
+        PortRecord{6031, "tcp", "x11", "X Window System"},
+        PortRecord{6032, "tcp", "x11", "X Window System"},
+        PortRecord{6033, "tcp", "x11", "X Window System"},
+        PortRecord{6034, "tcp", "x11", "X Window System"},
+        PortRecord{6035, "tcp", "x11", "X Window System"},
+        PortRecord{6036, "tcp", "x11", "X Window System"},
+        PortRecord{6037, "tcp", "x11", "X Window System"},
+        PortRecord{6038, "tcp", "x11", "X Window System"},
+        PortRecord{6039, "tcp", "x11", "X Window System"},
+        PortRecord{6040, "tcp", "x11", "X Window System"},
+        PortRecord{6041, "tcp", "x11", "X Window System"},
+        PortRecord{6042, "tcp", "x11", "X Window System"},
+        PortRecord{6043, "tcp", "x11", "X Window System"},
+        PortRecord{6044, "tcp", "x11", "X Window System"},
+        PortRecord{6045, "tcp", "x11", "X Window System"},
+        PortRecord{6046, "tcp", "x11", "X Window System"},
+        PortRecord{6047, "tcp", "x11", "X Window System"},
+        PortRecord{6048, "tcp", "x11", "X Window System"},
+        PortRecord{6049, "tcp", "x11", "X Window System"},
+        PortRecord{6050, "tcp", "arcserve", "ARCserve agent"},
+        PortRecord{6051, "tcp", "x11", "X Window System"},
+        PortRecord{6052, "tcp", "x11", "X Window System"},
+        PortRecord{6053, "tcp", "x11", "X Window System"},
+        PortRecord{6054, "tcp", "x11", "X Window System"},
+        PortRecord{6055, "tcp", "x11", "X Window System"},
+        PortRecord{6056, "tcp", "x11", "X Window System"},
+        PortRecord{6057, "tcp", "x11", "X Window System"},
+        PortRecord{6058, "tcp", "x11", "X Window System"},
+        PortRecord{6059, "tcp", "X11:59", "X Window server"},
+        PortRecord{6060, "tcp", "x11", "X Window System"},
+        PortRecord{6061, "tcp", "x11", "X Window System"},
+        PortRecord{6062, "tcp", "x11", "X Window System"},
+        PortRecord{6063, "tcp", "x11", "X Window System"},
+        PortRecord{6064, "tcp", "ndl-ahp-svc", "ndl-ahp-svc"},
+        PortRecord{6065, "tcp", "winpharaoh", "winpharaoh"},
+        PortRecord{6066, "tcp", "ewctsp", "ewctsp"},
+        PortRecord{6068, "tcp", "gsmp", "gsmp"},
+        PortRecord{6069, "tcp", "trip", "trip"},
+        PortRecord{6070, "tcp", "messageasap", "messageasap"},
+        PortRecord{6071, "tcp", "ssdtp", "ssdtp"},
+        PortRecord{6072, "tcp", "diagnose-proc", "diagnose-proc"},
+        PortRecord{6073, "tcp", "directplay8", "directplay8"},
+        PortRecord{6074, "tcp", "max", "Microsoft Max"},
+        PortRecord{6075, "tcp", "dpm-acm", "Microsoft DPM Access Control Manager"},
+        PortRecord{6076, "tcp", "msft-dpm-cert", "Microsoft DPM WCF Certificates"},
+        PortRecord{6077, "tcp", "iconstructsrv", "iConstruct Server"},
+        PortRecord{6080, "tcp", "gue", "Generic UDP Encapsulation"},
+        PortRecord{6081, "tcp", "geneve", "Generic Network Virtualization Encapsulation (Geneve)"},
+        PortRecord{6082, "tcp", "p25cai", "APCO Project 25 Common Air Interface - UDP encapsulation"},
+        PortRecord{6083, "tcp", "miami-bcast", "telecomsoftware miami broadcast"},
+        PortRecord{6084, "tcp", "p2p-sip", "p2p-sip"},
+        PortRecord{6085, "tcp", "konspire2b", "konspire2b p2p network"},
+        PortRecord{6086, "tcp", "pdtp", "PDTP P2P"},
+        PortRecord{6087, "tcp", "ldss", "Local Download Sharing Service"},
+        PortRecord{6088, "tcp", "doglms", "doglms"},
+        PortRecord{6099, "tcp", "raxa-mgmt", "RAXA Management"},
+        PortRecord{6100, "tcp", "synchronet-db", "synchronet-db"},
+        PortRecord{6101, "tcp", "backupexec", "backupexec"},
+        PortRecord{6102, "tcp", "synchronet-upd", "synchronet-upd"},
+        PortRecord{6103, "tcp", "RETS-or-BackupExec", "RETS-or-BackupExec"},
+        PortRecord{6104, "tcp", "dbdb", "dbdb"},
+        PortRecord{6105, "tcp", "isdninfo", "isdninfo"},
+        PortRecord{6106, "tcp", "isdninfo", "isdninfo"},
+        PortRecord{6107, "tcp", "etc-control", "ETC Control"},
+        PortRecord{6108, "tcp", "sercomm-scadmin", "sercomm-scadmin"},
+        PortRecord{6109, "tcp", "globecast-id", "globecast-id"},
+        PortRecord{6110, "tcp", "softcm", "HP SoftBench CM"},
+        PortRecord{6111, "tcp", "spc", "HP SoftBench Sub-Process Control"},
+        PortRecord{6112, "tcp", "dtspc", "dtspc"},
+        PortRecord{6113, "tcp", "dayliteserver", "Daylite Server"},
+        PortRecord{6114, "tcp", "wrspice", "WRspice IPC Service"},
+        PortRecord{6115, "tcp", "xic", "Xic IPC Service"},
+        PortRecord{6116, "tcp", "xtlserv", "XicTools License Manager Service"},
+        PortRecord{6117, "tcp", "daylitetouch", "Daylite Touch Sync"},
+        PortRecord{6118, "tcp", "tipc", "Transparent Inter Process Communication"},
+        PortRecord{6121, "tcp", "spdy", "SPDY for a faster web"},
+        PortRecord{6122, "tcp", "bex-webadmin", "Backup Express Web Server"},
+        PortRecord{6123, "tcp", "backup-express", "Backup Express"},
+        PortRecord{6124, "tcp", "pnbs", "Phlexible Network Backup Service"},
+        PortRecord{6130, "tcp", "damewaremobgtwy", "The DameWare Mobile Gateway Service"},
+        PortRecord{6133, "tcp", "nbt-wol", "New Boundary Tech WOL"},
+        PortRecord{6140, "tcp", "pulsonixnls", "Pulsonix Network License Service"},
+        PortRecord{6141, "tcp", "meta-corp", "Meta Corporation License Manager"},
+        PortRecord{6142, "tcp", "aspentec-lm", "Aspen Technology License Manager"},
+        PortRecord{6143, "tcp", "watershed-lm", "Watershed License Manager"},
+        PortRecord{6144, "tcp", "statsci1-lm", "StatSci License Manager - 1"},
+        PortRecord{6145, "tcp", "statsci2-lm", "StatSci License Manager - 2"},
+        PortRecord{6146, "tcp", "lonewolf-lm", "Lone Wolf Systems License Manager"},
+        PortRecord{6147, "tcp", "montage-lm", "Montage License Manager"},
+        PortRecord{6148, "tcp", "ricardo-lm", "Ricardo North America License Manager"},
+        PortRecord{6149, "tcp", "tal-pod", "tal-pod"},
+        PortRecord{6159, "tcp", "efb-aci", "EFB Application Control Interface"},
+        PortRecord{6160, "tcp", "ecmp", "ecmp"},
+        PortRecord{6161, "tcp", "patrol-ism", "PATROL Internet Srv Mgr"},
+        PortRecord{6162, "tcp", "patrol-coll", "PATROL Collector"},
+        PortRecord{6163, "tcp", "pscribe", "Precision Scribe Cnx Port"},
+        PortRecord{6200, "tcp", "lm-x", "LM-X License Manager by X-Formation"},
+        PortRecord{6201, "tcp", "thermo-calc", "Management of service nodes in a processing grid for thermodynamic calculations"},
+        PortRecord{6209, "tcp", "qmtps", "QMTP over TLS"},
+        PortRecord{6222, "tcp", "radmind", "radmind"},
+        PortRecord{6241, "tcp", "jeol-nsdtp-1", "jeol-nsdtp-1"},
+        PortRecord{6242, "tcp", "jeol-nsdtp-2", "jeol-nsdtp-2"},
+        PortRecord{6243, "tcp", "jeol-nsdtp-3", "jeol-nsdtp-3"},
+        PortRecord{6244, "tcp", "jeol-nsdtp-4", "jeol-nsdtp-4"},
+        PortRecord{6251, "tcp", "tl1-raw-ssl", "TL1 Raw Over SSL/TLS"},
+        PortRecord{6252, "tcp", "tl1-ssh", "TL1 over SSH"},
+        PortRecord{6253, "tcp", "crip", "crip"},
+        PortRecord{6267, "tcp", "gld", "GridLAB-D User Interface"},
+        PortRecord{6268, "tcp", "grid", "Grid Authentication"},
+        PortRecord{6269, "tcp", "grid-alt", "Grid Authentication Alt"},
+        PortRecord{6300, "tcp", "bmc-grx", "BMC GRX"},
+        PortRecord{6301, "tcp", "bmc_ctd_ldap", "bmc_ctd_ldap"},
+        PortRecord{6306, "tcp", "ufmp", "Unified Fabric Management Protocol"},
+        PortRecord{6315, "tcp", "scup", "scup"},
+        PortRecord{6316, "tcp", "abb-escp", "Ethernet Sensor Communications Protocol"},
+        PortRecord{6317, "tcp", "nav-data-cmd", "nav-data-cmd"},
+        PortRecord{6320, "tcp", "repsvc", "Double-Take Replication Service"},
+        PortRecord{6321, "tcp", "emp-server1", "Empress Software Connectivity Server 1"},
+        PortRecord{6322, "tcp", "emp-server2", "Empress Software Connectivity Server 2"},
+        PortRecord{6324, "tcp", "hrd-ncs", "hrd-ncs"},
+        PortRecord{6325, "tcp", "dt-mgmtsvc", "Double-Take Management Service"},
+        PortRecord{6326, "tcp", "dt-vra", "Double-Take Virtual Recovery Assistant"},
+        PortRecord{6343, "tcp", "sflow", "sFlow traffic monitoring"},
+        PortRecord{6344, "tcp", "streletz", "Argus-Spectr security and fire-prevention systems service"},
+        PortRecord{6346, "tcp", "gnutella", "gnutella"},
+        PortRecord{6347, "tcp", "gnutella2", "gnutella2"},
+        PortRecord{6350, "tcp", "adap", "App Discovery and Access Protocol"},
+        PortRecord{6355, "tcp", "pmcs", "PMCS applications"},
+        PortRecord{6360, "tcp", "metaedit-mu", "MetaEdit+ Multi-User"},
+        PortRecord{6363, "tcp", "ndn", "Named Data Networking"},
+        PortRecord{6370, "tcp", "metaedit-se", "MetaEdit+ Server Administration"},
+        PortRecord{6379, "tcp", "redis", "An advanced key-value cache and store"},
+        PortRecord{6382, "tcp", "metatude-mds", "Metatude Dialogue Server"},
+        PortRecord{6389, "tcp", "clariion-evr01", "clariion-evr01"},
+        PortRecord{6390, "tcp", "metaedit-ws", "MetaEdit+ WebService API"},
+        PortRecord{6400, "tcp", "crystalreports", "crystalreports"},
+        PortRecord{6401, "tcp", "crystalenterprise", "crystalenterprise"},
+        PortRecord{6402, "tcp", "boe-eventsrv", "boe-eventsrv"},
+        PortRecord{6403, "tcp", "boe-cachesvr", "boe-cachesvr"},
+        PortRecord{6404, "tcp", "boe-filesvr", "Business Objects Enterprise internal server"},
+        PortRecord{6405, "tcp", "boe-pagesvr", "Business Objects Enterprise internal server"},
+        PortRecord{6406, "tcp", "boe-processsvr", "Business Objects Enterprise internal server"},
+        PortRecord{6407, "tcp", "boe-resssvr1", "Business Objects Enterprise internal server"},
+        PortRecord{6408, "tcp", "boe-resssvr2", "Business Objects Enterprise internal server"},
+        PortRecord{6409, "tcp", "boe-resssvr3", "Business Objects Enterprise internal server"},
+        PortRecord{6410, "tcp", "boe-resssvr4", "Business Objects Enterprise internal server"},
+        PortRecord{6417, "tcp", "faxcomservice", "Faxcom Message Service"},
+        PortRecord{6418, "tcp", "syserverremote", "SYserver remote commands"},
+        PortRecord{6419, "tcp", "svdrp", "svdrp"},
+        PortRecord{6420, "tcp", "nim-vdrshell", "NIM_VDRShell"},
+        PortRecord{6421, "tcp", "nim-wan", "NIM_WAN"},
+        PortRecord{6432, "tcp", "pgbouncer", "pgbouncer"},
+        PortRecord{6440, "tcp", "heliosd", "heliosd daemon"},
+        PortRecord{6442, "tcp", "tarp", "Transitory Application Request Protocol"},
+        PortRecord{6443, "tcp", "sun-sr-https", "Service Registry Default HTTPS Domain"},
+        PortRecord{6444, "tcp", "sge_qmaster", "sge_qmaster"},
+        PortRecord{6445, "tcp", "sge_execd", "sge_execd"},
+        PortRecord{6446, "tcp", "mysql-proxy", "MySQL Proxy Server"},
+        PortRecord{6455, "tcp", "skip-cert-recv", "SKIP Certificate Receive"},
+        PortRecord{6456, "tcp", "skip-cert-send", "SKIP Certificate Send"},
+        PortRecord{6464, "tcp", "ieee11073-20701", "Port assignment for medical device communication in accordance to IEEE 11073-20701"},
+        PortRecord{6471, "tcp", "lvision-lm", "LVision License Manager"},
+        PortRecord{6480, "tcp", "sun-sr-http", "Service Registry Default HTTP Domain"},
+        PortRecord{6481, "tcp", "servicetags", "Service Tags"},
+        PortRecord{6482, "tcp", "ldoms-mgmt", "Logical Domains Management Interface"},
+        PortRecord{6483, "tcp", "SunVTS-RMI", "SunVTS RMI"},
+        PortRecord{6484, "tcp", "sun-sr-jms", "Service Registry Default JMS Domain"},
+        PortRecord{6485, "tcp", "sun-sr-iiop", "Service Registry Default IIOP Domain"},
+        PortRecord{6486, "tcp", "sun-sr-iiops", "Service Registry Default IIOPS Domain"},
+        PortRecord{6487, "tcp", "sun-sr-iiop-aut", "Service Registry Default IIOPAuth Domain"},
+        PortRecord{6488, "tcp", "sun-sr-jmx", "Service Registry Default JMX Domain"},
+        PortRecord{6489, "tcp", "sun-sr-admin", "Service Registry Default Admin Domain"},
+        PortRecord{6500, "tcp", "boks", "BoKS Master"},
+        PortRecord{6501, "tcp", "boks_servc", "boks_servc"},
+        PortRecord{6502, "tcp", "netop-rc", "netop-rc"},
+        PortRecord{6503, "tcp", "boks_clntd", "boks_clntd"},
+        PortRecord{6505, "tcp", "badm_priv", "badm_priv"},
+        PortRecord{6506, "tcp", "badm_pub", "badm_pub"},
+        PortRecord{6507, "tcp", "bdir_priv", "bdir_priv"},
+        PortRecord{6508, "tcp", "bdir_pub", "bdir_pub"},
+        PortRecord{6509, "tcp", "mgcs-mfp-port", "MGCS-MFP Port"},
+        PortRecord{6510, "tcp", "mcer-port", "MCER Port"},
+        PortRecord{6511, "tcp", "dccp-udp", "Datagram Congestion Control Protocol Encapsulation for NAT Traversal"},
+        PortRecord{6513, "tcp", "netconf-tls", "NETCONF over TLS"},
+        PortRecord{6514, "tcp", "syslog-tls", "syslog-tls"},
+        PortRecord{6515, "tcp", "elipse-rec", "Elipse RPC Protocol"},
+        PortRecord{6543, "tcp", "mythtv", "mythtv"},
+        PortRecord{6544, "tcp", "mythtv", "mythtv"},
+        PortRecord{6547, "tcp", "powerchuteplus", "powerchuteplus"},
+        PortRecord{6548, "tcp", "powerchuteplus", "powerchuteplus"},
+        PortRecord{6549, "tcp", "apc-6549", "APC 6549"},
+        PortRecord{6550, "tcp", "fg-sysupdate", "fg-sysupdate"},
+        PortRecord{6551, "tcp", "sum", "Software Update Manager"},
+        PortRecord{6556, "tcp", "checkmk-agent", "Checkmk Monitoring Agent"},
+        PortRecord{6558, "tcp", "xdsxdm", "xdsxdm"},
+        PortRecord{6566, "tcp", "sane-port", "SANE Control Port"},
+        PortRecord{6567, "tcp", "esp", "eSilo Storage Protocol"},
+        PortRecord{6568, "tcp", "canit_store", "canit_store"},
+        PortRecord{6579, "tcp", "affiliate", "affiliate"},
+        PortRecord{6580, "tcp", "parsec-master", "Parsec Masterserver"},
+        PortRecord{6581, "tcp", "parsec-peer", "Parsec Peer-to-Peer"},
+        PortRecord{6582, "tcp", "parsec-game", "Parsec Gameserver"},
+        PortRecord{6583, "tcp", "joaJewelSuite", "JOA Jewel Suite"},
+        PortRecord{6588, "tcp", "analogx", "AnalogX HTTP proxy port"},
+        PortRecord{6600, "tcp", "mshvlm", "Microsoft Hyper-V Live Migration"},
+        PortRecord{6601, "tcp", "mstmg-sstp", "Microsoft Threat Management Gateway SSTP"},
+        PortRecord{6602, "tcp", "wsscomfrmwk", "Windows WSS Communication Framework"},
+        PortRecord{6619, "tcp", "odette-ftps", "ODETTE-FTP over TLS/SSL"},
+        PortRecord{6620, "tcp", "kftp-data", "Kerberos V5 FTP Data"},
+        PortRecord{6621, "tcp", "kftp", "Kerberos V5 FTP Control"},
+        PortRecord{6622, "tcp", "mcftp", "Multicast FTP"},
+        PortRecord{6623, "tcp", "ktelnet", "Kerberos V5 Telnet"},
+        PortRecord{6624, "tcp", "datascaler-db", "DataScaler database"},
+        PortRecord{6625, "tcp", "datascaler-ctl", "DataScaler control"},
+        PortRecord{6626, "tcp", "wago-service", "WAGO Service and Update"},
+        PortRecord{6627, "tcp", "nexgen", "Allied Electronics NeXGen"},
+        PortRecord{6628, "tcp", "afesc-mc", "AFE Stock Channel M/C"},
+        PortRecord{6629, "tcp", "nexgen-aux", "Secondary (non ANDI) multi-protocol multi-function interface"},
+        PortRecord{6632, "tcp", "mxodbc-connect", "eGenix mxODBC Connect"},
+        PortRecord{6633, "tcp", "cisco-vpath-tun", "Cisco vPath Services Overlay"},
+        PortRecord{6634, "tcp", "mpls-pm", "MPLS Performance Measurement out-of-band response"},
+        PortRecord{6635, "tcp", "mpls-udp", "Encapsulate MPLS packets in UDP tunnels."},
+        PortRecord{6636, "tcp", "mpls-udp-dtls", "Encapsulate MPLS packets in UDP tunnels with DTLS."},
+        PortRecord{6640, "tcp", "ovsdb", "Open vSwitch Database protocol"},
+        PortRecord{6653, "tcp", "openflow", "openflow"},
+        PortRecord{6655, "tcp", "pcs-sf-ui-man", "PC SOFT - Software factory UI/manager"},
+        PortRecord{6656, "tcp", "emgmsg", "Emergency Message Control Service"},
+        PortRecord{6657, "tcp", "palcom-disc", "PalCom Discovery"},
+        PortRecord{6662, "tcp", "radmind", "Radmind protocol (deprecated)"},
+        PortRecord{6665, "tcp", "irc", "Internet Relay Chat"},
+        PortRecord{6666, "tcp", "irc", "Internet Relay Chat Server"},
+        PortRecord{6667, "tcp", "irc", "Internet Relay Chat"},
+        PortRecord{6668, "tcp", "irc", "Internet Relay Chat"},
+        PortRecord{6669, "tcp", "irc", "Internet Relay Chat"},
+        PortRecord{6670, "tcp", "irc", "irc"},
+        PortRecord{6671, "tcp", "p4p-portal", "P4P Portal Service"},
+        PortRecord{6672, "tcp", "vision_server", "vision-server"},
+        PortRecord{6673, "tcp", "vision_elmd", "vision-elmd"},
+        PortRecord{6678, "tcp", "vfbp", "vfbp"},
+        PortRecord{6679, "tcp", "osaut", "Osorno Automation"},
+        PortRecord{6687, "tcp", "clever-ctrace", "CleverView for cTrace Message Service"},
+        PortRecord{6688, "tcp", "clever-tcpip", "CleverView for TCP/IP Message Service"},
+        PortRecord{6689, "tcp", "tsa", "Tofino Security Appliance"},
+        PortRecord{6690, "tcp", "cleverdetect", "CLEVERDetect Message Service"},
+        PortRecord{6696, "tcp", "babel", "Babel Routing Protocol"},
+        PortRecord{6697, "tcp", "ircs-u", "Internet Relay Chat via TLS/SSL"},
+        PortRecord{6699, "tcp", "napster", "napster"},
+        PortRecord{6700, "tcp", "carracho", "Carracho file sharing"},
+        PortRecord{6701, "tcp", "carracho", "carracho"},
+        PortRecord{6702, "tcp", "e-design-net", "e-Design network"},
+        PortRecord{6703, "tcp", "e-design-web", "e-Design web"},
+        PortRecord{6714, "tcp", "ibprotocol", "Internet Backplane Protocol"},
+        PortRecord{6715, "tcp", "fibotrader-com", "Fibotrader Communications"},
+        PortRecord{6716, "tcp", "princity-agent", "Princity Agent"},
+        PortRecord{6767, "tcp", "bmc-perf-agent", "BMC PERFORM AGENT"},
+        PortRecord{6768, "tcp", "bmc-perf-mgrd", "BMC PERFORM MGRD"},
+        PortRecord{6769, "tcp", "adi-gxp-srvprt", "ADInstruments GxP Server"},
+        PortRecord{6770, "tcp", "plysrv-http", "PolyServe Hypertext Transfer Protocol"},
+        PortRecord{6771, "tcp", "plysrv-https", "PolyServe Hypertext Transfer Protocol Secure"},
+        PortRecord{6777, "tcp", "ntz-tracker", "netTsunami Tracker"},
+        PortRecord{6778, "tcp", "ntz-p2p-storage", "netTsunami p2p storage system"},
+        PortRecord{6784, "tcp", "bfd-lag", "Bidirectional Forwarding Detection (BFD) on Link Aggregation Group (LAG) Interfaces"},
+        PortRecord{6785, "tcp", "dgpf-exchg", "DGPF Individual Exchange"},
+        PortRecord{6786, "tcp", "smc-jmx", "Sun Java Web Console JMX"},
+        PortRecord{6787, "tcp", "smc-admin", "Sun Web Console Admin"},
+        PortRecord{6788, "tcp", "smc-http", "SMC Hypertext Transfer Protocol"},
+        PortRecord{6789, "tcp", "ibm-db2-admin", "ibm-db2-admin"},
+        PortRecord{6790, "tcp", "hnmp", "hnmp"},
+        PortRecord{6791, "tcp", "hnm", "Halcyon Network Manager"},
+        PortRecord{6801, "tcp", "acnet", "ACNET Control System Protocol"},
+        PortRecord{6817, "tcp", "pentbox-sim", "PenTBox Secure IM Protocol"},
+        PortRecord{6831, "tcp", "ambit-lm", "ambit-lm"},
+        PortRecord{6841, "tcp", "netmo-default", "Netmo Default"},
+        PortRecord{6842, "tcp", "netmo-http", "Netmo Hypertext Transfer Protocol (Web)"},
+        PortRecord{6850, "tcp", "iccrushmore", "iccrushmore"},
+        PortRecord{6868, "tcp", "acctopus-cc", "acctopus-cc"},
+        PortRecord{6881, "tcp", "bittorrent-tracker", "BitTorrent tracker"},
+        PortRecord{6888, "tcp", "muse", "muse"},
+        PortRecord{6900, "tcp", "rtimeviewer", "R*TIME Viewer Data Interface"},
+        PortRecord{6901, "tcp", "jetstream", "Novell Jetstream messaging protocol"},
+        PortRecord{6924, "tcp", "split-ping", "Ping with RX/TX latency/loss split"},
+        PortRecord{6935, "tcp", "ethoscan", "EthoScan Service"},
+        PortRecord{6936, "tcp", "xsmsvc", "XenSource Management Service"},
+        PortRecord{6946, "tcp", "bioserver", "Biometrics Server"},
+        PortRecord{6951, "tcp", "otlp", "otlp"},
+        PortRecord{6961, "tcp", "jmact3", "jmact3"},
+        PortRecord{6962, "tcp", "jmevt2", "jmevt2"},
+        PortRecord{6963, "tcp", "swismgr1", "swismgr1"},
+        PortRecord{6964, "tcp", "swismgr2", "swismgr2"},
+        PortRecord{6965, "tcp", "swistrap", "swistrap"},
+        PortRecord{6966, "tcp", "swispol", "swispol"},
+        PortRecord{6969, "tcp", "acmsoda", "acmsoda"},
+        PortRecord{6970, "tcp", "conductor", "conductor"},
+        PortRecord{6997, "tcp", "MobilitySrv", "Mobility XE Protocol"},
+        PortRecord{6998, "tcp", "iatp-highpri", "iatp-highpri"},
+        PortRecord{6999, "tcp", "iatp-normalpri", "iatp-normalpri"},
+        PortRecord{7000, "tcp", "afs3-fileserver", "afs3-fileserver"},
+        PortRecord{7001, "tcp", "afs3-callback", "callbacks to cache managers"},
+        PortRecord{7002, "tcp", "afs3-prserver", "users & groups database"},
+        PortRecord{7003, "tcp", "afs3-vlserver", "volume location database"},
+        PortRecord{7004, "tcp", "afs3-kaserver", "AFS/Kerberos authentication service"},
+        PortRecord{7005, "tcp", "afs3-volser", "volume managment server"},
+        PortRecord{7006, "tcp", "afs3-errors", "error interpretation service"},
+        PortRecord{7007, "tcp", "afs3-bos", "basic overseer process"},
+        PortRecord{7008, "tcp", "afs3-update", "server-to-server updater"},
+        PortRecord{7009, "tcp", "afs3-rmtsys", "remote cache manager service"},
+        PortRecord{7010, "tcp", "ups-onlinet", "onlinet uninterruptable power supplies"},
+        PortRecord{7011, "tcp", "talon-disc", "Talon Discovery Port"},
+        PortRecord{7012, "tcp", "talon-engine", "Talon Engine"},
+        PortRecord{7013, "tcp", "microtalon-dis", "Microtalon Discovery"},
+        PortRecord{7014, "tcp", "microtalon-com", "Microtalon Communications"},
+        PortRecord{7015, "tcp", "talon-webserver", "Talon Webserver"},
+        PortRecord{7016, "tcp", "spg", "SPG Controls Carrier"},
+        PortRecord{7017, "tcp", "grasp", "grasp"},
+        PortRecord{7018, "tcp", "fisa-svc", "FISA Service"},
+        PortRecord{7019, "tcp", "doceri-ctl", "doceri-ctl"},
+        PortRecord{7020, "tcp", "dpserve", "DP Serve"},
+        PortRecord{7021, "tcp", "dpserveadmin", "DP Serve Admin"},
+        PortRecord{7022, "tcp", "ctdp", "CT Discovery Protocol"},
+        PortRecord{7023, "tcp", "ct2nmcs", "Comtech T2 NMCS"},
+        PortRecord{7024, "tcp", "vmsvc", "Vormetric service"},
+        PortRecord{7025, "tcp", "vmsvc-2", "Vormetric Service II"},
+        PortRecord{7026, "tcp", "loreji-panel", "Loreji Webhosting Panel"},
+        PortRecord{7030, "tcp", "op-probe", "ObjectPlanet probe"},
+        PortRecord{7031, "tcp", "iposplanet", "IPOSPLANET retailing multi devices protocol"},
+        PortRecord{7040, "tcp", "quest-disc", "Quest application level network service discovery"},
+        PortRecord{7070, "tcp", "realserver", "realserver"},
+        PortRecord{7071, "tcp", "iwg1", "IWGADTS Aircraft Housekeeping Message"},
+        PortRecord{7072, "tcp", "iba-cfg", "iba-cfg"},
+        PortRecord{7073, "tcp", "martalk", "MarTalk protocol"},
+        PortRecord{7080, "tcp", "empowerid", "EmpowerID Communication"},
+        PortRecord{7088, "tcp", "zixi-transport", "Zixi live video transport protocol"},
+        PortRecord{7095, "tcp", "jdp-disc", "Java Discovery Protocol"},
+        PortRecord{7099, "tcp", "lazy-ptop", "lazy-ptop"},
+        PortRecord{7100, "tcp", "font-service", "X Font Service"},
+        PortRecord{7101, "tcp", "elcn", "Embedded Light Control Network"},
+        PortRecord{7107, "tcp", "aes-x170", "aes-x170"},
+        PortRecord{7117, "tcp", "rothaga", "Encrypted chat and file transfer service"},
+        PortRecord{7121, "tcp", "virprot-lm", "Virtual Prototypes License Manager"},
+        PortRecord{7128, "tcp", "scenidm", "intelligent data manager"},
+        PortRecord{7129, "tcp", "scenccs", "Catalog Content Search"},
+        PortRecord{7161, "tcp", "cabsm-comm", "CA BSM Comm"},
+        PortRecord{7162, "tcp", "caistoragemgr", "CA Storage Manager"},
+        PortRecord{7163, "tcp", "cacsambroker", "CA Connection Broker"},
+        PortRecord{7164, "tcp", "fsr", "File System Repository Agent"},
+        PortRecord{7165, "tcp", "doc-server", "Document WCF Server"},
+        PortRecord{7166, "tcp", "aruba-server", "Aruba eDiscovery Server"},
+        PortRecord{7167, "tcp", "casrmagent", "CA SRM Agent"},
+        PortRecord{7168, "tcp", "cnckadserver", "cncKadServer DB & Inventory Services"},
+        PortRecord{7169, "tcp", "ccag-pib", "Consequor Consulting Process Integration Bridge"},
+        PortRecord{7170, "tcp", "nsrp", "Adaptive Name/Service Resolution"},
+        PortRecord{7171, "tcp", "drm-production", "Discovery and Retention Mgt Production"},
+        PortRecord{7172, "tcp", "metalbend", "Port used for MetalBend programmable interface"},
+        PortRecord{7173, "tcp", "zsecure", "zSecure Server"},
+        PortRecord{7174, "tcp", "clutild", "clutild"},
+        PortRecord{7181, "tcp", "janus-disc", "Janus Guidewire Enterprise Discovery Service Bus"},
+        PortRecord{7200, "tcp", "fodms", "FODMS FLIP"},
+        PortRecord{7201, "tcp", "dlip", "dlip"},
+        PortRecord{7202, "tcp", "pon-ictp", "Inter-Channel Termination Protocol (ICTP) for multi-wavelength PON (Passive Optical Network) systems"},
+        PortRecord{7215, "tcp", "PS-Server", "Communication ports for PaperStream Server services"},
+        PortRecord{7216, "tcp", "PS-Capture-Pro", "PaperStream Capture Professional"},
+        PortRecord{7227, "tcp", "ramp", "ramp"},
+        PortRecord{7228, "tcp", "citrixupp", "Citrix Universal Printing Port"},
+        PortRecord{7229, "tcp", "citrixuppg", "Citrix UPP Gateway"},
+        PortRecord{7234, "tcp", "asa-gateways", "Traffic forwarding for Okta cloud infra"},
+        PortRecord{7235, "tcp", "aspcoordination", "ASP Coordination Protocol"},
+        PortRecord{7236, "tcp", "display", "Wi-Fi Alliance Wi-Fi Display Protocol"},
+        PortRecord{7237, "tcp", "pads", "PADS (Public Area Display System) Server"},
+        PortRecord{7244, "tcp", "frc-hicp", "frc-hicp"},
+        PortRecord{7262, "tcp", "cnap", "Calypso Network Access Protocol"},
+        PortRecord{7272, "tcp", "watchme-7272", "WatchMe Monitoring 7272"},
+        PortRecord{7273, "tcp", "openmanage", "openmanage"},
+        PortRecord{7274, "tcp", "oma-rlp-s", "OMA Roaming Location SEC"},
+        PortRecord{7275, "tcp", "oma-ulp", "OMA UserPlane Location"},
+        PortRecord{7276, "tcp", "oma-ilp", "OMA Internal Location Protocol"},
+        PortRecord{7277, "tcp", "oma-ilp-s", "OMA Internal Location Secure Protocol"},
+        PortRecord{7278, "tcp", "oma-dcdocbs", "OMA Dynamic Content Delivery over CBS"},
+        PortRecord{7279, "tcp", "ctxlic", "Citrix Licensing"},
+        PortRecord{7280, "tcp", "itactionserver1", "ITACTIONSERVER 1"},
+        PortRecord{7281, "tcp", "itactionserver2", "ITACTIONSERVER 2"},
+        PortRecord{7282, "tcp", "mzca-action", "mzca-action"},
+        PortRecord{7283, "tcp", "genstat", "General Statistics Rendezvous Protocol"},
+        PortRecord{7300, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7301, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7302, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7303, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7304, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7305, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7306, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7307, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7308, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7309, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7310, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7311, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7312, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7313, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7314, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7315, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7316, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7317, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7318, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7319, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7320, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7321, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7322, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7323, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7324, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7325, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7326, "tcp", "icb", "Internet Citizen's Band"},
+        PortRecord{7327, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7328, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7329, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7330, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7331, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7332, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7333, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7334, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7335, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7336, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7337, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7338, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7339, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7340, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7341, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7342, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7343, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7344, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7345, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7346, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7347, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7348, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7349, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7350, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7351, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7352, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7353, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7354, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7355, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7356, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7357, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7358, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7359, "tcp", "swx", "The Swiss Exchange"},
+        PortRecord{7365, "tcp", "lcm-server", "LifeKeeper Communications"},
+        PortRecord{7391, "tcp", "mindfilesys", "mind-file system server"},
+        PortRecord{7392, "tcp", "mrssrendezvous", "mrss-rendezvous server"},
+        PortRecord{7393, "tcp", "nfoldman", "nFoldMan Remote Publish"},
+        PortRecord{7394, "tcp", "fse", "File system export of backup images"},
+        PortRecord{7395, "tcp", "winqedit", "winqedit"},
+        PortRecord{7397, "tcp", "hexarc", "Hexarc Command Language"},
+        PortRecord{7400, "tcp", "rtps-discovery", "RTPS Discovery"},
+        PortRecord{7401, "tcp", "rtps-dd-ut", "RTPS Data-Distribution User-Traffic"},
+        PortRecord{7402, "tcp", "rtps-dd-mt", "RTPS Data-Distribution Meta-Traffic"},
+        PortRecord{7410, "tcp", "ionixnetmon", "Ionix Network Monitor"},
+        PortRecord{7411, "tcp", "daqstream", "Streaming of measurement data"},
+        PortRecord{7420, "tcp", "ipluminary", "Multichannel real-time lighting control"},
+        PortRecord{7421, "tcp", "mtportmon", "Matisse Port Monitor"},
+        PortRecord{7426, "tcp", "pmdmgr", "OpenView DM Postmaster Manager"},
+        PortRecord{7427, "tcp", "oveadmgr", "OpenView DM Event Agent Manager"},
+        PortRecord{7428, "tcp", "ovladmgr", "OpenView DM Log Agent Manager"},
+        PortRecord{7429, "tcp", "opi-sock", "OpenView DM rqt communication"},
+        PortRecord{7430, "tcp", "xmpv7", "OpenView DM xmpv7 api pipe"},
+        PortRecord{7431, "tcp", "pmd", "OpenView DM ovc/xmpv3 api pipe"},
+        PortRecord{7437, "tcp", "faximum", "faximum"},
+        PortRecord{7443, "tcp", "oracleas-https", "Oracle Application Server HTTPS"},
+        PortRecord{7464, "tcp", "pythonds", "Python Documentation Server"},
+        PortRecord{7471, "tcp", "sttunnel", "Stateless Transport Tunneling Protocol"},
+        PortRecord{7473, "tcp", "rise", "Rise: The Vieneo Province"},
+        PortRecord{7474, "tcp", "neo4j", "Neo4j Graph Database"},
+        PortRecord{7478, "tcp", "openit", "IT Asset Management"},
+        PortRecord{7491, "tcp", "telops-lmd", "telops-lmd"},
+        PortRecord{7500, "tcp", "silhouette", "Silhouette User"},
+        PortRecord{7501, "tcp", "ovbus", "HP OpenView Bus Daemon"},
+        PortRecord{7508, "tcp", "adcp", "Automation Device Configuration Protocol"},
+        PortRecord{7509, "tcp", "acplt", "ACPLT - process automation service"},
+        PortRecord{7510, "tcp", "ovhpas", "HP OpenView Application Server"},
+        PortRecord{7511, "tcp", "pafec-lm", "pafec-lm"},
+        PortRecord{7542, "tcp", "saratoga", "Saratoga Transfer Protocol"},
+        PortRecord{7543, "tcp", "atul", "atul server"},
+        PortRecord{7544, "tcp", "nta-ds", "FlowAnalyzer DisplayServer"},
+        PortRecord{7545, "tcp", "nta-us", "FlowAnalyzer UtilityServer"},
+        PortRecord{7546, "tcp", "cfs", "Cisco Fabric service"},
+        PortRecord{7547, "tcp", "cwmp", "cwmp"},
+        PortRecord{7548, "tcp", "tidp", "Threat Information Distribution Protocol"},
+        PortRecord{7549, "tcp", "nls-tl", "Network Layer Signaling Transport Layer"},
+        PortRecord{7550, "tcp", "cloudsignaling", "Cloud Signaling Service"},
+        PortRecord{7551, "tcp", "controlone-con", "ControlONE Console signaling"},
+        PortRecord{7560, "tcp", "sncp", "Sniffer Command Protocol"},
+        PortRecord{7563, "tcp", "cfw", "Control Framework"},
+        PortRecord{7566, "tcp", "vsi-omega", "VSI Omega"},
+        PortRecord{7569, "tcp", "dell-eql-asm", "Dell EqualLogic Host Group Management"},
+        PortRecord{7570, "tcp", "aries-kfinder", "Aries Kfinder"},
+        PortRecord{7574, "tcp", "coherence", "coherence"},
+        PortRecord{7588, "tcp", "sun-lm", "Sun License Manager"},
+        PortRecord{7597, "tcp", "qaz", "Quaz trojan worm"},
+        PortRecord{7606, "tcp", "mipi-debug", "MIPI Alliance Debug"},
+        PortRecord{7624, "tcp", "indi", "Instrument Neutral Distributed Interface"},
+        PortRecord{7626, "tcp", "simco", "SImple Middlebox COnfiguration (SIMCO) Server"},
+        PortRecord{7627, "tcp", "soap-http", "SOAP Service Port"},
+        PortRecord{7628, "tcp", "zen-pawn", "Primary Agent Work Notification"},
+        PortRecord{7629, "tcp", "xdas", "OpenXDAS Wire Protocol"},
+        PortRecord{7630, "tcp", "hawk", "HA Web Konsole"},
+        PortRecord{7631, "tcp", "tesla-sys-msg", "TESLA System Messaging"},
+        PortRecord{7633, "tcp", "pmdfmgt", "PMDF Management"},
+        PortRecord{7634, "tcp", "hddtemp", "A cross-platform hard disk temperature monitoring daemon"},
+        PortRecord{7648, "tcp", "cuseeme", "bonjour-cuseeme"},
+        PortRecord{7663, "tcp", "rome", "Proprietary immutable distributed data storage"},
+        PortRecord{7672, "tcp", "imqstomp", "iMQ STOMP Server"},
+        PortRecord{7673, "tcp", "imqstomps", "iMQ STOMP Server over SSL"},
+        PortRecord{7674, "tcp", "imqtunnels", "iMQ SSL tunnel"},
+        PortRecord{7675, "tcp", "imqtunnel", "iMQ Tunnel"},
+        PortRecord{7676, "tcp", "imqbrokerd", "iMQ Broker Rendezvous"},
+        PortRecord{7677, "tcp", "sun-user-https", "Sun App Server - HTTPS"},
+        PortRecord{7680, "tcp", "pando-pub", "Pando Media Public Distribution"},
+        PortRecord{7683, "tcp", "dmt", "Cleondris DMT"},
+        PortRecord{7687, "tcp", "bolt", "Bolt database connection"},
+        PortRecord{7689, "tcp", "collaber", "Collaber Network Service"},
+        PortRecord{7697, "tcp", "klio", "KLIO communications"},
+        PortRecord{7700, "tcp", "em7-secom", "EM7 Secure Communications"},
+        PortRecord{7701, "tcp", "nfapi", "SCF nFAPI defining MAC/PHY split"},
+        PortRecord{7707, "tcp", "sync-em7", "EM7 Dynamic Updates"},
+        PortRecord{7708, "tcp", "scinet", "scientia.net"},
+        PortRecord{7720, "tcp", "medimageportal", "MedImage Portal"},
+        PortRecord{7724, "tcp", "nsdeepfreezectl", "Novell Snap-in Deep Freeze Control"},
+        PortRecord{7725, "tcp", "nitrogen", "Nitrogen Service"},
+        PortRecord{7726, "tcp", "freezexservice", "FreezeX Console Service"},
+        PortRecord{7727, "tcp", "trident-data", "Trident Systems Data"},
+        PortRecord{7728, "tcp", "osvr", "Open-Source Virtual Reality"},
+        PortRecord{7734, "tcp", "smip", "Smith Protocol over IP"},
+        PortRecord{7738, "tcp", "aiagent", "HP Enterprise Discovery Agent"},
+        PortRecord{7741, "tcp", "scriptview", "ScriptView Network"},
+        PortRecord{7742, "tcp", "msss", "Mugginsoft Script Server Service"},
+        PortRecord{7743, "tcp", "sstp-1", "Sakura Script Transfer Protocol"},
+        PortRecord{7744, "tcp", "raqmon-pdu", "RAQMON PDU"},
+        PortRecord{7747, "tcp", "prgp", "Put/Run/Get Protocol"},
+        PortRecord{7775, "tcp", "inetfs", "A File System using TLS over a wide area network"},
+        PortRecord{7777, "tcp", "cbt", "cbt"},
+        PortRecord{7778, "tcp", "interwise", "interwise"},
+        PortRecord{7779, "tcp", "vstat", "vstat"},
+        PortRecord{7781, "tcp", "accu-lmgr", "accu-lmgr"},
+        PortRecord{7784, "tcp", "s-bfd", "Seamless Bidirectional Forwarding Detection (S-BFD)"},
+        PortRecord{7786, "tcp", "minivend", "minivend"},
+        PortRecord{7787, "tcp", "popup-reminders", "Popup Reminders Receive"},
+        PortRecord{7789, "tcp", "office-tools", "Office Tools Pro Receive"},
+        PortRecord{7794, "tcp", "q3ade", "Q3ADE Cluster Service"},
+        PortRecord{7797, "tcp", "pnet-conn", "Propel Connector port"},
+        PortRecord{7798, "tcp", "pnet-enc", "Propel Encoder port"},
+        PortRecord{7799, "tcp", "altbsdp", "Alternate BSDP Service"},
+        PortRecord{7800, "tcp", "asr", "Apple Software Restore"},
+        PortRecord{7801, "tcp", "ssp-client", "Secure Server Protocol - client"},
+        PortRecord{7802, "tcp", "vns-tp", "Virtualized Network Services Tunnel Protocol"},
+        PortRecord{7810, "tcp", "rbt-wanopt", "Riverbed WAN Optimization Protocol"},
+        PortRecord{7845, "tcp", "apc-7845", "APC 7845"},
+        PortRecord{7846, "tcp", "apc-7846", "APC 7846"},
+        PortRecord{7847, "tcp", "csoauth", "A product key authentication protocol made by CSO"},
+        PortRecord{7869, "tcp", "mobileanalyzer", "MobileAnalyzer& MobileMonitor"},
+        PortRecord{7870, "tcp", "rbt-smc", "Riverbed Steelhead Mobile Service"},
+        PortRecord{7871, "tcp", "mdm", "Mobile Device Management"},
+        PortRecord{7872, "tcp", "mipv6tls", "TLS-based Mobile IPv6 Security"},
+        PortRecord{7878, "tcp", "owms", "Opswise Message Service"},
+        PortRecord{7880, "tcp", "pss", "Pearson"},
+        PortRecord{7887, "tcp", "ubroker", "Universal Broker"},
+        PortRecord{7900, "tcp", "mevent", "Multicast Event"},
+        PortRecord{7901, "tcp", "tnos-sp", "TNOS Service Protocol"},
+        PortRecord{7902, "tcp", "tnos-dp", "TNOS shell Protocol"},
+        PortRecord{7903, "tcp", "tnos-dps", "TNOS Secure DiaguardProtocol"},
+        PortRecord{7913, "tcp", "qo-secure", "QuickObjects secure port"},
+        PortRecord{7932, "tcp", "t2-drm", "Tier 2 Data Resource Manager"},
+        PortRecord{7933, "tcp", "t2-brm", "Tier 2 Business Rules Manager"},
+        PortRecord{7937, "tcp", "nsrexecd", "Legato NetWorker"},
+        PortRecord{7938, "tcp", "lgtomapper", "Legato portmapper"},
+        PortRecord{7962, "tcp", "generalsync", "Encrypted extendable general-purpose synchronization protocol"},
+        PortRecord{7967, "tcp", "supercell", "supercell"},
+        PortRecord{7979, "tcp", "micromuse-ncps", "micromuse-ncps"},
+        PortRecord{7980, "tcp", "quest-vista", "Quest Vista"},
+        PortRecord{7981, "tcp", "sossd-collect", "Spotlight on SQL Server Desktop Collect"},
+        PortRecord{7982, "tcp", "sossd-agent", "sossd-agent"},
+        PortRecord{7997, "tcp", "pushns", "PUSH Notification Service"},
+        PortRecord{7998, "tcp", "usicontentpush", "USI Content Push Service"},
+        PortRecord{7999, "tcp", "irdmi2", "irdmi2"},
+        PortRecord{8000, "tcp", "http-alt", "Hypertext Transfer Protocol (Alternate)"},
+        PortRecord{8001, "tcp", "vcom-tunnel", "VCOM Tunnel"},
+        PortRecord{8002, "tcp", "teradataordbms", "Teradata ORDBMS"},
+        PortRecord{8003, "tcp", "mcreport", "Mulberry Connect Reporting Service"},
+        PortRecord{8004, "tcp", "p2pevolvenet", "Opensource Evolv Enterprise Platform P2P Network Node Connection Protocol"},
+        PortRecord{8005, "tcp", "mxi", "MXI Generation II for z/OS"},
+        PortRecord{8006, "tcp", "wpl-analytics", "wpl-analytics"},
+        PortRecord{8007, "tcp", "ajp12", "ajp12"},
+        PortRecord{8008, "tcp", "http", "Hypertext Transfer Protocol"},
+        PortRecord{8009, "tcp", "ajp13", "ajp13"},
+        PortRecord{8010, "tcp", "xmpp", "XMPP File Transfer"},
+        PortRecord{8015, "tcp", "cfg-cloud", "Configuration Cloud Service"},
+        PortRecord{8016, "tcp", "ads-s", "Beckhoff Automation Device Specification"},
+        PortRecord{8019, "tcp", "qbdb", "QB DB Dynamic Port"},
+        PortRecord{8020, "tcp", "intu-ec-svcdisc", "Intuit Entitlement Service and Discovery"},
+        PortRecord{8021, "tcp", "ftp-proxy", "File Transfer Protocol Proxy"},
+        PortRecord{8022, "tcp", "oa-system", "oa-system"},
+        PortRecord{8023, "tcp", "arca-api", "ARCATrust vault API"},
+        PortRecord{8025, "tcp", "ca-audit-da", "CA Audit Distribution Agent"},
+        PortRecord{8026, "tcp", "ca-audit-ds", "CA Audit Distribution Server"},
+        PortRecord{8032, "tcp", "pro-ed", "ProEd"},
+        PortRecord{8033, "tcp", "mindprint", "mindprint"},
+        PortRecord{8034, "tcp", "vantronix-mgmt", ".vantronix Management"},
+        PortRecord{8040, "tcp", "ampify", "Ampify Messaging Protocol"},
+        PortRecord{8041, "tcp", "enguity-xccetp", "Xcorpeon ASIC Carrier Ethernet Transport"},
+        PortRecord{8042, "tcp", "fs-agent", "FireScope Agent"},
+        PortRecord{8043, "tcp", "fs-server", "FireScope Server"},
+        PortRecord{8044, "tcp", "fs-mgmt", "FireScope Management Interface"},
+        PortRecord{8051, "tcp", "rocrail", "Rocrail Client Service"},
+        PortRecord{8052, "tcp", "senomix01", "Senomix Timesheets Server"},
+        PortRecord{8053, "tcp", "senomix02", "Senomix Timesheets Client [1 year assignment]"},
+        PortRecord{8054, "tcp", "senomix03", "Senomix Timesheets Server [1 year assignment]"},
+        PortRecord{8055, "tcp", "senomix04", "Senomix Timesheets Server [1 year assignment]"},
+        PortRecord{8056, "tcp", "senomix05", "Senomix Timesheets Server [1 year assignment]"},
+        PortRecord{8057, "tcp", "senomix06", "Senomix Timesheets Client [1 year assignment]"},
+        PortRecord{8058, "tcp", "senomix07", "Senomix Timesheets Client [1 year assignment]"},
+        PortRecord{8059, "tcp", "senomix08", "Senomix Timesheets Client [1 year assignment]"},
+        PortRecord{8060, "tcp", "aero", "Asymmetric Extended Route Optimization (AERO)"},
+        PortRecord{8066, "tcp", "toad-bi-appsrvr", "Toad BI Application Server"},
+        PortRecord{8067, "tcp", "infi-async", "Infinidat async replication"},
+        PortRecord{8070, "tcp", "ucs-isc", "Oracle Unified Communication Suite's Indexed Search Converter"},
+        PortRecord{8074, "tcp", "gadugadu", "Gadu-Gadu"},
+        PortRecord{8076, "tcp", "slnp", "SLNP (Simple Library Network Protocol) by Sisis Informationssysteme GmbH"},
+        PortRecord{8077, "tcp", "mles", "Mles is a client-server data distribution protocol targeted to serve as a lightweight and reliable distributed publish/subscribe database service."},
+        PortRecord{8080, "tcp", "http-proxy", "Hypertext Transfer Protocol (Proxy)"},
+        PortRecord{8081, "tcp", "blackice-icecap", "blackice-icecap"},
+        PortRecord{8082, "tcp", "blackice-alerts", "blackice-alerts"},
+        PortRecord{8083, "tcp", "us-srv", "Utilistor (Server)"},
+        PortRecord{8084, "tcp", "websnp", "Snarl Network Protocol over HTTP"},
+        PortRecord{8086, "tcp", "d-s-n", "Distributed SCADA Networking Rendezvous Port"},
+        PortRecord{8087, "tcp", "simplifymedia", "Simplify Media SPP Protocol"},
+        PortRecord{8088, "tcp", "radan-http", "Radan HTTP"},
+        PortRecord{8090, "tcp", "opsmessaging", "Vehicle to station messaging"},
+        PortRecord{8091, "tcp", "jamlink", "Jam Link Framework"},
+        PortRecord{8097, "tcp", "sac", "SAC Port Id"},
+        PortRecord{8100, "tcp", "xprint-server", "Xprint Server"},
+        PortRecord{8101, "tcp", "ldoms-migr", "Logical Domains Migration"},
+        PortRecord{8102, "tcp", "kz-migr", "Oracle Kernel zones migration server"},
+        PortRecord{8111, "tcp", "skynetflow", "Skynetflow network services"},
+        PortRecord{8115, "tcp", "mtl8000-matrix", "MTL8000 Matrix"},
+        PortRecord{8116, "tcp", "cp-cluster", "Check Point Clustering"},
+        PortRecord{8117, "tcp", "purityrpc", "Purity replication clustering and remote management"},
+        PortRecord{8118, "tcp", "privoxy", "privoxy"},
+        PortRecord{8121, "tcp", "apollo-data", "Apollo Data Port"},
+        PortRecord{8122, "tcp", "apollo-admin", "Apollo Admin Port"},
+        PortRecord{8123, "tcp", "polipo", "Polipo open source web proxy cache"},
+        PortRecord{8128, "tcp", "paycash-online", "PayCash Online Protocol"},
+        PortRecord{8129, "tcp", "paycash-wbp", "PayCash Wallet-Browser"},
+        PortRecord{8130, "tcp", "indigo-vrmi", "indigo-vrmi"},
+        PortRecord{8131, "tcp", "indigo-vbcp", "indigo-vbcp"},
+        PortRecord{8132, "tcp", "dbabble", "dbabble"},
+        PortRecord{8140, "tcp", "puppet", "The Puppet master service"},
+        PortRecord{8148, "tcp", "isdd", "i-SDD file transfer"},
+        PortRecord{8149, "tcp", "eor-game", "Edge of Reality game data"},
+        PortRecord{8153, "tcp", "quantastor", "QuantaStor Management Interface"},
+        PortRecord{8160, "tcp", "patrol", "patrol"},
+        PortRecord{8161, "tcp", "patrol-snmp", "Patrol SNMP"},
+        PortRecord{8162, "tcp", "lpar2rrd", "LPAR2RRD client server communication"},
+        PortRecord{8181, "tcp", "intermapper", "Intermapper network management system"},
+        PortRecord{8182, "tcp", "vmware-fdm", "VMware Fault Domain Manager"},
+        PortRecord{8183, "tcp", "proremote", "proremote"},
+        PortRecord{8184, "tcp", "itach", "Remote iTach Connection"},
+        PortRecord{8190, "tcp", "gcp-rphy", "Generic control plane for RPHY"},
+        PortRecord{8191, "tcp", "limnerpressure", "Limner Pressure"},
+        PortRecord{8192, "tcp", "sophos", "sophos"},
+        PortRecord{8193, "tcp", "sophos", "Sophos Remote Management System"},
+        PortRecord{8194, "tcp", "sophos", "sophos"},
+        PortRecord{8195, "tcp", "blp2", "Bloomberg feed"},
+        PortRecord{8199, "tcp", "vvr-data", "VVR DATA"},
+        PortRecord{8200, "tcp", "trivnet1", "TRIVNET"},
+        PortRecord{8201, "tcp", "trivnet2", "TRIVNET"},
+        PortRecord{8202, "tcp", "aesop", "Audio+Ethernet Standard Open Protocol"},
+        PortRecord{8204, "tcp", "lm-perfworks", "LM Perfworks"},
+        PortRecord{8205, "tcp", "lm-instmgr", "LM Instmgr"},
+        PortRecord{8206, "tcp", "lm-dta", "LM Dta"},
+        PortRecord{8207, "tcp", "lm-sserver", "LM SServer"},
+        PortRecord{8208, "tcp", "lm-webwatcher", "LM Webwatcher"},
+        PortRecord{8211, "tcp", "aruba-papi", "Aruba Networks AP management"},
+        PortRecord{8230, "tcp", "rexecj", "RexecJ Server"},
+        PortRecord{8231, "tcp", "hncp-udp-port", "HNCP"},
+        PortRecord{8232, "tcp", "hncp-dtls-port", "HNCP over DTLS"},
+        PortRecord{8243, "tcp", "synapse-nhttps", "Synapse Non Blocking HTTPS"},
+        PortRecord{8266, "tcp", "espeasy-p2p", "ESPeasy peer-2-peer communication"},
+        PortRecord{8270, "tcp", "robot-remote", "Robot Framework Remote Library Interface"},
+        PortRecord{8276, "tcp", "pando-sec", "Pando Media Controlled Distribution"},
+        PortRecord{8280, "tcp", "synapse-nhttp", "Synapse Non Blocking HTTP"},
+        PortRecord{8282, "tcp", "libelle", "libelle"},
+        PortRecord{8292, "tcp", "blp3", "Bloomberg professional"},
+        PortRecord{8293, "tcp", "hiperscan-id", "Hiperscan Identification Service"},
+        PortRecord{8294, "tcp", "blp4", "Bloomberg intelligent client"},
+        PortRecord{8300, "tcp", "tmi", "Transport Management Interface"},
+        PortRecord{8301, "tcp", "amberon", "Amberon PPC/PPS"},
+        PortRecord{8313, "tcp", "hub-open-net", "Hub Open Network"},
+        PortRecord{8320, "tcp", "tnp-discover", "Thin(ium) Network Protocol"},
+        PortRecord{8321, "tcp", "tnp", "Thin(ium) Network Protocol"},
+        PortRecord{8322, "tcp", "garmin-marine", "Garmin Marine"},
+        PortRecord{8333, "tcp", "bitcoin", "Bitcoin crypto currency"},
+        PortRecord{8351, "tcp", "server-find", "Server Find"},
+        PortRecord{8376, "tcp", "cruise-enum", "Cruise ENUM"},
+        PortRecord{8377, "tcp", "cruise-swroute", "Cruise SWROUTE"},
+        PortRecord{8378, "tcp", "cruise-config", "Cruise CONFIG"},
+        PortRecord{8379, "tcp", "cruise-diags", "Cruise DIAGS"},
+        PortRecord{8380, "tcp", "cruise-update", "Cruise UPDATE"},
+        PortRecord{8383, "tcp", "m2mservices", "M2m Services"},
+        PortRecord{8384, "tcp", "marathontp", "Marathon Transport Protocol"},
+        PortRecord{8400, "tcp", "cvd", "cvd"},
+        PortRecord{8401, "tcp", "sabarsd", "sabarsd"},
+        PortRecord{8402, "tcp", "abarsd", "abarsd"},
+        PortRecord{8403, "tcp", "admind", "admind"},
+        PortRecord{8404, "tcp", "svcloud", "SuperVault Cloud"},
+        PortRecord{8405, "tcp", "svbackup", "SuperVault Backup"},
+        PortRecord{8415, "tcp", "dlpx-sp", "Delphix Session Protocol"},
+        PortRecord{8416, "tcp", "espeech", "eSpeech Session Protocol"},
+        PortRecord{8417, "tcp", "espeech-rtp", "eSpeech RTP Protocol"},
+        PortRecord{8423, "tcp", "aritts", "Aristech text-to-speech server"},
+        PortRecord{8442, "tcp", "cybro-a-bus", "CyBro A-bus Protocol"},
+        PortRecord{8443, "tcp", "https-alt", "Hypertext Transfer Protocol Secure (Alternate)"},
+        PortRecord{8444, "tcp", "pcsync-http", "PCsync HTTP"},
+        PortRecord{8445, "tcp", "copy", "copy"},
+        PortRecord{8450, "tcp", "npmp", "npmp"},
+        PortRecord{8457, "tcp", "nexentamv", "Nexenta Management GUI"},
+        PortRecord{8470, "tcp", "cisco-avp", "Cisco Address Validation Protocol"},
+        PortRecord{8471, "tcp", "pim-port", "PIM over Reliable Transport"},
+        PortRecord{8472, "tcp", "otv", "Overlay Transport Virtualization (OTV)"},
+        PortRecord{8473, "tcp", "vp2p", "Virtual Point to Point"},
+        PortRecord{8474, "tcp", "noteshare", "AquaMinds NoteShare"},
+        PortRecord{8500, "tcp", "fmtp", "Flight Message Transfer Protocol"},
+        PortRecord{8501, "tcp", "cmtp-mgt", "cmtp-mgt"},
+        PortRecord{8502, "tcp", "ftnmtp", "FTN Message Transfer Protocol"},
+        PortRecord{8503, "tcp", "lsp-self-ping", "MPLS LSP Self-Ping"},
+        PortRecord{8554, "tcp", "rtsp-alt", "RTSP Alternate (see port 554)"},
+        PortRecord{8555, "tcp", "d-fence", "SYMAX D-FENCE"},
+        PortRecord{8567, "tcp", "oap-admin", "oap-admin"},
+        PortRecord{8600, "tcp", "asterix", "Surveillance Data"},
+        PortRecord{8609, "tcp", "canon-cpp-disc", "Canon Compact Printer Protocol Discovery"},
+        PortRecord{8610, "tcp", "canon-mfnp", "Canon MFNP Service"},
+        PortRecord{8611, "tcp", "canon-bjnp1", "Canon BJNP Port 1"},
+        PortRecord{8612, "tcp", "canon-bjnp2", "Canon BJNP Port 2"},
+        PortRecord{8613, "tcp", "canon-bjnp3", "Canon BJNP Port 3"},
+        PortRecord{8614, "tcp", "canon-bjnp4", "Canon BJNP Port 4"},
+        PortRecord{8615, "tcp", "imink", "Imink Service Control"},
+        PortRecord{8665, "tcp", "monetra", "monetra"},
+        PortRecord{8666, "tcp", "monetra-admin", "Monetra Administrative Access"},
+        PortRecord{8675, "tcp", "msi-cps-rm", "msi-cps-rm"},
+        PortRecord{8686, "tcp", "sun-as-jmxrmi", "Sun App Server - JMX/RMI"},
+        PortRecord{8688, "tcp", "openremote-ctrl", "OpenRemote Controller HTTP/REST"},
+        PortRecord{8699, "tcp", "vnyx", "VNYX Primary Port"},
+        PortRecord{8710, "tcp", "semi-grpc", "gRPC for SEMI Standards implementations"},
+        PortRecord{8711, "tcp", "nvc", "Nuance Voice Control"},
+        PortRecord{8732, "tcp", "dtp-net", "DASGIP Net Services"},
+        PortRecord{8733, "tcp", "ibus", "ibus"},
+        PortRecord{8750, "tcp", "dey-keyneg", "DEY Storage Key Negotiation"},
+        PortRecord{8763, "tcp", "mc-appserver", "mc-appserver"},
+        PortRecord{8764, "tcp", "openqueue", "openqueue"},
+        PortRecord{8765, "tcp", "ultraseek-http", "Ultraseek HTTP"},
+        PortRecord{8766, "tcp", "amcs", "Agilent Connectivity Service"},
+        PortRecord{8767, "tcp", "core-of-source", "Online mobile multiplayer game"},
+        PortRecord{8768, "tcp", "sandpolis", "Sandpolis Server"},
+        PortRecord{8769, "tcp", "oktaauthenticat", "Okta MultiPlatform Access Mgmt for Cloud Svcs"},
+        PortRecord{8770, "tcp", "apple-iphoto", "apple-iphoto"},
+        PortRecord{8778, "tcp", "uec", "Stonebranch Universal Enterprise Controller"},
+        PortRecord{8786, "tcp", "msgclnt", "Message Client"},
+        PortRecord{8787, "tcp", "msgsrvr", "Message Server"},
+        PortRecord{8793, "tcp", "acd-pm", "Accedian Performance Measurement"},
+        PortRecord{8800, "tcp", "sunwebadmin", "Sun Web Server Admin Service"},
+        PortRecord{8804, "tcp", "truecm", "truecm"},
+        PortRecord{8805, "tcp", "pfcp", "Destination Port number for PFCP"},
+        PortRecord{8807, "tcp", "hes-clip", "HES-CLIP Interoperability protocol"},
+        PortRecord{8808, "tcp", "ssports-bcast", "STATSports Broadcast Service"},
+        PortRecord{8809, "tcp", "3gpp-monp", "MCPTT Off-Network Protocol (MONP)"},
+        PortRecord{8834, "tcp", "nessus-xmlrpc", "nessus-xmlrpc"},
+        PortRecord{8873, "tcp", "dxspider", "dxspider linking protocol"},
+        PortRecord{8880, "tcp", "cddbp-alt", "CDDBP"},
+        PortRecord{8881, "tcp", "galaxy4d", "Galaxy4D Online Game Engine"},
+        PortRecord{8883, "tcp", "secure-mqtt", "Secure MQTT"},
+        PortRecord{8888, "tcp", "sun-answerbook", "sun-answerbook"},
+        PortRecord{8889, "tcp", "ddi-tcp-2", "ddi-tcp-2"},
+        PortRecord{8890, "tcp", "ddi-tcp-3", "ddi-tcp-3"},
+        PortRecord{8891, "tcp", "ddi-tcp-4", "ddi-tcp-4"},
+        PortRecord{8892, "tcp", "seosload", "seosload"},
+        PortRecord{8893, "tcp", "ddi-tcp-6", "ddi-tcp-6"},
+        PortRecord{8894, "tcp", "ddi-tcp-7", "ddi-tcp-7"},
+        PortRecord{8899, "tcp", "ospf-lite", "ospf-lite"},
+        PortRecord{8900, "tcp", "jmb-cds1", "JMB-CDS 1"},
+        PortRecord{8901, "tcp", "jmb-cds2", "JMB-CDS 2"},
+        PortRecord{8910, "tcp", "manyone-http", "manyone-http"},
+        PortRecord{8911, "tcp", "manyone-xml", "manyone-xml"},
+        PortRecord{8912, "tcp", "wcbackup", "Windows Client Backup"},
+        PortRecord{8913, "tcp", "dragonfly", "Dragonfly System Service"},
+        PortRecord{8937, "tcp", "twds", "Transaction Warehouse Data Service"},
+        PortRecord{8953, "tcp", "ub-dns-control", "unbound dns nameserver control"},
+        PortRecord{8954, "tcp", "cumulus-admin", "Cumulus Admin Port"},
+        PortRecord{8980, "tcp", "nod-provider", "Network of Devices Provider"},
+        PortRecord{8981, "tcp", "nod-client", "Network of Devices Client"},
+        PortRecord{8989, "tcp", "sunwebadmins", "Sun Web Server SSL Admin Service"},
+        PortRecord{8990, "tcp", "http-wmap", "webmail HTTP service"},
+        PortRecord{8991, "tcp", "https-wmap", "webmail HTTPS service"},
+        PortRecord{8997, "tcp", "oracle-ms-ens", "Oracle Messaging Server Event Notification Service"},
+        PortRecord{8998, "tcp", "canto-roboflow", "Canto RoboFlow Control"},
+        PortRecord{8999, "tcp", "bctp", "Brodos Crypto Trade Protocol"},
+        PortRecord{9000, "tcp", "cslistener", "cslistener"},
+        PortRecord{9001, "tcp", "tor-orport", "tor-orport"},
+        PortRecord{9002, "tcp", "dynamid", "DynamID authentication"},
+        PortRecord{9005, "tcp", "golem", "Golem Inter-System RPC"},
+        PortRecord{9007, "tcp", "ogs-client", "Open Grid Services Client"},
+        PortRecord{9008, "tcp", "ogs-server", "Open Grid Services Server"},
+        PortRecord{9009, "tcp", "pichat", "Pichat Server"},
+        PortRecord{9010, "tcp", "sdr", "Secure Data Replicator Protocol"},
+        PortRecord{9011, "tcp", "d-star", "D-Star Routing digital voice+data for amateur radio"},
+        PortRecord{9020, "tcp", "tambora", "tambora"},
+        PortRecord{9021, "tcp", "panagolin-ident", "Pangolin Identification"},
+        PortRecord{9022, "tcp", "paragent", "PrivateArk Remote Agent"},
+        PortRecord{9023, "tcp", "swa-1", "Secure Web Access - 1"},
+        PortRecord{9024, "tcp", "swa-2", "Secure Web Access - 2"},
+        PortRecord{9025, "tcp", "swa-3", "Secure Web Access - 3"},
+        PortRecord{9026, "tcp", "swa-4", "Secure Web Access - 4"},
+        PortRecord{9040, "tcp", "tor-trans", "Tor Transport (www.torproject.org)"},
+        PortRecord{9050, "tcp", "tor-socks", "tor-socks"},
+        PortRecord{9051, "tcp", "tor-control", "tor-control"},
+        PortRecord{9060, "tcp", "CardWeb-IO", "CardWeb-IO"},
+        PortRecord{9080, "tcp", "glrpc", "Groove GLRPC"},
+        PortRecord{9081, "tcp", "cisco-aqos", "Required for Adaptive Quality of Service"},
+        PortRecord{9083, "tcp", "emc-pp-mgmtsvc", "EMC PowerPath Mgmt Service"},
+        PortRecord{9084, "tcp", "aurora", "IBM AURORA Performance Visualizer"},
+        PortRecord{9085, "tcp", "ibm-rsyscon", "IBM Remote System Console"},
+        PortRecord{9086, "tcp", "net2display", "Vesa Net2Display"},
+        PortRecord{9087, "tcp", "classic", "Classic Data Server"},
+        PortRecord{9088, "tcp", "sqlexec", "IBM Informix SQL Interface"},
+        PortRecord{9089, "tcp", "sqlexec-ssl", "IBM Informix SQL Interface - Encrypted"},
+        PortRecord{9090, "tcp", "zeus-admin", "zeus-admin"},
+        PortRecord{9091, "tcp", "xmltec-xmlmail", "xmltec-xmlmail"},
+        PortRecord{9092, "tcp", "XmlIpcRegSvc", "Xml-Ipc Server Reg"},
+        PortRecord{9093, "tcp", "copycat", "Copycat database replication service"},
+        PortRecord{9100, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9101, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9102, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9103, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9104, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9105, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9106, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9107, "tcp", "jetdirect", "jetdirect"},
+        PortRecord{9111, "tcp", "DragonIDSConsole", "DragonIDSConsole"},
+        PortRecord{9119, "tcp", "mxit", "MXit Instant Messaging"},
+        PortRecord{9122, "tcp", "grcmp", "Global Relay compliant mobile instant messaging protocol"},
+        PortRecord{9123, "tcp", "grcp", "Global Relay compliant instant messaging protocol"},
+        PortRecord{9131, "tcp", "dddp", "Dynamic Device Discovery"},
+        PortRecord{9152, "tcp", "ms-sql2000", "ms-sql2000"},
+        PortRecord{9160, "tcp", "apani1", "apani1"},
+        PortRecord{9161, "tcp", "apani2", "apani2"},
+        PortRecord{9162, "tcp", "apani3", "apani3"},
+        PortRecord{9163, "tcp", "apani4", "apani4"},
+        PortRecord{9164, "tcp", "apani5", "apani5"},
+        PortRecord{9191, "tcp", "sun-as-jpda", "Sun AppSvr JPDA"},
+        PortRecord{9200, "tcp", "wap-wsp", "wap-wsp"},
+        PortRecord{9201, "tcp", "wap-wsp-wtp", "WAP session service"},
+        PortRecord{9202, "tcp", "wap-wsp-s", "WAP secure connectionless session service"},
+        PortRecord{9203, "tcp", "wap-wsp-wtp-s", "WAP secure session service"},
+        PortRecord{9204, "tcp", "wap-vcard", "WAP vCard"},
+        PortRecord{9205, "tcp", "wap-vcal", "WAP vCal"},
+        PortRecord{9206, "tcp", "wap-vcard-s", "WAP vCard Secure"},
+        PortRecord{9207, "tcp", "wap-vcal-s", "WAP vCal Secure"},
+        PortRecord{9208, "tcp", "rjcdb-vcards", "rjcdb vCard"},
+        PortRecord{9209, "tcp", "almobile-system", "ALMobile System Service"},
+        PortRecord{9210, "tcp", "oma-mlp", "OMA Mobile Location Protocol"},
+        PortRecord{9211, "tcp", "oma-mlp-s", "OMA Mobile Location Protocol Secure"},
+        PortRecord{9212, "tcp", "serverviewdbms", "serverviewdbms"},
+        PortRecord{9213, "tcp", "serverstart", "serverstart"},
+        PortRecord{9214, "tcp", "ipdcesgbs", "IPDC ESG BootstrapService"},
+        PortRecord{9215, "tcp", "insis", "Integrated Setup and Install Service"},
+        PortRecord{9216, "tcp", "acme", "Aionex Communication Management Engine"},
+        PortRecord{9217, "tcp", "fsc-port", "FSC Communication Port"},
+        PortRecord{9222, "tcp", "teamcoherence", "QSC Team Coherence"},
+        PortRecord{9255, "tcp", "mon", "Manager On Network"},
+        PortRecord{9277, "tcp", "traingpsdata", "GPS Data transmitted from train to ground network"},
+        PortRecord{9278, "tcp", "pegasus", "Pegasus GPS Platform"},
+        PortRecord{9279, "tcp", "pegasus-ctl", "Pegaus GPS System Control Interface"},
+        PortRecord{9280, "tcp", "pgps", "Predicted GPS"},
+        PortRecord{9281, "tcp", "swtp-port1", "SofaWare transport port 1"},
+        PortRecord{9282, "tcp", "swtp-port2", "SofaWare transport port 2"},
+        PortRecord{9283, "tcp", "callwaveiam", "callwaveiam"},
+        PortRecord{9284, "tcp", "visd", "VERITAS Information Serve"},
+        PortRecord{9285, "tcp", "n2h2server", "N2H2 Filter Service Port"},
+        PortRecord{9286, "tcp", "n2receive", "n2 monitoring receiver"},
+        PortRecord{9287, "tcp", "cumulus", "cumulus"},
+        PortRecord{9292, "tcp", "armtechdaemon", "ArmTech Daemon"},
+        PortRecord{9293, "tcp", "storview", "StorView Client"},
+        PortRecord{9294, "tcp", "armcenterhttp", "ARMCenter http Service"},
+        PortRecord{9295, "tcp", "armcenterhttps", "ARMCenter https Service"},
+        PortRecord{9300, "tcp", "vrace", "Virtual Racing Service"},
+        PortRecord{9306, "tcp", "sphinxql", "Sphinx search server (MySQL listener)"},
+        PortRecord{9310, "tcp", "sapms", "SAP Message Server"},
+        PortRecord{9312, "tcp", "sphinxapi", "Sphinx search server"},
+        PortRecord{9318, "tcp", "secure-ts", "PKIX TimeStamp over TLS"},
+        PortRecord{9321, "tcp", "guibase", "guibase"},
+        PortRecord{9333, "tcp", "litecoin", "Litecoin crypto currency"},
+        PortRecord{9339, "tcp", "gnmi-gnoi", "gRPC Network Mgmt/Operations Interface"},
+        PortRecord{9343, "tcp", "mpidcmgr", "mpidcmgr"},
+        PortRecord{9344, "tcp", "mphlpdmc", "mphlpdmc"},
+        PortRecord{9345, "tcp", "rancher", "Rancher Agent"},
+        PortRecord{9346, "tcp", "ctechlicensing", "C Tech Licensing"},
+        PortRecord{9374, "tcp", "fjdmimgr", "fjdmimgr"},
+        PortRecord{9380, "tcp", "boxp", "Brivs! Open Extensible Protocol"},
+        PortRecord{9387, "tcp", "d2dconfig", "D2D Configuration Service"},
+        PortRecord{9388, "tcp", "d2ddatatrans", "D2D Data Transfer Service"},
+        PortRecord{9389, "tcp", "adws", "Active Directory Web Services"},
+        PortRecord{9390, "tcp", "otp", "OpenVAS Transfer Protocol"},
+        PortRecord{9396, "tcp", "fjinvmgr", "fjinvmgr"},
+        PortRecord{9397, "tcp", "mpidcagt", "mpidcagt"},
+        PortRecord{9400, "tcp", "sec-t4net-srv", "Samsung Twain for Network Server"},
+        PortRecord{9401, "tcp", "sec-t4net-clt", "Samsung Twain for Network Client"},
+        PortRecord{9402, "tcp", "sec-pc2fax-srv", "Samsung PC2FAX for Network Server"},
+        PortRecord{9418, "tcp", "git", "git"},
+        PortRecord{9443, "tcp", "tungsten-https", "WSO2 Tungsten HTTPS"},
+        PortRecord{9444, "tcp", "wso2esb-console", "WSO2 ESB Administration Console HTTPS"},
+        PortRecord{9445, "tcp", "mindarray-ca", "MindArray Systems Console Agent"},
+        PortRecord{9450, "tcp", "sntlkeyssrvr", "Sentinel Keys Server"},
+        PortRecord{9500, "tcp", "ismserver", "ismserver"},
+        PortRecord{9522, "tcp", "sma-spw", "SMA Speedwire"},
+        PortRecord{9535, "tcp", "man", "man"},
+        PortRecord{9536, "tcp", "laes-bf", "Surveillance buffering function"},
+        PortRecord{9555, "tcp", "trispen-sra", "Trispen Secure Remote Access"},
+        PortRecord{9592, "tcp", "ldgateway", "LANDesk Gateway"},
+        PortRecord{9593, "tcp", "cba8", "LANDesk Management Agent (cba8)"},
+        PortRecord{9594, "tcp", "msgsys", "Message System"},
+        PortRecord{9595, "tcp", "pds", "pds"},
+        PortRecord{9596, "tcp", "mercury-disc", "Mercury Discovery"},
+        PortRecord{9597, "tcp", "pd-admin", "PD Administration"},
+        PortRecord{9598, "tcp", "vscp", "Very Simple Ctrl Protocol"},
+        PortRecord{9599, "tcp", "robix", "robix"},
+        PortRecord{9600, "tcp", "micromuse-ncpw", "micromuse-ncpw"},
+        PortRecord{9612, "tcp", "streamcomm-ds", "StreamComm User Directory"},
+        PortRecord{9614, "tcp", "iadt-tls", "iADT Protocol over TLS"},
+        PortRecord{9616, "tcp", "erunbook_agent", "erunbook_agent"},
+        PortRecord{9617, "tcp", "erunbook_server", "erunbook_server"},
+        PortRecord{9618, "tcp", "condor", "Condor Collector Service"},
+        PortRecord{9628, "tcp", "odbcpathway", "ODBC Pathway Service"},
+        PortRecord{9629, "tcp", "uniport", "UniPort SSO Controller"},
+        PortRecord{9630, "tcp", "peoctlr", "Peovica Controller"},
+        PortRecord{9631, "tcp", "peocoll", "Peovica Collector"},
+        PortRecord{9632, "tcp", "mc-comm", "Mobile-C Communications"},
+        PortRecord{9640, "tcp", "pqsflows", "ProQueSys Flows Service"},
+        PortRecord{9666, "tcp", "zoomcp", "Zoom Control Panel Game Server Management"},
+        PortRecord{9667, "tcp", "xmms2", "Cross-platform Music Multiplexing System"},
+        PortRecord{9668, "tcp", "tec5-sdctp", "tec5 Spectral Device Control Protocol"},
+        PortRecord{9694, "tcp", "client-wakeup", "T-Mobile Client Wakeup Message"},
+        PortRecord{9695, "tcp", "ccnx", "Content Centric Networking"},
+        PortRecord{9700, "tcp", "board-roar", "Board M.I.T. Service"},
+        PortRecord{9747, "tcp", "l5nas-parchan", "L5NAS Parallel Channel"},
+        PortRecord{9750, "tcp", "board-voip", "Board M.I.T. Synchronous Collaboration"},
+        PortRecord{9753, "tcp", "rasadv", "rasadv"},
+        PortRecord{9762, "tcp", "tungsten-http", "WSO2 Tungsten HTTP"},
+        PortRecord{9800, "tcp", "davsrc", "WebDav Source Port"},
+        PortRecord{9801, "tcp", "sstp-2", "Sakura Script Transfer Protocol-2"},
+        PortRecord{9802, "tcp", "davsrcs", "WebDAV Source TLS/SSL"},
+        PortRecord{9875, "tcp", "sapv1", "Session Announcement v1"},
+        PortRecord{9876, "tcp", "sd", "Session Director"},
+        PortRecord{9877, "tcp", "x510", "The X.510 wrapper protocol"},
+        PortRecord{9878, "tcp", "kca-service", "The KX509 Kerberized Certificate Issuance Protocol in Use in 2012"},
+        PortRecord{9888, "tcp", "cyborg-systems", "CYBORG Systems"},
+        PortRecord{9889, "tcp", "gt-proxy", "Port for Cable network related data proxy or repeater"},
+        PortRecord{9898, "tcp", "monkeycom", "monkeycom"},
+        PortRecord{9899, "tcp", "sctp-tunneling", "SCTP TUNNELING"},
+        PortRecord{9900, "tcp", "iua", "IUA"},
+        PortRecord{9903, "tcp", "multicast-ping", "Multicast Ping Protocol"},
+        PortRecord{9909, "tcp", "domaintime", "domaintime"},
+        PortRecord{9911, "tcp", "sype-transport", "SYPECom Transport Protocol"},
+        PortRecord{9925, "tcp", "xybrid-cloud", "XYBRID Cloud"},
+        PortRecord{9929, "tcp", "nping-echo", "Nping echo server mode"},
+        PortRecord{9950, "tcp", "apc-9950", "APC 9950"},
+        PortRecord{9951, "tcp", "apc-9951", "APC 9951"},
+        PortRecord{9952, "tcp", "apc-9952", "APC 9952"},
+        PortRecord{9953, "tcp", "acis", "9953"},
+        PortRecord{9954, "tcp", "hinp", "HaloteC Instrument Network Protocol"},
+        PortRecord{9955, "tcp", "alljoyn-stm", "alljoyn-stm"},
+        PortRecord{9956, "tcp", "alljoyn", "Alljoyn Name Service"},
+        PortRecord{9966, "tcp", "odnsp", "OKI Data Network Setting Protocol"},
+        PortRecord{9978, "tcp", "xybrid-rt", "XYBRID RT Server"},
+        PortRecord{9979, "tcp", "visweather", "Valley Information Systems Weather station data"},
+        PortRecord{9981, "tcp", "pumpkindb", "Event sourcing database engine with a built-in programming language"},
+        PortRecord{9987, "tcp", "dsm-scm-target", "DSM/SCM Target Interface"},
+        PortRecord{9988, "tcp", "nsesrvr", "Software Essentials Secure HTTP server"},
+        PortRecord{9990, "tcp", "osm-appsrvr", "OSM Applet Server"},
+        PortRecord{9991, "tcp", "issa", "issa"},
+        PortRecord{9992, "tcp", "issc", "issc"},
+        PortRecord{9993, "tcp", "palace-2", "OnLive-2"},
+        PortRecord{9994, "tcp", "palace-3", "OnLive-3"},
+        PortRecord{9995, "tcp", "palace-4", "palace-4"},
+        PortRecord{9996, "tcp", "palace-5", "palace-5"},
+        PortRecord{9997, "tcp", "palace-6", "palace-6"},
+        PortRecord{9998, "tcp", "distinct32", "distinct32"},
+        PortRecord{9999, "tcp", "abyss", "abyss"},
+        PortRecord{10000, "tcp", "snet-sensor-mgmt", "snet-sensor-mgmt"},
+        PortRecord{10001, "tcp", "scp-config", "SCP Configuration"},
+        PortRecord{10002, "tcp", "documentum", "EMC-Documentum Content Server Product"},
+        PortRecord{10003, "tcp", "documentum_s", "documentum_s"},
+        PortRecord{10004, "tcp", "emcrmirccd", "EMC Replication Manager Client"},
+        PortRecord{10005, "tcp", "stel", "stel"},
+        PortRecord{10006, "tcp", "netapp-sync", "Sync replication protocol among different NetApp platforms"},
+        PortRecord{10007, "tcp", "mvs-capacity", "MVS Capacity"},
+        PortRecord{10008, "tcp", "octopus", "Octopus Multiplexer"},
+        PortRecord{10009, "tcp", "swdtp-sv", "Systemwalker Desktop Patrol"},
+        PortRecord{10010, "tcp", "rxapi", "ooRexx rxapi services"},
+        PortRecord{10020, "tcp", "abb-hw", "Hardware configuration and maintenance"},
+        PortRecord{10023, "tcp", "cefd-vmp", "Comtech EF-Data's Vipersat Management Protocol"},
+        PortRecord{10050, "tcp", "zabbix-agent", "Zabbix Agent"},
+        PortRecord{10051, "tcp", "zabbix-trapper", "Zabbix Trapper"},
+        PortRecord{10055, "tcp", "qptlmd", "Quantapoint FLEXlm Licensing Service"},
+        PortRecord{10080, "tcp", "amanda", "amanda"},
+        PortRecord{10081, "tcp", "famdc", "FAM Archive Server"},
+        PortRecord{10082, "tcp", "amandaidx", "Amanda indexing"},
+        PortRecord{10083, "tcp", "amidxtape", "Amanda tape indexing"},
+        PortRecord{10100, "tcp", "itap-ddtp", "VERITAS ITAP DDTP"},
+        PortRecord{10101, "tcp", "ezmeeting-2", "eZmeeting"},
+        PortRecord{10102, "tcp", "ezproxy-2", "eZproxy"},
+        PortRecord{10103, "tcp", "ezrelay", "ezrelay"},
+        PortRecord{10104, "tcp", "swdtp", "Systemwalker Desktop Patrol"},
+        PortRecord{10107, "tcp", "bctp-server", "VERITAS BCTP server"},
+        PortRecord{10110, "tcp", "nmea-0183", "NMEA-0183 Navigational Data"},
+        PortRecord{10111, "tcp", "nmea-onenet", "NMEA OneNet multicast messaging"},
+        PortRecord{10113, "tcp", "netiq-endpoint", "NetIQ Endpoint"},
+        PortRecord{10114, "tcp", "netiq-qcheck", "NetIQ Qcheck"},
+        PortRecord{10115, "tcp", "netiq-endpt", "NetIQ Endpoint"},
+        PortRecord{10116, "tcp", "netiq-voipa", "NetIQ VoIP Assessor"},
+        PortRecord{10117, "tcp", "iqrm", "NetIQ IQCResource Managament Svc"},
+        PortRecord{10125, "tcp", "cimple", "HotLink CIMple REST API"},
+        PortRecord{10128, "tcp", "bmc-perf-sd", "BMC-PERFORM-SERVICE DAEMON"},
+        PortRecord{10129, "tcp", "bmc-gms", "BMC General Manager Server"},
+        PortRecord{10160, "tcp", "qb-db-server", "QB Database Server"},
+        PortRecord{10161, "tcp", "snmptls", "snmptls"},
+        PortRecord{10162, "tcp", "snmptls-trap", "snmptls-trap"},
+        PortRecord{10200, "tcp", "trisoap", "Trigence AE Soap Service"},
+        PortRecord{10201, "tcp", "rsms", "rsms"},
+        PortRecord{10252, "tcp", "apollo-relay", "Apollo Relay Port"},
+        PortRecord{10253, "tcp", "eapol-relay", "Relay of EAPOL frames"},
+        PortRecord{10260, "tcp", "axis-wimp-port", "Axis WIMP Port"},
+        PortRecord{10261, "tcp", "tile-ml", "Tile remote machine learning"},
+        PortRecord{10288, "tcp", "blocks", "blocks"},
+        PortRecord{10321, "tcp", "cosir", "Computer Op System Information Report"},
+        PortRecord{10439, "tcp", "bngsync", "BalanceNG session table synchronization protocol"},
+        PortRecord{10443, "tcp", "cirrossp", "CirrosSP Workstation Communication"},
+        PortRecord{10500, "tcp", "hip-nat-t", "HIP NAT-Traversal"},
+        PortRecord{10540, "tcp", "MOS-lower", "MOS Media Object Metadata Port"},
+        PortRecord{10541, "tcp", "MOS-upper", "MOS Running Order Port"},
+        PortRecord{10542, "tcp", "MOS-aux", "MOS Low Priority Port"},
+        PortRecord{10543, "tcp", "MOS-soap", "MOS SOAP Default Port"},
+        PortRecord{10544, "tcp", "MOS-soap-opt", "MOS SOAP Optional Port"},
+        PortRecord{10548, "tcp", "serverdocs", "Apple Document Sharing Service"},
+        PortRecord{10631, "tcp", "printopia", "Printopia Serve"},
+        PortRecord{10800, "tcp", "gap", "Gestor de Acaparamiento para Pocket PCs"},
+        PortRecord{10805, "tcp", "lpdg", "LUCIA Pareja Data Group"},
+        PortRecord{10809, "tcp", "nbd", "Linux Network Block Device"},
+        PortRecord{10810, "tcp", "nmc-disc", "Nuance Mobile Care Discovery"},
+        PortRecord{10860, "tcp", "helix", "Helix Client/Server"},
+        PortRecord{10880, "tcp", "bveapi", "BVEssentials HTTP API"},
+        PortRecord{10933, "tcp", "octopustentacle", "Listen port used by the Octopus Deploy Tentacle deployment agent"},
+        PortRecord{10990, "tcp", "rmiaux", "Auxiliary RMI Port"},
+        PortRecord{11000, "tcp", "irisa", "irisa"},
+        PortRecord{11001, "tcp", "metasys", "metasys"},
+        PortRecord{11095, "tcp", "weave", "Nest device-to-device and device-to-service application protocol"},
+        PortRecord{11103, "tcp", "origo-sync", "OrigoDB Server Sync Interface"},
+        PortRecord{11104, "tcp", "netapp-icmgmt", "NetApp Intercluster Management"},
+        PortRecord{11105, "tcp", "netapp-icdata", "NetApp Intercluster Data"},
+        PortRecord{11106, "tcp", "sgi-lk", "SGI LK Licensing service"},
+        PortRecord{11108, "tcp", "myq-termlink", "Hardware Terminals Discovery and Low-Level Communication Protocol"},
+        PortRecord{11109, "tcp", "sgi-dmfmgr", "Data migration facility Manager (DMF) is a browser based interface to DMF"},
+        PortRecord{11110, "tcp", "sgi-soap", "Data migration facility (DMF) SOAP is a web server protocol to support remote access to DMF"},
+        PortRecord{11111, "tcp", "vce", "Viral Computing Environment (VCE)"},
+        PortRecord{11112, "tcp", "dicom", "dicom"},
+        PortRecord{11161, "tcp", "suncacao-snmp", "sun cacao snmp access point"},
+        PortRecord{11162, "tcp", "suncacao-jmxmp", "sun cacao JMX-remoting access point"},
+        PortRecord{11163, "tcp", "suncacao-rmi", "sun cacao rmi registry access point"},
+        PortRecord{11164, "tcp", "suncacao-csa", "sun cacao command-streaming access point"},
+        PortRecord{11165, "tcp", "suncacao-websvc", "sun cacao web service access point"},
+        PortRecord{11171, "tcp", "snss", "Surgical Notes Security Service Discovery (SNSS)"},
+        PortRecord{11172, "tcp", "oemcacao-jmxmp", "OEM cacao JMX-remoting access point"},
+        PortRecord{11173, "tcp", "t5-straton", "Straton Runtime Programing"},
+        PortRecord{11174, "tcp", "oemcacao-rmi", "OEM cacao rmi registry access point"},
+        PortRecord{11175, "tcp", "oemcacao-websvc", "OEM cacao web service access point"},
+        PortRecord{11201, "tcp", "smsqp", "smsqp"},
+        PortRecord{11202, "tcp", "dcsl-backup", "DCSL Network Backup Services"},
+        PortRecord{11208, "tcp", "wifree", "WiFree Service"},
+        PortRecord{11211, "tcp", "memcache", "Memory cache service"},
+        PortRecord{11319, "tcp", "imip", "imip"},
+        PortRecord{11320, "tcp", "imip-channels", "IMIP Channels Port"},
+        PortRecord{11321, "tcp", "arena-server", "Arena Server Listen"},
+        PortRecord{11367, "tcp", "atm-uhas", "ATM UHAS"},
+        PortRecord{11371, "tcp", "pksd", "pksd"},
+        PortRecord{11430, "tcp", "lsdp", "Lenbrook Service Discovery Protocol"},
+        PortRecord{11489, "tcp", "asgcypresstcps", "ASG Cypress Secure Only"},
+        PortRecord{11600, "tcp", "tempest-port", "Tempest Protocol Port"},
+        PortRecord{11623, "tcp", "emc-xsw-dconfig", "EMC XtremSW distributed config"},
+        PortRecord{11720, "tcp", "h323callsigalt", "h323callsigalt"},
+        PortRecord{11723, "tcp", "emc-xsw-dcache", "EMC XtremSW distributed cache"},
+        PortRecord{11751, "tcp", "intrepid-ssl", "Intrepid SSL"},
+        PortRecord{11796, "tcp", "lanschool", "lanschool"},
+        PortRecord{11876, "tcp", "xoraya", "X2E Xoraya Multichannel protocol"},
+        PortRecord{11877, "tcp", "x2e-disc", "X2E service discovery protocol"},
+        PortRecord{11967, "tcp", "sysinfo-sp", "sysinfo-sp"},
+        PortRecord{11971, "tcp", "tibsd", "TiBS Service"},
+        PortRecord{12000, "tcp", "cce4x", "cce4x"},
+        PortRecord{12001, "tcp", "entextnetwk", "IBM Enterprise Extender SNA COS Network Priority"},
+        PortRecord{12002, "tcp", "entexthigh", "IBM Enterprise Extender SNA COS High Priority"},
+        PortRecord{12003, "tcp", "entextmed", "IBM Enterprise Extender SNA COS Medium Priority"},
+        PortRecord{12004, "tcp", "entextlow", "IBM Enterprise Extender SNA COS Low Priority"},
+        PortRecord{12005, "tcp", "dbisamserver1", "DBISAM Database Server - Regular"},
+        PortRecord{12006, "tcp", "dbisamserver2", "DBISAM Database Server - Admin"},
+        PortRecord{12007, "tcp", "accuracer", "accuracer"},
+        PortRecord{12008, "tcp", "accuracer-dbms", "accuracer-dbms"},
+        PortRecord{12009, "tcp", "ghvpn", "Green Hills VPN"},
+        PortRecord{12010, "tcp", "edbsrvr", "ElevateDB Server"},
+        PortRecord{12012, "tcp", "vipera", "Vipera Messaging Service"},
+        PortRecord{12013, "tcp", "vipera-ssl", "Vipera Messaging Service over SSL Communication"},
+        PortRecord{12109, "tcp", "rets-ssl", "RETS over SSL"},
+        PortRecord{12121, "tcp", "nupaper-ss", "NuPaper Session Service"},
+        PortRecord{12168, "tcp", "cawas", "CA Web Access Service"},
+        PortRecord{12172, "tcp", "hivep", "hivep"},
+        PortRecord{12300, "tcp", "linogridengine", "LinoGrid Engine"},
+        PortRecord{12302, "tcp", "rads", "Remote Administration Daemon (RAD)"},
+        PortRecord{12321, "tcp", "warehouse-sss", "Warehouse Monitoring Syst SSS"},
+        PortRecord{12322, "tcp", "warehouse", "Warehouse Monitoring Syst"},
+        PortRecord{12345, "tcp", "netbus", "netbus"},
+        PortRecord{12346, "tcp", "netbus", "NetBus backdoor trojan"},
+        PortRecord{12753, "tcp", "tsaf", "tsaf port"},
+        PortRecord{12865, "tcp", "netperf", "control port for the netperf benchmark"},
+        PortRecord{13160, "tcp", "i-zipqd", "i-zipqd"},
+        PortRecord{13216, "tcp", "bcslogc", "Black Crow Software application logging"},
+        PortRecord{13217, "tcp", "rs-pias", "R&S Proxy Installation Assistant Service"},
+        PortRecord{13218, "tcp", "emc-vcas-tcp", "emc-vcas-tcp"},
+        PortRecord{13223, "tcp", "powwow-client", "PowWow Client"},
+        PortRecord{13224, "tcp", "powwow-server", "PowWow Server"},
+        PortRecord{13400, "tcp", "doip-data", "doip-data"},
+        PortRecord{13701, "tcp", "netbackup", "vmd server"},
+        PortRecord{13702, "tcp", "netbackup", "ascd server"},
+        PortRecord{13705, "tcp", "netbackup", "tl8cd server"},
+        PortRecord{13706, "tcp", "netbackup", "odld server"},
+        PortRecord{13708, "tcp", "netbackup", "vtlcd server"},
+        PortRecord{13709, "tcp", "netbackup", "ts8d server"},
+        PortRecord{13710, "tcp", "netbackup", "tc8d server"},
+        PortRecord{13711, "tcp", "netbackup", "server"},
+        PortRecord{13712, "tcp", "netbackup", "tc4d server"},
+        PortRecord{13713, "tcp", "netbackup", "tl4d server"},
+        PortRecord{13714, "tcp", "netbackup", "tsdd server"},
+        PortRecord{13715, "tcp", "netbackup", "tshd server"},
+        PortRecord{13716, "tcp", "netbackup", "tlmd server"},
+        PortRecord{13717, "tcp", "netbackup", "tlhcd server"},
+        PortRecord{13718, "tcp", "netbackup", "lmfcd server"},
+        PortRecord{13720, "tcp", "netbackup", "netbackup"},
+        PortRecord{13721, "tcp", "netbackup", "netbackup"},
+        PortRecord{13722, "tcp", "netbackup", "netbackup"},
+        PortRecord{13724, "tcp", "vnetd", "Veritas Network Utility"},
+        PortRecord{13782, "tcp", "netbackup", "netbackup"},
+        PortRecord{13783, "tcp", "netbackup", "netbackup"},
+        PortRecord{13785, "tcp", "nbdb", "NetBackup Database"},
+        PortRecord{13786, "tcp", "nomdb", "Veritas-nomdb"},
+        PortRecord{13818, "tcp", "dsmcc-config", "DSMCC Config"},
+        PortRecord{13819, "tcp", "dsmcc-session", "DSMCC Session Messages"},
+        PortRecord{13820, "tcp", "dsmcc-passthru", "DSMCC Pass-Thru Messages"},
+        PortRecord{13821, "tcp", "dsmcc-download", "DSMCC Download Protocol"},
+        PortRecord{13822, "tcp", "dsmcc-ccp", "DSMCC Channel Change Protocol"},
+        PortRecord{13823, "tcp", "bmdss", "Blackmagic Design Streaming Server"},
+        PortRecord{13882, "tcp", "vunknown", "vunknown"},
+        PortRecord{13894, "tcp", "ucontrol", "Ultimate Control communication protocol"},
+        PortRecord{13929, "tcp", "dta-systems", "D-TA SYSTEMS"},
+        PortRecord{13930, "tcp", "medevolve", "MedEvolve Port Requester"},
+        PortRecord{14000, "tcp", "scotty-ft", "SCOTTY High-Speed Filetransfer"},
+        PortRecord{14001, "tcp", "sua", "SUA"},
+        PortRecord{14002, "tcp", "scotty-disc", "Discovery of a SCOTTY hardware codec board"},
+        PortRecord{14033, "tcp", "sage-best-com1", "sage Best! Config Server 1"},
+        PortRecord{14034, "tcp", "sage-best-com2", "sage Best! Config Server 2"},
+        PortRecord{14141, "tcp", "bo2k", "bo2k"},
+        PortRecord{14142, "tcp", "icpp", "IceWall Cert Protocol"},
+        PortRecord{14143, "tcp", "icpps", "IceWall Cert Protocol over TLS"},
+        PortRecord{14145, "tcp", "gcm-app", "GCM Application"},
+        PortRecord{14149, "tcp", "vrts-tdd", "Veritas Traffic Director"},
+        PortRecord{14150, "tcp", "vcscmd", "Veritas Cluster Server Command Server"},
+        PortRecord{14154, "tcp", "vad", "Veritas Application Director"},
+        PortRecord{14250, "tcp", "cps", "Fencing Server"},
+        PortRecord{14414, "tcp", "ca-web-update", "CA eTrust Web Update Service"},
+        PortRecord{14500, "tcp", "xpra", "xpra network protocol"},
+        PortRecord{14936, "tcp", "hde-lcesrvr-1", "hde-lcesrvr-1"},
+        PortRecord{14937, "tcp", "hde-lcesrvr-2", "hde-lcesrvr-2"},
+        PortRecord{15000, "tcp", "hydap", "hydap"},
+        PortRecord{15002, "tcp", "onep-tls", "Open Network Environment TLS"},
+        PortRecord{15118, "tcp", "v2g-secc", "v2g Supply Equipment Communication Controller Discovery Protocol"},
+        PortRecord{15126, "tcp", "swgps", "Nortel Java S/WGPS Global Payment Solutions for US credit card authorizations"},
+        PortRecord{15151, "tcp", "bo2k", "Back Orifice 2K BoPeep video output"},
+        PortRecord{15345, "tcp", "xpilot", "XPilot Contact Port"},
+        PortRecord{15363, "tcp", "3link", "3Link Negotiation"},
+        PortRecord{15555, "tcp", "cisco-snat", "Cisco Stateful NAT"},
+        PortRecord{15660, "tcp", "bex-xr", "Backup Express Restore Server"},
+        PortRecord{15740, "tcp", "ptp", "Picture Transfer Protocol"},
+        PortRecord{15998, "tcp", "2ping", "2ping Bi-Directional Ping Service"},
+        PortRecord{15999, "tcp", "programmar", "ProGrammar Enterprise"},
+        PortRecord{16000, "tcp", "fmsas", "Administration Server Access"},
+        PortRecord{16001, "tcp", "fmsascon", "Administration Server Connector"},
+        PortRecord{16002, "tcp", "gsms", "GoodSync Mediation Service"},
+        PortRecord{16003, "tcp", "alfin", "Automation and Control by REGULACE.ORG"},
+        PortRecord{16020, "tcp", "jwpc", "Filemaker Java Web Publishing Core"},
+        PortRecord{16021, "tcp", "jwpc-bin", "Filemaker Java Web Publishing Core Binary"},
+        PortRecord{16080, "tcp", "osxwebadmin", "Apple OS X WebAdmin"},
+        PortRecord{16161, "tcp", "sun-sea-port", "Solaris SEA Port"},
+        PortRecord{16162, "tcp", "solaris-audit", "Solaris Audit - secure remote audit log"},
+        PortRecord{16309, "tcp", "etb4j", "etb4j"},
+        PortRecord{16310, "tcp", "pduncs", "Policy Distribute Update Notification"},
+        PortRecord{16311, "tcp", "pdefmns", "Policy definition and update management"},
+        PortRecord{16360, "tcp", "netserialext1", "Network Serial Extension Ports One"},
+        PortRecord{16361, "tcp", "netserialext2", "Network Serial Extension Ports Two"},
+        PortRecord{16367, "tcp", "netserialext3", "Network Serial Extension Ports Three"},
+        PortRecord{16368, "tcp", "netserialext4", "Network Serial Extension Ports Four"},
+        PortRecord{16384, "tcp", "connected", "Connected Corp"},
+        PortRecord{16385, "tcp", "rdgs", "Reliable Datagram Sockets"},
+        PortRecord{16444, "tcp", "overnet", "Overnet file sharing"},
+        PortRecord{16619, "tcp", "xoms", "X509 Objects Management Service"},
+        PortRecord{16665, "tcp", "axon-tunnel", "Reliable multipath data transport for high latencies"},
+        PortRecord{16666, "tcp", "vtp", "Vidder Tunnel Protocol"},
+        PortRecord{16789, "tcp", "cadsisvr", "This server provides callable services to mainframe External Security Managers from any TCP/IP platform"},
+        PortRecord{16900, "tcp", "newbay-snc-mc", "Newbay Mobile Client Update Service"},
+        PortRecord{16950, "tcp", "sgcip", "Simple Generic Client Interface Protocol"},
+        PortRecord{16959, "tcp", "subseven", "Subseven trojan"},
+        PortRecord{16991, "tcp", "intel-rci-mp", "intel-rci-mp"},
+        PortRecord{16992, "tcp", "amt-soap-http", "Intel(R) AMT SOAP/HTTP"},
+        PortRecord{16993, "tcp", "amt-soap-https", "Intel(R) AMT SOAP/HTTPS"},
+        PortRecord{16994, "tcp", "amt-redir-tcp", "Intel(R) AMT Redirection/TCP"},
+        PortRecord{16995, "tcp", "amt-redir-tls", "Intel(R) AMT Redirection/TLS"},
+        PortRecord{17007, "tcp", "isode-dua", "isode-dua"},
+        PortRecord{17184, "tcp", "vestasdlp", "Vestas Data Layer Protocol"},
+        PortRecord{17185, "tcp", "soundsvirtual", "Sounds Virtual"},
+        PortRecord{17219, "tcp", "chipper", "chipper"},
+        PortRecord{17220, "tcp", "avtp", "IEEE 1722 Transport Protocol for Time Sensitive Applications"},
+        PortRecord{17221, "tcp", "avdecc", "IEEE 1722.1 AVB Discovery Enumeration/Connection management/Control"},
+        PortRecord{17222, "tcp", "cpsp", "Control Plane Synchronization Protocol (SPSP)"},
+        PortRecord{17223, "tcp", "isa100-gci", "ISA100 GCI is a service utilizing a common interface between an ISA100 Wireless gateway and a client application"},
+        PortRecord{17224, "tcp", "trdp-pd", "Train Realtime Data Protocol (TRDP) Process Data"},
+        PortRecord{17225, "tcp", "trdp-md", "Train Realtime Data Protocol (TRDP) Message Data"},
+        PortRecord{17234, "tcp", "integrius-stp", "Integrius Secure Tunnel Protocol"},
+        PortRecord{17235, "tcp", "ssh-mgmt", "SSH Tectia Manager"},
+        PortRecord{17300, "tcp", "kuang2", "Kuang2 backdoor"},
+        PortRecord{17500, "tcp", "db-lsp", "db-lsp"},
+        PortRecord{17555, "tcp", "ailith", "Ailith management of routers"},
+        PortRecord{17729, "tcp", "ea", "Eclipse Aviation"},
+        PortRecord{17754, "tcp", "zep", "Encap. ZigBee Packets"},
+        PortRecord{17755, "tcp", "zigbee-ip", "ZigBee IP Transport Service"},
+        PortRecord{17756, "tcp", "zigbee-ips", "ZigBee IP Transport Secure Service"},
+        PortRecord{17777, "tcp", "sw-orion", "SolarWinds Orion"},
+        PortRecord{18000, "tcp", "biimenu", "Beckman Instruments Inc."},
+        PortRecord{18104, "tcp", "radpdf", "RAD PDF Service"},
+        PortRecord{18136, "tcp", "racf", "z/OS Resource Access Control Facility"},
+        PortRecord{18181, "tcp", "opsec-cvp", "opsec-cvp"},
+        PortRecord{18182, "tcp", "opsec-ufp", "opsec-ufp"},
+        PortRecord{18183, "tcp", "opsec-sam", "opsec-sam"},
+        PortRecord{18184, "tcp", "opsec-lea", "opsec-lea"},
+        PortRecord{18185, "tcp", "opsec-omi", "opsec-omi"},
+        PortRecord{18186, "tcp", "ohsc", "ohsc"},
+        PortRecord{18187, "tcp", "opsec-ela", "opsec-ela"},
+        PortRecord{18241, "tcp", "checkpoint-rtm", "Check Point RTM"},
+        PortRecord{18242, "tcp", "iclid", "Checkpoint router monitoring"},
+        PortRecord{18243, "tcp", "clusterxl", "Checkpoint router state backup"},
+        PortRecord{18262, "tcp", "gv-pf", "GV NetConfig Service"},
+        PortRecord{18333, "tcp", "bitcoin", "Bitcoin crypto currency"},
+        PortRecord{18463, "tcp", "ac-cluster", "AC Cluster"},
+        PortRecord{18516, "tcp", "heythings", "HeyThings Device communicate service"},
+        PortRecord{18634, "tcp", "rds-ib", "Reliable Datagram Service"},
+        PortRecord{18635, "tcp", "rds-ip", "Reliable Datagram Service over IP"},
+        PortRecord{18668, "tcp", "vdmmesh", "vdmmesh"},
+        PortRecord{18769, "tcp", "ique", "IQue Protocol"},
+        PortRecord{18881, "tcp", "infotos", "infotos"},
+        PortRecord{18888, "tcp", "apc-necmp", "APCNECMP"},
+        PortRecord{19000, "tcp", "igrid", "iGrid Server"},
+        PortRecord{19007, "tcp", "scintilla", "Scintilla protocol for device services"},
+        PortRecord{19020, "tcp", "j-link", "J-Link TCP/IP Protocol"},
+        PortRecord{19150, "tcp", "gkrellm", "GKrellM remote system activity meter daemon"},
+        PortRecord{19191, "tcp", "opsec-uaa", "OPSEC UAA"},
+        PortRecord{19194, "tcp", "ua-secureagent", "UserAuthority SecureAgent"},
+        PortRecord{19220, "tcp", "cora", "cora"},
+        PortRecord{19283, "tcp", "keysrvr", "Key Server for SASSAFRAS"},
+        PortRecord{19315, "tcp", "keyshadow", "Key Shadow for SASSAFRAS"},
+        PortRecord{19333, "tcp", "litecoin", "Litecoin crypto currency testnet"},
+        PortRecord{19398, "tcp", "mtrgtrans", "mtrgtrans"},
+        PortRecord{19410, "tcp", "hp-sco", "hp-sco"},
+        PortRecord{19411, "tcp", "hp-sca", "hp-sca"},
+        PortRecord{19412, "tcp", "hp-sessmon", "hp-sessmon"},
+        PortRecord{19539, "tcp", "fxuptp", "fxuptp"},
+        PortRecord{19540, "tcp", "sxuptp", "sxuptp"},
+        PortRecord{19541, "tcp", "jcp", "JCP Client"},
+        PortRecord{19788, "tcp", "mle", "Mesh Link Establishment"},
+        PortRecord{19998, "tcp", "iec-104-sec", "IEC 60870-5-104 process control - secure"},
+        PortRecord{19999, "tcp", "dnp-sec", "Distributed Network Protocol - Secure"},
+        PortRecord{20000, "tcp", "dnp", "dnp"},
+        PortRecord{20001, "tcp", "microsan", "microsan"},
+        PortRecord{20002, "tcp", "commtact-http", "Commtact HTTP"},
+        PortRecord{20003, "tcp", "commtact-https", "Commtact HTTPS"},
+        PortRecord{20005, "tcp", "btx", "btx"},
+        PortRecord{20012, "tcp", "ss-idi-disc", "Samsung Interdevice Interaction discovery"},
+        PortRecord{20013, "tcp", "ss-idi", "Samsung Interdevice Interaction"},
+        PortRecord{20014, "tcp", "opendeploy", "OpenDeploy Listener"},
+        PortRecord{20034, "tcp", "nburn_id", "nburn_id"},
+        PortRecord{20046, "tcp", "tmophl7mts", "TMOP HL7 Message Transfer Service"},
+        PortRecord{20048, "tcp", "mountd", "NFS mount protocol"},
+        PortRecord{20049, "tcp", "nfsrdma", "Network File System (NFS) over RDMA"},
+        PortRecord{20057, "tcp", "avesterra", "AvesTerra Hypergraph Transfer Protocol (HGTP)"},
+        PortRecord{20167, "tcp", "tolfab", "TOLfab Data Change"},
+        PortRecord{20202, "tcp", "ipdtp-port", "IPD Tunneling Port"},
+        PortRecord{20222, "tcp", "ipulse-ics", "ipulse-ics"},
+        PortRecord{20480, "tcp", "emwavemsg", "emWave Message Service"},
+        PortRecord{20670, "tcp", "track", "track"},
+        PortRecord{20999, "tcp", "athand-mmp", "athand-mmp"},
+        PortRecord{21000, "tcp", "irtrans", "IRTrans Control"},
+        PortRecord{21010, "tcp", "notezilla-lan", "Notezilla.Lan Server"},
+        PortRecord{21201, "tcp", "memcachedb", "memcachedb"},
+        PortRecord{21212, "tcp", "trinket-agent", "Distributed artificial intelligence"},
+        PortRecord{21213, "tcp", "cohesity-agent", "Cohesity backup agents"},
+        PortRecord{21221, "tcp", "aigairserver", "Services for Air Server"},
+        PortRecord{21553, "tcp", "rdm-tfs", "Raima RDM TFS"},
+        PortRecord{21554, "tcp", "dfserver", "MineScape Design File Server"},
+        PortRecord{21590, "tcp", "vofr-gateway", "VoFR Gateway"},
+        PortRecord{21800, "tcp", "tvpm", "TVNC Pro Multiplexing"},
+        PortRecord{21845, "tcp", "webphone", "webphone"},
+        PortRecord{21846, "tcp", "netspeak-is", "NetSpeak Corp. Directory Services"},
+        PortRecord{21847, "tcp", "netspeak-cs", "NetSpeak Corp. Connection Services"},
+        PortRecord{21848, "tcp", "netspeak-acd", "NetSpeak Corp. Automatic Call Distribution"},
+        PortRecord{21849, "tcp", "netspeak-cps", "NetSpeak Corp. Credit Processing System"},
+        PortRecord{22000, "tcp", "snapenetio", "snapenetio"},
+        PortRecord{22001, "tcp", "optocontrol", "optocontrol"},
+        PortRecord{22002, "tcp", "optohost002", "Opto Host Port 2"},
+        PortRecord{22003, "tcp", "optohost003", "Opto Host Port 3"},
+        PortRecord{22004, "tcp", "optohost004", "Opto Host Port 4"},
+        PortRecord{22005, "tcp", "optohost004", "Opto Host Port 5"},
+        PortRecord{22125, "tcp", "dcap", "dCache Access Protocol"},
+        PortRecord{22128, "tcp", "gsidcap", "GSI dCache Access Protocol"},
+        PortRecord{22222, "tcp", "easyengine", "EasyEngine is CLI tool to manage WordPress Sites on Nginx server"},
+        PortRecord{22273, "tcp", "wnn6", "Wnn6 (Japanese input)"},
+        PortRecord{22289, "tcp", "wnn6_Cn", "Wnn6 (Chinese input)"},
+        PortRecord{22305, "tcp", "wnn6_Kr", "wnn6_Kr"},
+        PortRecord{22321, "tcp", "wnn6_Tw", "Wnn6 (Taiwanse input)"},
+        PortRecord{22335, "tcp", "shrewd-control", "shrewd-control"},
+        PortRecord{22343, "tcp", "cis-secure", "CompactIS Secure Tunnel"},
+        PortRecord{22347, "tcp", "WibuKey", "WibuKey Standard WkLan"},
+        PortRecord{22350, "tcp", "CodeMeter", "CodeMeter Standard"},
+        PortRecord{22351, "tcp", "codemeter-cmwan", "TPC/IP requests of copy protection software to a server"},
+        PortRecord{22370, "tcp", "hpnpd", "Hewlett-Packard Network Printer Daemon"},
+        PortRecord{22537, "tcp", "caldsoft-backup", "CaldSoft Backup server file transfer"},
+        PortRecord{22555, "tcp", "vocaltec-wconf", "vocaltec-wconf"},
+        PortRecord{22763, "tcp", "talikaserver", "Talika Main Server"},
+        PortRecord{22800, "tcp", "aws-brf", "Telerate Information Platform LAN"},
+        PortRecord{22951, "tcp", "brf-gw", "Telerate Information Platform WAN"},
+        PortRecord{23000, "tcp", "inovaport1", "Inova LightLink Server Type 1"},
+        PortRecord{23001, "tcp", "inovaport2", "Inova LightLink Server Type 2"},
+        PortRecord{23002, "tcp", "inovaport3", "Inova LightLink Server Type 3"},
+        PortRecord{23003, "tcp", "inovaport4", "Inova LightLink Server Type 4"},
+        PortRecord{23004, "tcp", "inovaport5", "Inova LightLink Server Type 5"},
+        PortRecord{23005, "tcp", "inovaport6", "Inova LightLink Server Type 6"},
+        PortRecord{23053, "tcp", "gntp", "Generic Notification Transport Protocol"},
+        PortRecord{23272, "tcp", "s102", "S102 application"},
+        PortRecord{23294, "tcp", "5afe-dir", "5afe-dir"},
+        PortRecord{23333, "tcp", "elxmgmt", "Emulex HBAnyware Remote Management"},
+        PortRecord{23400, "tcp", "novar-dbase", "Novar Data"},
+        PortRecord{23401, "tcp", "novar-alarm", "Novar Alarm"},
+        PortRecord{23402, "tcp", "novar-global", "Novar Global"},
+        PortRecord{23456, "tcp", "aequus", "Aequus Service"},
+        PortRecord{23457, "tcp", "aequus-alt", "Aequus Service Mgmt"},
+        PortRecord{23546, "tcp", "areaguard-neo", "AreaGuard Neo - WebServer"},
+        PortRecord{24000, "tcp", "med-ltp", "med-ltp"},
+        PortRecord{24001, "tcp", "med-fsp-rx", "med-fsp-rx"},
+        PortRecord{24002, "tcp", "med-fsp-tx", "med-fsp-tx"},
+        PortRecord{24003, "tcp", "med-supp", "med-supp"},
+        PortRecord{24004, "tcp", "med-ovw", "med-ovw"},
+        PortRecord{24005, "tcp", "med-ci", "med-ci"},
+        PortRecord{24006, "tcp", "med-net-svc", "med-net-svc"},
+        PortRecord{24242, "tcp", "filesphere", "filesphere"},
+        PortRecord{24249, "tcp", "vista-4gl", "Vista 4GL"},
+        PortRecord{24321, "tcp", "ild", "Isolv Local Directory"},
+        PortRecord{24322, "tcp", "hid", "Transport of Human Interface Device data streams"},
+        PortRecord{24323, "tcp", "vrmg-ip", "Verimag mobile class protocol over TCP"},
+        PortRecord{24386, "tcp", "intel_rci", "intel_rci"},
+        PortRecord{24465, "tcp", "tonidods", "Tonido Domain Server"},
+        PortRecord{24554, "tcp", "binkp", "binkp"},
+        PortRecord{24577, "tcp", "bilobit", "bilobit"},
+        PortRecord{24666, "tcp", "sdtvwcam", "Service used by SmarDTV to communicate between a CAM and a second screen application"},
+        PortRecord{24676, "tcp", "canditv", "Canditv Message Service"},
+        PortRecord{24677, "tcp", "flashfiler", "flashfiler"},
+        PortRecord{24678, "tcp", "proactivate", "Turbopower Proactivate"},
+        PortRecord{24680, "tcp", "tcc-http", "TCC User HTTP Service"},
+        PortRecord{24754, "tcp", "cslg", "Citrix StorageLink Gateway"},
+        PortRecord{24850, "tcp", "assoc-disc", "Device Association Discovery"},
+        PortRecord{24922, "tcp", "find", "Find Identification of Network Devices"},
+        PortRecord{25000, "tcp", "icl-twobase1", "icl-twobase1"},
+        PortRecord{25001, "tcp", "icl-twobase2", "icl-twobase2"},
+        PortRecord{25002, "tcp", "icl-twobase3", "icl-twobase3"},
+        PortRecord{25003, "tcp", "icl-twobase4", "icl-twobase4"},
+        PortRecord{25004, "tcp", "icl-twobase5", "icl-twobase5"},
+        PortRecord{25005, "tcp", "icl-twobase6", "icl-twobase6"},
+        PortRecord{25006, "tcp", "icl-twobase7", "icl-twobase7"},
+        PortRecord{25007, "tcp", "icl-twobase8", "icl-twobase8"},
+        PortRecord{25008, "tcp", "icl-twobase9", "icl-twobase9"},
+        PortRecord{25009, "tcp", "icl-twobase10", "icl-twobase10"},
+        PortRecord{25471, "tcp", "rna", "RNSAP User Adaptation for Iurh"},
+        PortRecord{25565, "tcp", "minecraft", "Minecraft (video game)"},
+        PortRecord{25576, "tcp", "sauterdongle", "Sauter Dongle"},
+        PortRecord{25604, "tcp", "idtp", "Identifier Tracing Protocol"},
+        PortRecord{25793, "tcp", "vocaltec-hos", "Vocaltec Address Server"},
+        PortRecord{25900, "tcp", "tasp-net", "TASP Network Comm"},
+        PortRecord{25901, "tcp", "niobserver", "niobserver"},
+        PortRecord{25902, "tcp", "nilinkanalyst", "nilinkanalyst"},
+        PortRecord{25903, "tcp", "niprobe", "niprobe"},
+        PortRecord{25954, "tcp", "bf-game", "Bitfighter game server"},
+        PortRecord{25955, "tcp", "bf-master", "Bitfighter master server"},
+        PortRecord{26000, "tcp", "quake", "quake"},
+        PortRecord{26133, "tcp", "scscp", "Symbolic Computation Software Composability Protocol"},
+        PortRecord{26208, "tcp", "wnn6_DS", "wnn6_DS"},
+        PortRecord{26257, "tcp", "cockroach", "CockroachDB"},
+        PortRecord{26260, "tcp", "ezproxy", "ezproxy"},
+        PortRecord{26261, "tcp", "ezmeeting", "ezmeeting"},
+        PortRecord{26262, "tcp", "k3software-svr", "K3 Software-Server"},
+        PortRecord{26263, "tcp", "k3software-cli", "K3 Software-Client"},
+        PortRecord{26486, "tcp", "exoline-tcp", "exoline-tcp"},
+        PortRecord{26487, "tcp", "exoconfig", "exoconfig"},
+        PortRecord{26489, "tcp", "exonet", "exonet"},
+        PortRecord{27000, "tcp", "flexlm0", "FlexLM license manager additional ports"},
+        PortRecord{27001, "tcp", "flexlm1", "FlexLM license manager additional ports"},
+        PortRecord{27002, "tcp", "flexlm2", "FlexLM license manager additional ports"},
+        PortRecord{27003, "tcp", "flexlm3", "FlexLM license manager additional ports"},
+        PortRecord{27004, "tcp", "flexlm4", "FlexLM license manager additional ports"},
+        PortRecord{27005, "tcp", "flexlm5", "FlexLM license manager additional ports"},
+        PortRecord{27006, "tcp", "flexlm6", "FlexLM license manager additional ports"},
+        PortRecord{27007, "tcp", "flexlm7", "FlexLM license manager additional ports"},
+        PortRecord{27008, "tcp", "flexlm8", "FlexLM license manager additional ports"},
+        PortRecord{27009, "tcp", "flexlm9", "FlexLM license manager additional ports"},
+        PortRecord{27010, "tcp", "flexlm10", "flexlm10"},
+        PortRecord{27017, "tcp", "mongod", "mongod"},
+        PortRecord{27018, "tcp", "mongod", "Mongo Database"},
+        PortRecord{27019, "tcp", "mongod", "Mongo Database"},
+        PortRecord{27345, "tcp", "imagepump", "imagepump"},
+        PortRecord{27374, "tcp", "subseven", "Subseven Windows trojan"},
+        PortRecord{27442, "tcp", "jesmsjc", "Job controller service"},
+        PortRecord{27504, "tcp", "kopek-httphead", "Kopek HTTP Head Port"},
+        PortRecord{27665, "tcp", "Trinoo_Master", "Trinoo distributed attack tool Master server control port"},
+        PortRecord{27782, "tcp", "ars-vista", "ARS VISTA Application"},
+        PortRecord{27876, "tcp", "astrolink", "Astrolink Protocol"},
+        PortRecord{27999, "tcp", "tw-auth-key", "tw-auth-key"},
+        PortRecord{28000, "tcp", "nxlmd", "NX License Manager"},
+        PortRecord{28001, "tcp", "pqsp", "PQ Service"},
+        PortRecord{28010, "tcp", "gruber-cashreg", "Gruber cash registry protocol"},
+        PortRecord{28017, "tcp", "mongod", "Mongo Database"},
+        PortRecord{28119, "tcp", "a27-ran-ran", "A27 cdma2000 RAN Management"},
+        PortRecord{28200, "tcp", "voxelstorm", "VoxelStorm game server"},
+        PortRecord{28240, "tcp", "siemensgsm", "Siemens GSM"},
+        PortRecord{28589, "tcp", "bosswave", "Building operating system services wide area verified exchange"},
+        PortRecord{29000, "tcp", "saltd-licensing", "Siemens Licensing Server"},
+        PortRecord{29167, "tcp", "otmp", "ObTools Message Protocol"},
+        PortRecord{29999, "tcp", "bingbang", "data exchange protocol for IEC61850 in wind power plants"},
+        PortRecord{30000, "tcp", "ndmps", "Secure Network Data Management Protocol"},
+        PortRecord{30001, "tcp", "pago-services1", "Pago Services 1"},
+        PortRecord{30002, "tcp", "pago-services2", "Pago Services 2"},
+        PortRecord{30003, "tcp", "amicon-fpsu-ra", "Amicon FPSU-IP Remote Administration"},
+        PortRecord{30004, "tcp", "amicon-fpsu-s", "Amicon FPSU-IP VPN"},
+        PortRecord{30100, "tcp", "rwp", "Remote Window Protocol"},
+        PortRecord{30260, "tcp", "kingdomsonline", "Kingdoms Online (CraigAvenue)"},
+        PortRecord{30400, "tcp", "gs-realtime", "GroundStar RealTime System"},
+        PortRecord{30832, "tcp", "samsung-disc", "Samsung Convergence Discovery Protocol"},
+        PortRecord{30999, "tcp", "ovobs", "OpenView Service Desk Client"},
+        PortRecord{31016, "tcp", "ka-sddp", "ka-sddp"},
+        PortRecord{31020, "tcp", "autotrac-acp", "Autotrac ACP 245"},
+        PortRecord{31029, "tcp", "yawn", "YaWN - Yet Another Windows Notifier"},
+        PortRecord{31337, "tcp", "Elite", "Sometimes interesting stuff can be found here"},
+        PortRecord{31400, "tcp", "pace-licensed", "PACE license server"},
+        PortRecord{31416, "tcp", "boinc", "boinc"},
+        PortRecord{31457, "tcp", "tetrinet", "TetriNET Protocol"},
+        PortRecord{31620, "tcp", "lm-mon", "lm mon"},
+        PortRecord{31685, "tcp", "dsx_monitor", "dsx_monitor"},
+        PortRecord{31727, "tcp", "diagd", "diagd"},
+        PortRecord{31765, "tcp", "gamesmith-port", "GameSmith Port"},
+        PortRecord{31948, "tcp", "iceedcp_tx", "iceedcp_tx"},
+        PortRecord{31949, "tcp", "iceedcp_rx", "iceedcp_rx"},
+        PortRecord{32034, "tcp", "iracinghelper", "iRacing helper service"},
+        PortRecord{32249, "tcp", "t1distproc60", "T1 Distributed Processor"},
+        PortRecord{32400, "tcp", "plex", "Plex multimedia"},
+        PortRecord{32483, "tcp", "apm-link", "Access Point Manager Link"},
+        PortRecord{32635, "tcp", "sec-ntb-clnt", "SecureNotebook-CLNT"},
+        PortRecord{32636, "tcp", "DMExpress", "DMExpress"},
+        PortRecord{32767, "tcp", "filenet-powsrm", "FileNet BPM WS-ReliableMessaging Client"},
+        PortRecord{32768, "tcp", "filenet-tms", "Filenet TMS"},
+        PortRecord{32769, "tcp", "filenet-rpc", "Filenet RPC"},
+        PortRecord{32770, "tcp", "sometimes-rpc3", "sometimes-rpc3"},
+        PortRecord{32771, "tcp", "sometimes-rpc5", "sometimes-rpc5"},
+        PortRecord{32772, "tcp", "sometimes-rpc7", "sometimes-rpc7"},
+        PortRecord{32773, "tcp", "sometimes-rpc9", "sometimes-rpc9"},
+        PortRecord{32774, "tcp", "sometimes-rpc11", "sometimes-rpc11"},
+        PortRecord{32775, "tcp", "sometimes-rpc13", "sometimes-rpc13"},
+        PortRecord{32776, "tcp", "sometimes-rpc15", "sometimes-rpc15"},
+        PortRecord{32777, "tcp", "sometimes-rpc17", "sometimes-rpc17"},
+        PortRecord{32778, "tcp", "sometimes-rpc19", "Sometimes an RPC port on my Solaris box (rstatd)"},
+        PortRecord{32779, "tcp", "sometimes-rpc21", "Sometimes an RPC port on my Solaris box"},
+        PortRecord{32780, "tcp", "sometimes-rpc23", "Sometimes an RPC port on my Solaris box"},
+        PortRecord{32786, "tcp", "sometimes-rpc25", "Sometimes an RPC port (mountd)"},
+        PortRecord{32787, "tcp", "sometimes-rpc27", "Sometimes an RPC port dmispd (DMI Service Provider)"},
+        PortRecord{32801, "tcp", "mlsn", "Multiple Listing Service Network"},
+        PortRecord{32811, "tcp", "retp", "Real Estate Transport Protocol"},
+        PortRecord{32896, "tcp", "idmgratm", "Attachmate ID Manager"},
+        PortRecord{33000, "tcp", "wg-endpt-comms", "WatchGuard Endpoint Communications"},
+        PortRecord{33060, "tcp", "mysqlx", "MySQL Database Extended Interface"},
+        PortRecord{33123, "tcp", "aurora-balaena", "Aurora (Balaena Ltd)"},
+        PortRecord{33331, "tcp", "diamondport", "DiamondCentral Interface"},
+        PortRecord{33333, "tcp", "dgi-serv", "Digital Gaslight Service"},
+        PortRecord{33334, "tcp", "speedtrace", "speedtrace"},
+        PortRecord{33434, "tcp", "traceroute", "traceroute use"},
+        PortRecord{33435, "tcp", "mtrace", "IP Multicast Traceroute"},
+        PortRecord{33656, "tcp", "snip-slave", "SNIP Slave"},
+        PortRecord{33890, "tcp", "digilent-adept", "Adept IP protocol"},
+        PortRecord{34249, "tcp", "turbonote-2", "TurboNote Relay Server Default Port"},
+        PortRecord{34378, "tcp", "p-net-local", "P-Net on IP local"},
+        PortRecord{34379, "tcp", "p-net-remote", "P-Net on IP remote"},
+        PortRecord{34567, "tcp", "dhanalakshmi", "dhanalakshmi"},
+        PortRecord{34962, "tcp", "profinet-rt", "PROFInet RT Unicast"},
+        PortRecord{34963, "tcp", "profinet-rtm", "PROFInet RT Multicast"},
+        PortRecord{34964, "tcp", "profinet-cm", "PROFInet Context Manager"},
+        PortRecord{34980, "tcp", "ethercat", "ethercat"},
+        PortRecord{35000, "tcp", "heathview", "heathview"},
+        PortRecord{35001, "tcp", "rt-viewer", "ReadyTech Viewer"},
+        PortRecord{35002, "tcp", "rt-sound", "ReadyTech Sound Server"},
+        PortRecord{35003, "tcp", "rt-devicemapper", "ReadyTech DeviceMapper Server"},
+        PortRecord{35004, "tcp", "rt-classmanager", "ReadyTech ClassManager"},
+        PortRecord{35005, "tcp", "rt-labtracker", "ReadyTech LabTracker"},
+        PortRecord{35006, "tcp", "rt-helper", "ReadyTech Helper Service"},
+        PortRecord{35100, "tcp", "axio-disc", "Axiomatic discovery protocol"},
+        PortRecord{35354, "tcp", "kitim", "KIT Messenger"},
+        PortRecord{35355, "tcp", "altova-lm", "altova-lm"},
+        PortRecord{35356, "tcp", "guttersnex", "Gutters Note Exchange"},
+        PortRecord{35357, "tcp", "openstack-id", "OpenStack ID Service"},
+        PortRecord{36001, "tcp", "allpeers", "AllPeers Network"},
+        PortRecord{36411, "tcp", "wlcp", "Wireless LAN Control plane Protocol (WLCP)"},
+        PortRecord{36423, "tcp", "slmap", "SLm Interface Application Protocol"},
+        PortRecord{36424, "tcp", "nq-ap", "Nq and Nq' Application Protocol"},
+        PortRecord{36443, "tcp", "m2ap", "M2 Application Part"},
+        PortRecord{36444, "tcp", "m3ap", "M3 Application Part"},
+        PortRecord{36462, "tcp", "xw-control", "Xw-Control Plane (3GPP)"},
+        PortRecord{36524, "tcp", "febooti-aw", "Febooti Automation Workshop"},
+        PortRecord{36602, "tcp", "observium-agent", "Observium statistics collection agent"},
+        PortRecord{36700, "tcp", "mapx", "MapX communication"},
+        PortRecord{36865, "tcp", "kastenxpipe", "KastenX Pipe"},
+        PortRecord{37472, "tcp", "3gpp-w1ap", "W1 signalling transport"},
+        PortRecord{37475, "tcp", "neckar", "science + computing's Venus Administration Port"},
+        PortRecord{37483, "tcp", "gdrive-sync", "Google Drive Sync"},
+        PortRecord{37601, "tcp", "eftp", "Epipole File Transfer Protocol"},
+        PortRecord{37654, "tcp", "unisys-eportal", "Unisys ClearPath ePortal"},
+        PortRecord{38000, "tcp", "ivs-database", "InfoVista Server Database"},
+        PortRecord{38001, "tcp", "ivs-insertion", "InfoVista Server Insertion"},
+        PortRecord{38002, "tcp", "cresco-control", "cresco-control"},
+        PortRecord{38037, "tcp", "landesk-cba", "landesk-cba"},
+        PortRecord{38201, "tcp", "galaxy7-data", "Galaxy7 Data Tunnel"},
+        PortRecord{38202, "tcp", "fairview", "Fairview Message Service"},
+        PortRecord{38203, "tcp", "agpolicy", "AppGate Policy Server"},
+        PortRecord{38292, "tcp", "landesk-cba", "landesk-cba"},
+        PortRecord{38412, "tcp", "ng-control", "NG Control Plane (3GPP)"},
+        PortRecord{38422, "tcp", "xn-control", "Xn Control Plane (3GPP)"},
+        PortRecord{38462, "tcp", "e1-interface", "E1 signalling transport (3GPP)"},
+        PortRecord{38472, "tcp", "f1-control", "F1 Control Plane (3GPP)"},
+        PortRecord{38800, "tcp", "sruth", "Sruth is a service for the distribution of routinely- generated but arbitrary files based on a publish/subscribe distribution model and implemented using a peer-to-peer transport mechanism"},
+        PortRecord{38865, "tcp", "secrmmsafecopya", "Security approval process for use of the secRMM SafeCopy program"},
+        PortRecord{39681, "tcp", "turbonote-1", "TurboNote Default Port"},
+        PortRecord{40000, "tcp", "safetynetp", "SafetyNET p"},
+        PortRecord{40023, "tcp", "k-patentssensor", "K-PatentsSensorInformation"},
+        PortRecord{40404, "tcp", "sptx", "Simplify Printing TX"},
+        PortRecord{40841, "tcp", "cscp", "cscp"},
+        PortRecord{40842, "tcp", "csccredir", "csccredir"},
+        PortRecord{40843, "tcp", "csccfirewall", "csccfirewall"},
+        PortRecord{40853, "tcp", "ortec-disc", "ORTEC Service Discovery"},
+        PortRecord{41111, "tcp", "fs-qos", "Foursticks QoS Protocol"},
+        PortRecord{41121, "tcp", "tentacle", "Tentacle Server"},
+        PortRecord{41230, "tcp", "z-wave-s", "z-wave-s"},
+        PortRecord{41794, "tcp", "crestron-cip", "Crestron Control Port"},
+        PortRecord{41795, "tcp", "crestron-ctp", "Crestron Terminal Port"},
+        PortRecord{41796, "tcp", "crestron-cips", "Crestron Secure Control Port"},
+        PortRecord{41797, "tcp", "crestron-ctps", "Crestron Secure Terminal Port"},
+        PortRecord{42508, "tcp", "candp", "Computer Associates network discovery protocol"},
+        PortRecord{42509, "tcp", "candrp", "CA discovery response"},
+        PortRecord{42510, "tcp", "caerpc", "CA eTrust RPC"},
+        PortRecord{43000, "tcp", "recvr-rc", "recvr-rc"},
+        PortRecord{43188, "tcp", "reachout", "reachout"},
+        PortRecord{43189, "tcp", "ndm-agent-port", "ndm-agent-port"},
+        PortRecord{43190, "tcp", "ip-provision", "ip-provision"},
+        PortRecord{43191, "tcp", "noit-transport", "Reconnoiter Agent Data Transport"},
+        PortRecord{43210, "tcp", "shaperai", "shaperai"},
+        PortRecord{43438, "tcp", "hmip-routing", "HmIP LAN Routing"},
+        PortRecord{43439, "tcp", "eq3-update", "eq3-update"},
+        PortRecord{43440, "tcp", "ew-mgmt", "ew-mgmt"},
+        PortRecord{43441, "tcp", "ciscocsdb", "Cisco NetMgmt DB Ports"},
+        PortRecord{44123, "tcp", "z-wave-tunnel", "Z-Wave Secure Tunnel"},
+        PortRecord{44321, "tcp", "pmcd", "PCP server (pmcd)"},
+        PortRecord{44322, "tcp", "pmcdproxy", "PCP server (pmcd) proxy"},
+        PortRecord{44323, "tcp", "pmwebapi", "HTTP binding for Performance Co-Pilot client API"},
+        PortRecord{44334, "tcp", "tinyfw", "tiny personal firewall admin port"},
+        PortRecord{44442, "tcp", "coldfusion-auth", "ColdFusion Advanced Security/Siteminder Authentication Port (by Allaire/Netegrity)"},
+        PortRecord{44443, "tcp", "coldfusion-auth", "ColdFusion Advanced Security/Siteminder Authentication Port (by Allaire/Netegrity)"},
+        PortRecord{44444, "tcp", "cognex-dataman", "Cognex DataMan Management Protocol"},
+        PortRecord{44445, "tcp", "acronis-backup", "Acronis Backup Gateway service port"},
+        PortRecord{44544, "tcp", "domiq", "DOMIQ Building Automation"},
+        PortRecord{44553, "tcp", "rbr-debug", "REALbasic Remote Debug"},
+        PortRecord{44600, "tcp", "asihpi", "AudioScience HPI"},
+        PortRecord{44818, "tcp", "EtherNetIP-2", "EtherNetIP-2"},
+        PortRecord{44900, "tcp", "m3da", "m3da"},
+        PortRecord{45000, "tcp", "asmp", "asmp"},
+        PortRecord{45001, "tcp", "asmps", "Nuance AutoStore Status Monitoring Protocol (secure data transfer)"},
+        PortRecord{45002, "tcp", "rs-status", "Redspeed Status Monitor"},
+        PortRecord{45045, "tcp", "synctest", "Remote application control protocol"},
+        PortRecord{45054, "tcp", "invision-ag", "InVision AG"},
+        PortRecord{45514, "tcp", "cloudcheck", "cloudcheck"},
+        PortRecord{45678, "tcp", "eba", "EBA PRISE"},
+        PortRecord{45824, "tcp", "dai-shell", "Server for the DAI family of client-server products"},
+        PortRecord{45825, "tcp", "qdb2service", "Qpuncture Data Access Service"},
+        PortRecord{45966, "tcp", "ssr-servermgr", "SSRServerMgr"},
+        PortRecord{46336, "tcp", "inedo", "Listen port used for Inedo agent communication"},
+        PortRecord{46998, "tcp", "spremotetablet", "Connection between a desktop computer or server and a signature tablet to capture handwritten signatures"},
+        PortRecord{46999, "tcp", "mediabox", "MediaBox Server"},
+        PortRecord{47000, "tcp", "mbus", "Message Bus"},
+        PortRecord{47001, "tcp", "winrm", "Windows Remote Management Service"},
+        PortRecord{47100, "tcp", "jvl-mactalk", "Configuration of motors connected to Industrial Ethernet"},
+        PortRecord{47557, "tcp", "dbbrowse", "Databeam Corporation"},
+        PortRecord{47624, "tcp", "directplaysrvr", "Direct Play Server"},
+        PortRecord{47806, "tcp", "ap", "ALC Protocol"},
+        PortRecord{47808, "tcp", "bacnet", "Building Automation and Control Networks"},
+        PortRecord{47809, "tcp", "presonus-ucnet", "PreSonus Universal Control Network Protocol"},
+        PortRecord{48000, "tcp", "nimcontroller", "Nimbus Controller"},
+        PortRecord{48001, "tcp", "nimspooler", "Nimbus Spooler"},
+        PortRecord{48002, "tcp", "nimhub", "Nimbus Hub"},
+        PortRecord{48003, "tcp", "nimgtw", "Nimbus Gateway"},
+        PortRecord{48004, "tcp", "nimbusdb", "NimbusDB Connector"},
+        PortRecord{48005, "tcp", "nimbusdbctrl", "NimbusDB Control"},
+        PortRecord{48048, "tcp", "juka", "Juliar Programming Language Protocol"},
+        PortRecord{48049, "tcp", "3gpp-cbsp", "3GPP Cell Broadcast Service Protocol"},
+        PortRecord{48050, "tcp", "weandsf", "WeFi Access Network Discovery and Selection Function"},
+        PortRecord{48128, "tcp", "isnetserv", "Image Systems Network Services"},
+        PortRecord{48129, "tcp", "blp5", "Bloomberg locator"},
+        PortRecord{48556, "tcp", "com-bardac-dw", "com-bardac-dw"},
+        PortRecord{48619, "tcp", "iqobject", "iqobject"},
+        PortRecord{48653, "tcp", "robotraconteur", "Robot Raconteur transport"},
+        PortRecord{49000, "tcp", "matahari", "Matahari Broker"},
+        PortRecord{49001, "tcp", "nusrp", "nusrp"},
+        PortRecord{49150, "tcp", "inspider", "InSpider System"},
+        PortRecord{49400, "tcp", "compaqdiag", "Compaq Web-based management"},
+        PortRecord{50000, "tcp", "ibm-db2", "(also Internet/Intranet Input Method Server Framework?)"},
+        PortRecord{50002, "tcp", "iiimsf", "Internet/Intranet Input Method Server Framework"},
+        PortRecord{54320, "tcp", "bo2k", "Back Orifice 2K Default Port"},
+        PortRecord{61439, "tcp", "netprowler-manager", "netprowler-manager"},
+        PortRecord{61440, "tcp", "netprowler-manager2", "netprowler-manager2"},
+        PortRecord{61441, "tcp", "netprowler-sensor", "netprowler-sensor"},
+        PortRecord{62078, "tcp", "iphone-sync", "iphone-sync"},
+        PortRecord{65301, "tcp", "pcanywhere", "pcanywhere"},
+    };
+}
+
+#endif // !SCAN_PORT_DB_H
@@ -5,7 +5,6 @@
 #pragma once
 
 #define MAINICON                        101
-#define CSV_DATA                        102
 
 // Next default values for new objects
 //
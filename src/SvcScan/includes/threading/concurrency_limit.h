@@ -0,0 +1,74 @@
+/*
+* @file
+*     concurrency_limit.h
+* @brief
+*     Header file for an adaptive concurrency limit.
+*/
+#pragma once
+
+#ifndef SCAN_CONCURRENCY_LIMIT_H
+#define SCAN_CONCURRENCY_LIMIT_H
+
+#include "../utils/aliases.h"
+#include "thread_aliases.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Adaptive concurrency limit. The limit is adjusted once per window of
+    *     completed operations, where a window is as long as the current limit.
+    *     Latency is observed as the ratio of each latency sample to the minimum
+    *     latency of the same destination. The limit grows while all permits are
+    *     in use and latency is near its minimum, and shrinks when latency rises.
+    */
+    class ConcurrencyLimit
+    {
+    private:  /* Constants */
+        static constexpr double BACKOFF_FACTOR = 0.75;    // Limit decrease multiplier
+        static constexpr double GROWTH_GAIN = 0.25;       // Limit increase gain
+        static constexpr double LATENCY_GAIN = 1.0 / 8;   // Smoothed latency ratio gain
+        static constexpr double LATENCY_TOLERANCE = 2.0;  // Congested latency ratio
+
+    private:  /* Fields */
+        bool m_saturated;                // All permits were in use during the window
+
+        size_t m_active;                 // Acquired permit count
+        size_t m_limit;                  // Current concurrency limit
+        size_t m_max_limit;              // Maximum concurrency limit
+        size_t m_min_limit;              // Minimum concurrency limit
+        size_t m_peak_limit;             // Highest concurrency limit reached
+        size_t m_window_count;           // Completed operations in the window
+
+        double m_latency_ratio;          // Smoothed latency to minimum latency ratio
+
+        mutable mutex m_mtx;             // Concurrency limit mutex
+        condition_variable m_permit_cv;  // Permit available condition variable
+
+    public:  /* Constructors & Destructor */
+        ConcurrencyLimit() = delete;
+        ConcurrencyLimit(const ConcurrencyLimit&) = delete;
+        ConcurrencyLimit(ConcurrencyLimit&&) = delete;
+        ConcurrencyLimit(size_t t_initial, size_t t_min, size_t t_max) noexcept;
+
+        virtual ~ConcurrencyLimit() = default;
+
+    public:  /* Operators */
+        ConcurrencyLimit& operator=(const ConcurrencyLimit&) = delete;
+        ConcurrencyLimit& operator=(ConcurrencyLimit&&) = delete;
+
+    public:  /* Methods */
+        void acquire();
+        void release();
+        void update(const microseconds& t_latency, const microseconds& t_min_latency);
+
+        size_t limit() const;
+        size_t max_limit() const noexcept;
+        size_t peak_limit() const;
+
+    private:  /* Methods */
+        void adjust();
+    };
+}
+
+#endif // !SCAN_CONCURRENCY_LIMIT_H
@@ -0,0 +1,136 @@
+/*
+* @file
+*     lock_free_stack.h
+* @brief
+*     Header file for a lock-free multiple-producer LIFO stack.
+*/
+#pragma once
+
+#ifndef SCAN_LOCK_FREE_STACK_H
+#define SCAN_LOCK_FREE_STACK_H
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include "../utils/aliases.h"
+#include "thread_aliases.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Lock-free multiple-producer LIFO stack. Any number of threads can push
+    *     items concurrently, while all items are taken at once by a single consumer.
+    */
+    template<class T>
+    class LockFreeStack
+    {
+    private:  /* Types */
+        /**
+        * @brief
+        *     Singly linked stack node.
+        */
+        class Node final
+        {
+        public:  /* Fields */
+            T value;       // Node value
+            Node* nextp;   // Next node pointer
+
+        public:  /* Constructors & Destructor */
+            Node() = delete;
+            Node(const Node&) = delete;
+            Node(Node&&) = delete;
+
+            /**
+            * @brief
+            *     Initialize the object.
+            */
+            Node(T&& t_value, Node* t_nextp) noexcept
+                : value{std::move(t_value)}, nextp{t_nextp}
+            {
+            }
+
+            virtual ~Node() = default;
+
+        public:  /* Operators */
+            Node& operator=(const Node&) = delete;
+            Node& operator=(Node&&) = delete;
+        };
+
+    private:  /* Fields */
+        atomic<Node*> m_headp;  // Top node atomic pointer
+
+    public:  /* Constructors & Destructor */
+        LockFreeStack(const LockFreeStack&) = delete;
+        LockFreeStack(LockFreeStack&&) = delete;
+
+        /**
+        * @brief
+        *     Initialize the object.
+        */
+        LockFreeStack() noexcept : m_headp{nullptr}
+        {
+        }
+
+        /**
+        * @brief
+        *     Destroy the object.
+        */
+        virtual ~LockFreeStack()
+        {
+            take_all();
+        }
+
+    public:  /* Operators */
+        LockFreeStack& operator=(const LockFreeStack&) = delete;
+        LockFreeStack& operator=(LockFreeStack&&) = delete;
+
+    public:  /* Methods */
+        void push(T&& t_item);
+
+        vector<T> take_all();
+    };
+}
+
+/**
+* @brief
+*     Push the given item onto the stack without blocking.
+*/
+template<class T>
+inline void scan::LockFreeStack<T>::push(T&& t_item)
+{
+    Node* nodep{std::make_unique<Node>(std::move(t_item), nullptr).release()};
+    nodep->nextp = m_headp.load(std::memory_order_relaxed);
+
+    // Retry until the head pointer has not changed since it was read
+    while (!m_headp.compare_exchange_weak(nodep->nextp,
+                                          nodep,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+* @brief
+*     Remove all items from the stack and return them in the order they were pushed.
+*/
+template<class T>
+inline scan::vector<T> scan::LockFreeStack<T>::take_all()
+{
+    vector<T> items;
+    Node* nodep{m_headp.exchange(nullptr, std::memory_order_acquire)};
+
+    while (nodep != nullptr)
+    {
+        const unique_ptr<Node> node_ptr{nodep};
+
+        items.emplace_back(std::move(nodep->value));
+        nodep = nodep->nextp;
+    }
+
+    ranges::reverse(items);
+    return items;
+}
+
+#endif // !SCAN_LOCK_FREE_STACK_H
@@ -10,21 +10,36 @@
 #define SCAN_THREAD_ALIASES_H
 
 #include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
 #include <mutex>
+#include <semaphore>
 #include <thread>
-#include <boost/asio/thread_pool.hpp>
 #include "../utils/aliases.h"
 
 namespace scan
 {
-    using atomic_bool   = std::atomic_bool;
-    using mutex         = std::mutex;
-    using thread        = std::thread;
-    using thread_pool_t = asio::thread_pool;
+    using atomic_bool        = std::atomic_bool;
+    using condition_variable = std::condition_variable;
+    using mutex              = std::mutex;
+    using semaphore          = std::counting_semaphore<>;
+    using task_t             = std::function<void()>;
+    using thread             = std::thread;
+    using unique_lock        = std::unique_lock<mutex>;
+
+    template<class T>
+    using atomic = std::atomic<T>;
 
     template<class T>
     using atomic_ptr_t = std::atomic<shared_ptr<T>>;
 
+    template<class T>
+    using future = std::future<T>;
+
+    template<class T>
+    using promise = std::promise<T>;
+
     template<class... ArgsT>
     using scoped_lock = std::scoped_lock<ArgsT...>;
 }
@@ -10,10 +10,9 @@
 #define SCAN_THREAD_POOL_H
 
 #include <utility>
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include "../concepts/thread_concepts.h"
 #include "../ranges/algo.h"
+#include "../utils/aliases.h"
 #include "../utils/literals.h"
 #include "thread_aliases.h"
 
@@ -21,37 +20,87 @@ namespace scan
 {
     /**
     * @brief
-    *     Execution thread pool.
+    *     Work-stealing execution thread pool. Each worker thread owns a task
+    *     deque, and idle workers steal tasks from the other workers' deques.
+    *     The pool starts with an initial number of worker threads and can grow
+    *     on demand up to its maximum thread count, since worker task deques
+    *     are allocated for the maximum thread count in advance.
     */
     class ThreadPool
     {
+    private:  /* Types */
+        /**
+        * @brief
+        *     Worker thread task deque. Tasks are pushed and popped at
+        *     the back by the owner and stolen from the front by thieves.
+        */
+        class Worker final
+        {
+        public:  /* Fields */
+            mutex mtx;            // Task deque mutex
+            deque<task_t> tasks;  // Task deque
+
+        public:  /* Constructors & Destructor */
+            Worker() = default;
+            Worker(const Worker&) = delete;
+            Worker(Worker&&) = delete;
+
+            virtual ~Worker() = default;
+
+        public:  /* Operators */
+            Worker& operator=(const Worker&) = delete;
+            Worker& operator=(Worker&&) = delete;
+        };
+
     private:  /* Fields */
-        static const size_t m_cpu_threads;  // CPU thread count
+        static const size_t m_cpu_threads;               // CPU thread count
 
-        atomic_bool m_stopped;              // Thread pool execution stopped
-        thread_pool_t m_pool;               // Execution thread pool
+        static thread_local ThreadPool* m_current_poolp; // Current worker's pool
+        static thread_local size_t m_current_index;      // Current worker's index
+
+        atomic_bool m_stopped;                           // Thread pool execution stopped
+        bool m_draining;                                 // Exit workers once idle
+        size_t m_max_threads;                            // Maximum worker thread count
+
+        atomic<size_t> m_threads;                        // Worker thread count
+        atomic<size_t> m_next_index;                     // Next external post index
+        atomic<size_t> m_queued_count;                   // Queued task count
+        atomic<size_t> m_steal_count;                    // Stolen task count
+
+        mutex m_idle_mtx;                                // Idle worker mutex
+        mutex m_threads_mtx;                             // Worker thread list mutex
+        condition_variable m_idle_cv;                    // Idle worker condition variable
+
+        vector<unique_ptr<Worker>> m_workers;            // Worker task deques
+        deque<thread> m_worker_threads;                  // Worker threads
 
     public:  /* Constructors & Destructor */
         ThreadPool();
         ThreadPool(const ThreadPool&) = delete;
         ThreadPool(ThreadPool&&) = delete;
         ThreadPool(size_t t_threads);
+        ThreadPool(size_t t_threads, size_t t_max_threads);
 
-        virtual ~ThreadPool() = default;
+        virtual ~ThreadPool();
 
     public:  /* Operators */
-        ThreadPool& operator=(const ThreadPool&) = default;
-        ThreadPool& operator=(ThreadPool&&) = default;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
 
     public:  /* Methods */
         template<Task F>
         void post(F&& t_task);
 
+        void grow(size_t t_threads);
         void stop();
         void wait();
 
         bool is_stopped() const noexcept;
 
+        size_t queue_depth() const noexcept;
+        size_t size() const noexcept;
+        size_t steal_count() const noexcept;
+
     private:  /* Methods */
         /**
         * @brief
@@ -59,25 +108,35 @@ namespace scan
         */
         static constexpr size_t thread_count(size_t t_threads = 0_sz) noexcept
         {
-            size_t threads{(algo::min)(m_cpu_threads, 16_sz)};
+            size_t threads{(algo::min)((algo::max)(m_cpu_threads, 1_sz), 16_sz)};
 
-            if (t_threads > 0 && t_threads <= 32)
+            if (t_threads > 0)
             {
                 threads = t_threads;
             }
             return threads;
         }
+
+        void join();
+        void push(task_t&& t_task);
+        void run(size_t t_index);
+        void spawn(size_t t_threads);
+
+        bool pop(size_t t_index, task_t& t_task);
+        bool steal(size_t t_index, task_t& t_task);
     };
 }
 
 /**
 * @brief
-*     Submit a void task for execution by the underlying thread pool.
+*     Submit a void task for execution by the underlying worker threads. Tasks
+*     posted by a worker thread are pushed onto its own deque, while all other
+*     tasks are distributed across the worker deques in round-robin order.
 */
 template<scan::Task F>
 inline void scan::ThreadPool::post(F&& t_task)
 {
-    asio::post(m_pool, std::forward<F>(t_task));
+    push(task_t{std::forward<F>(t_task)});
 }
 
 #endif // !SCAN_THREAD_POOL_H
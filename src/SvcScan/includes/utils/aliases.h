@@ -13,6 +13,7 @@
 #include <chrono>
 #include <compare>
 #include <cstdint>
+#include <deque>
 #include <initializer_list>
 #include <ios>
 #include <istream>
@@ -21,8 +22,10 @@
 #include <memory>
 #include <ostream>
 #include <ranges>
+#include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <type_traits>
 #include <utility>
@@ -60,6 +63,7 @@ namespace scan
     using sstream         = std::stringstream;
     using streamsize      = std::streamsize;
     using string          = std::string;
+    using string_view     = std::string_view;
     using strong_ordering = std::strong_ordering;
 
     template<class T>
@@ -77,6 +81,9 @@ namespace scan
     template<class T>
     using decay_t = std::decay_t<T>;
 
+    template<class T>
+    using deque = std::deque<T>;
+
     template<class T>
     using hh_mm_ss = chrono::hh_mm_ss<T>;
 
@@ -116,6 +123,9 @@ namespace scan
     template<class T>
     using remove_reference_t = std::remove_reference_t<T>;
 
+    template<class T>
+    using set = std::set<T>;
+
     template<class T>
     using shared_ptr = std::shared_ptr<T>;
 
@@ -16,6 +16,7 @@
 #include <boost/json/object.hpp>
 #include <boost/json/value.hpp>
 #include "../concepts/concepts.h"
+#include "../console/args.h"
 #include "../inet/services/svc_info.h"
 #include "../inet/services/svc_table.h"
 #include "aliases.h"
@@ -73,12 +74,18 @@ namespace scan::json
         /// @brief  Scan duration property key.
         constexpr c_string_t DURATION_KEY = "duration";
 
+        /// @brief  SSL/TLS enumeration cipher suites property key.
+        constexpr c_string_t CIPHER_SUITES_KEY = "cipherSuites";
+
         /// @brief  Scan end time property key.
         constexpr c_string_t END_TIME_KEY = "endTime";
 
         /// @brief  Executable path property key.
         constexpr c_string_t EXECUTABLE_KEY = "executable";
 
+        /// @brief  SSL/TLS enumeration key exchange groups property key.
+        constexpr c_string_t GROUPS_KEY = "groups";
+
         /// @brief  HTTP message headers property key.
         constexpr c_string_t HEADERS_KEY = "headers";
 
@@ -88,6 +95,9 @@ namespace scan::json
         /// @brief  HTTP request method property key.
         constexpr c_string_t METHOD_KEY = "method";
 
+        /// @brief  Additional HTTP request URIs property key.
+        constexpr c_string_t PATHS_KEY = "paths";
+
         /// @brief  Network port number property key.
         constexpr c_string_t PORT_KEY = "port";
 
@@ -133,12 +143,21 @@ namespace scan::json
         /// @brief  Scan target name property key.
         constexpr c_string_t TARGET_KEY = "target";
 
+        /// @brief  SSL/TLS enumeration property key.
+        constexpr c_string_t TLS_ENUM_KEY = "tlsEnumeration";
+
+        /// @brief  HTTP response body truncated property key.
+        constexpr c_string_t TRUNCATED_KEY = "truncated";
+
         /// @brief  HTTP request URI property key.
         constexpr c_string_t URI_KEY = "uri";
 
         /// @brief  HTTP protocol version property key.
         constexpr c_string_t VERSION_KEY = "version";
 
+        /// @brief  SSL/TLS enumeration protocol versions property key.
+        constexpr c_string_t VERSIONS_KEY = "versions";
+
         /// @brief  X.509 certificate issuer property key.
         constexpr c_string_t X509_ISSUER_KEY = "x509Issuer";
 
@@ -156,22 +175,28 @@ namespace scan::json
         return t_data;
     }
 
+    void add_paths(object_t& t_http_obj, const SvcInfo& t_info);
     void add_request(object_t& t_http_obj, const SvcInfo& t_info);
     void add_response(object_t& t_http_obj, const SvcInfo& t_info);
     void add_service(array_t& t_svc_array, const SvcInfo& t_info);
     void add_services(object_t& t_report_obj, const SvcTable& t_table);
+    void add_tls_enum(object_t& t_svc_obj, const SvcInfo& t_info);
 
     bool valid_schema(const object_t& t_report_obj) noexcept;
 
     string prettify(const array_t& t_array, const string& t_indent = {});
     string prettify(const object_t& t_obj, const string& t_indent = {});
     string prettify(const value_t& t_value, const string& t_indent = {});
+    string ndjson_line(const SvcInfo& t_info);
     string serialize(const value_t& t_value);
 
     array_t make_array(const Range auto& t_range);
     object_t make_object(const StringMap auto& t_map);
+    object_t make_object(const header_list_t& t_headers);
+    object_t make_service(const SvcInfo& t_info);
 
-    object_t scan_report(const SvcTable& t_table,
+    object_t scan_report(const Args& t_args,
+                         const vector<SvcTable>& t_tables,
                          const Timer& t_timer,
                          const string& t_out_path = {});
 }
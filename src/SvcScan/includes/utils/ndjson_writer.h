@@ -0,0 +1,66 @@
+/*
+* @file
+*     ndjson_writer.h
+* @brief
+*     Header file for a streaming NDJSON (newline-delimited JSON) writer.
+*/
+#pragma once
+
+#ifndef SCAN_NDJSON_WRITER_H
+#define SCAN_NDJSON_WRITER_H
+
+#include <string>
+#include "../file_system/file.h"
+#include "../threading/thread_aliases.h"
+#include "aliases.h"
+#include "literals.h"
+
+namespace scan
+{
+    /**
+    * @brief
+    *     Streaming NDJSON (newline-delimited JSON) writer. Lines are written
+    *     in batches to the standard output stream or a file by a dedicated
+    *     writer thread. The pending line queue is bounded, so producers only
+    *     block when the output stream cannot keep up with the scan.
+    */
+    class NdjsonWriter
+    {
+    private:  /* Constants */
+        static constexpr size_t MAX_PENDING = 4096_sz;  // Maximum pending line count
+
+    private:  /* Fields */
+        bool m_stopped;                 // Writer stopped
+        mutable mutex m_lines_mtx;      // Pending lines mutex
+        condition_variable m_lines_cv;  // Pending lines condition variable
+        condition_variable m_space_cv;  // Pending lines capacity condition variable
+
+        File m_file;                    // Output file stream
+        vector<string> m_lines;         // Pending lines
+        thread m_thread;                // Writer thread
+
+    public:  /* Constructors & Destructor */
+        NdjsonWriter() noexcept;
+        NdjsonWriter(const NdjsonWriter&) = delete;
+        NdjsonWriter(NdjsonWriter&&) = delete;
+
+        virtual ~NdjsonWriter();
+
+    public:  /* Operators */
+        NdjsonWriter& operator=(const NdjsonWriter&) = delete;
+        NdjsonWriter& operator=(NdjsonWriter&&) = delete;
+
+    public:  /* Methods */
+        void start(const string& t_out_path = {});
+        void stop();
+        void write(string&& t_line);
+
+        bool is_running() const noexcept;
+
+    private:  /* Methods */
+        void run();
+        void write_batch(const vector<string>& t_lines);
+    };
+}
+
+#endif // !SCAN_NDJSON_WRITER_H
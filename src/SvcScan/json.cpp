@@ -18,6 +18,30 @@
 #include "includes/utils/const_defs.h"
 #include "includes/utils/json.h"
 
+/**
+* @brief
+*     Add additional HTTP request URI responses from the given service
+*     information to the specified HTTP information JSON object.
+*/
+void scan::json::add_paths(object_t& t_http_obj, const SvcInfo& t_info)
+{
+    object_t paths_obj;
+
+    for (const auto& [uri, response] : t_info.path_responses)
+    {
+        paths_obj[uri] = object_t
+        {
+            {VERSION_KEY,   response.httpv.num_str()},
+            {STATUS_KEY,    response.status_code()},
+            {REASON_KEY,    response.reason()},
+            {HEADERS_KEY,   std::move(make_object(response.headers()))},
+            {BODY_KEY,      response.body()},
+            {TRUNCATED_KEY, response.truncated()}
+        };
+    }
+    t_http_obj[PATHS_KEY] = std::move(paths_obj);
+}
+
 /**
 * @brief
 *     Add HTTP request message details from the given service
@@ -30,7 +54,7 @@ void scan::json::add_request(object_t& t_http_obj, const SvcInfo& t_info)
         {VERSION_KEY, t_info.request.httpv.num_str()},
         {METHOD_KEY,  t_info.request.method_str()},
         {URI_KEY,     t_info.request.uri()},
-        {HEADERS_KEY, std::move(make_object(t_info.request.msg_headers()))}
+        {HEADERS_KEY, std::move(make_object(t_info.request.headers()))}
     };
 }
 
@@ -43,11 +67,12 @@ void scan::json::add_response(object_t& t_http_obj, const SvcInfo& t_info)
 {
     t_http_obj[RESPONSE_KEY] = object_t
     {
-        {VERSION_KEY, t_info.response.httpv.num_str()},
-        {STATUS_KEY,  t_info.response.status_code()},
-        {REASON_KEY,  t_info.response.reason()},
-        {HEADERS_KEY, std::move(make_object(t_info.response.msg_headers()))},
-        {BODY_KEY,    t_info.response.body()}
+        {VERSION_KEY,   t_info.response.httpv.num_str()},
+        {STATUS_KEY,    t_info.response.status_code()},
+        {REASON_KEY,    t_info.response.reason()},
+        {HEADERS_KEY,   std::move(make_object(t_info.response.headers()))},
+        {BODY_KEY,      t_info.response.body()},
+        {TRUNCATED_KEY, t_info.response.truncated()}
     };
 }
 
@@ -58,39 +83,13 @@ void scan::json::add_response(object_t& t_http_obj, const SvcInfo& t_info)
 */
 void scan::json::add_service(array_t& t_svc_array, const SvcInfo& t_info)
 {
-    object_t svc_obj
-    {
-        {PORT_KEY,     t_info.port()},
-        {PROTOCOL_KEY, t_info.proto},
-        {STATE_KEY,    t_info.state_str()},
-        {SERVICE_KEY,  t_info.service},
-        {SUMMARY_KEY,  t_info.summary},
-        {BANNER_KEY,   t_info.banner}
-    };
-
-    // Add SSL/TLS information
-    if (!t_info.cipher.empty())
-    {
-        svc_obj[CIPHER_SUITE_KEY] = t_info.cipher;
-        svc_obj[X509_ISSUER_KEY] = t_info.issuer;
-        svc_obj[X509_SUBJECT_KEY] = t_info.subject;
-    }
-
-    // Add HTTP request and response information
-    if (!t_info.response.msg_headers().empty())
-    {
-        svc_obj[HTTP_INFO_KEY] = object_t{};
-
-        add_request(svc_obj[HTTP_INFO_KEY].get_object(), t_info);
-        add_response(svc_obj[HTTP_INFO_KEY].get_object(), t_info);
-    }
-
-    t_svc_array.emplace_back(svc_obj);
+    t_svc_array.emplace_back(make_service(t_info));
 }
 
 /**
 * @brief
-*     Add the services from the given table to the specified scan report JSON object.
+*     Add the target and services from the given table to the
+*     scan results of the specified scan report JSON object.
 */
 void scan::json::add_services(object_t& t_report_obj, const SvcTable& t_table)
 {
@@ -99,31 +98,51 @@ void scan::json::add_services(object_t& t_report_obj, const SvcTable& t_table)
         throw ArgEx{INVALID_JSON_REPORT_MSG, "t_report_obj"};
     }
 
-    object_t& results_obj{t_report_obj[SCAN_RESULTS_KEY].get_object()};
-    array_t& svc_array{results_obj[SERVICES_KEY].get_array()};
+    object_t target_obj
+    {
+        {TARGET_KEY,   t_table.addr()},
+        {SERVICES_KEY, array_t{}}
+    };
+    array_t& svc_array{target_obj[SERVICES_KEY].get_array()};
 
     // Add service information JSON objects
     for (const SvcInfo& info : t_table.values())
     {
         add_service(svc_array, info);
     }
+    t_report_obj[SCAN_RESULTS_KEY].get_array().emplace_back(std::move(target_obj));
 }
 
 /**
 * @brief
-*     Determine whether the report schema of the given JSON value is valid.
+*     Add SSL/TLS enumeration results from the given service
+*     information to the specified service information JSON object.
 */
-bool scan::json::valid_schema(const object_t& t_report_obj) noexcept
+void scan::json::add_tls_enum(object_t& t_svc_obj, const SvcInfo& t_info)
 {
-    bool valid{false};
-    const value_t* resultsp{t_report_obj.if_contains(SCAN_RESULTS_KEY)};
+    object_t ciphers_obj;
 
-    if (valid = resultsp != nullptr && resultsp->is_object())
+    for (const auto& [version, suites] : t_info.tls_ciphers)
     {
-        const value_t* servicesp{resultsp->get_object().if_contains(SERVICES_KEY)};
-        valid = servicesp != nullptr && servicesp->is_array();
+        ciphers_obj[version] = make_array(suites);
     }
-    return valid;
+
+    t_svc_obj[TLS_ENUM_KEY] = object_t
+    {
+        {VERSIONS_KEY,      std::move(make_array(t_info.tls_versions))},
+        {CIPHER_SUITES_KEY, std::move(ciphers_obj)},
+        {GROUPS_KEY,        std::move(make_array(t_info.tls_groups))}
+    };
+}
+
+/**
+* @brief
+*     Determine whether the report schema of the given JSON value is valid.
+*/
+bool scan::json::valid_schema(const object_t& t_report_obj) noexcept
+{
+    const value_t* resultsp{t_report_obj.if_contains(SCAN_RESULTS_KEY)};
+    return resultsp != nullptr && resultsp->is_array();
 }
 
 /**
@@ -227,6 +246,20 @@ std::string scan::json::prettify(const value_t& t_value, const string& t_indent)
     return stream.str();
 }
 
+/**
+* @brief
+*     Serialize the given service information to a single-line JSON
+*     object, which includes the target address of the service.
+*/
+std::string scan::json::ndjson_line(const SvcInfo& t_info)
+{
+    const object_t svc_obj{make_service(t_info)};
+    object_t line_obj{{TARGET_KEY, t_info.addr}};
+
+    line_obj.insert(svc_obj.begin(), svc_obj.end());
+    return serialize(line_obj);
+}
+
 /**
 * @brief
 *     Serialize the given JSON value to a string.
@@ -236,11 +269,74 @@ std::string scan::json::serialize(const value_t& t_value)
     return boost::json::serialize(t_value);
 }
 
+/**
+* @brief
+*     Create a JSON object with the header fields from the given header field views.
+*/
+boost::json::object scan::json::make_object(const header_list_t& t_headers)
+{
+    object_t json_obj;
+
+    for (const header_view_t& header : t_headers)
+    {
+        json_obj[header.first] = header.second;
+    }
+    return json_obj;
+}
+
+/**
+* @brief
+*     Create a new JSON object from the given service information.
+*/
+boost::json::object scan::json::make_service(const SvcInfo& t_info)
+{
+    object_t svc_obj
+    {
+        {PORT_KEY,     t_info.port()},
+        {PROTOCOL_KEY, t_info.proto},
+        {STATE_KEY,    t_info.state_str()},
+        {SERVICE_KEY,  t_info.service},
+        {SUMMARY_KEY,  t_info.summary},
+        {BANNER_KEY,   t_info.banner}
+    };
+
+    // Add SSL/TLS information
+    if (!t_info.cipher.empty())
+    {
+        svc_obj[CIPHER_SUITE_KEY] = t_info.cipher;
+        svc_obj[X509_ISSUER_KEY] = t_info.issuer;
+        svc_obj[X509_SUBJECT_KEY] = t_info.subject;
+    }
+
+    // Add SSL/TLS enumeration results
+    if (!t_info.tls_versions.empty())
+    {
+        add_tls_enum(svc_obj, t_info);
+    }
+
+    // Add HTTP request and response information
+    if (t_info.response.has_headers())
+    {
+        svc_obj[HTTP_INFO_KEY] = object_t{};
+
+        add_request(svc_obj[HTTP_INFO_KEY].get_object(), t_info);
+        add_response(svc_obj[HTTP_INFO_KEY].get_object(), t_info);
+
+        // Add additional HTTP request URI responses
+        if (!t_info.path_responses.empty())
+        {
+            add_paths(svc_obj[HTTP_INFO_KEY].get_object(), t_info);
+        }
+    }
+    return svc_obj;
+}
+
 /**
 * @brief
 *     Create a new scan report JSON object.
 */
-boost::json::object scan::json::scan_report(const SvcTable& t_table,
+boost::json::object scan::json::scan_report(const Args& t_args,
+                                            const vector<SvcTable>& t_tables,
                                             const Timer& t_timer,
                                             const string& t_out_path)
 {
@@ -258,18 +354,16 @@ boost::json::object scan::json::scan_report(const SvcTable& t_table,
                 {START_TIME_KEY,  t_timer.start_time()},
                 {END_TIME_KEY,    t_timer.end_time()},
                 {REPORT_PATH_KEY, t_out_path},
-                {EXECUTABLE_KEY,  t_table.args().exe_path},
-                {ARGUMENTS_KEY,   std::move(make_array(t_table.args().argv))}
+                {EXECUTABLE_KEY,  t_args.exe_path},
+                {ARGUMENTS_KEY,   std::move(make_array(t_args.argv))}
             }
         },
-        {SCAN_RESULTS_KEY,
-            {
-                {TARGET_KEY,   t_table.addr()},
-                {SERVICES_KEY, array_t{}}
-            }
-        }
+        {SCAN_RESULTS_KEY, array_t{}}
     };
-    add_services(report_obj, t_table);
 
+    for (const SvcTable& table : t_tables)
+    {
+        add_services(report_obj, table);
+    }
     return report_obj;
 }
@@ -15,6 +15,10 @@
 #include "includes/utils/aliases.h"
 #include "includes/utils/const_defs.h"
 
+#ifdef SCAN_RAW_SOCKETS
+#include "includes/inet/scanners/raw_scanner.h"
+#endif // SCAN_RAW_SOCKETS
+
 /**
 * @brief
 *     Application entry point.
@@ -56,8 +60,16 @@ int scan::exec_scan(const Args& t_args)
     unique_ptr<TcpScanner> scannerp;
     shared_ptr<Args> argsp{std::make_shared<Args>(t_args)};
 
-    // Use SSL/TLS capable TCP scanner
-    if (t_args.tls_enabled)
+#ifdef SCAN_RAW_SOCKETS
+    // Use half-open (SYN) scanner
+    if (t_args.syn_scan)
+    {
+        scannerp = std::make_unique<RawScanner>(io_ctx, argsp);
+    }
+    else if (t_args.tls_enabled)  // Use SSL/TLS capable TCP scanner
+#else
+    if (t_args.tls_enabled)  // Use SSL/TLS capable TCP scanner
+#endif // SCAN_RAW_SOCKETS
     {
         scannerp = std::make_unique<TlsScanner>(io_ctx, argsp);
     }
@@ -0,0 +1,191 @@
+/*
+* @file
+*     ndjson_writer.cpp
+* @brief
+*     Source file for a streaming NDJSON (newline-delimited JSON) writer.
+*/
+#include <iostream>
+#include <utility>
+#include "includes/console/util.h"
+#include "includes/errors/error_const_defs.h"
+#include "includes/errors/logic_ex.h"
+#include "includes/file_system/path.h"
+#include "includes/utils/const_defs.h"
+#include "includes/utils/literals.h"
+#include "includes/utils/ndjson_writer.h"
+
+/**
+* @brief
+*     Initialize the object.
+*/
+scan::NdjsonWriter::NdjsonWriter() noexcept
+{
+    m_stopped = true;
+}
+
+/**
+* @brief
+*     Destroy the object.
+*/
+scan::NdjsonWriter::~NdjsonWriter()
+{
+    stop();
+}
+
+/**
+* @brief
+*     Start the writer thread. Lines are written to the standard output stream
+*     when the given output file path is empty, otherwise the file is truncated
+*     and lines are written to the file.
+*/
+void scan::NdjsonWriter::start(const string& t_out_path)
+{
+    if (is_running())
+    {
+        throw LogicEx{WRITER_RUNNING_MSG, "NdjsonWriter::start"};
+    }
+
+    if (!t_out_path.empty())
+    {
+        m_file.open(t_out_path, path::default_write_mode());
+    }
+
+    {
+        scoped_lock lock{m_lines_mtx};
+        m_stopped = false;
+    }
+
+    m_thread = thread{[this]() -> void
+    {
+        run();
+    }};
+}
+
+/**
+* @brief
+*     Write all pending lines, then stop the writer thread and close the
+*     output file stream. Blocks until the writer thread exits.
+*/
+void scan::NdjsonWriter::stop()
+{
+    if (is_running())
+    {
+        {
+            scoped_lock lock{m_lines_mtx};
+            m_stopped = true;
+        }
+        m_lines_cv.notify_one();
+        m_space_cv.notify_all();
+
+        m_thread.join();
+        m_file.close();
+    }
+}
+
+/**
+* @brief
+*     Queue the given serialized JSON line for writing. Blocks while the pending
+*     line queue is full, so memory usage stays bounded when the output stream
+*     is slower than the scan. Lines written after the writer stops are discarded.
+*/
+void scan::NdjsonWriter::write(string&& t_line)
+{
+    {
+        unique_lock lock{m_lines_mtx};
+
+        m_space_cv.wait(lock, [this]() -> bool
+        {
+            return m_stopped || m_lines.size() < MAX_PENDING;
+        });
+
+        if (m_stopped)
+        {
+            return;
+        }
+        m_lines.emplace_back(std::move(t_line));
+    }
+    m_lines_cv.notify_one();
+}
+
+/**
+* @brief
+*     Determine whether the writer thread is running.
+*/
+bool scan::NdjsonWriter::is_running() const noexcept
+{
+    return m_thread.joinable();
+}
+
+/**
+* @brief
+*     Writer thread loop. All lines queued while the previous batch was being
+*     written are taken at once and written as the next batch, which frees
+*     the pending line queue capacity for blocked producers.
+*/
+void scan::NdjsonWriter::run()
+{
+    bool stopped{false};
+    vector<string> batch;
+
+    while (!stopped)
+    {
+        {
+            unique_lock lock{m_lines_mtx};
+
+            m_lines_cv.wait(lock, [this]() -> bool
+            {
+                return m_stopped || !m_lines.empty();
+            });
+
+            batch.swap(m_lines);
+            stopped = m_stopped;
+        }
+        m_space_cv.notify_all();
+
+        if (!batch.empty())
+        {
+            write_batch(batch);
+            batch.clear();
+        }
+    }
+}
+
+/**
+* @brief
+*     Write the given batch of lines to the output stream and flush it, so that
+*     consumers can process the results while the scan is still running.
+*/
+void scan::NdjsonWriter::write_batch(const vector<string>& t_lines)
+{
+    size_t data_size{0_sz};
+
+    for (const string& line : t_lines)
+    {
+        data_size += line.size() + 1_sz;
+    }
+
+    string data;
+    data.reserve(data_size);
+
+    for (const string& line : t_lines)
+    {
+        data.append(line).append(LF);
+    }
+
+    if (m_file.is_open())
+    {
+        filesystem_error error{path::make_error()};
+        m_file.write(data, error);
+
+        // Report write failures without terminating the writer thread
+        if (path::is_error(error))
+        {
+            util::errorf(error.what());
+        }
+        m_file.flush();
+    }
+    else  // Write lines to standard output
+    {
+        std::cout << data << std::flush;
+    }
+}
@@ -8,9 +8,14 @@
 #define WIN32_LEAN_AND_MEAN
 #endif // !WIN32_LEAN_AND_MEAN
 
+#ifdef _WIN32
 #include <winsock2.h>
 #include <ws2def.h>
 #include <ws2tcpip.h>
+#else
+#include <sys/resource.h>
+#endif // _WIN32
+
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <openssl/x509.h>
@@ -20,25 +25,34 @@
 #include "includes/inet/net.h"
 #include "includes/utils/literals.h"
 
+/**
+* @brief
+*     Get the banner policy of the given port number's
+*     service using the embedded port service database.
+*/
+scan::BannerPolicy scan::net::banner_policy(port_t t_port, bool t_tls)
+{
+    if (!valid_port(t_port))
+    {
+        throw ArgEx{INVALID_PORTS_MSG, "t_port"};
+    }
+    return banner_policy(port_record(t_port).service, t_tls);
+}
+
 /**
 * @brief
 *     Update the given network service information
-*     using the specified embedded text file resource.
+*     using the embedded port service database.
 */
-void scan::net::update_svc(const TextRc& t_csv_rc, SvcInfo& t_info, HostState t_state)
+void scan::net::update_svc(SvcInfo& t_info, HostState t_state)
 {
     if (!valid_port(t_info.port(), true))
     {
         throw ArgEx{INVALID_PORTS_MSG, "t_info"};
     }
 
-    string csv_line;
     t_info.state(t_state);
-
-    if (t_csv_rc.get_line(csv_line, t_info.port()))
-    {
-        t_info.parse_csv_line(csv_line);
-    }
+    t_info.parse_record(port_record(t_info.port()));
 }
 
 /**
@@ -109,6 +123,31 @@ bool scan::net::valid_port(const string& t_port, bool t_ign_zero)
     return !is_empty && is_integral && valid_port(std::stoi(t_port), t_ign_zero);
 }
 
+/**
+* @brief
+*     Get the number of sockets the current process may hold open at once. Derived
+*     from the process file descriptor limit minus the reserved descriptors when the
+*     limit can be queried. Windows has no per-process socket handle limit to query,
+*     so the default socket budget is used instead.
+*/
+size_t scan::net::socket_budget()
+{
+    size_t budget{SOCKET_BUDGET};
+
+#ifndef _WIN32
+    rlimit fd_limit{};
+
+    // Unlimited descriptors fall back to the default socket budget
+    if (getrlimit(RLIMIT_NOFILE, &fd_limit) == 0 && fd_limit.rlim_cur != RLIM_INFINITY)
+    {
+        const size_t max_fds{static_cast<size_t>(fd_limit.rlim_cur)};
+        budget = max_fds > RESERVED_FDS ? max_fds - RESERVED_FDS : 0_sz;
+    }
+#endif // !_WIN32
+
+    return budget;
+}
+
 /**
 * @brief
 *     Write a socket error message to the standard error stream.
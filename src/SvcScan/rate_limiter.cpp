@@ -0,0 +1,141 @@
+/*
+* @file
+*     rate_limiter.cpp
+* @brief
+*     Source file for a global and per-target connection rate limiter.
+*/
+#include <thread>
+#include "includes/inet/sockets/rate_limiter.h"
+#include "includes/ranges/algo.h"
+
+/**
+* @brief
+*     Initialize the object. A maximum rate of zero disables rate limiting.
+*/
+scan::RateLimiter::RateLimiter(size_t t_max_rate, size_t t_min_rate)
+    : m_bucket{static_cast<double>(t_max_rate), burst(static_cast<double>(t_max_rate))}
+{
+    m_max_rate = static_cast<double>(t_max_rate);
+    m_min_rate = (algo::min)(static_cast<double>(t_min_rate), m_max_rate);
+}
+
+/**
+* @brief
+*     Block execution until a connection is permitted by the global token bucket.
+*/
+void scan::RateLimiter::acquire()
+{
+    if (enabled())
+    {
+        microseconds delay{0};
+        {
+            scoped_lock lock{m_mtx};
+            delay = m_bucket.reserve();
+        }
+
+        if (delay > microseconds{0})
+        {
+            std::this_thread::sleep_for(delay);
+        }
+    }
+}
+
+/**
+* @brief
+*     Update the connection rate of the given target address using the result
+*     of a connection attempt. The baseline timeout ratio of the target is learned
+*     from its first connection results and then adapts slowly, so targets with
+*     many filtered ports are not mistaken for congested targets. The rate is
+*     halved at most once per backoff interval while the smoothed timeout ratio
+*     rises above the baseline by the spike threshold, otherwise each successful
+*     connection gradually restores the maximum rate.
+*/
+void scan::RateLimiter::update(const string& t_addr, bool t_timed_out)
+{
+    if (enabled())
+    {
+        scoped_lock lock{m_mtx};
+
+        TargetState& state{target_state(t_addr)};
+        const steady_time_point_t now{steady_clock::now()};
+
+        const double sample{t_timed_out ? 1.0 : 0.0};
+        const bool warming_up{++state.samples <= BASELINE_SAMPLES};
+
+        // Average the initial samples equally to establish the baseline
+        if (warming_up)
+        {
+            const double gain{1.0 / static_cast<double>(state.samples)};
+
+            state.baseline_ratio += (sample - state.baseline_ratio) * gain;
+            state.timeout_ratio = state.baseline_ratio;
+        }
+        else  // Track recent timeouts against the slowly adapting baseline
+        {
+            state.baseline_ratio += (sample - state.baseline_ratio) * BASELINE_GAIN;
+            state.timeout_ratio += (sample - state.timeout_ratio) * TIMEOUT_GAIN;
+        }
+
+        const bool backoff = !warming_up
+                          && state.timeout_ratio - state.baseline_ratio > TIMEOUT_SPIKE
+                          && now - state.backoff_time >= BACKOFF_INTERVAL;
+
+        if (backoff)
+        {
+            state.bucket.rate((algo::max)(state.bucket.rate() * BACKOFF_FACTOR, m_min_rate));
+            state.backoff_time = now;
+        }
+        else if (!t_timed_out)  // Gradually restore the maximum rate
+        {
+            const double rate{state.bucket.rate() + m_max_rate * RECOVERY_GAIN};
+            state.bucket.rate((algo::min)(rate, m_max_rate));
+        }
+    }
+}
+
+/**
+* @brief
+*     Determine whether connection rate limiting is enabled.
+*/
+bool scan::RateLimiter::enabled() const noexcept
+{
+    return m_max_rate > 0.0;
+}
+
+/**
+* @brief
+*     Reserve a connection to the given target address from the target token bucket
+*     without blocking. Returns the duration to wait until the target permits another
+*     connection, which is zero if the connection was reserved. The global token
+*     bucket must still be acquired once the target connection is reserved.
+*/
+std::chrono::microseconds scan::RateLimiter::try_acquire(const string& t_addr)
+{
+    microseconds delay{0};
+
+    if (enabled())
+    {
+        scoped_lock lock{m_mtx};
+        delay = target_state(t_addr).bucket.try_reserve();
+    }
+    return delay;
+}
+
+/**
+* @brief
+*     Get the token bucket burst capacity of the given connection rate.
+*/
+double scan::RateLimiter::burst(double t_rate) noexcept
+{
+    return (algo::max)(t_rate * BURST_SECONDS, 1.0);
+}
+
+/**
+* @brief
+*     Get the pacing state of the given target address, which is created at the
+*     maximum rate if it does not exist. The caller must lock the underlying mutex.
+*/
+scan::RateLimiter::TargetState& scan::RateLimiter::target_state(const string& t_addr)
+{
+    return m_states.try_emplace(t_addr, m_max_rate, burst(m_max_rate)).first->second;
+}
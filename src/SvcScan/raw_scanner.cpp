@@ -0,0 +1,386 @@
+/*
+* @file
+*     raw_scanner.cpp
+* @brief
+*     Source file for an IPv4 half-open (SYN) network scanner.
+*/
+#include <random>
+#include <thread>
+#include <utility>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
+#include "includes/errors/error_const_defs.h"
+#include "includes/errors/runtime_ex.h"
+#include "includes/inet/net.h"
+#include "includes/inet/net_const_defs.h"
+#include "includes/inet/scanners/raw_scanner.h"
+#include "includes/inet/services/svc_info.h"
+#include "includes/utils/const_defs.h"
+
+/**
+* @brief
+*     Initialize the object.
+*/
+scan::RawScanner::RawScanner(RawScanner&& t_scanner) noexcept
+    : TcpScanner{t_scanner.m_io_ctx, t_scanner.m_args_ap.load()}
+{
+    *this = std::move(t_scanner);
+}
+
+/**
+* @brief
+*     Initialize the object.
+*/
+scan::RawScanner::RawScanner(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp)
+    : TcpScanner{t_io_ctx, t_argsp}
+{
+    std::random_device rand_device;
+
+    m_cookie_key = rand_device();
+    m_src_port = static_cast<port_t>(PORT_DYNAMIC + m_cookie_key % (PORT_MAX - PORT_DYNAMIC));
+}
+
+/**
+* @brief
+*     Move assignment operator overload.
+*/
+scan::RawScanner& scan::RawScanner::operator=(RawScanner&& t_scanner) noexcept
+{
+    if (this != &t_scanner)
+    {
+        scoped_lock lock{m_syn_mtx};
+
+        m_cookie_key = t_scanner.m_cookie_key;
+        m_src_port = t_scanner.m_src_port;
+        m_syn_states = std::move(t_scanner.m_syn_states);
+
+        TcpScanner::operator=(std::move(t_scanner));
+    }
+    return *this;
+}
+
+/**
+* @brief
+*     Asynchronously read the next inbound packet from the given raw socket. Reads
+*     continue until the socket is closed, at which point the given promise is set.
+*/
+void scan::RawScanner::async_recv(raw_socket_t& t_socket,
+                                  packet_t& t_packet,
+                                  promise<void>& t_done)
+{
+    auto recv_callback = [this, &t_socket, &t_packet, &t_done](
+        const net_error_code_t& l_ecode, size_t l_bytes_read) -> void
+    {
+        if (net::is_error(l_ecode))
+        {
+            t_done.set_value();
+        }
+        else  // Process reply and read the next packet
+        {
+            on_reply(&t_packet[0], l_bytes_read);
+            async_recv(t_socket, t_packet, t_done);
+        }
+    };
+
+    t_socket.async_receive(asio::buffer(t_packet), std::move(recv_callback));
+}
+
+/**
+* @brief
+*     Parse the given inbound IPv4 packet and record the target port state if it
+*     is a SYN/ACK or RST reply to one of the SYN probes. Replies are validated
+*     statelessly by comparing the acknowledgment number to the SYN cookie, so
+*     replies from any number of targets can be matched without a lookup.
+*/
+void scan::RawScanner::on_reply(const uint8_t* t_datap, size_t t_size)
+{
+    const size_t header_size{t_size > 0 ? (t_datap[0] & 0x0f) * 4_sz : 0_sz};
+
+    const bool valid_packet = t_size >= IPV4_HEADER_MIN
+                           && t_datap[0] >> 4 == 4
+                           && t_datap[9] == IPPROTO_TCP
+                           && header_size >= IPV4_HEADER_MIN
+                           && t_size >= header_size + TCP_HEADER_MIN;
+
+    if (valid_packet)
+    {
+        const uint8_t* segmentp{t_datap + header_size};
+
+        // Replies are sent from the target to the local address
+        const route_t route{read_dword(&t_datap[12]), read_dword(&t_datap[16])};
+
+        const port_t port{read_word(&segmentp[0])};
+        const uint8_t flags{segmentp[13]};
+
+        const bool valid_reply = read_word(&segmentp[2]) == m_src_port
+                              && read_dword(&segmentp[8]) == syn_cookie(route, port) + 1U
+                              && (flags & TCP_FLAG_ACK) != 0;
+
+        if (valid_reply)
+        {
+            scoped_lock lock{m_syn_mtx};
+
+            if ((flags & TCP_FLAG_SYN) != 0)
+            {
+                m_syn_states[state_key(route.first, port)] = HostState::open;
+            }
+            else if ((flags & TCP_FLAG_RST) != 0)
+            {
+                m_syn_states[state_key(route.first, port)] = HostState::closed;
+            }
+        }
+    }
+}
+
+/**
+* @brief
+*     Submit a port scan task for the given endpoint. Only ports that replied to
+*     the SYN probes with a SYN/ACK are connected to for service probing.
+*/
+void scan::RawScanner::post_port_scan(const Endpoint& t_ep)
+{
+    const HostState state{syn_state(t_ep)};
+
+    if (state == HostState::open)
+    {
+        TcpScanner::post_port_scan(t_ep);
+    }
+    else  // Record the discovery results
+    {
+        // No connection is started, so release the pipeline slots
+        m_connect_sem.release();
+        m_queue_sem.release();
+
+        SvcInfo svc_info{t_ep};
+        net::update_svc(svc_info, state);
+
+        complete_task(std::move(svc_info));
+    }
+}
+
+/**
+* @brief
+*     Perform half-open port discovery, then scan the discovered open ports.
+*/
+void scan::RawScanner::scan_ports()
+{
+    syn_sweep();
+    TcpScanner::scan_ports();
+}
+
+/**
+* @brief
+*     Send a SYN probe to every port of every target on a raw socket while
+*     replies are read on a separate raw socket by the shared I/O context.
+*     Probes are interleaved across targets and paced by the global rate limit,
+*     and the connection timeout duration is waited after the last probe is sent.
+*/
+void scan::RawScanner::syn_sweep()
+{
+    net_error_code_t ecode;
+
+    raw_socket_t recv_socket{asio::make_strand(m_io_ctx)};
+    raw_socket_t send_socket{m_io_ctx};
+
+    recv_socket.open(RawTcp::v4(), ecode);
+
+    if (net::no_error(ecode))
+    {
+        send_socket.open(RawTcp::v4(), ecode);
+    }
+
+    if (net::is_error(ecode))
+    {
+        throw RuntimeEx{RAW_SOCKET_FAILED_MSG, "RawScanner::syn_sweep"};
+    }
+
+    vector<route_t> routes;
+
+    // Resolve the local address used to reach each target
+    for (const Hostname& target : targets)
+    {
+        const uint32_t dest_addr{ip::make_address_v4(target.addr()).to_uint()};
+        routes.emplace_back(dest_addr, local_addr(dest_addr));
+    }
+
+    packet_t packet{};
+    promise<void> recv_done;
+
+    async_recv(recv_socket, packet, recv_done);
+
+    // Send SYN probes to all target ports
+    {
+        scoped_lock lock{m_ports_mtx};
+
+        for (const port_t& port : ports)
+        {
+            for (const route_t& route : routes)
+            {
+                const segment_t segment{syn_segment(route, port)};
+                const RawTcp::endpoint dest_ep{ip::address_v4{route.first}, PORT_NULL};
+
+                m_limiter.acquire();
+                send_socket.send_to(asio::buffer(segment), dest_ep, 0, ecode);
+
+                if (net::is_error(ecode))
+                {
+                    break;
+                }
+            }
+
+            if (net::is_error(ecode))
+            {
+                break;
+            }
+        }
+    }
+
+    // Wait for the remaining replies
+    if (net::no_error(ecode))
+    {
+        std::this_thread::sleep_for(static_cast<milliseconds>(m_timeout));
+    }
+
+    asio::post(recv_socket.get_executor(), [&recv_socket]() -> void
+    {
+        net_error_code_t discard_ecode;
+        recv_socket.close(discard_ecode);
+    });
+    recv_done.get_future().wait();
+
+    if (net::is_error(ecode))
+    {
+        throw RuntimeEx{RAW_SOCKET_FAILED_MSG, "RawScanner::syn_sweep"};
+    }
+}
+
+/**
+* @brief
+*     Calculate the TCP checksum of the given segment, including the IPv4
+*     pseudo-header. The given route holds the target and local addresses.
+*/
+uint16_t scan::RawScanner::checksum(const segment_t& t_segment,
+                                    const route_t& t_route)
+    const noexcept
+{
+    const auto& [dest_addr, src_addr] = t_route;
+
+    uint32_t sum{(src_addr >> 16) + (src_addr & 0xffff)};
+    sum += (dest_addr >> 16) + (dest_addr & 0xffff);
+    sum += static_cast<uint32_t>(IPPROTO_TCP + t_segment.size());
+
+    for (size_t i{0_sz}; i < t_segment.size(); i += 2)
+    {
+        sum += read_word(&t_segment[i]);
+    }
+
+    // Fold the carry bits into the lower 16 bits
+    while (sum >> 16 != 0)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return static_cast<uint16_t>(~sum);
+}
+
+/**
+* @brief
+*     Get the local IPv4 address used to route packets to the given target address.
+*/
+uint32_t scan::RawScanner::local_addr(uint32_t t_dest_addr) const
+{
+    net_error_code_t ecode;
+    ip::udp::endpoint local_ep;
+
+    ip::udp::socket socket{m_io_ctx};
+    socket.connect({ip::address_v4{t_dest_addr}, PORT_MAX}, ecode);
+
+    if (net::no_error(ecode))
+    {
+        local_ep = socket.local_endpoint(ecode);
+    }
+
+    if (net::is_error(ecode))
+    {
+        throw RuntimeEx{RAW_SOCKET_FAILED_MSG, "RawScanner::local_addr"};
+    }
+    return local_ep.address().to_v4().to_uint();
+}
+
+/**
+* @brief
+*     Calculate the SYN cookie (initial sequence number) for the given route and
+*     target port. The cookie is an FNV-1A hash of the secret key and connection tuple.
+*/
+uint32_t scan::RawScanner::syn_cookie(const route_t& t_route, port_t t_port) const noexcept
+{
+    const array<uint32_t, 4> fields
+    {
+        m_cookie_key,
+        t_route.second,
+        t_route.first,
+        static_cast<uint32_t>(m_src_port) << 16 | t_port
+    };
+
+    size_t hash{FNV_OFFSET_BASIS};
+
+    for (const uint32_t& field : fields)
+    {
+        for (uint32_t shift{0U}; shift < 32U; shift += 8U)
+        {
+            hash ^= static_cast<size_t>(field >> shift & 0xff);
+            hash *= FNV_PRIME;
+        }
+    }
+    return static_cast<uint32_t>(hash);
+}
+
+/**
+* @brief
+*     Get the discovered state of the given endpoint. Locks the SYN reply state map mutex.
+*/
+scan::HostState scan::RawScanner::syn_state(const Endpoint& t_ep) const
+{
+    HostState state{HostState::unknown};
+    const uint64_t key{state_key(ip::make_address_v4(t_ep.addr).to_uint(), t_ep.port)};
+
+    scoped_lock lock{m_syn_mtx};
+
+    if (m_syn_states.contains(key))
+    {
+        state = m_syn_states.at(key);
+    }
+    return state;
+}
+
+/**
+* @brief
+*     Create a TCP SYN segment (with an MSS option) for the given route and target port.
+*/
+scan::RawScanner::segment_t scan::RawScanner::syn_segment(const route_t& t_route,
+                                                          port_t t_port)
+    const noexcept
+{
+    segment_t segment{};
+
+    write_word(&segment[0], m_src_port);
+    write_word(&segment[2], t_port);
+    write_dword(&segment[4], syn_cookie(t_route, t_port));
+
+    segment[12] = static_cast<uint8_t>(TCP_HEADER_SIZE / 4 << 4);
+    segment[13] = TCP_FLAG_SYN;
+
+    write_word(&segment[14], WINDOW_SIZE);
+
+    // Maximum segment size option
+    segment[20] = 2;
+    segment[21] = 4;
+    write_word(&segment[22], MSS);
+
+    write_word(&segment[16], checksum(segment, t_route));
+    return segment;
+}
@@ -4,6 +4,9 @@
 * @brief
 *     Source file for network application service information.
 */
+#include <algorithm>
+#include <cctype>
+#include <string_view>
 #include "includes/console/util.h"
 #include "includes/errors/error_const_defs.h"
 #include "includes/errors/runtime_ex.h"
@@ -48,29 +51,51 @@ scan::SvcInfo::SvcInfo(const Endpoint& t_ep, const string& t_banner, HostState t
 
 /**
 * @brief
-*     Parse the given network application socket banner.
+*     Parse the given network application socket banner. The banner is parsed
+*     in place, so owned strings are only created for the resulting fields.
 */
-void scan::SvcInfo::parse_banner(const string& t_banner)
+void scan::SvcInfo::parse_banner(string_view t_banner)
 {
     if (!t_banner.empty())
     {
-        banner = algo::up_to_last_eol(t_banner);
+        const string_view banner_view{algo::up_to_last_eol(t_banner)};
+
+        banner = banner_view;
         state(HostState::open);
 
-        if (algo::count(banner, CHAR_DASH) >= 2)
+        size_t version_end{NPOS};
+        const size_t name_end{banner_view.find(CHAR_DASH)};
+
+        if (!algo::is_npos(name_end))
+        {
+            version_end = banner_view.find(CHAR_DASH, name_end + 1_sz);
+        }
+
+        // Parse the service name, version and summary fields
+        if (!algo::is_npos(version_end))
         {
-            const string_array_t fields{algo::split<3>(banner, "-")};
+            const string_view name{banner_view.substr(0_sz, name_end)};
+            const string_view version{banner_view.substr(name_end + 1_sz,
+                                                         version_end - name_end - 1_sz)};
+
+            service.clear();
+            service.reserve(name.size() + version.size() + 3_sz);
 
-            service = algo::fstr("% (%)",
-                                 algo::to_lower(fields[0]),
-                                 algo::to_lower(fields[1]));
+            service.append(name).append(" (").append(version).append(")");
 
-            summary = algo::replace(fields[2], "_", " ");
+            // Bytes must be passed to tolower as unsigned char values
+            ranges::transform(service, service.begin(), [](unsigned char l_ch) -> char
+            {
+                return static_cast<char>(std::tolower(l_ch));
+            });
+
+            summary = banner_view.substr(version_end + 1_sz);
+            ranges::replace(summary, '_', ' ');
         }
         else  // Unable to detect extended service info
         {
             service = SVC_UNKNOWN;
-            summary = abbreviate<35>(algo::up_to_first_eol(banner));
+            summary = abbreviate<35>(algo::up_to_first_eol(banner_view));
         }
     }
 }
@@ -128,15 +153,53 @@ std::string scan::SvcInfo::details(bool t_colorize) const
         stream << LF << tls_details(t_colorize);
     }
 
+    // Include SSL/TLS enumeration results
+    if (!tls_versions.empty())
+    {
+        stream << LF << tls_enum_details(t_colorize);
+    }
+
     // Include HTTP request/response details
     if (response.valid())
     {
         stream << LF << request_details(t_colorize)
                << LF << response_details(t_colorize);
     }
+
+    // Include additional HTTP request URI responses
+    if (!path_responses.empty())
+    {
+        stream << LF << paths_details(t_colorize);
+    }
     return algo::normalize_eol(stream.str());
 }
 
+/**
+* @brief
+*     Get the underlying additional HTTP request URI response
+*     details as a string. Optionally colorize the resulting details.
+*/
+std::string scan::SvcInfo::paths_details(bool t_colorize) const
+{
+    sstream stream;
+    size_t uri_width{0_sz};
+
+    for (const auto& [uri, path_response] : path_responses)
+    {
+        uri_width = std::max(uri_width, uri.size() + 2_sz);
+    }
+    stream << util::fmt_field("Request Paths  ", t_colorize) << LF;
+
+    // Include the response status of each request URI
+    for (const auto& [uri, path_response] : path_responses)
+    {
+        stream << algo::pad(4_sz)
+               << algo::pad(uri, uri_width)
+               << path_response.status_code() << " " << path_response.reason() << LF;
+    }
+    return stream.str();
+}
+
 /**
 * @brief
 *     Get the underlying HTTP request details as a
@@ -191,11 +254,20 @@ std::string scan::SvcInfo::response_details(bool t_colorize) const
            << util::fmt_field("Response Headers", t_colorize)          << LF
            << response.raw_headers(algo::pad(4_sz))                    << LF;
 
+    // Indicate that the message body was truncated or not read
+    if (response.truncated())
+    {
+        stream << util::fmt_field("Response Body   ", "truncated", t_colorize) << LF;
+    }
+
     // Include the message body
     if (!response.body().empty())
     {
-        stream << util::fmt_field("Response Body   ", t_colorize) << LF
-               << response.body(algo::pad(4_sz))                  << LF;
+        if (!response.truncated())
+        {
+            stream << util::fmt_field("Response Body   ", t_colorize) << LF;
+        }
+        stream << response.body(algo::pad(4_sz)) << LF;
     }
     return stream.str();
 }
@@ -214,3 +286,30 @@ std::string scan::SvcInfo::tls_details(bool t_colorize) const
 
     return stream.str();
 }
+
+/**
+* @brief
+*     Get the underlying SSL/TLS enumeration details.
+*     Optionally colorize the resulting details.
+*/
+std::string scan::SvcInfo::tls_enum_details(bool t_colorize) const
+{
+    sstream stream;
+
+    const string groups{algo::join(tls_groups, ", ")};
+    const string versions{algo::join(tls_versions, ", ")};
+
+    stream << util::fmt_field("TLS Versions ", versions, t_colorize) << LF
+           << util::fmt_field("TLS Groups   ", groups, t_colorize)   << LF
+           << util::fmt_field("TLS Ciphers  ", t_colorize)           << LF;
+
+    // Include the accepted cipher suites of each version
+    for (const auto& [version, suites] : tls_ciphers)
+    {
+        for (const string& suite : suites)
+        {
+            stream << algo::pad(4_sz) << algo::pad(version, 8_sz) << suite << LF;
+        }
+    }
+    return stream.str();
+}
@@ -11,23 +11,21 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <winsock2.h>
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/io_context.hpp>
-#include <boost/asio/placeholders.hpp>
+#include <boost/asio/redirect_error.hpp>
 #include <boost/asio/socket_base.hpp>
-#include <boost/beast/core/flat_buffer.hpp>
-#include <boost/beast/http/error.hpp>
-#include <boost/beast/http/parser.hpp>
-#include <boost/beast/http/read.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/beast/http/verb.hpp>
-#include <boost/beast/http/write.hpp>
-#include <boost/bind/bind.hpp>
 #include "includes/console/util.h"
 #include "includes/errors/arg_ex.h"
 #include "includes/errors/error_const_defs.h"
+#include "includes/errors/logic_ex.h"
 #include "includes/errors/runtime_ex.h"
 #include "includes/inet/sockets/tcp_client.h"
 #include "includes/utils/literals.h"
@@ -45,27 +43,38 @@ scan::TcpClient::TcpClient(TcpClient&& t_client) noexcept : m_io_ctx{t_client.m_
 * @brief
 *     Initialize the object.
 */
+scan::TcpClient::TcpClient(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp)
+    : TcpClient{t_io_ctx, t_argsp, std::make_unique<stream_t>(asio::make_strand(t_io_ctx))}
+{
+}
+
+/**
+* @brief
+*     Initialize the object using the given TCP stream smart pointer. Derived
+*     clients that provide their own stream pass a null pointer, so that no
+*     unused TCP stream is allocated.
+*/
 scan::TcpClient::TcpClient(io_context_t& t_io_ctx,
                            shared_ptr<Args> t_argsp,
-                           shared_ptr<TextRc> t_rcp)
+                           unique_ptr<stream_t>&& t_streamp)
     : m_io_ctx{t_io_ctx}
 {
     m_connected = false;
     m_verbose = false;
 
-    m_rc_ap = t_rcp;
-    m_streamp = std::make_unique<stream_t>(m_io_ctx);
+    m_streamp = std::move(t_streamp);
 
     parse_argsp(t_argsp);
 }
 
 /**
 * @brief
-*     Destroy the object.
+*     Destroy the object. Derived clients that
+*     provide their own stream close it themselves.
 */
 scan::TcpClient::~TcpClient()
 {
-    if (is_open())
+    if (m_streamp != nullptr && is_open())
     {
         net_error_code_t ecode;
         socket().close(ecode);
@@ -81,9 +90,9 @@ scan::TcpClient& scan::TcpClient::operator=(TcpClient&& t_client) noexcept
     if (this != &t_client)
     {
         m_args_ap = std::move(t_client.m_args_ap.load());
+        m_banner_buffer = std::move(t_client.m_banner_buffer);
         m_connected = t_client.m_connected;
         m_ecode = std::move(t_client.m_ecode);
-        m_rc_ap = std::move(t_client.m_rc_ap.load());
         m_remote_ep = std::move(t_client.m_remote_ep);
         m_streamp = std::move(t_client.m_streamp);
         m_svc_info = std::move(t_client.m_svc_info);
@@ -115,28 +124,12 @@ void scan::TcpClient::close()
 */
 void scan::TcpClient::connect(const Endpoint& t_ep)
 {
-    if (!net::valid_endpoint(m_remote_ep = t_ep))
-    {
-        throw ArgEx{INVALID_ENDPOINT_MSG, "t_ep"};
-    }
-
-    m_svc_info.addr = t_ep.addr;
-    m_svc_info.port(t_ep.port);
-
-    // Perform DNS name resolution
-    const results_t results{net::resolve(m_io_ctx, m_remote_ep, m_ecode)};
-
-    // Establish the connection
-    if (success_check())
-    {
-        async_connect(results);
-        async_await();
-    }
+    co_wait(co_connect(t_ep));
 }
 
 /**
 * @brief
-*     Establish a network connection to underlying target on the given port.
+*     Establish a network connection to the underlying remote host on the given port.
 */
 void scan::TcpClient::connect(port_t t_port)
 {
@@ -148,13 +141,9 @@ void scan::TcpClient::connect(port_t t_port)
     // Unknown remote host address
     if (m_remote_ep.addr.empty() || m_remote_ep.addr == IPV4_ANY)
     {
-        if (m_args_ap.load()->target.addr().empty())
-        {
-            throw RuntimeEx{INVALID_TARGET_MSG, "TcpClient::connect"};
-        }
-        m_remote_ep = {m_args_ap.load()->target.addr(), t_port};
+        throw RuntimeEx{INVALID_TARGET_MSG, "TcpClient::connect"};
     }
-    connect(m_remote_ep);
+    connect(Endpoint{m_remote_ep.addr, t_port});
 }
 
 /**
@@ -170,6 +159,39 @@ void scan::TcpClient::disconnect()
     m_connected = false;
 }
 
+/**
+* @brief
+*     Disconnect from the underlying remote endpoint and establish a new
+*     connection to it. The underlying service information is preserved.
+*/
+void scan::TcpClient::reconnect()
+{
+    disconnect();
+    connect(Endpoint{m_remote_ep});
+}
+
+/**
+* @brief
+*     Reset the client so that it can be reused for another connection. Closes
+*     the underlying TCP socket and clears the connection state, the remote
+*     endpoint and the service information.
+*/
+void scan::TcpClient::reset()
+{
+    if (is_open())
+    {
+        net_error_code_t discard_ecode;
+        socket().close(discard_ecode);
+    }
+    stream().expires_never();
+
+    m_connected = false;
+    m_ecode.clear();
+    m_remote_ep = {};
+    m_svc_info.reset();
+    m_timeout = m_args_ap.load()->timeout;
+}
+
 /**
 * @brief
 *     Shutdown further communications on the underlying TCP socket.
@@ -194,21 +216,32 @@ bool scan::TcpClient::is_open() const noexcept
 
 /**
 * @brief
-*     Read inbound data from the underlying socket stream.
+*     Release ownership of the native handle of the underlying connected TCP socket.
+*     The client is disconnected afterwards, but its remote endpoint and service
+*     information are retained so that it can reconnect to the same endpoint.
 */
-size_t scan::TcpClient::recv(buffer_t& t_buffer)
+scan::native_socket_t scan::TcpClient::release_socket()
 {
-    string data;
-    size_t bytes_read{0_sz};
-
-    if (connected_check())
+    if (!is_connected())
     {
-        recv_timeout(RECV_TIMEOUT);
-
-        const mutable_buffer_t mut_buffer{&t_buffer[0], sizeof t_buffer};
-        bytes_read = stream().read_some(mut_buffer, m_ecode);
+        throw LogicEx{CLIENT_DISCONNECTED_MSG, "TcpClient::release_socket"};
     }
-    return bytes_read;
+    stream().expires_never();
+
+    const native_socket_t handle{socket().release(m_ecode)};
+    m_connected = !success_check();
+
+    return handle;
+}
+
+/**
+* @brief
+*     Read inbound data from the underlying socket stream. Waits for
+*     data until the given receive timeout duration has elapsed.
+*/
+size_t scan::TcpClient::recv(buffer_t& t_buffer, const Timeout& t_timeout)
+{
+    return co_wait(co_recv_some(t_buffer, t_timeout));
 }
 
 /**
@@ -217,57 +250,67 @@ size_t scan::TcpClient::recv(buffer_t& t_buffer)
 */
 size_t scan::TcpClient::send(const string& t_payload)
 {
-    size_t bytes_sent{0_sz};
-
-    if (connected_check())
-    {
-        send_timeout(SEND_TIMEOUT);
-
-        if (connected_check() && !t_payload.empty())
-        {
-            bytes_sent = stream().write_some(asio::buffer(t_payload), m_ecode);
-        }
-    }
-    return bytes_sent;
+    return co_wait(co_send(t_payload));
 }
 
 /**
 * @brief
-*     Send the given HTTP request and return the server's response.
+*     Read the service banner from the underlying socket stream into the reusable
+*     banner buffer. The first read waits until the given receive timeout elapses,
+*     then reads are accumulated until the given byte budget is exhausted, a banner
+*     terminator is received, or no data arrives within the banner idle gap.
 */
-scan::Response<> scan::TcpClient::request(const Request<>& t_request)
+std::string_view scan::TcpClient::recv_banner(size_t t_max_bytes, const Timeout& t_timeout)
 {
-    if (!t_request.valid())
-    {
-        throw ArgEx{INVALID_REQUEST_MSG, "t_request"};
-    }
-    Response response;
+    size_t bytes_read{0_sz};
 
-    // Perform HTTP communications
     if (connected_check())
     {
-        http::write(stream(), t_request.message(), m_ecode);
+        bool reading{t_max_bytes > 0_sz};
+
+        // Buffer only grows, so recycled clients reuse their allocation
+        if (m_banner_buffer.size() < t_max_bytes)
+        {
+            m_banner_buffer.resize(t_max_bytes);
+        }
+        recv_timeout(t_timeout);
 
-        if (success_check())
+        while (reading)
         {
-            http::response_parser<string_body_t> parser;
-            flat_buffer_t& buffer{response.buffer};
+            const mutable_buffer_t mut_buffer{&m_banner_buffer[bytes_read],
+                                              t_max_bytes - bytes_read};
 
-            size_t bytes_read{http::read_header(stream(), buffer, parser, m_ecode)};
+            const size_t count{read_some(mut_buffer)};
+            const string_view banner{m_banner_buffer.data(), bytes_read += count};
 
-            if (m_ecode != http::error::bad_version && success_check(true, true))
-            {
-                do  // Read until end reached or message fully parsed
-                {
-                    bytes_read = http::read(stream(), buffer, parser, m_ecode);
-                }
-                while (bytes_read > 0 && net::no_error(m_ecode));
+            reading = count > 0_sz
+                   && bytes_read < t_max_bytes
+                   && net::no_error(m_ecode)
+                   && !net::banner_complete(banner);
 
-                response.parse(parser.get());
+            // Wait for the remaining data using the idle gap
+            if (reading && bytes_read == count)
+            {
+                recv_timeout(BANNER_IDLE_TIMEOUT);
             }
         }
+
+        // Received banner data indicates that the service is open
+        if (bytes_read > 0_sz)
+        {
+            m_ecode.clear();
+        }
     }
-    return response;
+    return string_view{m_banner_buffer.data(), bytes_read};
+}
+
+/**
+* @brief
+*     Send the given HTTP request and return the server's response.
+*/
+scan::Response<> scan::TcpClient::request(const Request<>& t_request)
+{
+    return co_wait(co_request(t_request));
 }
 
 /**
@@ -299,28 +342,73 @@ scan::Response<> scan::TcpClient::request(verb_t t_method,
 
 /**
 * @brief
-*     Await the completion of the most recent asynchronous operation.
+*     Establish a network connection to the given TCP endpoint. The returned
+*     coroutine must be spawned on or awaited from the client's strand executor.
 */
-void scan::TcpClient::async_await()
+scan::awaitable_t<> scan::TcpClient::co_connect(Endpoint t_ep)
 {
-    m_io_ctx.run();
-    m_io_ctx.restart();
+    if (!net::valid_endpoint(m_remote_ep = t_ep))
+    {
+        throw ArgEx{INVALID_ENDPOINT_MSG, "t_ep"};
+    }
+
+    m_svc_info.addr = t_ep.addr;
+    m_svc_info.port(t_ep.port);
+
+    // Perform DNS name resolution
+    const results_t results{net::resolve(m_io_ctx, m_remote_ep, m_ecode)};
+
+    // Establish the connection
+    if (success_check())
+    {
+        auto token{asio::redirect_error(asio::use_awaitable, m_ecode)};
+
+        stream().expires_after(static_cast<milliseconds>(m_timeout));
+
+        const endpoint_t ep{co_await stream().async_connect(results, token)};
+        on_connect(m_ecode, ep);
+    }
 }
 
 /**
 * @brief
-*     Asynchronously establish a network connection on the underlying
-*     TCP socket. Does not wait for completion and returns immediately.
+*     Read inbound data from the underlying socket stream. Waits for data
+*     until the given receive timeout duration has elapsed. The given
+*     buffer must remain valid until the returned coroutine completes.
 */
-void scan::TcpClient::async_connect(const results_t& t_results)
+scan::awaitable_t<size_t> scan::TcpClient::co_recv_some(buffer_t& t_buffer,
+                                                        Timeout t_timeout)
 {
-    auto connect_callback = boost::bind(&TcpClient::on_connect,
-                                        this,
-                                        asio::placeholders::error,
-                                        asio::placeholders::endpoint);
+    return co_recv_some(stream(), t_buffer, t_timeout);
+}
 
-    stream().expires_after(static_cast<milliseconds>(m_timeout));
-    stream().async_connect(t_results, std::move(connect_callback));
+/**
+* @brief
+*     Write the given string payload to the underlying socket stream.
+*/
+scan::awaitable_t<size_t> scan::TcpClient::co_send(string t_payload)
+{
+    return co_send(stream(), std::move(t_payload));
+}
+
+/**
+* @brief
+*     Send the given HTTP request and return the server's response.
+*/
+scan::awaitable_t<scan::Response<>> scan::TcpClient::co_request(Request<> t_request)
+{
+    return co_request(stream(), std::move(t_request));
+}
+
+/**
+* @brief
+*     Get the strand executor of the underlying socket stream. Coroutine socket
+*     operations must be spawned on this executor, so that their completion
+*     handlers and timeout handlers never execute concurrently.
+*/
+scan::executor_t scan::TcpClient::executor() noexcept
+{
+    return stream().get_executor();
 }
 
 /**
@@ -336,17 +424,12 @@ void scan::TcpClient::error(const net_error_code_t& t_ecode)
     {
         net::error(m_remote_ep, m_ecode);
     }
-
-    if (m_rc_ap.load() == nullptr)
-    {
-        throw RuntimeEx{NULL_PTR_DEREF_MSG, "TcpClient::error"};
-    }
-    net::update_svc(*m_rc_ap.load(), m_svc_info, state);
+    net::update_svc(m_svc_info, state);
 }
 
 /**
 * @brief
-*     Callback handler for asynchronous connect operations.
+*     Completion handler for coroutine connect operations.
 */
 void scan::TcpClient::on_connect(const net_error_code_t& t_ecode, Endpoint t_ep)
 {
@@ -380,7 +463,6 @@ void scan::TcpClient::on_connect(const net_error_code_t& t_ecode, Endpoint t_ep)
 void scan::TcpClient::parse_argsp(shared_ptr<Args> t_argsp)
 {
     m_args_ap = t_argsp;
-    m_svc_info.addr = t_argsp->target;
     m_timeout = t_argsp->timeout;
     m_verbose = t_argsp->verbose;
 }
@@ -394,15 +476,6 @@ void scan::TcpClient::recv_timeout(const Timeout& t_timeout)
     set_timeout<SO_RCVTIMEO>(t_timeout);
 }
 
-/**
-* @brief
-*     Set the timeout for synchronous socket send operations.
-*/
-void scan::TcpClient::send_timeout(const Timeout& t_timeout)
-{
-    set_timeout<SO_SNDTIMEO>(t_timeout);
-}
-
 /**
 * @brief
 *     Returns true if connected, otherwise false (and displays error).
@@ -445,6 +518,15 @@ bool scan::TcpClient::success_check(const net_error_code_t& t_ecode,
     return success;
 }
 
+/**
+* @brief
+*     Read inbound data from the underlying socket stream into the given buffer.
+*/
+size_t scan::TcpClient::read_some(const mutable_buffer_t& t_buffer)
+{
+    return stream().read_some(t_buffer, m_ecode);
+}
+
 /**
 * @brief
 *     Get a constant reference to the underlying TCP socket stream.
@@ -5,12 +5,16 @@
 *     Source file for an IPv4 TCP network scanner.
 */
 #include <algorithm>
+#include <exception>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
+#include <boost/asio/co_spawn.hpp>
 #include <boost/asio/io_context.hpp>
 #include "includes/concepts/concepts.h"
 #include "includes/console/util.h"
@@ -21,7 +25,6 @@
 #include "includes/inet/net.h"
 #include "includes/inet/scanners/tcp_scanner.h"
 #include "includes/inet/sockets/host_state.h"
-#include "includes/resources/resource.h"
 #include "includes/utils/const_defs.h"
 #include "includes/utils/json.h"
 #include "includes/utils/literals.h"
@@ -31,7 +34,17 @@
 *     Initialize the object.
 */
 scan::TcpScanner::TcpScanner(TcpScanner&& t_scanner) noexcept
-    : m_io_ctx{t_scanner.m_io_ctx}
+    : m_io_ctx{t_scanner.m_io_ctx},
+      m_pool{(algo::min)(INITIAL_PROBES, t_scanner.m_probe_limit.max_limit()),
+             t_scanner.m_probe_limit.max_limit()},
+      m_io_pool{IO_THREADS},
+      m_connect_sem{static_cast<ptrdiff_t>(t_scanner.m_args_ap.load()->connects)},
+      m_queue_sem{static_cast<ptrdiff_t>(probe_queue_size(*t_scanner.m_args_ap.load()))},
+      m_clients{t_scanner.m_io_ctx,
+                t_scanner.m_args_ap.load(),
+                max_clients(*t_scanner.m_args_ap.load())},
+      m_limiter{t_scanner.m_args_ap.load()->max_rate, t_scanner.m_args_ap.load()->min_rate},
+      m_probe_limit{INITIAL_PROBES, MIN_PROBES, t_scanner.m_probe_limit.max_limit()}
 {
     *this = std::move(t_scanner);
 }
@@ -41,9 +54,16 @@ scan::TcpScanner::TcpScanner(TcpScanner&& t_scanner) noexcept
 *     Initialize the object.
 */
 scan::TcpScanner::TcpScanner(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp)
-    : m_io_ctx{t_io_ctx}, m_pool{t_argsp->threads}
+    : m_io_ctx{t_io_ctx},
+      m_pool{(algo::min)(INITIAL_PROBES, max_probes(*t_argsp)), max_probes(*t_argsp)},
+      m_io_pool{IO_THREADS},
+      m_connect_sem{static_cast<ptrdiff_t>(t_argsp->connects)},
+      m_queue_sem{static_cast<ptrdiff_t>(probe_queue_size(*t_argsp))},
+      m_clients{t_io_ctx, t_argsp, max_clients(*t_argsp)},
+      m_limiter{t_argsp->max_rate, t_argsp->min_rate},
+      m_probe_limit{INITIAL_PROBES, MIN_PROBES, max_probes(*t_argsp)}
 {
-    m_rc_ap = std::make_shared<TextRc>(CSV_DATA);
+    m_active_count = m_completed_count = m_task_count = 0_sz;
     parse_argsp(t_argsp);
 }
 
@@ -55,38 +75,49 @@ scan::TcpScanner& scan::TcpScanner::operator=(TcpScanner&& t_scanner) noexcept
 {
     if (this != &t_scanner)
     {
-        scoped_lock lock{m_ports_mtx, m_services_mtx, m_statuses_mtx};
+        scoped_lock lock{m_latency_mtx, m_ports_mtx, m_rtt_mtx};
 
         m_args_ap = std::move(t_scanner.m_args_ap.load());
-        m_rc_ap = std::move(t_scanner.m_rc_ap.load());
-        m_services = std::move(t_scanner.m_services);
-        m_statuses = std::move(t_scanner.m_statuses);
+        m_active_count = t_scanner.m_active_count.load();
+        m_completed_count = t_scanner.m_completed_count.load();
+        m_min_latencies = std::move(t_scanner.m_min_latencies);
+        m_min_timeout = std::move(t_scanner.m_min_timeout);
+        m_rtt_estimators = std::move(t_scanner.m_rtt_estimators);
+        m_task_count = t_scanner.m_task_count.load();
         m_timeout = std::move(t_scanner.m_timeout);
         m_timer = std::move(t_scanner.m_timer);
         m_uri = std::move(t_scanner.m_uri);
 
         out_json = t_scanner.out_json.load();
+        out_ndjson = t_scanner.out_ndjson.load();
         out_path = std::move(t_scanner.out_path);
         ports = std::move(t_scanner.ports);
-        target = std::move(t_scanner.target);
+        targets = std::move(t_scanner.targets);
         verbose = t_scanner.verbose.load();
+
+        for (SvcInfo& svc_info : t_scanner.m_services.take_all())
+        {
+            m_services.push(std::move(svc_info));
+        }
     }
     return *this;
 }
 
 /**
 * @brief
-*     Perform the network service scan against the
-*     target. Locks the underlying port list mutex.
+*     Perform the network service scan against the targets. All connections
+*     are driven by the shared I/O context, which keeps a bounded number
+*     of asynchronous connect operations in flight at any given time.
 */
 void scan::TcpScanner::scan()
 {
-    if (!target.valid())
+    const bool valid_targets{!targets.empty() && ranges::all_of(targets, &Hostname::valid)};
+
+    if (!valid_targets)
     {
         throw RuntimeEx{INVALID_TARGET_MSG, "TcpScanner::scan"};
     }
 
-    // Post scan tasks to the thread pool
     {
         scoped_lock lock{m_ports_mtx};
 
@@ -95,36 +126,119 @@ void scan::TcpScanner::scan()
             throw RuntimeEx{INVALID_PORTS_MSG, "TcpScanner::scan"};
         }
         scan_startup();
-
-        for (const port_t& port : ports)
-        {
-            post_port_scan(port);
-        }
     }
 
-    m_pool.wait();
+    work_guard_t io_guard{m_io_ctx.get_executor()};
+    start_io();
+
+    scan_ports();
+
+    io_guard.reset();
+    m_io_pool.wait();
+
     scan_shutdown();
 }
 
 /**
 * @brief
-*     Block execution until all outstanding scan tasks in
-*     the underlying thread pool have completed executing.
+*     Block execution until all outstanding port scan tasks have completed
+*     executing, then stop the service probing thread pool workers.
 */
 void scan::TcpScanner::wait()
 {
+    const size_t total_tasks{task_count()};
+    size_t completed{completed_tasks()};
+
+    // Wait for the final task completion notification
+    while (completed < total_tasks)
+    {
+        m_completed_count.wait(completed, std::memory_order_acquire);
+        completed = completed_tasks();
+    }
+
     m_pool.wait();
 }
 
 /**
 * @brief
-*     Add service information to the underlying service
-*     list. Locks the underlying service list mutex.
+*     Determine whether the connection that received the given HTTP response can be
+*     reused for another request. The server must keep the connection alive, and the
+*     response must have been read in full so no unread body data remains.
 */
-void scan::TcpScanner::add_service(const SvcInfo& t_info)
+bool scan::TcpScanner::reusable(const Response<>& t_response)
 {
-    scoped_lock lock{m_services_mtx};
-    m_services.emplace_back(t_info);
+    return t_response.valid() && !t_response.truncated() && t_response.message().keep_alive();
+}
+
+/**
+* @brief
+*     Get the maximum number of TCP clients that may be in use at once with the
+*     given command-line arguments, which includes connecting, queued and probing
+*     clients. Used to size the client pool, so that releasing never reallocates.
+*/
+size_t scan::TcpScanner::max_clients(const Args& t_args) noexcept
+{
+    return t_args.connects + probe_queue_size(t_args) + max_probes(t_args);
+}
+
+/**
+* @brief
+*     Get the maximum service probing concurrency of the given command-line
+*     arguments. Each probing worker holds an open socket, so the limit is also
+*     bounded by the process socket budget minus the sockets that connecting
+*     and queued clients may hold.
+*/
+size_t scan::TcpScanner::max_probes(const Args& t_args) noexcept
+{
+    static const size_t budget{net::socket_budget()};
+    const size_t reserved{t_args.connects + probe_queue_size(t_args)};
+
+    size_t probes{t_args.threads > 0 ? t_args.threads : MAX_PROBES};
+
+    if (reserved + MIN_PROBES < budget)
+    {
+        probes = (algo::min)(probes, budget - reserved);
+    }
+    else  // Socket budget exhausted by connecting and queued clients
+    {
+        probes = (algo::min)(probes, MIN_PROBES);
+    }
+    return probes;
+}
+
+/**
+* @brief
+*     Get the maximum number of connected clients that may be queued for
+*     service probing with the given command-line arguments.
+*/
+size_t scan::TcpScanner::probe_queue_size(const Args& t_args) noexcept
+{
+    return (algo::max)(t_args.connects, PROBE_QUEUE_SIZE);
+}
+
+/**
+* @brief
+*     Record the results of a completed port scan task. The service information
+*     is streamed to the NDJSON writer when NDJSON output is enabled, otherwise
+*     it is moved onto the lock-free service information stack.
+*/
+void scan::TcpScanner::complete_task(SvcInfo&& t_info)
+{
+    if (out_ndjson)
+    {
+        m_writer.write(json::ndjson_line(t_info));
+    }
+    else  // Retain results for the scan report
+    {
+        m_services.push(std::move(t_info));
+    }
+    m_active_count.fetch_sub(1_sz, std::memory_order_relaxed);
+
+    // Only the waiting thread needs to be notified of the final task completion
+    if (m_completed_count.fetch_add(1_sz, std::memory_order_acq_rel) + 1_sz >= task_count())
+    {
+        m_completed_count.notify_all();
+    }
 }
 
 /**
@@ -135,62 +249,103 @@ void scan::TcpScanner::add_service(const SvcInfo& t_info)
 void scan::TcpScanner::parse_argsp(shared_ptr<Args> t_argsp)
 {
     m_args_ap = t_argsp;
+    m_min_timeout = t_argsp->min_timeout;
     m_timeout = t_argsp->timeout;
     m_uri = t_argsp->uri;
 
     out_json = t_argsp->out_json;
+    out_ndjson = t_argsp->out_ndjson;
     out_path = t_argsp->out_path;
-    target = t_argsp->target;
+    targets = t_argsp->targets;
     verbose = t_argsp->verbose;
 
     {
         scoped_lock lock{m_ports_mtx};
-
-        for (const uint_t& port : ports = t_argsp->ports)
-        {
-            set_status(port, TaskStatus::not_started);
-        }
+        ports = t_argsp->ports;
     }
 }
 
 /**
 * @brief
-*     Create a new port scan task and submit it
-*     to the underlying thread pool for execution.
+*     Spawn a coroutine connection on the strand executor of an acquired client.
+*     Requires a connection semaphore slot and a probing queue semaphore slot, which
+*     are released once the connection attempt completes or its probe starts. The
+*     connection timeout is derived from the round-trip times measured for the target,
+*     and the rate limiter is notified of the connection result.
 */
-void scan::TcpScanner::post_port_scan(port_t t_port)
+void scan::TcpScanner::post_port_scan(const Endpoint& t_ep)
 {
-    if (!net::valid_port(t_port))
+    if (!net::valid_endpoint(t_ep))
     {
-        throw ArgEx{INVALID_PORTS_MSG, "t_port"};
+        throw ArgEx{INVALID_ENDPOINT_MSG, "t_ep"};
     }
+    client_ptr_t clientp{m_clients.acquire()};
 
-    if (!target.valid())
-    {
-        throw RuntimeEx{INVALID_TARGET_MSG, "TcpScanner::post_port_scan"};
-    }
+    clientp->connect_timeout(connect_timeout(t_ep.addr));
+
+    const steady_time_point_t start_time{steady_clock::now()};
 
-    // Post a new scan task to the thread pool
-    m_pool.post([this, t_port]() mutable -> void
+    auto on_complete = [this, clientp, start_time](std::exception_ptr l_exp) mutable -> void
     {
-        print_progress();
-        set_status(t_port, TaskStatus::executing);
+        m_connect_sem.release();
+        util::except(l_exp);
 
-        io_context_t io_ctx;
+        const steady_time_point_t end_time{steady_clock::now()};
 
-        client_ptr_t clientp{std::make_unique<TcpClient>(io_ctx, m_args_ap, m_rc_ap)};
-        clientp->connect(t_port);
+        update_rtt(clientp, chrono::duration_cast<microseconds>(end_time - start_time));
+        m_limiter.update(clientp->svcinfo().addr, clientp->host_state() == HostState::unknown);
 
+        // Queue the client for service probing
         if (clientp->is_connected())
         {
-            process_data(clientp);
-            clientp->disconnect();
+            post_probe(std::move(clientp));
+        }
+        else  // Failed to establish connection
+        {
+            m_queue_sem.release();
+
+            complete_task(std::move(clientp->svcinfo()));
+            clientp->close();
+
+            m_clients.release(std::move(clientp));
         }
+    };
+
+    asio::co_spawn(clientp->executor(), clientp->co_connect(t_ep), std::move(on_complete));
+}
+
+/**
+* @brief
+*     Post a service probing task for the given connected client to the underlying
+*     work-stealing thread pool. The client's probing queue semaphore slot is
+*     released once the task starts, and the number of concurrent probes is
+*     bounded by the adaptive probing concurrency limit. Each probe is timed to
+*     adapt the limit, and the thread pool grows to keep up with the limit.
+*/
+void scan::TcpScanner::post_probe(client_ptr_t&& t_clientp)
+{
+    if (t_clientp == nullptr)
+    {
+        throw NullPtrEx{"t_clientp"};
+    }
+
+    m_pool.post([this, clientp = std::move(t_clientp)]() mutable -> void
+    {
+        m_queue_sem.release();
+
+        const SvcInfo& svc_info{clientp->svcinfo()};
+        const latency_key_t key{svc_info.addr, net::banner_policy(svc_info.port())};
+
+        m_probe_limit.acquire();
+        const steady_time_point_t start_time{steady_clock::now()};
 
-        add_service(clientp->svcinfo());
-        set_status(t_port, TaskStatus::complete);
+        probe_client(clientp);
 
-        clientp->close();
+        const steady_time_point_t end_time{steady_clock::now()};
+        update_probe_latency(key, chrono::duration_cast<microseconds>(end_time - start_time));
+
+        m_probe_limit.release();
+        m_pool.grow(m_probe_limit.limit());
     });
 }
 
@@ -203,7 +358,7 @@ void scan::TcpScanner::print_progress() const
 {
     if (util::key_pressed())
     {
-        if (calc_progress() > 0.0)
+        if (calc_progress() > 0.0 && !ndjson_stdout())
         {
             util::successf(scan_progress());
         }
@@ -211,22 +366,45 @@ void scan::TcpScanner::print_progress() const
     }
 }
 
+/**
+* @brief
+*     Probe the service of the given connected client and record the results.
+*/
+void scan::TcpScanner::probe_client(client_ptr_t& t_clientp)
+{
+    if (t_clientp == nullptr)
+    {
+        throw NullPtrEx{"t_clientp"};
+    }
+
+    process_data(t_clientp);
+    t_clientp->disconnect();
+
+    complete_task(std::move(t_clientp->svcinfo()));
+    t_clientp->close();
+
+    m_clients.release(std::move(t_clientp));
+}
+
 /**
 * @brief
 *     Write the scan report to the standard output stream.
 */
-void scan::TcpScanner::print_report(const SvcTable& t_table) const
+void scan::TcpScanner::print_report(const table_list_t& t_tables) const
 {
     std::cout << algo::concat(LF, scan_summary(true), LF, LF);
 
     // Print JSON scan report
     if (out_json && out_path.empty())
     {
-        std::cout << json_report(t_table, true, true) << LF;
+        std::cout << json_report(t_tables, true, true) << LF;
     }
     else  // Print text scan report
     {
-        std::cout << algo::wrap(t_table.str(true), util::console_width()) << LF;
+        for (const SvcTable& table : t_tables)
+        {
+            std::cout << algo::wrap(table.str(true), util::console_width()) << LF;
+        }
     }
 }
 
@@ -234,19 +412,28 @@ void scan::TcpScanner::print_report(const SvcTable& t_table) const
 * @brief
 *     Save the scan report to a local text or JSON file.
 */
-void scan::TcpScanner::save_report(const SvcTable& t_table) const
+void scan::TcpScanner::save_report(const table_list_t& t_tables) const
 {
     sstream output_stream;
 
     if (out_json)
     {
-        output_stream << json_report(t_table);
+        output_stream << json_report(t_tables);
     }
     else  // Save text scan report
     {
         output_stream << util::app_title("Scan Report") << LF
-                      << algo::concat(LF, scan_summary(), LF, LF)
-                      << algo::wrap(t_table.str(false));
+                      << algo::concat(LF, scan_summary(), LF, LF);
+
+        for (const SvcTable& table : t_tables)
+        {
+            output_stream << algo::wrap(table.str(false));
+
+            if (&table != &t_tables.back())
+            {
+                output_stream << LF;
+            }
+        }
     }
 
     File::write(out_path, output_stream.str());
@@ -254,26 +441,127 @@ void scan::TcpScanner::save_report(const SvcTable& t_table) const
 
 /**
 * @brief
-*     Stop the underlying scan timer and display the scan
-*     results. Optionally saves the scan results to a local file.
+*     Stop the underlying scan timer and display the scan results. Optionally
+*     saves the scan results to a local file. When NDJSON output is enabled,
+*     all results have already been streamed, so the writer is only flushed
+*     and stopped, and the scan summary is displayed when writing to a file.
 */
 void scan::TcpScanner::scan_shutdown()
 {
     m_timer.stop();
-    const SvcTable table{target.name(), m_args_ap.load(), m_services};
 
-    print_report(table);
+    if (out_ndjson)
+    {
+        m_writer.stop();
 
-    if (!out_path.empty())
+        if (!ndjson_stdout())
+        {
+            std::cout << algo::concat(LF, scan_summary(true), LF, LF);
+        }
+    }
+    else  // Display and save scan report
     {
-        save_report(table);
+        const table_list_t tables{make_tables()};
+        print_report(tables);
+
+        if (!out_path.empty())
+        {
+            save_report(tables);
+        }
     }
     util::clear_keys();
 }
 
 /**
 * @brief
-*     Start the underlying scan timer and display the scan startup message.
+*     Scan all target ports using a two-stage pipeline. Connections are
+*     established by the shared I/O context and each connected client is posted
+*     as a service probing task to the work-stealing thread pool. Each stage has
+*     its own concurrency limit, and new connections are only started while the
+*     probing queue has capacity.
+*     Targets are interleaved, and targets whose rate limit does not yet permit
+*     another connection are skipped, so a backed off target never stalls the
+*     others. The global rate limit is applied after a target permits a connection.
+*     Blocks until all port scan tasks complete. If a connection cannot be started,
+*     its slots are released and the started tasks are drained before rethrowing.
+*/
+void scan::TcpScanner::scan_ports()
+{
+    List<port_t> pending_ports;
+    {
+        scoped_lock lock{m_ports_mtx};
+        pending_ports = ports;
+    }
+
+    size_t started{0_sz};
+    vector<size_t> port_indexes(targets.size(), 0_sz);
+
+    const size_t total_tasks{pending_ports.size() * targets.size()};
+
+    m_task_count = total_tasks;
+
+    while (started < total_tasks)
+    {
+        bool dispatched{false};
+        microseconds min_delay{microseconds::max()};
+
+        // Interleave the targets so consecutive connections reach different hosts
+        for (size_t i{0_sz}; i < targets.size(); i++)
+        {
+            if (port_indexes[i] >= pending_ports.size())
+            {
+                continue;
+            }
+            const string& addr{targets[i].addr()};
+            const microseconds delay{m_limiter.try_acquire(addr)};
+
+            // Defer the target until its rate limit permits a connection
+            if (delay > microseconds{0})
+            {
+                min_delay = (algo::min)(min_delay, delay);
+                continue;
+            }
+
+            m_queue_sem.acquire();
+            m_connect_sem.acquire();
+            m_limiter.acquire();
+
+            print_progress();
+            m_active_count.fetch_add(1_sz, std::memory_order_relaxed);
+
+            try  // Start the connection attempt
+            {
+                post_port_scan(Endpoint{addr, pending_ports[port_indexes[i]++]});
+                started++;
+                dispatched = true;
+            }
+            catch (...)
+            {
+                m_active_count.fetch_sub(1_sz, std::memory_order_relaxed);
+                m_connect_sem.release();
+                m_queue_sem.release();
+
+                m_task_count = started;
+                wait();
+                throw;
+            }
+        }
+
+        // All remaining targets are waiting on their rate limits
+        if (!dispatched && started < total_tasks)
+        {
+            std::this_thread::sleep_for(min_delay);
+        }
+    }
+    wait();
+}
+
+/**
+* @brief
+*     Start the underlying scan timer and display the scan startup message. The
+*     startup message is omitted when NDJSON results are streamed to the standard
+*     output stream, so that the stream only contains NDJSON lines. Status messages
+*     are written to the standard error stream in that case.
 */
 void scan::TcpScanner::scan_startup()
 {
@@ -286,40 +574,128 @@ void scan::TcpScanner::scan_startup()
         ports_str += algo::fstr("... (% not shown)", ports.size() - ports_list.size());
     }
 
-    std::cout << util::fmt_title(util::app_title(), true)         << LF
-              << util::fmt_field("Time  ", m_timer.start(), true) << LF
-              << util::fmt_field("Target", target, true)          << LF
-              << util::fmt_field("Ports ", ports_str, true)       << LF;
+    if (out_ndjson)
+    {
+        m_writer.start(out_path);
+    }
+    util::stdout_reserved = ndjson_stdout();
 
-    // Separate message and connection statuses
-    if (verbose)
+    const string start_time{m_timer.start()};
+
+    if (!ndjson_stdout())
     {
-        std::cout << LF;
+        std::cout << util::fmt_title(util::app_title(), true)           << LF
+                  << util::fmt_field("Time  ", start_time, true)        << LF
+                  << util::fmt_field("Target", targets_summary(), true) << LF
+                  << util::fmt_field("Ports ", ports_str, true)         << LF;
+
+        // Separate message and connection statuses
+        if (verbose)
+        {
+            std::cout << LF;
+        }
     }
 }
 
 /**
 * @brief
-*     Set a task execution status in the underlying task
-*     status map. Locks the underlying status map mutex.
+*     Run the shared I/O context on the underlying I/O thread pool.
 */
-void scan::TcpScanner::set_status(port_t t_port, TaskStatus t_status)
+void scan::TcpScanner::start_io()
 {
-    scoped_lock lock{m_statuses_mtx};
-    m_statuses[t_port] = t_status;
+    m_io_ctx.restart();
+
+    for (size_t i{0_sz}; i < IO_THREADS; i++)
+    {
+        m_io_pool.post([this]() -> void
+        {
+            m_io_ctx.run();
+        });
+    }
 }
 
 /**
 * @brief
-*     Get the number of completed port scan thread pool
-*     tasks. Locks the underlying status map mutex.
+*     Record the duration of a completed service probe and adapt the service
+*     probing concurrency limit. Probe latency is compared against the minimum
+*     latency of the same target and banner policy, since banner waits make
+*     server-first and client-first probes incomparable. Locks the underlying
+*     probe latency map mutex.
 */
-size_t scan::TcpScanner::completed_tasks() const
+void scan::TcpScanner::update_probe_latency(const latency_key_t& t_key,
+                                            const microseconds& t_latency)
 {
-    return ranges::count_if(m_statuses, [](const Pair auto& l_pair) -> bool
+    microseconds min_latency;
     {
-        return l_pair.second == TaskStatus::complete;
-    });
+        scoped_lock lock{m_latency_mtx};
+        auto iter{m_min_latencies.try_emplace(t_key, t_latency).first};
+
+        iter->second = (algo::min)(iter->second, t_latency);
+        min_latency = iter->second;
+    }
+    m_probe_limit.update(t_latency, min_latency);
+}
+
+/**
+* @brief
+*     Record the connection round-trip time of the given client's target. Timed out
+*     connection attempts are not sampled, since their round-trip time is unknown.
+*     Locks the underlying RTT estimator map mutex.
+*/
+void scan::TcpScanner::update_rtt(const client_ptr_t& t_clientp,
+                                  const microseconds& t_rtt)
+{
+    if (t_clientp == nullptr)
+    {
+        throw NullPtrEx{"t_clientp"};
+    }
+
+    if (t_clientp->host_state() != HostState::unknown)
+    {
+        scoped_lock lock{m_rtt_mtx};
+
+        const string addr{t_clientp->svcinfo().addr};
+        auto iter{m_rtt_estimators.try_emplace(addr, m_min_timeout, m_timeout).first};
+
+        iter->second.update(t_rtt);
+    }
+}
+
+/**
+* @brief
+*     Determine whether NDJSON scan results are streamed to the standard output stream.
+*/
+bool scan::TcpScanner::ndjson_stdout() const noexcept
+{
+    return out_ndjson && out_path.empty();
+}
+
+/**
+* @brief
+*     Get the number of started port scan tasks that have not yet completed.
+*/
+size_t scan::TcpScanner::active_tasks() const noexcept
+{
+    return m_active_count.load(std::memory_order_relaxed);
+}
+
+/**
+* @brief
+*     Get the number of completed port scan tasks.
+*/
+size_t scan::TcpScanner::completed_tasks() const noexcept
+{
+    return m_completed_count.load(std::memory_order_acquire);
+}
+
+/**
+* @brief
+*     Get the total number of port scan tasks, which is the number of
+*     target ports multiplied by the number of targets.
+*/
+size_t scan::TcpScanner::task_count() const noexcept
+{
+    return m_task_count.load(std::memory_order_relaxed);
 }
 
 /**
@@ -334,24 +710,61 @@ double scan::TcpScanner::calc_progress() const
 
 /**
 * @brief
-*     Calculate the current scan progress percentage. Locks
-*     the underlying port list mutex and sets the given task count
-*     reference to the total number of completed scan tasks.
+*     Calculate the current scan progress percentage. Sets the given
+*     task count reference to the total number of completed scan tasks.
 */
 double scan::TcpScanner::calc_progress(size_t& t_completed) const
 {
     t_completed = completed_tasks();
 
     double percentage{0.0};
-    scoped_lock lock{m_ports_mtx};
+    const size_t total_tasks{task_count()};
 
-    if (ports.size() > 0)
+    if (total_tasks > 0)
     {
-        percentage = static_cast<double>(t_completed) / ports.size();
+        percentage = static_cast<double>(t_completed) / total_tasks;
     }
     return percentage;
 }
 
+/**
+* @brief
+*     Get the banner receive timeout of the given target address, which is derived
+*     from the connection timeout and bounded by the minimum and default receive timeouts.
+*/
+scan::Timeout scan::TcpScanner::banner_timeout(const string& t_addr) const
+{
+    Timeout timeout{connect_timeout(t_addr)};
+
+    if (timeout < Timeout{MIN_RECV_TIMEOUT})
+    {
+        timeout = MIN_RECV_TIMEOUT;
+    }
+    else if (timeout > Timeout{RECV_TIMEOUT})
+    {
+        timeout = RECV_TIMEOUT;
+    }
+    return timeout;
+}
+
+/**
+* @brief
+*     Get the connection timeout of the given target address. The maximum connection
+*     timeout is used until a round-trip time is measured for the target address.
+*     Locks the underlying RTT estimator map mutex.
+*/
+scan::Timeout scan::TcpScanner::connect_timeout(const string& t_addr) const
+{
+    Timeout timeout{m_timeout};
+    scoped_lock lock{m_rtt_mtx};
+
+    if (m_rtt_estimators.contains(t_addr))
+    {
+        timeout = m_rtt_estimators.at(t_addr).timeout();
+    }
+    return timeout;
+}
+
 /**
 * @brief
 *     Process the inbound and outbound socket stream data.
@@ -368,21 +781,18 @@ scan::TcpScanner::client_ptr_t& scan::TcpScanner::process_data(client_ptr_t& t_c
         throw LogicEx{CLIENT_DISCONNECTED_MSG, "TcpScanner::process_data"};
     }
 
-    TcpClient::buffer_t buffer{CHAR_NULL};
     SvcInfo& svc_info{t_clientp->svcinfo()};
 
-    const size_t bytes_read{t_clientp->recv(buffer)};
+    const string_view recv_data{recv_banner(t_clientp)};
     HostState state{t_clientp->host_state()};
 
     // Parse banner or probe HTTP information
     if (state == HostState::open)
     {
-        const string recv_data(&buffer[0], bytes_read);
-
         if (!recv_data.empty())
         {
             svc_info.parse_banner(recv_data);
-            net::update_svc(*m_rc_ap.load(), svc_info, state);
+            net::update_svc(svc_info, state);
         }
 
         if (m_args_ap.load()->curl || recv_data.empty())
@@ -390,7 +800,7 @@ scan::TcpScanner::client_ptr_t& scan::TcpScanner::process_data(client_ptr_t& t_c
             probe_http(t_clientp);
         }
     }
-    net::update_svc(*m_rc_ap.load(), svc_info, state);
+    net::update_svc(svc_info, state);
 
     return t_clientp;
 }
@@ -399,17 +809,19 @@ scan::TcpScanner::client_ptr_t& scan::TcpScanner::process_data(client_ptr_t& t_c
 * @brief
 *     Get a JSON report of the scan results in the given service table.
 */
-std::string scan::TcpScanner::json_report(const SvcTable& t_table,
+std::string scan::TcpScanner::json_report(const table_list_t& t_tables,
                                           bool t_colorize,
                                           bool t_include_title)
     const
 {
     sstream stream;
-    const json::object_t report{json::scan_report(t_table, m_timer, out_path)};
+    const Args& args{*m_args_ap.load()};
+
+    const json::object_t report{json::scan_report(args, t_tables, m_timer, out_path)};
 
     if (t_include_title)
     {
-        stream << util::fmt_title("Target", t_table.addr(), t_colorize) << LF;
+        stream << util::fmt_title("Target", targets_summary(), t_colorize) << LF;
     }
     stream << json::prettify(report) << LF;
 
@@ -418,20 +830,39 @@ std::string scan::TcpScanner::json_report(const SvcTable& t_table,
 
 /**
 * @brief
-*     Get a summary of the current scan progress. Locks the underlying status map mutex.
+*     Get a summary of the adaptive service probing concurrency limit
+*     and the number of probing tasks stolen by idle pool workers.
+*/
+std::string scan::TcpScanner::probe_summary() const
+{
+    return algo::fstr("% concurrent (peak %, maximum %), % stolen",
+                      m_probe_limit.limit(),
+                      m_probe_limit.peak_limit(),
+                      m_probe_limit.max_limit(),
+                      m_pool.steal_count());
+}
+
+/**
+* @brief
+*     Get a summary of the current scan progress, including the number of
+*     probing tasks queued in the underlying thread pool. Locks the underlying
+*     probing concurrency limit mutex.
 */
 std::string scan::TcpScanner::scan_progress() const
 {
     size_t completed{0_sz};
     double percentage{calc_progress(completed)};
 
-    scoped_lock lock{m_ports_mtx};
-    const size_t remaining{ports.size() - completed};
+    const size_t remaining{task_count() - completed};
 
-    const string progress = algo::fstr("Approximately %\\% complete (% % remaining)",
+    const string progress = algo::fstr("Approximately %\\% complete (% % remaining, "
+                                       "% active, % queued, probe limit %)",
                                        percentage * 100.0,
                                        remaining,
-                                       remaining == 1 ? "port" : "ports");
+                                       remaining == 1 ? "port" : "ports",
+                                       active_tasks(),
+                                       m_pool.queue_depth(),
+                                       m_probe_limit.limit());
     return progress;
 }
 
@@ -447,7 +878,16 @@ std::string scan::TcpScanner::scan_summary(bool t_colorize, bool t_include_cmd)
     stream << util::fmt_title("Scan Summary", t_colorize)                     << LF
            << util::fmt_field("Duration  ", m_timer.elapsed(), t_colorize)    << LF
            << util::fmt_field("Start Time", m_timer.start_time(), t_colorize) << LF
-           << util::fmt_field("End Time  ", m_timer.end_time(), t_colorize);
+           << util::fmt_field("End Time  ", m_timer.end_time(), t_colorize)    << LF
+           << util::fmt_field("Probes    ", probe_summary(), t_colorize);
+
+    const string sessions{session_summary()};
+
+    // Include SSL/TLS session details
+    if (!sessions.empty())
+    {
+        stream << LF << util::fmt_field("Sessions  ", sessions, t_colorize);
+    }
 
     // Include report file path
     if (!out_path.empty())
@@ -468,3 +908,64 @@ std::string scan::TcpScanner::scan_summary(bool t_colorize, bool t_include_cmd)
 
     return stream.str();
 }
+
+/**
+* @brief
+*     Get a summary of the underlying targets. Only the first few targets are listed.
+*/
+std::string scan::TcpScanner::targets_summary() const
+{
+    const List<string> targets_list{algo::str_vector(targets, 4)};
+    string targets_str{targets_list.join(", ")};
+
+    // Indicate that not all targets are shown
+    if (targets_list.size() < targets.size())
+    {
+        targets_str += algo::fstr("... (% not shown)", targets.size() - targets_list.size());
+    }
+    return targets_str;
+}
+
+/**
+* @brief
+*     Get a summary of the SSL/TLS sessions established by the scan. Plaintext
+*     TCP scans do not establish SSL/TLS sessions, so the summary is empty.
+*/
+std::string scan::TcpScanner::session_summary() const
+{
+    return {};
+}
+
+/**
+* @brief
+*     Create the service tables of the scan results, grouped by target. When
+*     multiple targets are scanned, targets without any open ports are omitted.
+*     Takes all the service information from the underlying lock-free service stack.
+*/
+scan::TcpScanner::table_list_t scan::TcpScanner::make_tables()
+{
+    map<string, List<SvcInfo>> target_services;
+
+    for (SvcInfo& svc_info : m_services.take_all())
+    {
+        target_services[svc_info.addr].emplace_back(std::move(svc_info));
+    }
+
+    table_list_t tables;
+
+    for (const Hostname& target : targets)
+    {
+        const List<SvcInfo>& services{target_services[target.addr()]};
+
+        const bool any_open{ranges::any_of(services, [](const SvcInfo& l_info) -> bool
+        {
+            return l_info.state() == HostState::open;
+        })};
+
+        if (targets.size() == 1 || any_open)
+        {
+            tables.emplace_back(target.name(), m_args_ap.load(), services);
+        }
+    }
+    return tables;
+}
@@ -4,7 +4,9 @@
 * @brief
 *     Source file for a thread pool.
 */
+#include <memory>
 #include <thread>
+#include <utility>
 #include "includes/threading/thread_pool.h"
 
 /**
@@ -13,6 +15,19 @@
 */
 const size_t scan::ThreadPool::m_cpu_threads{thread::hardware_concurrency()};
 
+/**
+* @brief
+*     Thread pool that owns the current worker thread, or null
+*     if the current thread is not a thread pool worker thread.
+*/
+thread_local scan::ThreadPool* scan::ThreadPool::m_current_poolp{nullptr};
+
+/**
+* @brief
+*     Worker deque index of the current worker thread.
+*/
+thread_local size_t scan::ThreadPool::m_current_index{0_sz};
+
 /**
 * @brief
 *     Initialize the object.
@@ -25,9 +40,51 @@ scan::ThreadPool::ThreadPool() : ThreadPool{0_sz}
 * @brief
 *     Initialize the object.
 */
-scan::ThreadPool::ThreadPool(size_t t_threads) : m_pool{thread_count(t_threads)}
+scan::ThreadPool::ThreadPool(size_t t_threads) : ThreadPool{t_threads, t_threads}
+{
+}
+
+/**
+* @brief
+*     Initialize the object. The pool starts with the given number of worker
+*     threads, and can grow up to the given maximum worker thread count.
+*/
+scan::ThreadPool::ThreadPool(size_t t_threads, size_t t_max_threads)
+{
+    m_stopped = m_draining = false;
+    m_max_threads = (algo::max)(thread_count(t_threads), t_max_threads);
+    m_next_index = m_queued_count = m_steal_count = m_threads = 0_sz;
+
+    for (size_t i{0_sz}; i < m_max_threads; i++)
+    {
+        m_workers.emplace_back(std::make_unique<Worker>());
+    }
+    spawn(thread_count(t_threads));
+}
+
+/**
+* @brief
+*     Destroy the object. Stops the underlying worker threads
+*     and blocks until they finish executing their current tasks.
+*/
+scan::ThreadPool::~ThreadPool()
+{
+    stop();
+    join();
+}
+
+/**
+* @brief
+*     Start additional worker threads until the underlying thread pool has the
+*     given number of worker threads. The thread count never exceeds the maximum
+*     thread count, and the thread pool never shrinks.
+*/
+void scan::ThreadPool::grow(size_t t_threads)
 {
-    m_stopped = false;
+    if (t_threads > size())
+    {
+        spawn((algo::min)(t_threads, m_max_threads));
+    }
 }
 
 /**
@@ -36,18 +93,47 @@ scan::ThreadPool::ThreadPool(size_t t_threads) : m_pool{thread_count(t_threads)}
 */
 void scan::ThreadPool::stop()
 {
-    m_stopped = true;
-    m_pool.stop();
+    {
+        scoped_lock lock{m_idle_mtx};
+        m_stopped = true;
+    }
+    m_idle_cv.notify_all();
 }
 
 /**
 * @brief
 *     Wait for all worker threads in the underlying thread pool to complete
-*     their current tasks. Blocks until there is no more outstanding work.
+*     their current tasks. Blocks until there is no more outstanding work. The
+*     worker threads are then restarted, so the thread pool can be reused until
+*     it is stopped. Locks the underlying worker thread list mutex.
 */
 void scan::ThreadPool::wait()
 {
-    m_pool.wait();
+    {
+        scoped_lock lock{m_idle_mtx};
+        m_draining = true;
+    }
+    m_idle_cv.notify_all();
+
+    join();
+
+    {
+        scoped_lock lock{m_idle_mtx};
+        m_draining = false;
+    }
+
+    if (!is_stopped())
+    {
+        scoped_lock lock{m_threads_mtx};
+
+        for (size_t i{0_sz}; i < m_worker_threads.size(); i++)
+        {
+            m_worker_threads[i] = thread{[this, i]() -> void
+            {
+                run(i);
+            }};
+        }
+    }
 }
 
 /**
@@ -58,3 +144,202 @@ bool scan::ThreadPool::is_stopped() const noexcept
 {
     return m_stopped.load();
 }
+
+/**
+* @brief
+*     Get the number of tasks queued in all worker deques.
+*/
+size_t scan::ThreadPool::queue_depth() const noexcept
+{
+    return m_queued_count.load(std::memory_order_relaxed);
+}
+
+/**
+* @brief
+*     Get the number of worker threads in the underlying thread pool.
+*/
+size_t scan::ThreadPool::size() const noexcept
+{
+    return m_threads.load(std::memory_order_acquire);
+}
+
+/**
+* @brief
+*     Get the number of tasks that were stolen from another worker's deque.
+*/
+size_t scan::ThreadPool::steal_count() const noexcept
+{
+    return m_steal_count.load(std::memory_order_relaxed);
+}
+
+/**
+* @brief
+*     Block until all the underlying worker threads have exited, including
+*     worker threads that are started while joining. Locks the underlying
+*     worker thread list mutex while accessing the worker thread list.
+*/
+void scan::ThreadPool::join()
+{
+    for (size_t i{0_sz}; ; i++)
+    {
+        thread* threadp{nullptr};
+        {
+            scoped_lock lock{m_threads_mtx};
+
+            if (i >= m_worker_threads.size())
+            {
+                break;
+            }
+            threadp = &m_worker_threads[i];
+        }
+
+        if (threadp->joinable())
+        {
+            threadp->join();
+        }
+    }
+}
+
+/**
+* @brief
+*     Push the given task onto the current worker's deque, or onto the next
+*     worker's deque in round-robin order when called by an external thread.
+*     Wakes an idle worker thread to execute or steal the task.
+*/
+void scan::ThreadPool::push(task_t&& t_task)
+{
+    size_t index{m_current_index};
+
+    if (m_current_poolp != this)
+    {
+        index = m_next_index.fetch_add(1_sz, std::memory_order_relaxed) % size();
+    }
+
+    // Count the task first, so a worker that pops it never underflows the count
+    m_queued_count.fetch_add(1_sz, std::memory_order_release);
+    {
+        Worker& worker{*m_workers[index]};
+        scoped_lock lock{worker.mtx};
+
+        worker.tasks.emplace_back(std::move(t_task));
+    }
+
+    // Synchronize with workers that are about to become idle
+    {
+        scoped_lock lock{m_idle_mtx};
+    }
+    m_idle_cv.notify_one();
+}
+
+/**
+* @brief
+*     Worker thread loop. Tasks are popped from the worker's own deque or stolen
+*     from the other deques until the thread pool is stopped, or until all queued
+*     tasks have been executed after the thread pool started draining.
+*/
+void scan::ThreadPool::run(size_t t_index)
+{
+    m_current_poolp = this;
+    m_current_index = t_index;
+
+    bool exit{false};
+    task_t task;
+
+    while (!exit && !is_stopped())
+    {
+        if (pop(t_index, task) || steal(t_index, task))
+        {
+            m_queued_count.fetch_sub(1_sz, std::memory_order_relaxed);
+
+            task();
+            task = nullptr;
+        }
+        else  // Wait for more tasks to be queued
+        {
+            unique_lock lock{m_idle_mtx};
+
+            m_idle_cv.wait(lock, [this]() -> bool
+            {
+                return m_stopped || m_draining || queue_depth() > 0;
+            });
+
+            exit = m_draining && queue_depth() == 0;
+        }
+    }
+}
+
+/**
+* @brief
+*     Pop the most recently pushed task from the given worker's deque.
+*/
+bool scan::ThreadPool::pop(size_t t_index, task_t& t_task)
+{
+    bool popped{false};
+    Worker& worker{*m_workers[t_index]};
+
+    scoped_lock lock{worker.mtx};
+
+    if (!worker.tasks.empty())
+    {
+        t_task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        popped = true;
+    }
+    return popped;
+}
+
+/**
+* @brief
+*     Steal the least recently pushed task from the first non-empty
+*     deque of the other workers, starting with the next worker.
+*/
+bool scan::ThreadPool::steal(size_t t_index, task_t& t_task)
+{
+    bool stolen{false};
+    const size_t threads{size()};
+
+    for (size_t i{1_sz}; !stolen && i < threads; i++)
+    {
+        Worker& victim{*m_workers[(t_index + i) % threads]};
+        scoped_lock lock{victim.mtx};
+
+        if (!victim.tasks.empty())
+        {
+            t_task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            stolen = true;
+        }
+    }
+
+    if (stolen)
+    {
+        m_steal_count.fetch_add(1_sz, std::memory_order_relaxed);
+    }
+    return stolen;
+}
+
+/**
+* @brief
+*     Start worker threads until the underlying thread pool has the given number
+*     of worker threads. The worker thread count is only published once the new
+*     worker threads have started, so tasks are only pushed onto the deques of
+*     running workers. Locks the underlying worker thread list mutex.
+*/
+void scan::ThreadPool::spawn(size_t t_threads)
+{
+    scoped_lock lock{m_threads_mtx};
+    const size_t threads{size()};
+
+    for (size_t i{threads}; i < t_threads; i++)
+    {
+        m_worker_threads.emplace_back([this, i]() -> void
+        {
+            run(i);
+        });
+    }
+
+    if (t_threads > threads)
+    {
+        m_threads.store(t_threads, std::memory_order_release);
+    }
+}
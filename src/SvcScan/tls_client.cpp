@@ -5,40 +5,70 @@
 *     Source file for a secure IPv4 TCP socket client.
 */
 #include <array>
-#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
-#include <boost/asio/buffer.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/io_context.hpp>
-#include <boost/asio/placeholders.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/asio/ssl/stream_base.hpp>
 #include <boost/asio/ssl/verify_mode.hpp>
-#include <boost/beast/core/flat_buffer.hpp>
 #include <boost/beast/core/stream_traits.hpp>
-#include <boost/beast/http/error.hpp>
-#include <boost/beast/http/parser.hpp>
-#include <boost/beast/http/read.hpp>
-#include <boost/beast/http/verb.hpp>
-#include <boost/beast/http/write.hpp>
-#include <boost/bind/bind.hpp>
+#include <openssl/bio.h>
 #include <openssl/types.h>
-#include <openssl/x509_vfy.h>
+#include <openssl/x509.h>
 #include "includes/console/util.h"
-#include "includes/errors/arg_ex.h"
 #include "includes/errors/error_const_defs.h"
+#include "includes/errors/logic_ex.h"
 #include "includes/errors/runtime_ex.h"
 #include "includes/inet/sockets/tls_client.h"
 #include "includes/ranges/algo.h"
 #include "includes/utils/literals.h"
 
+/**
+* @brief
+*     OpenSSL application data index of the client that owns an SSL/TLS connection.
+*/
+const int scan::TlsClient::m_ssl_index{SSL_get_ex_new_index(0L,
+                                                            nullptr,
+                                                            nullptr,
+                                                            nullptr,
+                                                            nullptr)};
+
+/**
+* @brief
+*     Shared TLS context map mutex.
+*/
+scan::mutex scan::TlsClient::m_contexts_mtx;
+
+/**
+* @brief
+*     TLS session cache mutex.
+*/
+scan::mutex scan::TlsClient::m_sessions_mtx;
+
+/**
+* @brief
+*     Shared TLS contexts, mapped by their TLS method.
+*/
+scan::TlsClient::context_map_t scan::TlsClient::m_contexts;
+
+/**
+* @brief
+*     Resumable TLS sessions, mapped by their session cache key.
+*/
+scan::TlsClient::session_map_t scan::TlsClient::m_sessions;
+
 /**
 * @brief
 *     Initialize the object.
 */
 scan::TlsClient::TlsClient(TlsClient&& t_client) noexcept
-    : TcpClient{t_client.m_io_ctx, t_client.m_args_ap, t_client.m_rc_ap}
+    : TcpClient{t_client.m_io_ctx, t_client.m_args_ap, nullptr}
 {
     *this = std::move(t_client);
 }
@@ -47,23 +77,11 @@ scan::TlsClient::TlsClient(TlsClient&& t_client) noexcept
 * @brief
 *     Initialize the object.
 */
-scan::TlsClient::TlsClient(io_context_t& t_io_ctx,
-                           shared_ptr<Args> t_argsp,
-                           shared_ptr<TextRc> t_rcp)
-    : TcpClient{t_io_ctx, t_argsp, t_rcp}
+scan::TlsClient::TlsClient(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp)
+    : TcpClient{t_io_ctx, t_argsp, nullptr}
 {
-    m_ssl_ctxp = std::make_unique<ssl_context_t>(ssl_context_t::tlsv12_client);
-
-    auto verify_callback = std::bind(&TlsClient::on_verify,
-                                     this,
-                                     std::placeholders::_1,
-                                     std::placeholders::_2);
-
-    m_ssl_ctxp->set_default_verify_paths(m_ecode);
-    m_ssl_ctxp->set_verify_mode(ssl::verify_none);
-    m_ssl_ctxp->set_verify_callback(std::move(verify_callback), m_ecode);
-
-    m_ssl_streamp = std::make_unique<ssl_stream_t>(m_io_ctx, *m_ssl_ctxp);
+    m_ssl_ctxp = shared_context(CLIENT_METHOD);
+    reset_stream();
 }
 
 /**
@@ -75,6 +93,8 @@ scan::TlsClient::~TlsClient()
     if (is_open())
     {
         net_error_code_t discard_ecode;
+
+        mark_shutdown();
         socket().close(discard_ecode);
     }
 }
@@ -87,9 +107,16 @@ scan::TlsClient& scan::TlsClient::operator=(TlsClient&& t_client) noexcept
 {
     if (this != &t_client)
     {
+        m_server_name = std::move(t_client.m_server_name);
         m_ssl_ctxp = std::move(t_client.m_ssl_ctxp);
         m_ssl_streamp = std::move(t_client.m_ssl_streamp);
         TcpClient::operator=(std::move(t_client));
+
+        // OpenSSL callbacks must reference this client
+        if (m_ssl_streamp != nullptr)
+        {
+            bind_callbacks();
+        }
     }
     return *this;
 }
@@ -103,6 +130,8 @@ void scan::TlsClient::close()
     if (is_open())
     {
         net_error_code_t ecode;
+
+        mark_shutdown();
         socket().close(ecode);
 
         success_check(ecode);
@@ -112,36 +141,79 @@ void scan::TlsClient::close()
 
 /**
 * @brief
-*     Establish a network connection to the given TCP endpoint.
+*     Disconnect from the underlying remote endpoint and establish a new SSL/TLS
+*     connection to it using a new TLS stream. The underlying service information
+*     is preserved.
+*/
+void scan::TlsClient::reconnect()
+{
+    disconnect();
+    mark_shutdown();
+
+    reset_stream();
+    connect(Endpoint{m_remote_ep});
+}
+
+/**
+* @brief
+*     Reset the client so that it can be reused for another connection. The
+*     OpenSSL connection and the TCP stream of the SSL/TLS stream are reused.
 */
-void scan::TlsClient::connect(const Endpoint& t_ep)
+void scan::TlsClient::reset()
 {
-    if (!net::valid_endpoint(m_remote_ep = t_ep))
+    if (m_ssl_streamp != nullptr)
     {
-        throw ArgEx{INVALID_ENDPOINT_MSG, "t_ep"};
+        mark_shutdown();
     }
 
-    m_svc_info.addr = t_ep.addr;
-    m_svc_info.port(t_ep.port);
+    TcpClient::reset();
+    recycle_stream();
 
-    // Perform DNS name resolution
-    results_t results{net::resolve(m_io_ctx, m_remote_ep, m_ecode)};
+    m_server_name.clear();
+}
 
-    // Establish the connection
-    if (success_check())
+/**
+* @brief
+*     Set the SNI host name sent in subsequent TLS handshakes. No SNI
+*     extension is sent when the given host name is empty or an IPv4 address.
+*/
+void scan::TlsClient::server_name(const string& t_name)
+{
+    m_server_name = net::valid_ipv4_fmt(t_name) ? string{} : t_name;
+}
+
+/**
+* @brief
+*     Upgrade the connection of the given connected TCP client to SSL/TLS. Ownership
+*     of the client's underlying socket is transferred to this client before the TLS
+*     handshake, so no additional TCP connection to the remote host is established.
+*/
+void scan::TlsClient::upgrade(TcpClient& t_client)
+{
+    if (!t_client.is_connected())
     {
-        async_connect(results);
-        async_await();
+        throw LogicEx{CLIENT_DISCONNECTED_MSG, "TlsClient::upgrade"};
+    }
+
+    m_svc_info = t_client.svcinfo();
+    m_remote_ep = Endpoint{m_svc_info.addr, m_svc_info.port()};
 
-        // Perform TLS handshake negotiations
-        if (success_check())
+    const native_socket_t handle{t_client.release_socket()};
+
+    // Adopt the released socket and perform TLS handshake negotiations
+    if (!t_client.is_connected())
+    {
+        socket().assign(ip::tcp::v4(), handle, m_ecode);
+        m_connected = success_check();
+
+        if (m_connected)
         {
             handshake();
             m_connected = valid_handshake();
 
             if (m_connected && net::no_error(m_ecode) && m_verbose)
             {
-                util::printf("SSL/TLS connection established: %/%", t_ep.port, PROTO);
+                util::printf("SSL/TLS connection upgraded: %/%", m_remote_ep.port, PROTO);
             }
         }
     }
@@ -149,150 +221,181 @@ void scan::TlsClient::connect(const Endpoint& t_ep)
 
 /**
 * @brief
-*     Establish a network connection to underlying target on the given port.
+*     Determine whether the most recent TLS handshake resumed a cached session.
 */
-void scan::TlsClient::connect(port_t t_port)
+bool scan::TlsClient::session_resumed() const
 {
-    if (!net::valid_port(t_port))
-    {
-        throw ArgEx{INVALID_PORTS_MSG, "t_port"};
-    }
+    bool resumed{false};
 
-    // Unknown remote host address
-    if (m_remote_ep.addr.empty() || m_remote_ep.addr == IPV4_ANY)
+    if (m_ssl_streamp != nullptr)
     {
-        if (m_args_ap.load()->target.addr().empty())
-        {
-            throw RuntimeEx{INVALID_TARGET_MSG, "TlsClient::connect"};
-        }
-        m_remote_ep = {m_args_ap.load()->target.addr(), t_port};
+        resumed = SSL_session_reused(m_ssl_streamp->native_handle()) == 1;
     }
-    connect(m_remote_ep);
+    return resumed;
 }
 
 /**
 * @brief
-*     Read inbound data from the underlying SSL/TLS socket stream.
+*     Establish a network connection to the given TCP endpoint and perform TLS
+*     handshake negotiations. The endpoint host name is sent as the SNI host name
+*     unless one was already set. The returned coroutine must be spawned on or
+*     awaited from the client's strand executor.
 */
-size_t scan::TlsClient::recv(buffer_t& t_buffer)
+scan::awaitable_t<> scan::TlsClient::co_connect(Endpoint t_ep)
 {
-    string data;
-    size_t bytes_read{0_sz};
+    // Send the target host name when connecting by name
+    if (m_server_name.empty())
+    {
+        server_name(t_ep.addr);
+    }
+    co_await TcpClient::co_connect(t_ep);
 
-    if (connected_check())
+    // Perform TLS handshake negotiations
+    if (success_check())
     {
-        recv_timeout(RECV_TIMEOUT);
+        co_await co_handshake();
+        m_connected = valid_handshake();
 
-        const mutable_buffer_t mut_buffer{&t_buffer[0], sizeof t_buffer};
-        bytes_read = m_ssl_streamp->read_some(mut_buffer, m_ecode);
+        if (m_connected && net::no_error(m_ecode) && m_verbose)
+        {
+            util::printf("SSL/TLS connection established: %/%", t_ep.port, PROTO);
+        }
     }
-    return bytes_read;
 }
 
 /**
 * @brief
-*     Write the given string payload to the underlying SSL/TLS socket stream.
+*     Perform TLS handshake negotiations on the underlying SSL/TLS stream.
 */
-size_t scan::TlsClient::send(const string& t_payload)
+scan::awaitable_t<scan::net_error_code_t> scan::TlsClient::co_handshake()
 {
-    size_t bytes_sent{0_sz};
+    auto token{asio::redirect_error(asio::use_awaitable, m_ecode)};
+    const char* server_namep{m_server_name.empty() ? nullptr : m_server_name.c_str()};
 
-    if (connected_check())
-    {
-        send_timeout(SEND_TIMEOUT);
+    // A null host name clears the SNI host name of a recycled connection
+    SSL_set_tlsext_host_name(m_ssl_streamp->native_handle(), server_namep);
+    resume_session();
+    stream().expires_after(RECV_TIMEOUT);
 
-        if (connected_check() && !t_payload.empty())
-        {
-            bytes_sent = m_ssl_streamp->write_some(asio::buffer(t_payload), m_ecode);
-        }
+    co_await m_ssl_streamp->async_handshake(ssl_stream_t::client, token);
+    on_handshake(m_ecode);
+
+    if (net::is_error(m_ecode))
+    {
+        stream().cancel();
     }
-    return bytes_sent;
+    co_return m_ecode;
 }
 
 /**
 * @brief
-*     Send the given HTTPS request and return the server's response.
+*     Read inbound data from the underlying SSL/TLS socket stream. Waits for
+*     data until the given receive timeout duration has elapsed. The given
+*     buffer must remain valid until the returned coroutine completes.
 */
-scan::Response<> scan::TlsClient::request(const Request<>& t_request)
+scan::awaitable_t<size_t> scan::TlsClient::co_recv_some(buffer_t& t_buffer,
+                                                        Timeout t_timeout)
 {
-    if (!t_request.valid())
-    {
-        throw ArgEx{INVALID_REQUEST_MSG, "t_request"};
-    }
-    Response response;
-
-    // Perform HTTPS communications
-    if (connected_check())
-    {
-        http::write(*m_ssl_streamp, t_request.message(), m_ecode);
-
-        if (success_check())
-        {
-            http::response_parser<string_body_t> parser;
-            flat_buffer_t& buffer{response.buffer};
-
-            size_t bytes_read{http::read_header(*m_ssl_streamp, buffer, parser, m_ecode)};
+    return TcpClient::co_recv_some(*m_ssl_streamp, t_buffer, t_timeout);
+}
 
-            if (m_ecode != http::error::bad_version && success_check(true, true))
-            {
-                do  // Read until end reached or message fully parsed
-                {
-                    bytes_read = http::read(*m_ssl_streamp, buffer, parser, m_ecode);
-                }
-                while (bytes_read > 0 && net::no_error(m_ecode));
+/**
+* @brief
+*     Write the given string payload to the underlying SSL/TLS socket stream.
+*/
+scan::awaitable_t<size_t> scan::TlsClient::co_send(string t_payload)
+{
+    return TcpClient::co_send(*m_ssl_streamp, std::move(t_payload));
+}
 
-                response.parse(parser.get());
-            }
-        }
-    }
-    return response;
+/**
+* @brief
+*     Send the given HTTPS request and return the server's response.
+*/
+scan::awaitable_t<scan::Response<>> scan::TlsClient::co_request(Request<> t_request)
+{
+    return TcpClient::co_request(*m_ssl_streamp, std::move(t_request));
 }
 
 /**
 * @brief
-*     Send an HTTPS request and return the server's response.
+*     Callback handler for new client sessions negotiated by OpenSSL, which may
+*     be received after the handshake completes. Resumable sessions are cached
+*     by the session cache key of the owning client. Locks the underlying TLS
+*     session cache mutex. Returns 1 when the session reference is retained.
 */
-scan::Response<> scan::TlsClient::request(const string& t_host, const string& t_uri)
+int scan::TlsClient::on_new_session(SSL* t_sslp, SSL_SESSION* t_sessionp)
 {
-    return request(verb_t::get, t_host, t_uri);
+    int retained{0};
+    const TlsClient* clientp{static_cast<TlsClient*>(SSL_get_ex_data(t_sslp, m_ssl_index))};
+
+    if (clientp != nullptr && SSL_SESSION_is_resumable(t_sessionp) == 1)
+    {
+        scoped_lock lock{m_sessions_mtx};
+
+        m_sessions[clientp->session_key()] = session_ptr_t{t_sessionp, &::SSL_SESSION_free};
+        retained = 1;
+    }
+    return retained;
 }
 
 /**
 * @brief
-*     Send an HTTPS request and return the server's response.
+*     Get the shared TLS context of the given TLS method, which is created on
+*     first use. The system certificate store is loaded and client session
+*     caching is configured when the context is created. Locks the underlying
+*     shared TLS context map mutex.
 */
-scan::Response<> scan::TlsClient::request(verb_t t_method,
-                                          const string& t_host,
-                                          const string& t_uri,
-                                          const string& t_body)
+scan::TlsClient::ssl_context_ptr_t scan::TlsClient::shared_context(ssl_method_t t_method)
 {
-    Response response;
+    scoped_lock lock{m_contexts_mtx};
+    ssl_context_ptr_t& ctxp{m_contexts[t_method]};
 
-    if (connected_check())
+    if (ctxp == nullptr)
     {
-        response = request(Request{t_method, t_host, t_uri, t_body});
+        net_error_code_t discard_ecode;
+        ctxp = std::make_shared<ssl_context_t>(t_method);
+
+        ctxp->set_default_verify_paths(discard_ecode);
+        ctxp->set_verify_mode(ssl::verify_none);
+
+        SSL_CTX* native_ctxp{ctxp->native_handle()};
+
+        // Sessions are only stored by the new session callback
+        const long cache_mode{SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE};
+
+        SSL_CTX_set_session_cache_mode(native_ctxp, cache_mode);
+        SSL_CTX_sess_set_new_cb(native_ctxp, &TlsClient::on_new_session);
     }
-    return response;
+    return ctxp;
 }
 
 /**
 * @brief
-*     Asynchronously perform TLS handshake negotiations on the underlying
-*     SSL/TLS stream. Does not wait for completion and returns immediately.
+*     Associate the OpenSSL connection of the underlying
+*     SSL/TLS stream with this client for session callbacks.
 */
-void scan::TlsClient::async_handshake()
+void scan::TlsClient::bind_callbacks()
 {
-    auto handshake_callback = boost::bind(&TlsClient::on_handshake,
-                                          this,
-                                          asio::placeholders::error);
+    SSL_set_ex_data(m_ssl_streamp->native_handle(), m_ssl_index, this);
+}
 
-    stream().expires_after(RECV_TIMEOUT);
-    m_ssl_streamp->async_handshake(ssl_stream_t::client, std::move(handshake_callback));
+/**
+* @brief
+*     Mark the underlying SSL/TLS connection as shut down. Connections are closed
+*     without exchanging close_notify alerts, and OpenSSL invalidates the session
+*     of any connection that is freed before it has been shut down, which would
+*     prevent the cached session from being resumed.
+*/
+void scan::TlsClient::mark_shutdown()
+{
+    const int shutdown_state{SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN};
+    SSL_set_shutdown(m_ssl_streamp->native_handle(), shutdown_state);
 }
 
 /**
 * @brief
-*     Callback handler for asynchronous connect operations.
+*     Completion handler for coroutine connect operations.
 */
 void scan::TlsClient::on_connect(const net_error_code_t& t_ecode, Endpoint t_ep)
 {
@@ -314,7 +417,7 @@ void scan::TlsClient::on_connect(const net_error_code_t& t_ecode, Endpoint t_ep)
 
 /**
 * @brief
-*     Callback handler for asynchronous SSL/TLS handshake operations.
+*     Completion handler for coroutine SSL/TLS handshake operations.
 */
 void scan::TlsClient::on_handshake(const net_error_code_t& t_ecode)
 {
@@ -324,28 +427,88 @@ void scan::TlsClient::on_handshake(const net_error_code_t& t_ecode)
     if (m_connected)
     {
         m_svc_info.cipher = cipher_suite();
+        parse_peer_cert();
     }
 }
 
 /**
 * @brief
-*     Callback handler for SSL/TLS peer verification operations.
+*     Record the issuer and subject of the peer certificate of the underlying
+*     SSL/TLS connection. The peer certificate is read from the connection rather
+*     than during peer verification, since resumed handshakes skip verification.
 */
-bool scan::TlsClient::on_verify(bool t_preverified, verify_context_t& t_verify_ctx)
+void scan::TlsClient::parse_peer_cert()
 {
-    if (t_preverified)
+    X509* certp{SSL_get1_peer_certificate(m_ssl_streamp->native_handle())};
+
+    if (certp != nullptr)
     {
-        X509_STORE_CTX* ctxp{t_verify_ctx.native_handle()};
+        m_svc_info.issuer = net::x509_issuer(certp);
+        m_svc_info.subject = net::x509_subject(certp);
 
-        if (ctxp != nullptr)
-        {
-            X509* certp{X509_STORE_CTX_get_current_cert(ctxp)};
+        X509_free(certp);
+    }
+}
+
+/**
+* @brief
+*     Clear the OpenSSL connection state of the underlying SSL/TLS stream, so that
+*     the stream can be reused once its TCP socket has been closed. The stream is
+*     replaced instead when it still buffers inbound or outbound TLS records, since
+*     the input buffer of the SSL/TLS stream cannot be cleared.
+*/
+void scan::TlsClient::recycle_stream()
+{
+    SSL* sslp{m_ssl_streamp->native_handle()};
+    BIO* biop{SSL_get_rbio(sslp)};
+
+    const bool buffered{SSL_pending(sslp) > 0
+                     || BIO_ctrl_pending(biop) > 0_sz
+                     || BIO_ctrl_wpending(biop) > 0_sz};
+
+    if (buffered || SSL_clear(sslp) != 1)
+    {
+        reset_stream();
+    }
+    else  // Never offer the session of the previous remote endpoint
+    {
+        SSL_set_session(sslp, nullptr);
+    }
+}
+
+/**
+* @brief
+*     Create a new SSL/TLS stream that uses the shared TLS context.
+*/
+void scan::TlsClient::reset_stream()
+{
+    m_ssl_streamp = std::make_unique<ssl_stream_t>(asio::make_strand(m_io_ctx), *m_ssl_ctxp);
+    bind_callbacks();
+}
 
-            m_svc_info.issuer = net::x509_issuer(certp);
-            m_svc_info.subject = net::x509_subject(certp);
+/**
+* @brief
+*     Offer the cached session of the remote host, if any, in the next TLS
+*     handshake on the underlying SSL/TLS stream. Locks the underlying TLS
+*     session cache mutex.
+*/
+void scan::TlsClient::resume_session()
+{
+    session_ptr_t sessionp;
+    const string key{session_key()};
+    {
+        scoped_lock lock{m_sessions_mtx};
+
+        if (m_sessions.contains(key))
+        {
+            sessionp = m_sessions.at(key);
         }
     }
-    return true;
+
+    if (sessionp != nullptr)
+    {
+        SSL_set_session(m_ssl_streamp->native_handle(), sessionp.get());
+    }
 }
 
 /**
@@ -358,6 +521,15 @@ bool scan::TlsClient::valid_handshake() const
     return algo::any_eq(handshake_state(), ::TLS_ST_BEFORE, ::TLS_ST_OK);
 }
 
+/**
+* @brief
+*     Read inbound data from the underlying SSL/TLS stream into the given buffer.
+*/
+size_t scan::TlsClient::read_some(const mutable_buffer_t& t_buffer)
+{
+    return m_ssl_streamp->read_some(t_buffer, m_ecode);
+}
+
 /**
 * @brief
 *     Get the OpenSSL handshake state from the underlying SSL/TLS stream.
@@ -392,14 +564,7 @@ const SSL_CIPHER* scan::TlsClient::cipher_ptr() const
 */
 scan::net_error_code_t scan::TlsClient::handshake()
 {
-    async_handshake();
-    async_await();
-
-    if (net::is_error(m_ecode))
-    {
-        stream().cancel();
-    }
-    return m_ecode;
+    return co_wait(co_handshake());
 }
 
 /**
@@ -418,6 +583,23 @@ std::string scan::TlsClient::cipher_suite() const
     return suite;
 }
 
+/**
+* @brief
+*     Get the TLS session cache key of the underlying SSL/TLS connection. Sessions
+*     are keyed by the remote host address and by the SNI host name when one is
+*     sent, so services on different ports of the same host share sessions.
+*/
+std::string scan::TlsClient::session_key() const
+{
+    string key{m_remote_ep.addr};
+
+    if (!m_server_name.empty())
+    {
+        key = algo::fstr("%/%", key, m_server_name);
+    }
+    return key;
+}
+
 /**
 * @brief
 *     Get a constant reference to the underlying TCP socket stream.
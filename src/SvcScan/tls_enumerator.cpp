@@ -0,0 +1,411 @@
+/*
+* @file
+*     tls_enumerator.cpp
+* @brief
+*     Source file for an SSL/TLS network service capability enumerator.
+*/
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <utility>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/ssl/stream_base.hpp>
+#include <openssl/objects.h>
+#include "includes/console/util.h"
+#include "includes/inet/net.h"
+#include "includes/inet/sockets/tls_enumerator.h"
+#include "includes/ranges/algo.h"
+#include "includes/utils/literals.h"
+
+/**
+* @brief
+*     Active handshake count map mutex.
+*/
+scan::mutex scan::TlsEnumerator::m_hosts_mtx;
+
+/**
+* @brief
+*     Active enumeration handshake counts by remote host address.
+*/
+scan::TlsEnumerator::count_map_t scan::TlsEnumerator::m_hosts;
+
+/**
+* @brief
+*     Initialize the object.
+*/
+scan::TlsEnumerator::TlsEnumerator(io_context_t& t_io_ctx, const Timeout& t_timeout)
+    : m_io_ctx{t_io_ctx}, m_strand{asio::make_strand(t_io_ctx)}
+{
+    m_timeout = t_timeout;
+}
+
+/**
+* @brief
+*     Enumerate the SSL/TLS capabilities of the given service and update its
+*     service information. Protocol versions are enumerated first, then the
+*     cipher suites of each supported version and the key exchange groups.
+*     Blocks until all handshake attempts have completed.
+*/
+void scan::TlsEnumerator::enumerate(SvcInfo& t_info)
+{
+    m_remote_ep = Endpoint{t_info.addr, t_info.port()};
+    m_results = net::resolve(m_io_ctx, m_remote_ep, m_ecode);
+
+    if (net::no_error(m_ecode))
+    {
+        task_list_t version_tasks;
+
+        for (const int version : VERSIONS)
+        {
+            version_tasks.push_back(probe_version(version));
+        }
+        run(std::move(version_tasks));
+        ranges::sort(m_versions);
+
+        // Probe cipher suites and groups of the supported versions
+        if (!m_versions.empty())
+        {
+            task_list_t tasks;
+
+            for (const int version : m_versions)
+            {
+                tasks.push_back(probe_ciphers(version));
+            }
+
+            for (const char* group : GROUPS)
+            {
+                tasks.push_back(probe_group(group, m_versions.back()));
+            }
+            run(std::move(tasks));
+        }
+
+        t_info.tls_versions.clear();
+
+        for (const int version : m_versions)
+        {
+            t_info.tls_versions.push_back(version_name(version));
+        }
+
+        // Preserve the group preference order
+        t_info.tls_groups.clear();
+
+        for (const char* group : GROUPS)
+        {
+            if (ranges::find(m_groups, group) != m_groups.end())
+            {
+                t_info.tls_groups.push_back(group);
+            }
+        }
+        t_info.tls_ciphers = std::move(m_ciphers);
+    }
+}
+
+/**
+* @brief
+*     Get a reference to the shared SSL/TLS enumeration context. The context
+*     permits every protocol version and cipher suite supported by OpenSSL,
+*     which are restricted on each connection during enumeration.
+*/
+scan::TlsEnumerator::ssl_context_t& scan::TlsEnumerator::shared_context()
+{
+    static ssl_context_t ssl_ctx = []() -> ssl_context_t
+    {
+        ssl_context_t ctx{ssl_context_t::tls_client};
+        SSL_CTX* ctxp{ctx.native_handle()};
+
+        SSL_CTX_set_security_level(ctxp, 0);
+        SSL_CTX_set_min_proto_version(ctxp, 0);
+        SSL_CTX_set_max_proto_version(ctxp, 0);
+        SSL_CTX_set_cipher_list(ctxp, CIPHER_LIST);
+        SSL_CTX_set_ciphersuites(ctxp, CIPHER_SUITES);
+
+        return ctx;
+    }();
+
+    return ssl_ctx;
+}
+
+/**
+* @brief
+*     Get the OpenSSL cipher list string of the given cipher suites.
+*/
+std::string scan::TlsEnumerator::cipher_list(const cipher_list_t& t_ciphers)
+{
+    vector<string> names;
+
+    for (const SSL_CIPHER* cipherp : t_ciphers)
+    {
+        names.push_back(SSL_CIPHER_get_name(cipherp));
+    }
+    return algo::join(names, ":");
+}
+
+/**
+* @brief
+*     Get the cipher suites that can be offered when
+*     negotiating the given SSL/TLS protocol version.
+*/
+scan::TlsEnumerator::cipher_list_t scan::TlsEnumerator::supported_ciphers(int t_version)
+{
+    cipher_list_t ciphers;
+    SSL* sslp{SSL_new(shared_context().native_handle())};
+
+    if (sslp != nullptr)
+    {
+        SSL_set_min_proto_version(sslp, t_version);
+        SSL_set_max_proto_version(sslp, t_version);
+
+        STACK_OF(SSL_CIPHER)* stackp{SSL_get1_supported_ciphers(sslp)};
+
+        if (stackp != nullptr)
+        {
+            for (int i{0}; i < sk_SSL_CIPHER_num(stackp); i++)
+            {
+                ciphers.push_back(sk_SSL_CIPHER_value(stackp, i));
+            }
+            sk_SSL_CIPHER_free(stackp);
+        }
+        SSL_free(sslp);
+    }
+    return ciphers;
+}
+
+/**
+* @brief
+*     Release a handshake slot of the underlying remote host.
+*     Locks the underlying active handshake count map mutex.
+*/
+void scan::TlsEnumerator::release_slot()
+{
+    scoped_lock lock{m_hosts_mtx};
+    size_t& count{m_hosts[m_remote_ep.addr]};
+
+    if (count <= 1_sz)
+    {
+        m_hosts.erase(m_remote_ep.addr);
+    }
+    else  // Other handshakes are still active
+    {
+        count--;
+    }
+}
+
+/**
+* @brief
+*     Spawn the given handshake coroutines on the underlying strand and block
+*     until all of the coroutines have completed. Exceptions thrown by the
+*     coroutines are written to the standard error stream.
+*/
+void scan::TlsEnumerator::run(task_list_t&& t_tasks)
+{
+    if (!t_tasks.empty())
+    {
+        promise<void> tasks_promise;
+        future<void> tasks_future{tasks_promise.get_future()};
+
+        atomic<size_t> pending{t_tasks.size()};
+
+        auto on_complete = [&](std::exception_ptr l_exp) -> void
+        {
+            util::except(l_exp);
+
+            if (pending.fetch_sub(1_sz) == 1_sz)
+            {
+                tasks_promise.set_value();
+            }
+        };
+
+        for (awaitable_t<>& task : t_tasks)
+        {
+            asio::co_spawn(m_strand, std::move(task), on_complete);
+        }
+        tasks_future.wait();
+    }
+}
+
+/**
+* @brief
+*     Acquire a handshake slot of the underlying remote host if fewer than the
+*     maximum number of handshakes to the host are active. Locks the underlying
+*     active handshake count map mutex.
+*/
+bool scan::TlsEnumerator::acquire_slot()
+{
+    scoped_lock lock{m_hosts_mtx};
+    size_t& count{m_hosts[m_remote_ep.addr]};
+
+    const bool acquired{count < TLS_ENUM_HANDSHAKES};
+
+    if (acquired)
+    {
+        count++;
+    }
+    return acquired;
+}
+
+/**
+* @brief
+*     Wait until a handshake slot of the underlying remote host is acquired.
+*     Slot availability is polled, so waiting never blocks the I/O context.
+*/
+scan::awaitable_t<> scan::TlsEnumerator::await_slot()
+{
+    steady_timer_t timer{co_await asio::this_coro::executor};
+
+    while (!acquire_slot())
+    {
+        net_error_code_t ecode;
+
+        timer.expires_after(TLS_ENUM_POLL_INTERVAL);
+        co_await timer.async_wait(asio::redirect_error(asio::use_awaitable, ecode));
+    }
+}
+
+/**
+* @brief
+*     Enumerate the cipher suites supported for the given SSL/TLS protocol version.
+*     Each accepted cipher suite is removed from the offered list until the service
+*     rejects the handshake, so the suites are recorded in order of preference.
+*/
+scan::awaitable_t<> scan::TlsEnumerator::probe_ciphers(int t_version)
+{
+    cipher_list_t ciphers{supported_ciphers(t_version)};
+    bool accepted{!ciphers.empty()};
+
+    while (accepted)
+    {
+        Handshake attempt{t_version};
+        attempt.ciphers = cipher_list(ciphers);
+
+        attempt = co_await handshake(std::move(attempt));
+
+        auto iter = ranges::find_if(ciphers, [&](const SSL_CIPHER* l_cipherp) -> bool
+        {
+            return SSL_CIPHER_get_id(l_cipherp) == attempt.cipher;
+        });
+        accepted = attempt.accepted && iter != ciphers.end();
+
+        // Remove the accepted cipher suite from the offered list
+        if (accepted)
+        {
+            m_ciphers[version_name(t_version)].push_back(attempt.suite);
+            ciphers.erase(iter);
+
+            accepted = !ciphers.empty();
+        }
+    }
+}
+
+/**
+* @brief
+*     Determine whether the given key exchange group is
+*     supported for the given SSL/TLS protocol version.
+*/
+scan::awaitable_t<> scan::TlsEnumerator::probe_group(string t_group, int t_version)
+{
+    Handshake attempt{t_version};
+    attempt.groups = t_group;
+
+    attempt = co_await handshake(std::move(attempt));
+
+    // Only the offered group can be negotiated
+    if (attempt.accepted && attempt.group != NID_undef)
+    {
+        m_groups.push_back(t_group);
+    }
+}
+
+/**
+* @brief
+*     Determine whether the given SSL/TLS protocol version is supported.
+*/
+scan::awaitable_t<> scan::TlsEnumerator::probe_version(int t_version)
+{
+    const Handshake attempt{co_await handshake(Handshake{t_version})};
+
+    if (attempt.accepted)
+    {
+        m_versions.push_back(t_version);
+    }
+}
+
+/**
+* @brief
+*     Perform an SSL/TLS handshake with the underlying remote host using the
+*     parameters of the given handshake attempt, and return the attempt results.
+*     The connection is closed as soon as the handshake completes, and the
+*     acquired handshake slot is released even if the attempt throws.
+*/
+scan::awaitable_t<scan::TlsEnumerator::Handshake>
+scan::TlsEnumerator::handshake(Handshake t_handshake)
+{
+    co_await await_slot();
+    const SlotGuard slot_guard{*this};
+
+    net_error_code_t ecode;
+    ssl_stream_t ssl_stream{co_await asio::this_coro::executor, shared_context()};
+
+    SSL* sslp{ssl_stream.native_handle()};
+    stream_t& stream{ssl_stream.next_layer()};
+
+    bool configured{SSL_set_min_proto_version(sslp, t_handshake.version) == 1
+                 && SSL_set_max_proto_version(sslp, t_handshake.version) == 1};
+
+    // Restrict the offered cipher suites
+    if (configured && !t_handshake.ciphers.empty())
+    {
+        if (t_handshake.version == TLS1_3_VERSION)
+        {
+            configured = SSL_set_ciphersuites(sslp, t_handshake.ciphers.c_str()) == 1;
+        }
+        else  // Cipher suites of earlier versions
+        {
+            configured = SSL_set_cipher_list(sslp, t_handshake.ciphers.c_str()) == 1;
+        }
+    }
+
+    // Restrict the offered key exchange groups
+    if (configured && !t_handshake.groups.empty())
+    {
+        configured = SSL_set1_groups_list(sslp, t_handshake.groups.c_str()) == 1;
+    }
+
+    if (configured)
+    {
+        stream.expires_after(static_cast<milliseconds>(m_timeout));
+        co_await stream.async_connect(m_results,
+                                      asio::redirect_error(asio::use_awaitable, ecode));
+
+        // Perform TLS handshake negotiations
+        if (net::no_error(ecode))
+        {
+            stream.expires_after(RECV_TIMEOUT);
+
+            co_await ssl_stream.async_handshake(ssl_stream_t::client,
+                                                asio::redirect_error(asio::use_awaitable,
+                                                                     ecode));
+
+            t_handshake.accepted = net::no_error(ecode);
+        }
+    }
+
+    // Record the negotiated parameters
+    if (t_handshake.accepted)
+    {
+        const SSL_CIPHER* cipherp{SSL_get_current_cipher(sslp)};
+
+        if (cipherp != nullptr)
+        {
+            t_handshake.cipher = static_cast<uint_t>(SSL_CIPHER_get_id(cipherp));
+            t_handshake.suite = SSL_CIPHER_standard_name(cipherp);
+        }
+        t_handshake.group = static_cast<int>(SSL_get_negotiated_group(sslp));
+    }
+
+    stream.close();
+
+    co_return t_handshake;
+}
@@ -4,22 +4,28 @@
 * @brief
 *     Source file for an IPv4 network scanner with SSL/TLS capabilities.
 */
+#include <atomic>
+#include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <boost/asio/io_context.hpp>
-#include "includes/errors/arg_ex.h"
-#include "includes/errors/runtime_ex.h"
+#include "includes/errors/null_ptr_ex.h"
 #include "includes/inet/scanners/tls_scanner.h"
-#include "includes/threading/task_status.h"
-#include "includes/threading/thread_pool.h"
+#include "includes/ranges/algo.h"
+#include "includes/utils/literals.h"
 
 /**
 * @brief
 *     Initialize the object.
 */
 scan::TlsScanner::TlsScanner(TlsScanner&& t_scanner) noexcept
-    : TcpScanner{t_scanner.m_io_ctx, t_scanner.m_args_ap.load()}
+    : TcpScanner{t_scanner.m_io_ctx, t_scanner.m_args_ap.load()},
+      m_tls_clients{t_scanner.m_io_ctx,
+                    t_scanner.m_args_ap.load(),
+                    max_probes(*t_scanner.m_args_ap.load())}
 {
+    m_resumed_count = m_session_count = 0_sz;
     *this = std::move(t_scanner);
 }
 
@@ -28,74 +34,159 @@ scan::TlsScanner::TlsScanner(TlsScanner&& t_scanner) noexcept
 *     Initialize the object.
 */
 scan::TlsScanner::TlsScanner(io_context_t& t_io_ctx, shared_ptr<Args> t_argsp)
-    : TcpScanner{t_io_ctx, t_argsp}
+    : TcpScanner{t_io_ctx, t_argsp},
+      m_tls_clients{t_io_ctx, t_argsp, max_probes(*t_argsp)}
 {
+    m_resumed_count = m_session_count = 0_sz;
+    parse_server_names();
 }
 
 /**
 * @brief
-*     Create a new port scan task and submit it to
-*     the underlying thread pool for execution.
+*     Move assignment operator overload.
 */
-void scan::TlsScanner::post_port_scan(port_t t_port)
+scan::TlsScanner& scan::TlsScanner::operator=(TlsScanner&& t_scanner) noexcept
 {
-    if (!net::valid_port(t_port))
+    if (this != &t_scanner)
     {
-        throw ArgEx{INVALID_PORTS_MSG, "t_port"};
+        m_resumed_count = t_scanner.m_resumed_count.load();
+        m_server_names = std::move(t_scanner.m_server_names);
+        m_session_count = t_scanner.m_session_count.load();
+
+        TcpScanner::operator=(std::move(t_scanner));
     }
+    return *this;
+}
 
-    if (!target.valid())
+/**
+* @brief
+*     Map the addresses of the underlying targets to the host names that were
+*     given for them, which are sent as SNI host names in TLS handshakes.
+*/
+void scan::TlsScanner::parse_server_names()
+{
+    for (const Hostname& target : targets)
     {
-        throw RuntimeEx{INVALID_TARGET_MSG, "TlsScanner::post_port_scan"};
+        if (target.valid() && !net::valid_ipv4_fmt(target.name()))
+        {
+            m_server_names.try_emplace(target.addr(), target.name());
+        }
     }
+}
 
-    // Post a new scan task to the thread pool
-    m_pool.post([this, t_port]() mutable -> void
+/**
+* @brief
+*     Probe the service of the given connected client and record the results. When
+*     the service sends no banner, the existing connection is upgraded to SSL/TLS,
+*     and the remote host is only reconnected if the TLS handshake is rejected.
+*/
+void scan::TlsScanner::probe_client(client_ptr_t& t_clientp)
+{
+    if (t_clientp == nullptr)
     {
-        print_progress();
-        set_status(t_port, TaskStatus::executing);
+        throw NullPtrEx{"t_clientp"};
+    }
+    bool tls_connected{false};
+
+    const Endpoint remote_ep{t_clientp->svcinfo().addr, t_clientp->svcinfo().port()};
 
-        io_context_t io_ctx;
-        tls_client_ptr_t tls_clientp;
+    const string_view banner{recv_banner(t_clientp)};
+    const bool silent{banner.empty() && t_clientp->host_state() == HostState::open};
+
+    // Send the TLS client hello on the existing connection
+    if (silent && t_clientp->is_connected())
+    {
+        tls_client_ptr_t tls_clientp{m_tls_clients.acquire()};
 
-        client_ptr_t clientp{std::make_unique<TcpClient>(io_ctx, m_args_ap, m_rc_ap)};
-        clientp->connect(t_port);
+        tls_clientp->server_name(server_name(remote_ep.addr));
+        tls_clientp->upgrade(*t_clientp);
+        tls_connected = tls_clientp->is_connected();
 
-        if (clientp->is_connected())
+        // SSL/TLS connection established
+        if (tls_connected)
         {
-            bool success{process_data(clientp)};
-            tls_clientp = std::make_unique<TlsClient>(io_ctx, m_args_ap, m_rc_ap);
+            m_session_count.fetch_add(1_sz, std::memory_order_relaxed);
 
-            // Try to establish SSL/TLS connection
-            if (!success)
+            if (tls_clientp->session_resumed())
             {
-                tls_clientp->svcinfo() = clientp->svcinfo();
-
-                clientp->disconnect();
-                tls_clientp->connect(t_port);
+                m_resumed_count.fetch_add(1_sz, std::memory_order_relaxed);
+            }
 
-                // SSL/TLS connection established
-                if (tls_clientp->is_connected())
-                {
-                    process_data(tls_clientp);
-                    tls_clientp->disconnect();
-                }
+            process_data(tls_clientp);
+            tls_clientp->disconnect();
 
-                add_service(tls_clientp->svcinfo());
-                tls_clientp->close();
-            }
-            else  // No SSL/TLS connection necessary
+            // Enumerate the SSL/TLS capabilities
+            if (m_args_ap.load()->tls_enum)
             {
-                add_service(clientp->svcinfo());
-                clientp->disconnect();
+                enumerate_tls(tls_clientp->svcinfo());
             }
+            complete_task(std::move(tls_clientp->svcinfo()));
         }
-        else  // Failed to establish connection
+        tls_clientp->close();
+
+        m_tls_clients.release(std::move(tls_clientp));
+    }
+
+    // Probe the plaintext service information
+    if (!tls_connected)
+    {
+        // Handshake rejected by plaintext service
+        if (silent && !t_clientp->is_connected())
         {
-            add_service(clientp->svcinfo());
+            t_clientp->connect(remote_ep);
         }
 
-        set_status(t_port, TaskStatus::complete);
-        clientp->close();
-    });
+        if (t_clientp->is_connected())
+        {
+            process_data(t_clientp, banner);
+            t_clientp->disconnect();
+        }
+        else  // Reconnection failed, port is still known to be open
+        {
+            net::update_svc(t_clientp->svcinfo(), HostState::open);
+        }
+        complete_task(std::move(t_clientp->svcinfo()));
+    }
+    t_clientp->close();
+
+    m_clients.release(std::move(t_clientp));
+}
+
+/**
+* @brief
+*     Enumerate the SSL/TLS protocol versions, cipher suites and key exchange
+*     groups supported by the given service and update its service information.
+*/
+void scan::TlsScanner::enumerate_tls(SvcInfo& t_info)
+{
+    TlsEnumerator enumerator{m_io_ctx, connect_timeout(t_info.addr)};
+    enumerator.enumerate(t_info);
+}
+
+/**
+* @brief
+*     Get the SNI host name of the target with the given address.
+*     Returns an empty string when the target was given by address.
+*/
+std::string scan::TlsScanner::server_name(const string& t_addr) const
+{
+    string name;
+
+    if (m_server_names.contains(t_addr))
+    {
+        name = m_server_names.at(t_addr);
+    }
+    return name;
+}
+
+/**
+* @brief
+*     Get a summary of the SSL/TLS sessions established by the scan,
+*     including the number of sessions resumed from the session cache.
+*/
+std::string scan::TlsScanner::session_summary() const
+{
+    return algo::fstr("% established (% resumed)",
+                      m_session_count.load(std::memory_order_relaxed),
+                      m_resumed_count.load(std::memory_order_relaxed));
 }
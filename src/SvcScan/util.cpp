@@ -10,6 +10,7 @@
 
 #include <cerrno>
 #include <cstdlib>
+#include <exception>
 #include <conio.h>
 #include <windows.h>
 #include <consoleapi.h>
@@ -47,6 +48,30 @@ void scan::util::console_title(const string& t_title)
     std::cout << algo::fstr("\x1b]0;%\x07", t_title);
 }
 
+/**
+* @brief
+*     Write the details of the exception referenced by the given exception pointer
+*     to the standard error stream, if any. Locks the standard error stream mutex.
+*/
+void scan::util::except(std::exception_ptr t_exp)
+{
+    if (t_exp != nullptr)
+    {
+        try
+        {
+            std::rethrow_exception(t_exp);
+        }
+        catch (const Exception& ex)
+        {
+            except(ex);
+        }
+        catch (const std::exception& ex)
+        {
+            errorf("%", ex.what());
+        }
+    }
+}
+
 /**
 * @brief
 *     Customize the console title and enable virtual terminal processing.
@@ -0,0 +1,124 @@
+<#
+.SYNOPSIS
+    SvcScan port service database header generator script.
+.DESCRIPTION
+    SvcScan port service database header generator script used to convert
+    the port service CSV file into a compile-time constant C++ header file.
+.PARAMETER Force
+    Regenerate the header file even if it is newer than the CSV file.
+.LINK
+    Application repository: https://github.com/vandavey/SvcScan
+#>
+[CmdletBinding()]
+param (
+    [switch] $Force
+)
+
+$DefaultErrorPreference = $ErrorActionPreference
+$DefaultProgressPreference = $ProgressPreference
+
+# Reset the global preference variables.
+function Reset-Preferences {
+    $ErrorActionPreference = $DefaultErrorPreference
+    $ProgressPreference = $DefaultProgressPreference
+}
+
+# Write an error message to stderr and exit.
+function Show-Error {
+    $Symbol = "[x]"
+    Reset-Preferences
+
+    if ($PSVersionTable.PSVersion.Major -ge 6) {
+        $Symbol = "`e[91m${Symbol}`e[0m"
+    }
+    [Console]::Error.WriteLine("${Symbol} ${args}`n")
+    exit 1
+}
+
+# Write a status message to stdout.
+function Show-Status {
+    $Symbol = "[*]"
+
+    if ($PSVersionTable.PSVersion.Major -ge 6) {
+        $Symbol = "`e[96m${Symbol}`e[0m"
+    }
+    Write-Output "${Symbol} ${args}"
+}
+
+# Escape the given value as a C++ string literal.
+function ConvertTo-Literal {
+    param ([string] $Value)
+    return "`"$($Value.Replace("\", "\\").Replace("`"", "\`""))`""
+}
+
+$ErrorActionPreference = "Stop"
+$ProgressPreference = "SilentlyContinue"
+
+$RootDir = Resolve-Path "${PSScriptRoot}\.."
+$AppDir = "${RootDir}\src\SvcScan"
+
+$CsvFile = "${AppDir}\data\ports.csv"
+$HeaderFile = "${AppDir}\includes\resources\port_db.h"
+
+# Invalid CSV file path
+if (-not (Test-Path $CsvFile)) {
+    Show-Error "CSV file not found: '${CsvFile}'"
+}
+
+# Header file is up to date
+if (-not $Force -and (Test-Path $HeaderFile)) {
+    if ((Get-Item $HeaderFile).LastWriteTime -ge (Get-Item $CsvFile).LastWriteTime) {
+        Reset-Preferences
+        exit 0
+    }
+}
+
+Show-Status "Generating port service database header..."
+
+# Only services with known details are included
+$Records = Import-Csv $CsvFile | Where-Object {
+    $_.svc -ne "unknown" -or $_.info -ne ""
+} | Sort-Object { [int]$_.port }
+
+$Lines = [Collections.Generic.List[string]]::new()
+
+$Lines.Add("/*")
+$Lines.Add("* @file")
+$Lines.Add("*     port_db.h")
+$Lines.Add("* @brief")
+$Lines.Add("*     Header file for the embedded port service database. Generated")
+$Lines.Add("*     from 'data/ports.csv' by 'tools/svcscan-gendb.ps1', do not edit.")
+$Lines.Add("*/")
+$Lines.Add("#pragma once")
+$Lines.Add("")
+$Lines.Add("#ifndef SCAN_PORT_DB_H")
+$Lines.Add("#define SCAN_PORT_DB_H")
+$Lines.Add("")
+$Lines.Add("#include `"../inet/services/port_record.h`"")
+$Lines.Add("#include `"../utils/aliases.h`"")
+$Lines.Add("")
+$Lines.Add("namespace scan")
+$Lines.Add("{")
+$Lines.Add("    /// @brief  Known port service database records (sorted by port number).")
+$Lines.Add("    constexpr array<PortRecord, $($Records.Count)> PORT_DB")
+$Lines.Add("    {")
+
+foreach ($Record in $Records) {
+    $Fields = @(
+        $Record.port,
+        (ConvertTo-Literal $Record.proto),
+        (ConvertTo-Literal $Record.svc),
+        (ConvertTo-Literal $Record.info)
+    )
+    $Lines.Add("        PortRecord{$($Fields -join ", ")},")
+}
+
+$Lines.Add("    };")
+$Lines.Add("}")
+$Lines.Add("")
+$Lines.Add("#endif // !SCAN_PORT_DB_H")
+
+[IO.File]::WriteAllText($HeaderFile, ($Lines -join "`n") + "`n")
+
+Reset-Preferences
+Show-Status "Successfully generated '${HeaderFile}'"